@@ -33,6 +33,7 @@
 #else
 #include "videoreader_avifile.hh"
 #endif
+#include "videoreader_y4m.hh"
 
 static char * filename = 0;
 static char * outputfilename = "output.swf";
@@ -42,6 +43,7 @@ static int quality = 80;
 static double scale = 1.0;
 static int flip = 0;
 static int expensive = 0;
+static char* motionsearch = 0;
 static int flashversion = 6;
 static int keyframe_interval = -1;
 static int skip = 0;
@@ -50,6 +52,10 @@ static int mp3_bitrate = 32;
 static int samplerate = 11025;
 static int numframes = 0;
 static char* skipframes = 0;
+static int threads = 1;
+static int raw_width = 0;
+static int raw_height = 0;
+static double raw_fps = 25.0;
 
 static struct options_t options[] = {
 {"h", "help"},
@@ -64,7 +70,11 @@ static struct options_t options[] = {
 {"q", "quality"},
 {"k", "keyframe"},
 {"x", "extragood"},
+{"M", "motion"},
 {"T", "flashversion"},
+{"t", "threads"},
+{"R", "raw"},
+{"F", "fps"},
 {"V", "version"},
 {0,0}
 };
@@ -119,6 +129,14 @@ int args_callback_option(char*name,char*val)
 	expensive = 1;
 	return 0;
     }
+    else if(!strcmp(name, "M")) {
+	if(strcmp(val, "fast") && strcmp(val, "full")) {
+	    fprintf(stderr, "Motion search must be either \"fast\" or \"full\"\n");
+	    exit(1);
+	}
+	motionsearch = val;
+	return 1;
+    }
     else if(!strcmp(name, "m")) {
 	mp3_bitrate = atoi(val);
 	return 1;
@@ -133,7 +151,7 @@ int args_callback_option(char*name,char*val)
             samplerate = 44100;
         else {
             fprintf(stderr, "Invalid samplerate: %d\n", samplerate);
-            fprintf(stderr, "Allowed values: 11025, 22050, 44100\n", samplerate);
+            fprintf(stderr, "Allowed values: 11025, 22050, 44100\n");
             exit(1);
         }
         return 1;
@@ -146,6 +164,23 @@ int args_callback_option(char*name,char*val)
 	skipframes = strdup(val);
 	return 1;
     }
+    else if(!strcmp(name, "t")) {
+	threads = atoi(val);
+	if(threads<1)
+	    threads = 1;
+	return 1;
+    }
+    else if(!strcmp(name, "R")) {
+	if(sscanf(val, "%dx%d", &raw_width, &raw_height)!=2 || raw_width<=0 || raw_height<=0) {
+	    fprintf(stderr, "Raw frame size must be given as <width>x<height>\n");
+	    exit(1);
+	}
+	return 1;
+    }
+    else if(!strcmp(name, "F")) {
+	raw_fps = atof(val);
+	return 1;
+    }
     else if(!strcmp(name, "s")) {
 	scale = atoi(val)/100.0;
 	if(scale>1.0 || scale<=0) {
@@ -172,13 +207,17 @@ void args_callback_usage(char *name)
     printf("-n , --num frames              Number of frames to encode\n");
     printf("-m , --mp3-bitrate <kbps>      Set the mp3 bitrate to encode audio with\n");
     printf("-r , --mp3-samplerate <hz>     Set the mp3 samplerate to encode audio with (default: 11025)\n");
-    printf("-s , --scale <val>             Scale down to factor <val>. (in %, e.g. 100 = original size)\n");
+    printf("-s , --scale <val>             Scale down to factor <val>. (in %%, e.g. 100 = original size)\n");
     printf("-S , --skipframes <num>        Skip <num> frames before starting the conversion.\n");
     printf("-p , --flip                    Turn movie upside down\n");
     printf("-q , --quality <val>           Set the quality to <val>. (0-100, 0=worst, 100=best, default:80)\n");
     printf("-k , --keyframe                Set the number of intermediate frames between keyframes.\n");
     printf("-x , --extragood               Enable some *very* expensive compression strategies.\n");
+    printf("-M , --motion <fast|full>      Enable motion compensation, using a fast or an exhaustive search.\n");
     printf("-T , --flashversion <n>        Set output flash version to <n>.\n");
+    printf("-t , --threads <n>             Encode <n> groups of frames in parallel (flash version 6 and up).\n");
+    printf("-R , --raw <width>x<height>    Input is raw rgb24 frames of the given size.\n");
+    printf("-F , --fps <fps>               Framerate of raw input (default: 25)\n");
     printf("-V , --version                 Print program version and exit\n");
     printf("\n");
 }
@@ -254,11 +293,18 @@ int main (int argc,char ** argv)
 	exit(1);
     }
     
+    int l = strlen(filename);
+    if(raw_width) {
+	ret = videoreader_raw_open(&video, filename, raw_width, raw_height, raw_fps);
+    } else if(!strcmp(filename, "-") || (l>4 && !strcasecmp(&filename[l-4], ".y4m"))) {
+	ret = videoreader_y4m_open(&video, filename);
+    } else {
 #ifdef WIN32
-    ret = videoreader_vfw_open(&video, filename);
+	ret = videoreader_vfw_open(&video, filename);
 #else
-    ret = videoreader_avifile_open(&video, filename);
+	ret = videoreader_avifile_open(&video, filename);
 #endif
+    }
 
     if(ret<0) {
 	fprintf(stderr, "Error opening %s\n", filename);
@@ -288,10 +334,13 @@ int main (int argc,char ** argv)
     v2swf_setparameter(&v2swf, "prescale", "1");
     v2swf_setparameter(&v2swf, "flash_version", itoa(flashversion));
     v2swf_setparameter(&v2swf, "keyframe_interval", itoa(keyframe_interval));
+    v2swf_setparameter(&v2swf, "threads", itoa(threads));
     if(skipframes)
 	v2swf_setparameter(&v2swf, "skipframes", skipframes);
     if(expensive)
 	v2swf_setparameter(&v2swf, "motioncompensation", "1");
+    if(motionsearch)
+	v2swf_setparameter(&v2swf, "motionsearch", motionsearch);
     if(flip)
 	video.setparameter(&video, "flip", "1");
     if(verbose)
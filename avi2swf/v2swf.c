@@ -20,9 +20,25 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include "../config.h"
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
 #include "v2swf.h"
 #include "../lib/rfxswf.h"
 #include "../lib/q.h"
+#include "../lib/h.263/blockdiff.h"
+
+/* a video frame which still needs to be encoded (in parallel mode) */
+typedef struct _gopframe
+{
+    RGBA*pic;
+    int iframe;
+    int quant;
+    int frame;
+    TAG*tag; // placeholder VIDEOFRAME tag, in the pending tag list
+    struct _gopframe*next;
+} gopframe_t;
 
 typedef struct _v2swf_internal_t
 {
@@ -77,6 +93,7 @@ typedef struct _v2swf_internal_t
     int samplewritepos;
     double soundframepos;
     int soundstreamhead;
+    SOUNDENCODER*soundenc;
     int seek;
 
     int numframes;
@@ -90,6 +107,7 @@ typedef struct _v2swf_internal_t
     int add_cut;
     
     int domotion;
+    int fastmotion;
 
     int head_done;
 
@@ -97,6 +115,18 @@ typedef struct _v2swf_internal_t
 
     VIDEOSTREAM stream;
 
+    /* parallel encoding: groups of pictures (an I-frame plus the
+       following P-frames) are independent and can be encoded on
+       separate threads. Frames are queued until enough GOPs have been
+       collected, all other tags are held back until then. */
+    int threads;
+    int vframe; // number of video frames queued so far
+    int numgops; // number of (started) GOPs in the queue
+    gopframe_t*gop_first;
+    gopframe_t*gop_last;
+    TAG*pending_first;
+    TAG*pending_last;
+
 } v2swf_internal_t;
 
 static int verbose = 0;
@@ -129,10 +159,141 @@ static void msg(char*format, ...)
     fflush(stdout);
 }
 
-extern int swf_mp3_in_samplerate;
-extern int swf_mp3_out_samplerate;
-extern int swf_mp3_channels;
-extern int swf_mp3_bitrate;
+static void writeTag(v2swf_internal_t*i)
+{
+    if(i->gop_first) {
+	/* there are video frames which haven't been encoded yet-
+	   keep the tag until they are */
+	TAG*t = swf_InsertTag(i->pending_last, i->tag->id);
+	swf_SetBlock(t, i->tag->data, i->tag->len);
+	if(!i->pending_first)
+	    i->pending_first = t;
+	i->pending_last = t;
+    } else {
+	i->filesize += swf_WriteTag2(&i->out, i->tag);
+    }
+}
+
+typedef struct _gopjob
+{
+    v2swf_internal_t*i;
+    gopframe_t*first;
+    gopframe_t*end; // first frame of the next GOP
+} gopjob_t;
+
+static void* encodegop(void*data)
+{
+    gopjob_t*job = (gopjob_t*)data;
+    v2swf_internal_t*i = job->i;
+    VIDEOSTREAM stream;
+    TAG*tmp = swf_InsertTag(0, ST_DEFINEVIDEOSTREAM);
+    swf_SetVideoStreamDefine(tmp, &stream, 65535, i->width, i->height);
+    swf_DeleteTag(0, tmp);
+    stream.do_motion = i->stream.do_motion;
+    stream.fast_motion = i->stream.fast_motion;
+    stream.frame = job->first->frame;
+
+    gopframe_t*f;
+    for(f=job->first;f!=job->end;f=f->next) {
+	swf_SetU16(f->tag, 99);
+	if(f->iframe) {
+	    swf_SetVideoStreamIFrame(f->tag, &stream, f->pic, f->quant);
+	} else {
+	    swf_SetVideoStreamPFrame(f->tag, &stream, f->pic, f->quant);
+	}
+    }
+    swf_VideoStreamClear(&stream);
+    return 0;
+}
+
+/* encode all queued frames, and write out the tags we held back */
+static void flushgops(v2swf_internal_t*i)
+{
+    if(!i->gop_first)
+	return;
+    msg("encoding %d GOPs\n", i->numgops);
+
+    gopjob_t*jobs = (gopjob_t*)malloc(sizeof(gopjob_t)*i->numgops);
+    int num = 0;
+    gopframe_t*f;
+    for(f=i->gop_first;f;f=f->next) {
+	if(f->iframe || !num) {
+	    if(num)
+		jobs[num-1].end = f;
+	    jobs[num].i = i;
+	    jobs[num].first = f;
+	    jobs[num].end = 0;
+	    num++;
+	}
+    }
+
+    int t;
+#ifdef HAVE_PTHREADS
+    pthread_t*threads = (pthread_t*)malloc(sizeof(pthread_t)*num);
+    for(t=1;t<num;t++) {
+	if(pthread_create(&threads[t], 0, encodegop, &jobs[t])) {
+	    /* couldn't spawn thread- do it ourselves */
+	    encodegop(&jobs[t]);
+	    threads[t] = 0;
+	}
+    }
+    encodegop(&jobs[0]);
+    for(t=1;t<num;t++) {
+	if(threads[t])
+	    pthread_join(threads[t], 0);
+    }
+    free(threads);
+#else
+    for(t=0;t<num;t++)
+	encodegop(&jobs[t]);
+#endif
+    free(jobs);
+
+    while(i->gop_first) {
+	f = i->gop_first;
+	i->gop_first = f->next;
+	free(f->pic);
+	free(f);
+    }
+    i->gop_last = 0;
+    i->numgops = 0;
+
+    TAG*tag = i->pending_first;
+    while(tag) {
+	TAG*next = tag->next;
+	i->filesize += swf_WriteTag2(&i->out, tag);
+	swf_DeleteTag(0, tag);
+	tag = next;
+    }
+    i->pending_first = i->pending_last = 0;
+}
+
+static void queueframe(v2swf_internal_t*i, int iframe, int quant)
+{
+    if(iframe) {
+	if(i->numgops >= i->threads)
+	    flushgops(i);
+	i->numgops++;
+    }
+    gopframe_t*f = (gopframe_t*)malloc(sizeof(gopframe_t));
+    memset(f, 0, sizeof(gopframe_t));
+    f->pic = (RGBA*)malloc(i->width*i->height*4);
+    memcpy(f->pic, i->buffer, i->width*i->height*4);
+    f->iframe = iframe;
+    f->quant = quant;
+    f->frame = i->vframe++;
+    if(i->gop_last)
+	i->gop_last->next = f;
+    else
+	i->gop_first = f;
+    i->gop_last = f;
+
+    /* placeholder, filled in by encodegop() */
+    swf_ResetTag(i->tag, ST_VIDEOFRAME);
+    writeTag(i);
+    f->tag = i->pending_last;
+}
+
 
 
 static void writeShape(v2swf_internal_t*i, int id, int gfxid, int width, int height)
@@ -171,15 +332,15 @@ static void writeShape(v2swf_internal_t*i, int id, int gfxid, int width, int hei
     swf_ShapeSetLine(i->tag,shape,-width*20,0);
     swf_ShapeSetLine(i->tag,shape,0,-height*20);
     swf_ShapeSetEnd(i->tag);
-    i->filesize += swf_WriteTag2(&i->out, i->tag);
+    writeTag(i);
     swf_ShapeFree(shape);
 }
 
 /* returns 0 on partial read */
-static int getSamples(videoreader_t*video, S16*data, int len, double speedup)
+static int getSamples(videoreader_t*video, S16*data, int len, int samplerate, double speedup)
 {
     double pos = 0;
-    double ratio = (double) video->samplerate * speedup / swf_mp3_in_samplerate;
+    double ratio = (double) video->samplerate * speedup / samplerate;
     int rlen = (int)(len * ratio);
     int t;
     S16 tmp[576*32];
@@ -204,7 +365,7 @@ static int getSamples(videoreader_t*video, S16*data, int len, double speedup)
 	tmp[t] = a/video->channels;
     }
 
-    /* down/up-sample to the desired input samplerate (swf_mp3_in_samplerate) */
+    /* down/up-sample to the desired input samplerate */
     for(t=0;t<len;t++) {
 	data[t] = tmp[(int)pos];
 	pos+=ratio;
@@ -244,21 +405,17 @@ static void writeAudioForOneFrame(v2swf_internal_t* i)
     msg("samplesperblock: %f", samplesperblock);
 
     if(!i->soundstreamhead) {
-	swf_mp3_out_samplerate = i->samplerate;
-	/* The pre-processing of sound samples in getSamples(..) above
-	   re-samples the sound to swf_mp3_in_samplerate. It is best to
+	/* first run - initialize.
+	   The pre-processing of sound samples in getSamples(..) above
+	   re-samples the sound to the encoder's input samplerate. It is best to
 	   simply make it the original samplerate:  */
-	swf_mp3_in_samplerate = i->video->samplerate;
-
-	/* first run - initialize */
-	swf_mp3_channels = 1;//i->video->channels;
-	swf_mp3_bitrate = i->bitrate;
+	i->soundenc = swf_SoundEncoderNew(i->video->samplerate, i->samplerate, i->bitrate);
 	swf_ResetTag(i->tag, ST_SOUNDSTREAMHEAD);
 	/* samplesperframe overrides the movie framerate: */
 	msg("swf_SetSoundStreamHead(): %08x %d", i->tag, samplesperframe);
-	swf_SetSoundStreamHead(i->tag, samplesperframe);
+	swf_SetSoundStreamHead2(i->tag, i->soundenc, samplesperframe);
 	msg("swf_SetSoundStreamHead() done");
-	i->filesize += swf_WriteTag2(&i->out, i->tag);
+	writeTag(i);
 	i->soundstreamhead = 1;
     }
 
@@ -286,19 +443,19 @@ static void writeAudioForOneFrame(v2swf_internal_t* i)
 
     /* write num frames, max 1 block */
     for(pos=0;pos<num;pos++) {
-        if(!getSamples(i->video, block1, blocksize * (double)swf_mp3_in_samplerate/swf_mp3_out_samplerate, speedup)) {
+        if(!getSamples(i->video, block1, i->soundenc->blocksize, i->soundenc->in_samplerate, speedup)) {
 	    i->audio_eof = 1; i->video->samplerate = i->video->channels = 0; //end of soundtrack
 	    /* fall through, this probably was a partial read. (We did, after all,
 	       come to this point, so i->audio_eof must have been false so far) */
 	}
 	if(!pos) {
 	    swf_ResetTag(i->tag, ST_SOUNDSTREAMBLOCK);
-	    swf_SetSoundStreamBlock(i->tag, block1, seek, num);
+	    swf_SetSoundStreamBlock2(i->tag, i->soundenc, block1, seek, num);
 	} else {
-	    swf_SetSoundStreamBlock(i->tag, block1, seek, 0);
+	    swf_SetSoundStreamBlock2(i->tag, i->soundenc, block1, seek, 0);
 	}
     }
-    i->filesize += swf_WriteTag2(&i->out, i->tag);
+    writeTag(i);
 
     i->seek = blocksize - (i->samplewritepos - i->samplepos);
     i->samplepos += samplesperframe;
@@ -310,7 +467,7 @@ static void writeShowFrame(v2swf_internal_t* i)
 	writeAudioForOneFrame(i);
 	
 	swf_ResetTag(i->tag, ST_SHOWFRAME);
-	i->filesize += swf_WriteTag2(&i->out, i->tag);
+	writeTag(i);
 
 	i->fpspos -= 1.0;
 	i->frames ++;
@@ -332,7 +489,7 @@ static void writeShowTags(v2swf_internal_t* i, int shapeid, int bmid, int width,
     } else {
 	swf_ObjectPlace(i->tag,shapeid,shapeid,0,0,0);
     }
-    i->filesize += swf_WriteTag2(&i->out, i->tag);
+    writeTag(i);
 
     i->showframe = 1;
 }
@@ -412,36 +569,40 @@ static void writehead(v2swf_internal_t*i)
     swf_SetU8(i->tag, 0); //black
     swf_SetU8(i->tag, 0);
     swf_SetU8(i->tag, 0);
-    i->filesize += swf_WriteTag2(&i->out, i->tag);
+    writeTag(i);
 }
 
 static void finish(v2swf_internal_t*i)
 {
     msg("finish(): i->finished=%d\n", i->finished);
     if(!i->finished) {
+	flushgops(i);
 	msg("write endtag\n", i->finished);
 
 	if(i->add_cut) {
 	    swf_ResetTag(i->tag, ST_SHOWFRAME);
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 
 	    swf_ResetTag(i->tag, ST_REMOVEOBJECT2);
 	    swf_SetU16(i->tag, 1); //depth
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 
 	    swf_ResetTag(i->tag, ST_DOACTION);
 	    swf_SetU16(i->tag, 0x0007);
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 	}
 
 	swf_ResetTag(i->tag, ST_END);
-	i->filesize += swf_WriteTag2(&i->out, i->tag);
+	writeTag(i);
 
 	i->out.finish(&i->out);
 
 	if(i->version>=6) {
 	    swf_VideoStreamClear(&i->stream);
 	}
+	if(i->soundenc) {
+	    swf_SoundEncoderFree(i->soundenc);i->soundenc = 0;
+	}
 	if(i->buffer)  {
 	    free(i->buffer);i->buffer = 0;
 	}
@@ -467,11 +628,11 @@ static void cleanup(v2swf_internal_t*i)
 	if(!(t&1)) {
 	    swf_ResetTag(i->tag, ST_REMOVEOBJECT2);
 	    swf_SetU16(i->tag, t);
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 	}
 	swf_ResetTag(i->tag, ST_FREECHARACTER);
 	swf_SetU16(i->tag, t);
-	i->filesize += swf_WriteTag2(&i->out, i->tag);
+	writeTag(i);
     }
     i->lastid = i->id;
 }
@@ -481,45 +642,17 @@ static void cleanup(v2swf_internal_t*i)
 #define DIFFMODE_EXACT 3
 #define DIFFMODE_QMEAN 4
 
+/* the comparison kernels take the line length, not the
+   distance from the end of one line to the start of the next */
+
 static int blockdiff_max(U8*d1,U8*d2,int yadd, int maxdiff, int xl, int yl)
 {
-    int x,y;
-    for(y=0;y<yl;y++) {
-	for(x=0;x<xl;x++) {
-	    int rd = d1[1] - d2[1];
-	    int gd = d1[2] - d2[2];
-	    int bd = d1[3] - d2[3];
-	    if(rd < 0) rd = -rd;
-	    if(gd < 0) gd = -gd;
-	    if(bd < 0) bd = -bd;
-	    if(rd+gd+bd>maxdiff)
-		return 1;
-
-	    d1+=4; d2+=4;
-	}
-	d1 += yadd; d2 += yadd;
-    }
-    return 0;
+    return blockdiff()->rgb_max(d1, d2, yadd+xl*4, xl, yl) > maxdiff;
 }
 
 static int blockdiff_mean(U8*d1,U8*d2,int yadd, int maxdiff, int xl, int yl)
 {
-    int mean = 0;
-    int x,y;
-    for(y=0;y<yl;y++) {
-	for(x=0;x<xl;x++) {
-	    int rd = d1[1] - d2[1];
-	    int gd = d1[2] - d2[2];
-	    int bd = d1[3] - d2[3];
-	    if(rd < 0) rd = -rd;
-	    if(gd < 0) gd = -gd;
-	    if(bd < 0) bd = -bd;
-	    mean += rd+gd+bd;
-
-	    d1+=4; d2+=4;
-	}
-	d1 += yadd; d2 += yadd;
-    }
+    int mean = blockdiff()->rgb_sad(d1, d2, yadd+xl*4, xl, yl);
     if(mean/(xl*yl) > maxdiff)
 	return 1;
     return 0;
@@ -527,42 +660,15 @@ static int blockdiff_mean(U8*d1,U8*d2,int yadd, int maxdiff, int xl, int yl)
 
 static int blockdiff_qmean(U8*d1,U8*d2,int yadd, int maxdiff, int xl, int yl)
 {
-    int mean = 0;
-    int x,y;
-    for(y=0;y<yl;y++) {
-	for(x=0;x<xl;x++) {
-	    int rd = d1[1] - d2[1];
-	    int gd = d1[2] - d2[2];
-	    int bd = d1[3] - d2[3];
-	    int q;
-	    if(rd < 0) rd = -rd;
-	    if(gd < 0) gd = -gd;
-	    if(bd < 0) bd = -bd;
-	    q = rd+gd+bd;
-	    mean += q*q;
-
-	    d1+=4; d2+=4;
-	}
-	d1 += yadd; d2 += yadd;
-    }
-    if(mean/(xl*yl) > maxdiff*maxdiff)
+    unsigned int mean = blockdiff()->rgb_ssd(d1, d2, yadd+xl*4, xl, yl);
+    if(mean/(xl*yl) > (unsigned int)(maxdiff*maxdiff))
 	return 1;
     return 0;
 }
 
 static int blockdiff_exact(U8*d1,U8*d2,int yadd, int xl, int yl)
 {
-    int x,y;
-    for(y=0;y<yl;y++) {
-	for(x=0;x<xl;x++) {
-	    if((*(U32*)d1^*(U32*)d2)&0xffffff00) { //bits [RGB_] of [RGBA] differ
-		return 1;
-	    }
-	    d1+=4; d2+=4;
-	}
-	d1 += yadd; d2 += yadd;
-    }
-    return 0;
+    return blockdiff()->rgb_differ(d1, d2, yadd+xl*4, xl, yl);
 }
 
 		/*U32 r = (*(U32*)d1^-(U32*)d2)&0xffffff00;
@@ -578,9 +684,10 @@ static void checkInit(v2swf_internal_t*i)
 	    swf_ResetTag(i->tag,  ST_DEFINEVIDEOSTREAM);
 	    swf_SetU16(i->tag, 99);
 	    swf_SetVideoStreamDefine(i->tag, &i->stream, 65535, i->width, i->height);
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 	    if(i->domotion) {
 		i->stream.do_motion = 1;
+		i->stream.fast_motion = i->fastmotion;
 	    }
 	}
 	i->head_done = 1;
@@ -690,16 +797,16 @@ static int encodeoneframe(v2swf_internal_t*i)
 	if(i->id>=4) {
 	    swf_ResetTag(i->tag, ST_REMOVEOBJECT2);
 	    swf_SetU16(i->tag, i->id-3);
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 	    swf_ResetTag(i->tag, ST_FREECHARACTER);
 	    swf_SetU16(i->tag, i->id-4);
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 	}
 
 	swf_ResetTag(i->tag, ST_DEFINEBITSJPEG2);
 	swf_SetU16(i->tag, bmid);
 	swf_SetJPEGBits2(i->tag, i->width, i->height, (RGBA*)i->buffer, i->quality);
-	i->filesize += swf_WriteTag2(&i->out, i->tag);
+	writeTag(i);
 	
 	writeShowTags(i, shapeid, bmid, i->width, i->height);
 
@@ -731,7 +838,7 @@ static int encodeoneframe(v2swf_internal_t*i)
 	    swf_ResetTag(i->tag, ST_DEFINEBITSJPEG2);
 	    swf_SetU16(i->tag, bmid);
 	    swf_SetJPEGBits2(i->tag, i->width, i->height, (RGBA*)i->buffer, i->quality);
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 	   
 	    writeShowTags(i, shapeid, bmid, i->width, i->height);
 	    return 1;
@@ -808,7 +915,7 @@ static int encodeoneframe(v2swf_internal_t*i)
 	    swf_ResetTag(i->tag, ST_DEFINEBITSJPEG3);
 	    swf_SetU16(i->tag, bmid);
 	    swf_SetJPEGBits3(i->tag, i->width, i->height, (RGBA*)i->buffer, i->quality);
-	    i->filesize += swf_WriteTag2(&i->out, i->tag);
+	    writeTag(i);
 
 	    writeShowTags(i, shapeid, bmid, i->width, i->height);
 	}
@@ -821,30 +928,39 @@ static int encodeoneframe(v2swf_internal_t*i)
 	    obj.matrix.sx = obj.matrix.sy = i->scale;
 	}
 
-	if(i->stream.frame==0) {
+	int frame = i->threads>1 ? i->vframe : i->stream.frame;
+	if(frame==0) {
 	    obj.depth = 1;
 	    obj.id = 99;
 	} else {
 	    obj.move = 1;
 	    obj.depth = 1;
-	    obj.ratio = i->stream.frame;
+	    obj.ratio = frame;
 	}
 
-	swf_ResetTag(i->tag, ST_VIDEOFRAME);
-	swf_SetU16(i->tag, 99);
-	if(!(--i->keyframe)) {
-	    msg("setting video I-frame, ratio=%d\n", i->stream.frame);
-	    swf_SetVideoStreamIFrame(i->tag, &i->stream, (RGBA*)i->buffer, quant);
+	int iframe = !(--i->keyframe);
+	if(iframe)
 	    i->keyframe = i->keyframe_interval;
+
+	if(i->threads>1) {
+	    msg("queueing video %s-frame, ratio=%d\n", iframe?"I":"P", frame);
+	    queueframe(i, iframe, quant);
 	} else {
-	    msg("setting video P-frame, ratio=%d\n", i->stream.frame);
-	    swf_SetVideoStreamPFrame(i->tag, &i->stream, (RGBA*)i->buffer, quant);
+	    swf_ResetTag(i->tag, ST_VIDEOFRAME);
+	    swf_SetU16(i->tag, 99);
+	    if(iframe) {
+		msg("setting video I-frame, ratio=%d\n", frame);
+		swf_SetVideoStreamIFrame(i->tag, &i->stream, (RGBA*)i->buffer, quant);
+	    } else {
+		msg("setting video P-frame, ratio=%d\n", frame);
+		swf_SetVideoStreamPFrame(i->tag, &i->stream, (RGBA*)i->buffer, quant);
+	    }
+	    writeTag(i);
 	}
-	i->filesize += swf_WriteTag2(&i->out, i->tag);
 
 	swf_ResetTag(i->tag, ST_PLACEOBJECT2);
 	swf_SetPlaceObject(i->tag,&obj);
-	i->filesize += swf_WriteTag2(&i->out, i->tag);
+	writeTag(i);
 	i->showframe = 1;
     }
     return 1;
@@ -981,6 +1097,18 @@ void v2swf_setparameter(v2swf_t*v2swf, char*name, char*value)
 	i->numframes = atoi(value);
     } else if(!strcmp(name, "motioncompensation")) {
 	i->domotion = atoi(value);
+    } else if(!strcmp(name, "motionsearch")) {
+	if(!strcmp(value, "fast")) {
+	    i->domotion = 1;
+	    i->fastmotion = 1;
+	} else if(!strcmp(value, "full")) {
+	    i->domotion = 1;
+	    i->fastmotion = 0;
+	} else {
+	    i->domotion = 0;
+	}
+    } else if(!strcmp(name, "threads")) {
+	i->threads = atoi(value);
     } else if(!strcmp(name, "prescale")) {
 	i->prescale = atoi(value);
     } else if(!strcmp(name, "blockdiff")) {
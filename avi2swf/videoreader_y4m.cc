@@ -0,0 +1,280 @@
+/* videoreader_y4m.cc
+   Read YUV4MPEG2 or raw rgb streams, e.g. as piped from ffmpeg.
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <memory.h>
+#include "videoreader.h"
+#include "videoreader_y4m.hh"
+
+#define FORMAT_RAW_RGB 0
+#define FORMAT_Y4M 1
+
+typedef struct _y4m_internal
+{
+    FILE*fi;
+    int format;
+
+    /* chroma subsampling (y4m only) */
+    int cwidth;
+    int cheight;
+    int has_chroma;
+
+    unsigned char*framebuf;
+    int framesize;
+
+    int flip;
+    int verbose;
+    int eof;
+} y4m_internal_t;
+
+static int readline(FILE*fi, char*line, int maxlen)
+{
+    int pos = 0;
+    while(1) {
+	int c = fgetc(fi);
+	if(c == EOF)
+	    return -1;
+	if(c == '\n')
+	    break;
+	if(pos < maxlen-1)
+	    line[pos++] = c;
+    }
+    line[pos] = 0;
+    return pos;
+}
+
+static inline unsigned char clip(int v)
+{
+    return v<0?0:(v>255?255:v);
+}
+
+/* ITU-R BT.601, 16..235 luminance range */
+static void yuv2rgb(unsigned char*dest, int width, int height,
+		    unsigned char*py, unsigned char*pu, unsigned char*pv,
+		    int cwidth, int cheight)
+{
+    int x,y;
+    for(y=0;y<height;y++) {
+	unsigned char*yl = &py[y*width];
+	unsigned char*ul = pu?&pu[(y*cheight/height)*cwidth]:0;
+	unsigned char*vl = pv?&pv[(y*cheight/height)*cwidth]:0;
+	unsigned char*d = &dest[y*width*4];
+	for(x=0;x<width;x++) {
+	    int c = (yl[x]-16)*76309;
+	    int u=0,v=0;
+	    if(ul) {
+		int cx = x*cwidth/width;
+		u = ul[cx]-128;
+		v = vl[cx]-128;
+	    }
+	    d[0] = 255;
+	    d[1] = clip((c + 104597*v + 32768) >> 16);
+	    d[2] = clip((c - 25675*u - 53279*v + 32768) >> 16);
+	    d[3] = clip((c + 132201*u + 32768) >> 16);
+	    d += 4;
+	}
+    }
+}
+
+static void flipimage(unsigned char*data, int width, int height)
+{
+    int linelen = width*4;
+    unsigned char*tmp = (unsigned char*)malloc(linelen);
+    int y;
+    for(y=0;y<height/2;y++) {
+	unsigned char*l1 = &data[y*linelen];
+	unsigned char*l2 = &data[(height-1-y)*linelen];
+	memcpy(tmp, l1, linelen);
+	memcpy(l1, l2, linelen);
+	memcpy(l2, tmp, linelen);
+    }
+    free(tmp);
+}
+
+static int y4m_getsamples(videoreader_t* v, void*buffer, int num)
+{
+    return 0; // no audio
+}
+
+static int y4m_getimage(videoreader_t* v, void*buffer)
+{
+    y4m_internal_t*i = (y4m_internal_t*)v->internal;
+    unsigned char*dest = (unsigned char*)buffer;
+    if(i->eof)
+	return 0;
+
+    if(i->format == FORMAT_Y4M) {
+	char line[256];
+	if(readline(i->fi, line, sizeof(line))<0 || strncmp(line, "FRAME", 5)) {
+	    i->eof = 1;
+	    return 0;
+	}
+    }
+    if(fread(i->framebuf, i->framesize, 1, i->fi) != 1) {
+	i->eof = 1;
+	return 0;
+    }
+
+    int size = v->width*v->height;
+    if(i->format == FORMAT_Y4M) {
+	unsigned char*py = i->framebuf;
+	unsigned char*pu = 0, *pv = 0;
+	if(i->has_chroma) {
+	    pu = &py[size];
+	    pv = &pu[i->cwidth*i->cheight];
+	}
+	yuv2rgb(dest, v->width, v->height, py, pu, pv, i->cwidth, i->cheight);
+    } else {
+	int t;
+	unsigned char*s = i->framebuf;
+	for(t=0;t<size;t++) {
+	    dest[0] = 255;
+	    dest[1] = s[0];
+	    dest[2] = s[1];
+	    dest[3] = s[2];
+	    dest += 4; s += 3;
+	}
+    }
+    if(i->flip)
+	flipimage((unsigned char*)buffer, v->width, v->height);
+
+    v->frame++;
+    return size*4;
+}
+
+static void y4m_close(videoreader_t* v)
+{
+    y4m_internal_t*i = (y4m_internal_t*)v->internal;
+    if(i->fi && i->fi != stdin)
+	fclose(i->fi);
+    free(i->framebuf);
+    free(v->internal);v->internal = 0;
+}
+
+static void y4m_setparameter(videoreader_t*v, char*name, char*value)
+{
+    y4m_internal_t*i = (y4m_internal_t*)v->internal;
+    if(!strcmp(name, "flip")) {
+	i->flip = atoi(value);
+    } else if(!strcmp(name, "verbose")) {
+	i->verbose = atoi(value);
+    }
+}
+
+static y4m_internal_t* y4m_init(videoreader_t*v, char*filename)
+{
+    FILE*fi;
+    if(!strcmp(filename, "-")) {
+	fi = stdin;
+    } else {
+	fi = fopen(filename, "rb");
+	if(!fi) {
+	    perror(filename);
+	    return 0;
+	}
+    }
+    y4m_internal_t*i = (y4m_internal_t*)malloc(sizeof(y4m_internal_t));
+    memset(i, 0, sizeof(y4m_internal_t));
+    i->fi = fi;
+
+    memset(v, 0, sizeof(videoreader_t));
+    v->internal = i;
+    v->getsamples = y4m_getsamples;
+    v->getimage = y4m_getimage;
+    v->close = y4m_close;
+    v->setparameter = y4m_setparameter;
+    v->channels = 0; // no audio
+    v->samplerate = 0;
+    return i;
+}
+
+int videoreader_y4m_open(videoreader_t* v, char* filename)
+{
+    y4m_internal_t*i = y4m_init(v, filename);
+    if(!i)
+	return -1;
+    i->format = FORMAT_Y4M;
+
+    char line[1024];
+    if(readline(i->fi, line, sizeof(line))<0 || strncmp(line, "YUV4MPEG2", 9)) {
+	fprintf(stderr, "%s is not a YUV4MPEG2 stream\n", filename);
+	y4m_close(v);
+	return -1;
+    }
+    const char*chroma = "420";
+    int fps_n = 25, fps_d = 1;
+    char*p = strtok(line+9, " ");
+    while(p) {
+	switch(p[0]) {
+	    case 'W': v->width = atoi(p+1); break;
+	    case 'H': v->height = atoi(p+1); break;
+	    case 'F': sscanf(p+1, "%d:%d", &fps_n, &fps_d); break;
+	    case 'C': chroma = p+1; break;
+	}
+	p = strtok(0, " ");
+    }
+    if(v->width<=0 || v->height<=0 || fps_n<=0 || fps_d<=0) {
+	fprintf(stderr, "Invalid YUV4MPEG2 header\n");
+	y4m_close(v);
+	return -1;
+    }
+    v->fps = (double)fps_n / fps_d;
+
+    i->has_chroma = 1;
+    if(!strncmp(chroma, "420", 3) && (!chroma[3] || !strcmp(chroma+3, "jpeg") ||
+		                      !strcmp(chroma+3, "paldv") || !strcmp(chroma+3, "mpeg2"))) {
+	i->cwidth = (v->width+1)/2;
+	i->cheight = (v->height+1)/2;
+    } else if(!strcmp(chroma, "422")) {
+	i->cwidth = (v->width+1)/2;
+	i->cheight = v->height;
+    } else if(!strcmp(chroma, "444")) {
+	i->cwidth = v->width;
+	i->cheight = v->height;
+    } else if(!strcmp(chroma, "mono")) {
+	i->has_chroma = 0;
+    } else {
+	fprintf(stderr, "Unsupported YUV4MPEG2 colorspace %s (try -pix_fmt yuv420p)\n", chroma);
+	y4m_close(v);
+	return -1;
+    }
+    i->framesize = v->width*v->height + (i->has_chroma?2*i->cwidth*i->cheight:0);
+    i->framebuf = (unsigned char*)malloc(i->framesize);
+    return 0;
+}
+
+int videoreader_raw_open(videoreader_t* v, char* filename, int width, int height, double fps)
+{
+    if(width<=0 || height<=0 || fps<=0)
+	return -1;
+    y4m_internal_t*i = y4m_init(v, filename);
+    if(!i)
+	return -1;
+    i->format = FORMAT_RAW_RGB;
+    v->width = width;
+    v->height = height;
+    v->fps = fps;
+    i->framesize = width*height*3;
+    i->framebuf = (unsigned char*)malloc(i->framesize);
+    return 0;
+}
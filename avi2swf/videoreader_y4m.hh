@@ -0,0 +1,34 @@
+/* videoreader_y4m.hh
+   Header file for videoreader_y4m.cc.
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#ifndef __videoreader_y4m_h__
+#define __videoreader_y4m_h__
+
+#include "videoreader.h"
+
+/* read a YUV4MPEG2 stream (as written by e.g. ffmpeg -f yuv4mpegpipe).
+   filename "-" reads from stdin. */
+int videoreader_y4m_open(videoreader_t* v, char* filename);
+
+/* read raw rgb24 frames of the given size (e.g. ffmpeg -f rawvideo -pix_fmt rgb24) */
+int videoreader_raw_open(videoreader_t* v, char* filename, int width, int height, double fps);
+
+#endif
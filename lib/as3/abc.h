@@ -83,6 +83,9 @@ struct _abc_file {
 
 abc_file_t*abc_file_new();
 
+/* run the peephole optimizer (code_optimize) over all method bodies */
+void abc_file_optimize(abc_file_t*file);
+
 #define TRAIT_SLOT 0
 #define TRAIT_METHOD 1
 #define TRAIT_GETTER 2
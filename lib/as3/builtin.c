@@ -5903,3049 +5903,3126 @@ static classinfo_t _ReferenceError = {0x03, 0x00, 0x88, 0x16, "", "ReferenceErro
 static varinfo_t _ReferenceError_length = {0x01, 0x00, 0x82, 0x16, "", "length", 0, &_int, &_ReferenceError, 0};
 static classinfo_t flash_display_Shape = {0x03, 0x00, 0x80, 0x16, "flash.display", "Shape", 0, &flash_display_DisplayObject, interfaces: {0}};
 static varinfo_t flash_display_Shape_graphics = {0x01, 0x00, 0x80, 0x16, "", "graphics", 0, &flash_display_Graphics, &flash_display_Shape, 0};
-dict_t* builtin_getclasses()
+
+static slotinfo_t* const _ArgumentError_static_members[] = {
+    (slotinfo_t*)&_ArgumentError_length,
+    0};
+static slotinfo_t* const _Array_members[] = {
+    (slotinfo_t*)&_Array_forEach,
+    (slotinfo_t*)&_Array_sortOn,
+    (slotinfo_t*)&_Array_indexOf,
+    (slotinfo_t*)&_Array_splice,
+    (slotinfo_t*)&_Array_lastIndexOf,
+    (slotinfo_t*)&_Array_map,
+    (slotinfo_t*)&_Array_concat,
+    (slotinfo_t*)&_Array_shift,
+    (slotinfo_t*)&_Array_unshift,
+    (slotinfo_t*)&_Array_some,
+    (slotinfo_t*)&_Array_filter,
+    (slotinfo_t*)&_Array_join,
+    (slotinfo_t*)&_Array_slice,
+    (slotinfo_t*)&_Array_every,
+    (slotinfo_t*)&_Array_pop,
+    (slotinfo_t*)&_Array_sort,
+    (slotinfo_t*)&_Array_reverse,
+    (slotinfo_t*)&_Array_push,
+    (slotinfo_t*)&_Array_length,
+    0};
+static slotinfo_t* const _Array_static_members[] = {
+    (slotinfo_t*)&_Array_DESCENDING,
+    (slotinfo_t*)&_Array_UNIQUESORT,
+    (slotinfo_t*)&_Array_RETURNINDEXEDARRAY,
+    (slotinfo_t*)&_Array_CASEINSENSITIVE,
+    (slotinfo_t*)&_Array_NUMERIC,
+    0};
+static slotinfo_t* const _Boolean_members[] = {
+    (slotinfo_t*)&_Boolean_valueOf,
+    (slotinfo_t*)&_Boolean_toString,
+    0};
+static slotinfo_t* const _Boolean_static_members[] = {
+    (slotinfo_t*)&_Boolean_length,
+    0};
+static slotinfo_t* const _Class_members[] = {
+    (slotinfo_t*)&_Class_prototype,
+    0};
+static slotinfo_t* const _Class_static_members[] = {
+    (slotinfo_t*)&_Class_length,
+    0};
+static slotinfo_t* const _Date_members[] = {
+    (slotinfo_t*)&_Date_getTimezoneOffset,
+    (slotinfo_t*)&_Date_getTime,
+    (slotinfo_t*)&_Date_setUTCMilliseconds,
+    (slotinfo_t*)&_Date_month,
+    (slotinfo_t*)&_Date_toString,
+    (slotinfo_t*)&_Date_getHours,
+    (slotinfo_t*)&_Date_date,
+    (slotinfo_t*)&_Date_milliseconds,
+    (slotinfo_t*)&_Date_setSeconds,
+    (slotinfo_t*)&_Date_getDate,
+    (slotinfo_t*)&_Date_hoursUTC,
+    (slotinfo_t*)&_Date_getUTCDate,
+    (slotinfo_t*)&_Date_timezoneOffset,
+    (slotinfo_t*)&_Date_setTime,
+    (slotinfo_t*)&_Date_millisecondsUTC,
+    (slotinfo_t*)&_Date_minutes,
+    (slotinfo_t*)&_Date_setUTCHours,
+    (slotinfo_t*)&_Date_minutesUTC,
+    (slotinfo_t*)&_Date_toLocaleTimeString,
+    (slotinfo_t*)&_Date_fullYearUTC,
+    (slotinfo_t*)&_Date_time,
+    (slotinfo_t*)&_Date_monthUTC,
+    (slotinfo_t*)&_Date_getUTCMilliseconds,
+    (slotinfo_t*)&_Date_toDateString,
+    (slotinfo_t*)&_Date_getMonth,
+    (slotinfo_t*)&_Date_setMinutes,
+    (slotinfo_t*)&_Date_toLocaleDateString,
+    (slotinfo_t*)&_Date_fullYear,
+    (slotinfo_t*)&_Date_getUTCFullYear,
+    (slotinfo_t*)&_Date_getSeconds,
+    (slotinfo_t*)&_Date_dateUTC,
+    (slotinfo_t*)&_Date_getMilliseconds,
+    (slotinfo_t*)&_Date_setUTCMinutes,
+    (slotinfo_t*)&_Date_day,
+    (slotinfo_t*)&_Date_setUTCSeconds,
+    (slotinfo_t*)&_Date_setUTCDate,
+    (slotinfo_t*)&_Date_getUTCMonth,
+    (slotinfo_t*)&_Date_valueOf,
+    (slotinfo_t*)&_Date_seconds,
+    (slotinfo_t*)&_Date_getUTCMinutes,
+    (slotinfo_t*)&_Date_setDate,
+    (slotinfo_t*)&_Date_getFullYear,
+    (slotinfo_t*)&_Date_setFullYear,
+    (slotinfo_t*)&_Date_setHours,
+    (slotinfo_t*)&_Date_setMonth,
+    (slotinfo_t*)&_Date_getUTCSeconds,
+    (slotinfo_t*)&_Date_getMinutes,
+    (slotinfo_t*)&_Date_toLocaleString,
+    (slotinfo_t*)&_Date_toUTCString,
+    (slotinfo_t*)&_Date_dayUTC,
+    (slotinfo_t*)&_Date_getDay,
+    (slotinfo_t*)&_Date_setUTCMonth,
+    (slotinfo_t*)&_Date_hours,
+    (slotinfo_t*)&_Date_getUTCDay,
+    (slotinfo_t*)&_Date_setUTCFullYear,
+    (slotinfo_t*)&_Date_secondsUTC,
+    (slotinfo_t*)&_Date_toTimeString,
+    (slotinfo_t*)&_Date_setMilliseconds,
+    (slotinfo_t*)&_Date_getUTCHours,
+    0};
+static slotinfo_t* const _Date_static_members[] = {
+    (slotinfo_t*)&_Date_length,
+    (slotinfo_t*)&_Date_UTC,
+    (slotinfo_t*)&_Date_parse,
+    0};
+static slotinfo_t* const _DefinitionError_static_members[] = {
+    (slotinfo_t*)&_DefinitionError_length,
+    0};
+static slotinfo_t* const _Error_members[] = {
+    (slotinfo_t*)&_Error_message,
+    (slotinfo_t*)&_Error_errorID,
+    (slotinfo_t*)&_Error_getStackTrace,
+    (slotinfo_t*)&_Error_name,
+    0};
+static slotinfo_t* const _Error_static_members[] = {
+    (slotinfo_t*)&_Error_length,
+    (slotinfo_t*)&_Error_getErrorMessage,
+    (slotinfo_t*)&_Error_throwError,
+    0};
+static slotinfo_t* const _EvalError_static_members[] = {
+    (slotinfo_t*)&_EvalError_length,
+    0};
+static slotinfo_t* const _Function_members[] = {
+    (slotinfo_t*)&_Function_length,
+    (slotinfo_t*)&_Function_apply,
+    (slotinfo_t*)&_Function_call,
+    (slotinfo_t*)&_Function_prototype,
+    0};
+static slotinfo_t* const _Math_static_members[] = {
+    (slotinfo_t*)&_Math_ceil,
+    (slotinfo_t*)&_Math_SQRT2,
+    (slotinfo_t*)&_Math_cos,
+    (slotinfo_t*)&_Math_abs,
+    (slotinfo_t*)&_Math_PI,
+    (slotinfo_t*)&_Math_E,
+    (slotinfo_t*)&_Math_round,
+    (slotinfo_t*)&_Math_LN10,
+    (slotinfo_t*)&_Math_SQRT1_2,
+    (slotinfo_t*)&_Math_log,
+    (slotinfo_t*)&_Math_LOG10E,
+    (slotinfo_t*)&_Math_random,
+    (slotinfo_t*)&_Math_acos,
+    (slotinfo_t*)&_Math_tan,
+    (slotinfo_t*)&_Math_asin,
+    (slotinfo_t*)&_Math_exp,
+    (slotinfo_t*)&_Math_atan2,
+    (slotinfo_t*)&_Math_pow,
+    (slotinfo_t*)&_Math_min,
+    (slotinfo_t*)&_Math_LN2,
+    (slotinfo_t*)&_Math_sin,
+    (slotinfo_t*)&_Math_sqrt,
+    (slotinfo_t*)&_Math_LOG2E,
+    (slotinfo_t*)&_Math_max,
+    (slotinfo_t*)&_Math_atan,
+    (slotinfo_t*)&_Math_floor,
+    0};
+static slotinfo_t* const _Namespace_members[] = {
+    (slotinfo_t*)&_Namespace_valueOf,
+    (slotinfo_t*)&_Namespace_toString,
+    (slotinfo_t*)&_Namespace_uri,
+    (slotinfo_t*)&_Namespace_prefix,
+    0};
+static slotinfo_t* const _Namespace_static_members[] = {
+    (slotinfo_t*)&_Namespace_length,
+    0};
+static slotinfo_t* const _Number_members[] = {
+    (slotinfo_t*)&_Number_valueOf,
+    (slotinfo_t*)&_Number_toString,
+    (slotinfo_t*)&_Number_toExponential,
+    (slotinfo_t*)&_Number_toFixed,
+    (slotinfo_t*)&_Number_toPrecision,
+    0};
+static slotinfo_t* const _Number_static_members[] = {
+    (slotinfo_t*)&_Number_MAX_VALUE,
+    (slotinfo_t*)&_Number_length,
+    (slotinfo_t*)&_Number_MIN_VALUE,
+    (slotinfo_t*)&_Number_NaN,
+    (slotinfo_t*)&_Number_POSITIVE_INFINITY,
+    (slotinfo_t*)&_Number_NEGATIVE_INFINITY,
+    0};
+static slotinfo_t* const _Object_members[] = {
+    (slotinfo_t*)&_Object_propertyIsEnumerable,
+    (slotinfo_t*)&_Object_isPrototypeOf,
+    (slotinfo_t*)&_Object_hasOwnProperty,
+    0};
+static slotinfo_t* const _Object_static_members[] = {
+    (slotinfo_t*)&_Object_init,
+    (slotinfo_t*)&_Object_length,
+    (slotinfo_t*)&_Object__setPropertyIsEnumerable,
+    (slotinfo_t*)&_Object__dontEnumPrototype,
+    0};
+static slotinfo_t* const _QName_members[] = {
+    (slotinfo_t*)&_QName_localName,
+    (slotinfo_t*)&_QName_valueOf,
+    (slotinfo_t*)&_QName_toString,
+    (slotinfo_t*)&_QName_uri,
+    0};
+static slotinfo_t* const _QName_static_members[] = {
+    (slotinfo_t*)&_QName_length,
+    0};
+static slotinfo_t* const _RangeError_static_members[] = {
+    (slotinfo_t*)&_RangeError_length,
+    0};
+static slotinfo_t* const _ReferenceError_static_members[] = {
+    (slotinfo_t*)&_ReferenceError_length,
+    0};
+static slotinfo_t* const _RegExp_members[] = {
+    (slotinfo_t*)&_RegExp_source,
+    (slotinfo_t*)&_RegExp_test,
+    (slotinfo_t*)&_RegExp_global,
+    (slotinfo_t*)&_RegExp_exec,
+    (slotinfo_t*)&_RegExp_ignoreCase,
+    (slotinfo_t*)&_RegExp_dotall,
+    (slotinfo_t*)&_RegExp_lastIndex,
+    (slotinfo_t*)&_RegExp_extended,
+    (slotinfo_t*)&_RegExp_multiline,
+    0};
+static slotinfo_t* const _RegExp_static_members[] = {
+    (slotinfo_t*)&_RegExp_length,
+    0};
+static slotinfo_t* const _SecurityError_static_members[] = {
+    (slotinfo_t*)&_SecurityError_length,
+    0};
+static slotinfo_t* const _String_members[] = {
+    (slotinfo_t*)&_String_indexOf,
+    (slotinfo_t*)&_String_replace,
+    (slotinfo_t*)&_String_lastIndexOf,
+    (slotinfo_t*)&_String_valueOf,
+    (slotinfo_t*)&_String_concat,
+    (slotinfo_t*)&_String_substr,
+    (slotinfo_t*)&_String_slice,
+    (slotinfo_t*)&_String_search,
+    (slotinfo_t*)&_String_toLocaleUpperCase,
+    (slotinfo_t*)&_String_toString,
+    (slotinfo_t*)&_String_toUpperCase,
+    (slotinfo_t*)&_String_charAt,
+    (slotinfo_t*)&_String_match,
+    (slotinfo_t*)&_String_charCodeAt,
+    (slotinfo_t*)&_String_substring,
+    (slotinfo_t*)&_String_localeCompare,
+    (slotinfo_t*)&_String_split,
+    (slotinfo_t*)&_String_toLocaleLowerCase,
+    (slotinfo_t*)&_String_length,
+    (slotinfo_t*)&_String_toLowerCase,
+    0};
+static slotinfo_t* const _String_static_members[] = {
+    (slotinfo_t*)&_String_fromCharCode,
+    0};
+static slotinfo_t* const _SyntaxError_static_members[] = {
+    (slotinfo_t*)&_SyntaxError_length,
+    0};
+static slotinfo_t* const _TypeError_static_members[] = {
+    (slotinfo_t*)&_TypeError_length,
+    0};
+static slotinfo_t* const _URIError_static_members[] = {
+    (slotinfo_t*)&_URIError_length,
+    0};
+static slotinfo_t* const _UninitializedError_static_members[] = {
+    (slotinfo_t*)&_UninitializedError_length,
+    0};
+static slotinfo_t* const _VerifyError_static_members[] = {
+    (slotinfo_t*)&_VerifyError_length,
+    0};
+static slotinfo_t* const _XML_members[] = {
+    (slotinfo_t*)&_XML_normalize,
+    (slotinfo_t*)&_XML_removeNamespace,
+    (slotinfo_t*)&_XML_prependChild,
+    (slotinfo_t*)&_XML_toXMLString,
+    (slotinfo_t*)&_XML_text,
+    (slotinfo_t*)&_XML_nodeKind,
+    (slotinfo_t*)&_XML_copy,
+    (slotinfo_t*)&_XML_toString,
+    (slotinfo_t*)&_XML_childIndex,
+    (slotinfo_t*)&_XML_setName,
+    (slotinfo_t*)&_XML_setLocalName,
+    (slotinfo_t*)&_XML_namespace,
+    (slotinfo_t*)&_XML_insertChildBefore,
+    (slotinfo_t*)&_XML_addNamespace,
+    (slotinfo_t*)&_XML_propertyIsEnumerable,
+    (slotinfo_t*)&_XML_comments,
+    (slotinfo_t*)&_XML_attributes,
+    (slotinfo_t*)&_XML_descendants,
+    (slotinfo_t*)&_XML_replace,
+    (slotinfo_t*)&_XML_setNotification,
+    (slotinfo_t*)&_XML_children,
+    (slotinfo_t*)&_XML_contains,
+    (slotinfo_t*)&_XML_hasSimpleContent,
+    (slotinfo_t*)&_XML_elements,
+    (slotinfo_t*)&_XML_hasComplexContent,
+    (slotinfo_t*)&_XML_insertChildAfter,
+    (slotinfo_t*)&_XML_parent,
+    (slotinfo_t*)&_XML_length,
+    (slotinfo_t*)&_XML_processingInstructions,
+    (slotinfo_t*)&_XML_child,
+    (slotinfo_t*)&_XML_appendChild,
+    (slotinfo_t*)&_XML_valueOf,
+    (slotinfo_t*)&_XML_localName,
+    (slotinfo_t*)&_XML_notification,
+    (slotinfo_t*)&_XML_inScopeNamespaces,
+    (slotinfo_t*)&_XML_hasOwnProperty,
+    (slotinfo_t*)&_XML_namespaceDeclarations,
+    (slotinfo_t*)&_XML_setNamespace,
+    (slotinfo_t*)&_XML_name,
+    (slotinfo_t*)&_XML_setChildren,
+    (slotinfo_t*)&_XML_attribute,
+    0};
+static slotinfo_t* const _XML_static_members[] = {
+    (slotinfo_t*)&_XML_prettyPrinting,
+    (slotinfo_t*)&_XML_setSettings,
+    (slotinfo_t*)&_XML_ignoreComments,
+    (slotinfo_t*)&_XML_prettyIndent,
+    (slotinfo_t*)&_XML_settings,
+    (slotinfo_t*)&_XML_ignoreProcessingInstructions,
+    (slotinfo_t*)&_XML_ignoreWhitespace,
+    (slotinfo_t*)&_XML_defaultSettings,
+    0};
+static slotinfo_t* const _XMLList_members[] = {
+    (slotinfo_t*)&_XMLList_normalize,
+    (slotinfo_t*)&_XMLList_removeNamespace,
+    (slotinfo_t*)&_XMLList_prependChild,
+    (slotinfo_t*)&_XMLList_toXMLString,
+    (slotinfo_t*)&_XMLList_nodeKind,
+    (slotinfo_t*)&_XMLList_copy,
+    (slotinfo_t*)&_XMLList_text,
+    (slotinfo_t*)&_XMLList_toString,
+    (slotinfo_t*)&_XMLList_childIndex,
+    (slotinfo_t*)&_XMLList_setName,
+    (slotinfo_t*)&_XMLList_setLocalName,
+    (slotinfo_t*)&_XMLList_namespace,
+    (slotinfo_t*)&_XMLList_insertChildBefore,
+    (slotinfo_t*)&_XMLList_addNamespace,
+    (slotinfo_t*)&_XMLList_propertyIsEnumerable,
+    (slotinfo_t*)&_XMLList_comments,
+    (slotinfo_t*)&_XMLList_attributes,
+    (slotinfo_t*)&_XMLList_descendants,
+    (slotinfo_t*)&_XMLList_replace,
+    (slotinfo_t*)&_XMLList_children,
+    (slotinfo_t*)&_XMLList_contains,
+    (slotinfo_t*)&_XMLList_hasSimpleContent,
+    (slotinfo_t*)&_XMLList_elements,
+    (slotinfo_t*)&_XMLList_hasComplexContent,
+    (slotinfo_t*)&_XMLList_insertChildAfter,
+    (slotinfo_t*)&_XMLList_parent,
+    (slotinfo_t*)&_XMLList_length,
+    (slotinfo_t*)&_XMLList_processingInstructions,
+    (slotinfo_t*)&_XMLList_child,
+    (slotinfo_t*)&_XMLList_appendChild,
+    (slotinfo_t*)&_XMLList_valueOf,
+    (slotinfo_t*)&_XMLList_localName,
+    (slotinfo_t*)&_XMLList_inScopeNamespaces,
+    (slotinfo_t*)&_XMLList_hasOwnProperty,
+    (slotinfo_t*)&_XMLList_setNamespace,
+    (slotinfo_t*)&_XMLList_namespaceDeclarations,
+    (slotinfo_t*)&_XMLList_name,
+    (slotinfo_t*)&_XMLList_setChildren,
+    (slotinfo_t*)&_XMLList_attribute,
+    0};
+static slotinfo_t* const _int_members[] = {
+    (slotinfo_t*)&_int_valueOf,
+    (slotinfo_t*)&_int_toString,
+    (slotinfo_t*)&_int_toExponential,
+    (slotinfo_t*)&_int_toFixed,
+    (slotinfo_t*)&_int_toPrecision,
+    0};
+static slotinfo_t* const _int_static_members[] = {
+    (slotinfo_t*)&_int_MAX_VALUE,
+    (slotinfo_t*)&_int_length,
+    (slotinfo_t*)&_int_MIN_VALUE,
+    0};
+static slotinfo_t* const _uint_members[] = {
+    (slotinfo_t*)&_uint_valueOf,
+    (slotinfo_t*)&_uint_toString,
+    (slotinfo_t*)&_uint_toExponential,
+    (slotinfo_t*)&_uint_toFixed,
+    (slotinfo_t*)&_uint_toPrecision,
+    0};
+static slotinfo_t* const _uint_static_members[] = {
+    (slotinfo_t*)&_uint_MAX_VALUE,
+    (slotinfo_t*)&_uint_length,
+    (slotinfo_t*)&_uint_MIN_VALUE,
+    0};
+static slotinfo_t* const adobe_utils_CustomActions_static_members[] = {
+    (slotinfo_t*)&adobe_utils_CustomActions_actionsList,
+    (slotinfo_t*)&adobe_utils_CustomActions_uninstallActions,
+    (slotinfo_t*)&adobe_utils_CustomActions_getActions,
+    (slotinfo_t*)&adobe_utils_CustomActions_installActions,
+    0};
+static slotinfo_t* const adobe_utils_ProductManager_members[] = {
+    (slotinfo_t*)&adobe_utils_ProductManager_running,
+    (slotinfo_t*)&adobe_utils_ProductManager_download,
+    (slotinfo_t*)&adobe_utils_ProductManager_installedVersion,
+    (slotinfo_t*)&adobe_utils_ProductManager_installed,
+    (slotinfo_t*)&adobe_utils_ProductManager_launch,
+    0};
+static slotinfo_t* const adobe_utils_XMLUI_static_members[] = {
+    (slotinfo_t*)&adobe_utils_XMLUI_cancel,
+    (slotinfo_t*)&adobe_utils_XMLUI_setProperty,
+    (slotinfo_t*)&adobe_utils_XMLUI_getProperty,
+    (slotinfo_t*)&adobe_utils_XMLUI_accept,
+    0};
+static slotinfo_t* const flash_accessibility_Accessibility_static_members[] = {
+    (slotinfo_t*)&flash_accessibility_Accessibility_active,
+    (slotinfo_t*)&flash_accessibility_Accessibility_updateProperties,
+    (slotinfo_t*)&flash_accessibility_Accessibility_sendEvent,
+    0};
+static slotinfo_t* const flash_accessibility_AccessibilityImplementation_members[] = {
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_get_accState,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_get_accName,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_get_accSelection,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_accDoDefaultAction,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_get_accFocus,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_get_accDefaultAction,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_accSelect,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_get_accValue,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_stub,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_get_accRole,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_errno,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_isLabeledBy,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_accLocation,
+    (slotinfo_t*)&flash_accessibility_AccessibilityImplementation_getChildIDArray,
+    0};
+static slotinfo_t* const flash_accessibility_AccessibilityProperties_members[] = {
+    (slotinfo_t*)&flash_accessibility_AccessibilityProperties_forceSimple,
+    (slotinfo_t*)&flash_accessibility_AccessibilityProperties_noAutoLabeling,
+    (slotinfo_t*)&flash_accessibility_AccessibilityProperties_description,
+    (slotinfo_t*)&flash_accessibility_AccessibilityProperties_name,
+    (slotinfo_t*)&flash_accessibility_AccessibilityProperties_shortcut,
+    (slotinfo_t*)&flash_accessibility_AccessibilityProperties_silent,
+    0};
+static slotinfo_t* const flash_desktop_Clipboard_members[] = {
+    (slotinfo_t*)&flash_desktop_Clipboard_setDataHandler,
+    (slotinfo_t*)&flash_desktop_Clipboard_setData,
+    (slotinfo_t*)&flash_desktop_Clipboard_formats,
+    (slotinfo_t*)&flash_desktop_Clipboard_clear,
+    (slotinfo_t*)&flash_desktop_Clipboard_getData,
+    (slotinfo_t*)&flash_desktop_Clipboard_hasFormat,
+    (slotinfo_t*)&flash_desktop_Clipboard_clearData,
+    0};
+static slotinfo_t* const flash_desktop_Clipboard_static_members[] = {
+    (slotinfo_t*)&flash_desktop_Clipboard_generalClipboard,
+    0};
+static slotinfo_t* const flash_desktop_ClipboardFormats_static_members[] = {
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_TEXT_FORMAT,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_BITMAP_FORMAT,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_FLASH_PREFIX,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_HTML_FORMAT,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_REFERENCE_PREFIX,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_AIR_PREFIX,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_SERIALIZATION_PREFIX,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_RICH_TEXT_FORMAT,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_URL_FORMAT,
+    (slotinfo_t*)&flash_desktop_ClipboardFormats_FILE_LIST_FORMAT,
+    0};
+static slotinfo_t* const flash_desktop_ClipboardTransferMode_static_members[] = {
+    (slotinfo_t*)&flash_desktop_ClipboardTransferMode_CLONE_ONLY,
+    (slotinfo_t*)&flash_desktop_ClipboardTransferMode_ORIGINAL_PREFERRED,
+    (slotinfo_t*)&flash_desktop_ClipboardTransferMode_CLONE_PREFERRED,
+    (slotinfo_t*)&flash_desktop_ClipboardTransferMode_ORIGINAL_ONLY,
+    0};
+static slotinfo_t* const flash_display_AVM1Movie_members[] = {
+    (slotinfo_t*)&flash_display_AVM1Movie_call,
+    (slotinfo_t*)&flash_display_AVM1Movie_addCallback,
+    0};
+static slotinfo_t* const flash_display_ActionScriptVersion_static_members[] = {
+    (slotinfo_t*)&flash_display_ActionScriptVersion_ACTIONSCRIPT3,
+    (slotinfo_t*)&flash_display_ActionScriptVersion_ACTIONSCRIPT2,
+    0};
+static slotinfo_t* const flash_display_Bitmap_members[] = {
+    (slotinfo_t*)&flash_display_Bitmap_pixelSnapping,
+    (slotinfo_t*)&flash_display_Bitmap_bitmapData,
+    (slotinfo_t*)&flash_display_Bitmap_smoothing,
+    0};
+static slotinfo_t* const flash_display_BitmapData_members[] = {
+    (slotinfo_t*)&flash_display_BitmapData_getPixel32,
+    (slotinfo_t*)&flash_display_BitmapData_draw,
+    (slotinfo_t*)&flash_display_BitmapData_setPixels,
+    (slotinfo_t*)&flash_display_BitmapData_copyPixels,
+    (slotinfo_t*)&flash_display_BitmapData_histogram,
+    (slotinfo_t*)&flash_display_BitmapData_scroll,
+    (slotinfo_t*)&flash_display_BitmapData_transparent,
+    (slotinfo_t*)&flash_display_BitmapData_noise,
+    (slotinfo_t*)&flash_display_BitmapData_threshold,
+    (slotinfo_t*)&flash_display_BitmapData_paletteMap,
+    (slotinfo_t*)&flash_display_BitmapData_perlinNoise,
+    (slotinfo_t*)&flash_display_BitmapData_hitTest,
+    (slotinfo_t*)&flash_display_BitmapData_getPixel,
+    (slotinfo_t*)&flash_display_BitmapData_unlock,
+    (slotinfo_t*)&flash_display_BitmapData_height,
+    (slotinfo_t*)&flash_display_BitmapData_copyChannel,
+    (slotinfo_t*)&flash_display_BitmapData_width,
+    (slotinfo_t*)&flash_display_BitmapData_clone,
+    (slotinfo_t*)&flash_display_BitmapData_colorTransform,
+    (slotinfo_t*)&flash_display_BitmapData_generateFilterRect,
+    (slotinfo_t*)&flash_display_BitmapData_compare,
+    (slotinfo_t*)&flash_display_BitmapData_fillRect,
+    (slotinfo_t*)&flash_display_BitmapData_setVector,
+    (slotinfo_t*)&flash_display_BitmapData_floodFill,
+    (slotinfo_t*)&flash_display_BitmapData_pixelDissolve,
+    (slotinfo_t*)&flash_display_BitmapData_setPixel,
+    (slotinfo_t*)&flash_display_BitmapData_setPixel32,
+    (slotinfo_t*)&flash_display_BitmapData_lock,
+    (slotinfo_t*)&flash_display_BitmapData_getVector,
+    (slotinfo_t*)&flash_display_BitmapData_getColorBoundsRect,
+    (slotinfo_t*)&flash_display_BitmapData_getPixels,
+    (slotinfo_t*)&flash_display_BitmapData_merge,
+    (slotinfo_t*)&flash_display_BitmapData_rect,
+    (slotinfo_t*)&flash_display_BitmapData_applyFilter,
+    (slotinfo_t*)&flash_display_BitmapData_dispose,
+    0};
+static slotinfo_t* const flash_display_BitmapDataChannel_static_members[] = {
+    (slotinfo_t*)&flash_display_BitmapDataChannel_BLUE,
+    (slotinfo_t*)&flash_display_BitmapDataChannel_GREEN,
+    (slotinfo_t*)&flash_display_BitmapDataChannel_ALPHA,
+    (slotinfo_t*)&flash_display_BitmapDataChannel_RED,
+    0};
+static slotinfo_t* const flash_display_BlendMode_static_members[] = {
+    (slotinfo_t*)&flash_display_BlendMode_LAYER,
+    (slotinfo_t*)&flash_display_BlendMode_ERASE,
+    (slotinfo_t*)&flash_display_BlendMode_HARDLIGHT,
+    (slotinfo_t*)&flash_display_BlendMode_OVERLAY,
+    (slotinfo_t*)&flash_display_BlendMode_ALPHA,
+    (slotinfo_t*)&flash_display_BlendMode_SUBTRACT,
+    (slotinfo_t*)&flash_display_BlendMode_INVERT,
+    (slotinfo_t*)&flash_display_BlendMode_DIFFERENCE,
+    (slotinfo_t*)&flash_display_BlendMode_DARKEN,
+    (slotinfo_t*)&flash_display_BlendMode_SHADER,
+    (slotinfo_t*)&flash_display_BlendMode_MULTIPLY,
+    (slotinfo_t*)&flash_display_BlendMode_ADD,
+    (slotinfo_t*)&flash_display_BlendMode_SCREEN,
+    (slotinfo_t*)&flash_display_BlendMode_NORMAL,
+    (slotinfo_t*)&flash_display_BlendMode_LIGHTEN,
+    0};
+static slotinfo_t* const flash_display_CapsStyle_static_members[] = {
+    (slotinfo_t*)&flash_display_CapsStyle_ROUND,
+    (slotinfo_t*)&flash_display_CapsStyle_SQUARE,
+    (slotinfo_t*)&flash_display_CapsStyle_NONE,
+    0};
+static slotinfo_t* const flash_display_ColorCorrection_static_members[] = {
+    (slotinfo_t*)&flash_display_ColorCorrection_OFF,
+    (slotinfo_t*)&flash_display_ColorCorrection_DEFAULT,
+    (slotinfo_t*)&flash_display_ColorCorrection_ON,
+    0};
+static slotinfo_t* const flash_display_ColorCorrectionSupport_static_members[] = {
+    (slotinfo_t*)&flash_display_ColorCorrectionSupport_UNSUPPORTED,
+    (slotinfo_t*)&flash_display_ColorCorrectionSupport_DEFAULT_ON,
+    (slotinfo_t*)&flash_display_ColorCorrectionSupport_DEFAULT_OFF,
+    0};
+static slotinfo_t* const flash_display_DisplayObject_members[] = {
+    (slotinfo_t*)&flash_display_DisplayObject_rotation,
+    (slotinfo_t*)&flash_display_DisplayObject_filters,
+    (slotinfo_t*)&flash_display_DisplayObject_rotationZ,
+    (slotinfo_t*)&flash_display_DisplayObject_accessibilityProperties,
+    (slotinfo_t*)&flash_display_DisplayObject_mouseX,
+    (slotinfo_t*)&flash_display_DisplayObject_root,
+    (slotinfo_t*)&flash_display_DisplayObject_stage,
+    (slotinfo_t*)&flash_display_DisplayObject_rotationY,
+    (slotinfo_t*)&flash_display_DisplayObject_scaleZ,
+    (slotinfo_t*)&flash_display_DisplayObject_local3DToGlobal,
+    (slotinfo_t*)&flash_display_DisplayObject_loaderInfo,
+    (slotinfo_t*)&flash_display_DisplayObject_cacheAsBitmap,
+    (slotinfo_t*)&flash_display_DisplayObject_transform,
+    (slotinfo_t*)&flash_display_DisplayObject_scaleY,
+    (slotinfo_t*)&flash_display_DisplayObject_height,
+    (slotinfo_t*)&flash_display_DisplayObject_rotationX,
+    (slotinfo_t*)&flash_display_DisplayObject_scrollRect,
+    (slotinfo_t*)&flash_display_DisplayObject_width,
+    (slotinfo_t*)&flash_display_DisplayObject_scale9Grid,
+    (slotinfo_t*)&flash_display_DisplayObject_parent,
+    (slotinfo_t*)&flash_display_DisplayObject_hitTestObject,
+    (slotinfo_t*)&flash_display_DisplayObject_hitTestPoint,
+    (slotinfo_t*)&flash_display_DisplayObject_alpha,
+    (slotinfo_t*)&flash_display_DisplayObject_getRect,
+    (slotinfo_t*)&flash_display_DisplayObject_opaqueBackground,
+    (slotinfo_t*)&flash_display_DisplayObject_globalToLocal3D,
+    (slotinfo_t*)&flash_display_DisplayObject_visible,
+    (slotinfo_t*)&flash_display_DisplayObject_blendMode,
+    (slotinfo_t*)&flash_display_DisplayObject_scaleX,
+    (slotinfo_t*)&flash_display_DisplayObject_globalToLocal,
+    (slotinfo_t*)&flash_display_DisplayObject_localToGlobal,
+    (slotinfo_t*)&flash_display_DisplayObject_z,
+    (slotinfo_t*)&flash_display_DisplayObject_name,
+    (slotinfo_t*)&flash_display_DisplayObject_getBounds,
+    (slotinfo_t*)&flash_display_DisplayObject_mask,
+    (slotinfo_t*)&flash_display_DisplayObject_mouseY,
+    (slotinfo_t*)&flash_display_DisplayObject_x,
+    (slotinfo_t*)&flash_display_DisplayObject_y,
+    0};
+static slotinfo_t* const flash_display_DisplayObjectContainer_members[] = {
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_addChild,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_getObjectsUnderPoint,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_removeChildAt,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_swapChildren,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_areInaccessibleObjectsUnderPoint,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_setChildIndex,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_numChildren,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_getChildIndex,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_getChildAt,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_removeChild,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_addChildAt,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_contains,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_getChildByName,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_swapChildrenAt,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_mouseChildren,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_tabChildren,
+    (slotinfo_t*)&flash_display_DisplayObjectContainer_textSnapshot,
+    0};
+static slotinfo_t* const flash_display_FrameLabel_members[] = {
+    (slotinfo_t*)&flash_display_FrameLabel_frame,
+    (slotinfo_t*)&flash_display_FrameLabel_name,
+    0};
+static slotinfo_t* const flash_display_GradientType_static_members[] = {
+    (slotinfo_t*)&flash_display_GradientType_LINEAR,
+    (slotinfo_t*)&flash_display_GradientType_RADIAL,
+    0};
+static slotinfo_t* const flash_display_Graphics_members[] = {
+    (slotinfo_t*)&flash_display_Graphics_drawPath,
+    (slotinfo_t*)&flash_display_Graphics_drawEllipse,
+    (slotinfo_t*)&flash_display_Graphics_drawRoundRectComplex,
+    (slotinfo_t*)&flash_display_Graphics_moveTo,
+    (slotinfo_t*)&flash_display_Graphics_lineShaderStyle,
+    (slotinfo_t*)&flash_display_Graphics_beginFill,
+    (slotinfo_t*)&flash_display_Graphics_beginGradientFill,
+    (slotinfo_t*)&flash_display_Graphics_drawGraphicsData,
+    (slotinfo_t*)&flash_display_Graphics_lineGradientStyle,
+    (slotinfo_t*)&flash_display_Graphics_drawRoundRect,
+    (slotinfo_t*)&flash_display_Graphics_beginBitmapFill,
+    (slotinfo_t*)&flash_display_Graphics_lineStyle,
+    (slotinfo_t*)&flash_display_Graphics_lineTo,
+    (slotinfo_t*)&flash_display_Graphics_endFill,
+    (slotinfo_t*)&flash_display_Graphics_copyFrom,
+    (slotinfo_t*)&flash_display_Graphics_lineBitmapStyle,
+    (slotinfo_t*)&flash_display_Graphics_curveTo,
+    (slotinfo_t*)&flash_display_Graphics_clear,
+    (slotinfo_t*)&flash_display_Graphics_drawCircle,
+    (slotinfo_t*)&flash_display_Graphics_beginShaderFill,
+    (slotinfo_t*)&flash_display_Graphics_drawTriangles,
+    (slotinfo_t*)&flash_display_Graphics_drawRect,
+    0};
+static slotinfo_t* const flash_display_GraphicsBitmapFill_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsBitmapFill_smooth,
+    (slotinfo_t*)&flash_display_GraphicsBitmapFill_repeat,
+    (slotinfo_t*)&flash_display_GraphicsBitmapFill_bitmapData,
+    (slotinfo_t*)&flash_display_GraphicsBitmapFill_matrix,
+    0};
+static slotinfo_t* const flash_display_GraphicsGradientFill_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsGradientFill_interpolationMethod,
+    (slotinfo_t*)&flash_display_GraphicsGradientFill_focalPointRatio,
+    (slotinfo_t*)&flash_display_GraphicsGradientFill_colors,
+    (slotinfo_t*)&flash_display_GraphicsGradientFill_matrix,
+    (slotinfo_t*)&flash_display_GraphicsGradientFill_type,
+    (slotinfo_t*)&flash_display_GraphicsGradientFill_ratios,
+    (slotinfo_t*)&flash_display_GraphicsGradientFill_spreadMethod,
+    (slotinfo_t*)&flash_display_GraphicsGradientFill_alphas,
+    0};
+static slotinfo_t* const flash_display_GraphicsPath_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsPath_wideMoveTo,
+    (slotinfo_t*)&flash_display_GraphicsPath_winding,
+    (slotinfo_t*)&flash_display_GraphicsPath_moveTo,
+    (slotinfo_t*)&flash_display_GraphicsPath_wideLineTo,
+    (slotinfo_t*)&flash_display_GraphicsPath_commands,
+    (slotinfo_t*)&flash_display_GraphicsPath_curveTo,
+    (slotinfo_t*)&flash_display_GraphicsPath_lineTo,
+    (slotinfo_t*)&flash_display_GraphicsPath_data,
+    0};
+static slotinfo_t* const flash_display_GraphicsPathCommand_static_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsPathCommand_NO_OP,
+    (slotinfo_t*)&flash_display_GraphicsPathCommand_MOVE_TO,
+    (slotinfo_t*)&flash_display_GraphicsPathCommand_WIDE_MOVE_TO,
+    (slotinfo_t*)&flash_display_GraphicsPathCommand_CURVE_TO,
+    (slotinfo_t*)&flash_display_GraphicsPathCommand_LINE_TO,
+    (slotinfo_t*)&flash_display_GraphicsPathCommand_WIDE_LINE_TO,
+    0};
+static slotinfo_t* const flash_display_GraphicsPathWinding_static_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsPathWinding_EVEN_ODD,
+    (slotinfo_t*)&flash_display_GraphicsPathWinding_NON_ZERO,
+    0};
+static slotinfo_t* const flash_display_GraphicsShaderFill_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsShaderFill_shader,
+    (slotinfo_t*)&flash_display_GraphicsShaderFill_matrix,
+    0};
+static slotinfo_t* const flash_display_GraphicsSolidFill_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsSolidFill_color,
+    (slotinfo_t*)&flash_display_GraphicsSolidFill_alpha,
+    0};
+static slotinfo_t* const flash_display_GraphicsStroke_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsStroke_scaleMode,
+    (slotinfo_t*)&flash_display_GraphicsStroke_miterLimit,
+    (slotinfo_t*)&flash_display_GraphicsStroke_pixelHinting,
+    (slotinfo_t*)&flash_display_GraphicsStroke_fill,
+    (slotinfo_t*)&flash_display_GraphicsStroke_thickness,
+    (slotinfo_t*)&flash_display_GraphicsStroke_joints,
+    (slotinfo_t*)&flash_display_GraphicsStroke_caps,
+    0};
+static slotinfo_t* const flash_display_GraphicsTrianglePath_members[] = {
+    (slotinfo_t*)&flash_display_GraphicsTrianglePath_culling,
+    (slotinfo_t*)&flash_display_GraphicsTrianglePath_vertices,
+    (slotinfo_t*)&flash_display_GraphicsTrianglePath_indices,
+    (slotinfo_t*)&flash_display_GraphicsTrianglePath_uvtData,
+    0};
+static slotinfo_t* const flash_display_InteractiveObject_members[] = {
+    (slotinfo_t*)&flash_display_InteractiveObject_tabIndex,
+    (slotinfo_t*)&flash_display_InteractiveObject_doubleClickEnabled,
+    (slotinfo_t*)&flash_display_InteractiveObject_tabEnabled,
+    (slotinfo_t*)&flash_display_InteractiveObject_mouseEnabled,
+    (slotinfo_t*)&flash_display_InteractiveObject_contextMenu,
+    (slotinfo_t*)&flash_display_InteractiveObject_focusRect,
+    (slotinfo_t*)&flash_display_InteractiveObject_accessibilityImplementation,
+    0};
+static slotinfo_t* const flash_display_InterpolationMethod_static_members[] = {
+    (slotinfo_t*)&flash_display_InterpolationMethod_RGB,
+    (slotinfo_t*)&flash_display_InterpolationMethod_LINEAR_RGB,
+    0};
+static slotinfo_t* const flash_display_JointStyle_static_members[] = {
+    (slotinfo_t*)&flash_display_JointStyle_ROUND,
+    (slotinfo_t*)&flash_display_JointStyle_MITER,
+    (slotinfo_t*)&flash_display_JointStyle_BEVEL,
+    0};
+static slotinfo_t* const flash_display_LineScaleMode_static_members[] = {
+    (slotinfo_t*)&flash_display_LineScaleMode_NORMAL,
+    (slotinfo_t*)&flash_display_LineScaleMode_VERTICAL,
+    (slotinfo_t*)&flash_display_LineScaleMode_NONE,
+    (slotinfo_t*)&flash_display_LineScaleMode_HORIZONTAL,
+    0};
+static slotinfo_t* const flash_display_Loader_members[] = {
+    (slotinfo_t*)&flash_display_Loader_content,
+    (slotinfo_t*)&flash_display_Loader_unloadAndStop,
+    (slotinfo_t*)&flash_display_Loader_unload,
+    (slotinfo_t*)&flash_display_Loader_removeChildAt,
+    (slotinfo_t*)&flash_display_Loader_addChildAt,
+    (slotinfo_t*)&flash_display_Loader_contentLoaderInfo,
+    (slotinfo_t*)&flash_display_Loader_loadBytes,
+    (slotinfo_t*)&flash_display_Loader_removeChild,
+    (slotinfo_t*)&flash_display_Loader_load,
+    (slotinfo_t*)&flash_display_Loader_addChild,
+    (slotinfo_t*)&flash_display_Loader_close,
+    (slotinfo_t*)&flash_display_Loader_setChildIndex,
+    0};
+static slotinfo_t* const flash_display_LoaderInfo_members[] = {
+    (slotinfo_t*)&flash_display_LoaderInfo_actionScriptVersion,
+    (slotinfo_t*)&flash_display_LoaderInfo_contentType,
+    (slotinfo_t*)&flash_display_LoaderInfo_sameDomain,
+    (slotinfo_t*)&flash_display_LoaderInfo_bytesTotal,
+    (slotinfo_t*)&flash_display_LoaderInfo_loaderURL,
+    (slotinfo_t*)&flash_display_LoaderInfo_width,
+    (slotinfo_t*)&flash_display_LoaderInfo_dispatchEvent,
+    (slotinfo_t*)&flash_display_LoaderInfo_height,
+    (slotinfo_t*)&flash_display_LoaderInfo_frameRate,
+    (slotinfo_t*)&flash_display_LoaderInfo_parameters,
+    (slotinfo_t*)&flash_display_LoaderInfo_bytesLoaded,
+    (slotinfo_t*)&flash_display_LoaderInfo_url,
+    (slotinfo_t*)&flash_display_LoaderInfo_content,
+    (slotinfo_t*)&flash_display_LoaderInfo_swfVersion,
+    (slotinfo_t*)&flash_display_LoaderInfo_bytes,
+    (slotinfo_t*)&flash_display_LoaderInfo_loader,
+    (slotinfo_t*)&flash_display_LoaderInfo_applicationDomain,
+    (slotinfo_t*)&flash_display_LoaderInfo_parentAllowsChild,
+    (slotinfo_t*)&flash_display_LoaderInfo_childAllowsParent,
+    (slotinfo_t*)&flash_display_LoaderInfo_sharedEvents,
+    0};
+static slotinfo_t* const flash_display_LoaderInfo_static_members[] = {
+    (slotinfo_t*)&flash_display_LoaderInfo_getLoaderInfoByDefinition,
+    0};
+static slotinfo_t* const flash_display_MovieClip_members[] = {
+    (slotinfo_t*)&flash_display_MovieClip_prevScene,
+    (slotinfo_t*)&flash_display_MovieClip_gotoAndPlay,
+    (slotinfo_t*)&flash_display_MovieClip_currentLabels,
+    (slotinfo_t*)&flash_display_MovieClip_nextFrame,
+    (slotinfo_t*)&flash_display_MovieClip_currentScene,
+    (slotinfo_t*)&flash_display_MovieClip_enabled,
+    (slotinfo_t*)&flash_display_MovieClip_currentFrameLabel,
+    (slotinfo_t*)&flash_display_MovieClip_play,
+    (slotinfo_t*)&flash_display_MovieClip_framesLoaded,
+    (slotinfo_t*)&flash_display_MovieClip_scenes,
+    (slotinfo_t*)&flash_display_MovieClip_addFrameScript,
+    (slotinfo_t*)&flash_display_MovieClip_currentLabel,
+    (slotinfo_t*)&flash_display_MovieClip_prevFrame,
+    (slotinfo_t*)&flash_display_MovieClip_gotoAndStop,
+    (slotinfo_t*)&flash_display_MovieClip_currentFrame,
+    (slotinfo_t*)&flash_display_MovieClip_nextScene,
+    (slotinfo_t*)&flash_display_MovieClip_totalFrames,
+    (slotinfo_t*)&flash_display_MovieClip_trackAsMenu,
+    (slotinfo_t*)&flash_display_MovieClip_stop,
+    0};
+static slotinfo_t* const flash_display_PixelSnapping_static_members[] = {
+    (slotinfo_t*)&flash_display_PixelSnapping_AUTO,
+    (slotinfo_t*)&flash_display_PixelSnapping_NEVER,
+    (slotinfo_t*)&flash_display_PixelSnapping_ALWAYS,
+    0};
+static slotinfo_t* const flash_display_SWFVersion_static_members[] = {
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH4,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH7,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH8,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH3,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH6,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH9,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH2,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH5,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH10,
+    (slotinfo_t*)&flash_display_SWFVersion_FLASH1,
+    0};
+static slotinfo_t* const flash_display_Scene_members[] = {
+    (slotinfo_t*)&flash_display_Scene_numFrames,
+    (slotinfo_t*)&flash_display_Scene_labels,
+    (slotinfo_t*)&flash_display_Scene_name,
+    0};
+static slotinfo_t* const flash_display_Shader_members[] = {
+    (slotinfo_t*)&flash_display_Shader_precisionHint,
+    (slotinfo_t*)&flash_display_Shader_data,
+    0};
+static slotinfo_t* const flash_display_ShaderInput_members[] = {
+    (slotinfo_t*)&flash_display_ShaderInput_width,
+    (slotinfo_t*)&flash_display_ShaderInput_input,
+    (slotinfo_t*)&flash_display_ShaderInput_height,
+    (slotinfo_t*)&flash_display_ShaderInput_index,
+    (slotinfo_t*)&flash_display_ShaderInput_channels,
+    0};
+static slotinfo_t* const flash_display_ShaderJob_members[] = {
+    (slotinfo_t*)&flash_display_ShaderJob_cancel,
+    (slotinfo_t*)&flash_display_ShaderJob_width,
+    (slotinfo_t*)&flash_display_ShaderJob_start,
+    (slotinfo_t*)&flash_display_ShaderJob_shader,
+    (slotinfo_t*)&flash_display_ShaderJob_height,
+    (slotinfo_t*)&flash_display_ShaderJob_target,
+    (slotinfo_t*)&flash_display_ShaderJob_progress,
+    0};
+static slotinfo_t* const flash_display_ShaderParameter_members[] = {
+    (slotinfo_t*)&flash_display_ShaderParameter_value,
+    (slotinfo_t*)&flash_display_ShaderParameter_index,
+    (slotinfo_t*)&flash_display_ShaderParameter_type,
+    0};
+static slotinfo_t* const flash_display_ShaderParameterType_static_members[] = {
+    (slotinfo_t*)&flash_display_ShaderParameterType_FLOAT,
+    (slotinfo_t*)&flash_display_ShaderParameterType_BOOL,
+    (slotinfo_t*)&flash_display_ShaderParameterType_FLOAT2,
+    (slotinfo_t*)&flash_display_ShaderParameterType_MATRIX2X2,
+    (slotinfo_t*)&flash_display_ShaderParameterType_INT,
+    (slotinfo_t*)&flash_display_ShaderParameterType_INT4,
+    (slotinfo_t*)&flash_display_ShaderParameterType_MATRIX4X4,
+    (slotinfo_t*)&flash_display_ShaderParameterType_FLOAT3,
+    (slotinfo_t*)&flash_display_ShaderParameterType_BOOL2,
+    (slotinfo_t*)&flash_display_ShaderParameterType_INT3,
+    (slotinfo_t*)&flash_display_ShaderParameterType_BOOL3,
+    (slotinfo_t*)&flash_display_ShaderParameterType_BOOL4,
+    (slotinfo_t*)&flash_display_ShaderParameterType_FLOAT4,
+    (slotinfo_t*)&flash_display_ShaderParameterType_INT2,
+    (slotinfo_t*)&flash_display_ShaderParameterType_MATRIX3X3,
+    0};
+static slotinfo_t* const flash_display_ShaderPrecision_static_members[] = {
+    (slotinfo_t*)&flash_display_ShaderPrecision_FULL,
+    (slotinfo_t*)&flash_display_ShaderPrecision_FAST,
+    0};
+static slotinfo_t* const flash_display_Shape_members[] = {
+    (slotinfo_t*)&flash_display_Shape_graphics,
+    0};
+static slotinfo_t* const flash_display_SimpleButton_members[] = {
+    (slotinfo_t*)&flash_display_SimpleButton_overState,
+    (slotinfo_t*)&flash_display_SimpleButton_downState,
+    (slotinfo_t*)&flash_display_SimpleButton_enabled,
+    (slotinfo_t*)&flash_display_SimpleButton_trackAsMenu,
+    (slotinfo_t*)&flash_display_SimpleButton_soundTransform,
+    (slotinfo_t*)&flash_display_SimpleButton_useHandCursor,
+    (slotinfo_t*)&flash_display_SimpleButton_upState,
+    (slotinfo_t*)&flash_display_SimpleButton_hitTestState,
+    0};
+static slotinfo_t* const flash_display_SpreadMethod_static_members[] = {
+    (slotinfo_t*)&flash_display_SpreadMethod_REFLECT,
+    (slotinfo_t*)&flash_display_SpreadMethod_REPEAT,
+    (slotinfo_t*)&flash_display_SpreadMethod_PAD,
+    0};
+static slotinfo_t* const flash_display_Sprite_members[] = {
+    (slotinfo_t*)&flash_display_Sprite_stopDrag,
+    (slotinfo_t*)&flash_display_Sprite_buttonMode,
+    (slotinfo_t*)&flash_display_Sprite_soundTransform,
+    (slotinfo_t*)&flash_display_Sprite_hitArea,
+    (slotinfo_t*)&flash_display_Sprite_useHandCursor,
+    (slotinfo_t*)&flash_display_Sprite_graphics,
+    (slotinfo_t*)&flash_display_Sprite_startDrag,
+    (slotinfo_t*)&flash_display_Sprite_dropTarget,
+    0};
+static slotinfo_t* const flash_display_Stage_members[] = {
+    (slotinfo_t*)&flash_display_Stage_setChildIndex,
+    (slotinfo_t*)&flash_display_Stage_stageFocusRect,
+    (slotinfo_t*)&flash_display_Stage_frameRate,
+    (slotinfo_t*)&flash_display_Stage_invalidate,
+    (slotinfo_t*)&flash_display_Stage_textSnapshot,
+    (slotinfo_t*)&flash_display_Stage_quality,
+    (slotinfo_t*)&flash_display_Stage_willTrigger,
+    (slotinfo_t*)&flash_display_Stage_dispatchEvent,
+    (slotinfo_t*)&flash_display_Stage_isFocusInaccessible,
+    (slotinfo_t*)&flash_display_Stage_removeChildAt,
+    (slotinfo_t*)&flash_display_Stage_fullScreenWidth,
+    (slotinfo_t*)&flash_display_Stage_addChildAt,
+    (slotinfo_t*)&flash_display_Stage_height,
+    (slotinfo_t*)&flash_display_Stage_fullScreenSourceRect,
+    (slotinfo_t*)&flash_display_Stage_width,
+    (slotinfo_t*)&flash_display_Stage_addChild,
+    (slotinfo_t*)&flash_display_Stage_numChildren,
+    (slotinfo_t*)&flash_display_Stage_mouseChildren,
+    (slotinfo_t*)&flash_display_Stage_swapChildrenAt,
+    (slotinfo_t*)&flash_display_Stage_showDefaultContextMenu,
+    (slotinfo_t*)&flash_display_Stage_addEventListener,
+    (slotinfo_t*)&flash_display_Stage_stageHeight,
+    (slotinfo_t*)&flash_display_Stage_fullScreenHeight,
+    (slotinfo_t*)&flash_display_Stage_align,
+    (slotinfo_t*)&flash_display_Stage_hasEventListener,
+    (slotinfo_t*)&flash_display_Stage_displayState,
+    (slotinfo_t*)&flash_display_Stage_scaleMode,
+    (slotinfo_t*)&flash_display_Stage_tabChildren,
+    (slotinfo_t*)&flash_display_Stage_focus,
+    (slotinfo_t*)&flash_display_Stage_colorCorrection,
+    (slotinfo_t*)&flash_display_Stage_colorCorrectionSupport,
+    (slotinfo_t*)&flash_display_Stage_stageWidth,
+    0};
+static slotinfo_t* const flash_display_StageAlign_static_members[] = {
+    (slotinfo_t*)&flash_display_StageAlign_RIGHT,
+    (slotinfo_t*)&flash_display_StageAlign_BOTTOM,
+    (slotinfo_t*)&flash_display_StageAlign_BOTTOM_LEFT,
+    (slotinfo_t*)&flash_display_StageAlign_TOP_RIGHT,
+    (slotinfo_t*)&flash_display_StageAlign_TOP,
+    (slotinfo_t*)&flash_display_StageAlign_LEFT,
+    (slotinfo_t*)&flash_display_StageAlign_BOTTOM_RIGHT,
+    (slotinfo_t*)&flash_display_StageAlign_TOP_LEFT,
+    0};
+static slotinfo_t* const flash_display_StageDisplayState_static_members[] = {
+    (slotinfo_t*)&flash_display_StageDisplayState_NORMAL,
+    (slotinfo_t*)&flash_display_StageDisplayState_FULL_SCREEN,
+    0};
+static slotinfo_t* const flash_display_StageQuality_static_members[] = {
+    (slotinfo_t*)&flash_display_StageQuality_LOW,
+    (slotinfo_t*)&flash_display_StageQuality_MEDIUM,
+    (slotinfo_t*)&flash_display_StageQuality_HIGH,
+    (slotinfo_t*)&flash_display_StageQuality_BEST,
+    0};
+static slotinfo_t* const flash_display_StageScaleMode_static_members[] = {
+    (slotinfo_t*)&flash_display_StageScaleMode_SHOW_ALL,
+    (slotinfo_t*)&flash_display_StageScaleMode_NO_BORDER,
+    (slotinfo_t*)&flash_display_StageScaleMode_EXACT_FIT,
+    (slotinfo_t*)&flash_display_StageScaleMode_NO_SCALE,
+    0};
+static slotinfo_t* const flash_display_TriangleCulling_static_members[] = {
+    (slotinfo_t*)&flash_display_TriangleCulling_POSITIVE,
+    (slotinfo_t*)&flash_display_TriangleCulling_NEGATIVE,
+    (slotinfo_t*)&flash_display_TriangleCulling_NONE,
+    0};
+static slotinfo_t* const flash_events_ActivityEvent_members[] = {
+    (slotinfo_t*)&flash_events_ActivityEvent_toString,
+    (slotinfo_t*)&flash_events_ActivityEvent_activating,
+    (slotinfo_t*)&flash_events_ActivityEvent_clone,
+    0};
+static slotinfo_t* const flash_events_ActivityEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_ActivityEvent_ACTIVITY,
+    0};
+static slotinfo_t* const flash_events_AsyncErrorEvent_members[] = {
+    (slotinfo_t*)&flash_events_AsyncErrorEvent_toString,
+    (slotinfo_t*)&flash_events_AsyncErrorEvent_error,
+    (slotinfo_t*)&flash_events_AsyncErrorEvent_clone,
+    0};
+static slotinfo_t* const flash_events_AsyncErrorEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_AsyncErrorEvent_ASYNC_ERROR,
+    0};
+static slotinfo_t* const flash_events_ContextMenuEvent_members[] = {
+    (slotinfo_t*)&flash_events_ContextMenuEvent_mouseTarget,
+    (slotinfo_t*)&flash_events_ContextMenuEvent_isMouseTargetInaccessible,
+    (slotinfo_t*)&flash_events_ContextMenuEvent_toString,
+    (slotinfo_t*)&flash_events_ContextMenuEvent_contextMenuOwner,
+    (slotinfo_t*)&flash_events_ContextMenuEvent_clone,
+    0};
+static slotinfo_t* const flash_events_ContextMenuEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_ContextMenuEvent_MENU_SELECT,
+    (slotinfo_t*)&flash_events_ContextMenuEvent_MENU_ITEM_SELECT,
+    0};
+static slotinfo_t* const flash_events_DataEvent_members[] = {
+    (slotinfo_t*)&flash_events_DataEvent_toString,
+    (slotinfo_t*)&flash_events_DataEvent_clone,
+    (slotinfo_t*)&flash_events_DataEvent_data,
+    0};
+static slotinfo_t* const flash_events_DataEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_DataEvent_DATA,
+    (slotinfo_t*)&flash_events_DataEvent_UPLOAD_COMPLETE_DATA,
+    0};
+static slotinfo_t* const flash_events_ErrorEvent_members[] = {
+    (slotinfo_t*)&flash_events_ErrorEvent_toString,
+    (slotinfo_t*)&flash_events_ErrorEvent_clone,
+    0};
+static slotinfo_t* const flash_events_ErrorEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_ErrorEvent_ERROR,
+    0};
+static slotinfo_t* const flash_events_Event_members[] = {
+    (slotinfo_t*)&flash_events_Event_type,
+    (slotinfo_t*)&flash_events_Event_cancelable,
+    (slotinfo_t*)&flash_events_Event_isDefaultPrevented,
+    (slotinfo_t*)&flash_events_Event_target,
+    (slotinfo_t*)&flash_events_Event_eventPhase,
+    (slotinfo_t*)&flash_events_Event_currentTarget,
+    (slotinfo_t*)&flash_events_Event_toString,
+    (slotinfo_t*)&flash_events_Event_stopImmediatePropagation,
+    (slotinfo_t*)&flash_events_Event_bubbles,
+    (slotinfo_t*)&flash_events_Event_stopPropagation,
+    (slotinfo_t*)&flash_events_Event_clone,
+    (slotinfo_t*)&flash_events_Event_preventDefault,
+    (slotinfo_t*)&flash_events_Event_formatToString,
+    0};
+static slotinfo_t* const flash_events_Event_static_members[] = {
+    (slotinfo_t*)&flash_events_Event_REMOVED_FROM_STAGE,
+    (slotinfo_t*)&flash_events_Event_CLEAR,
+    (slotinfo_t*)&flash_events_Event_OPEN,
+    (slotinfo_t*)&flash_events_Event_TAB_CHILDREN_CHANGE,
+    (slotinfo_t*)&flash_events_Event_DEACTIVATE,
+    (slotinfo_t*)&flash_events_Event_ACTIVATE,
+    (slotinfo_t*)&flash_events_Event_SOUND_COMPLETE,
+    (slotinfo_t*)&flash_events_Event_CANCEL,
+    (slotinfo_t*)&flash_events_Event_REMOVED,
+    (slotinfo_t*)&flash_events_Event_INIT,
+    (slotinfo_t*)&flash_events_Event_FRAME_CONSTRUCTED,
+    (slotinfo_t*)&flash_events_Event_SCROLL,
+    (slotinfo_t*)&flash_events_Event_TAB_INDEX_CHANGE,
+    (slotinfo_t*)&flash_events_Event_CHANGE,
+    (slotinfo_t*)&flash_events_Event_ADDED_TO_STAGE,
+    (slotinfo_t*)&flash_events_Event_UNLOAD,
+    (slotinfo_t*)&flash_events_Event_SELECT,
+    (slotinfo_t*)&flash_events_Event_CONNECT,
+    (slotinfo_t*)&flash_events_Event_CUT,
+    (slotinfo_t*)&flash_events_Event_PASTE,
+    (slotinfo_t*)&flash_events_Event_ADDED,
+    (slotinfo_t*)&flash_events_Event_ID3,
+    (slotinfo_t*)&flash_events_Event_ENTER_FRAME,
+    (slotinfo_t*)&flash_events_Event_RENDER,
+    (slotinfo_t*)&flash_events_Event_EXIT_FRAME,
+    (slotinfo_t*)&flash_events_Event_RESIZE,
+    (slotinfo_t*)&flash_events_Event_FULLSCREEN,
+    (slotinfo_t*)&flash_events_Event_MOUSE_LEAVE,
+    (slotinfo_t*)&flash_events_Event_CLOSE,
+    (slotinfo_t*)&flash_events_Event_SELECT_ALL,
+    (slotinfo_t*)&flash_events_Event_TAB_ENABLED_CHANGE,
+    (slotinfo_t*)&flash_events_Event_COPY,
+    (slotinfo_t*)&flash_events_Event_COMPLETE,
+    0};
+static slotinfo_t* const flash_events_EventDispatcher_members[] = {
+    (slotinfo_t*)&flash_events_EventDispatcher_willTrigger,
+    (slotinfo_t*)&flash_events_EventDispatcher_toString,
+    (slotinfo_t*)&flash_events_EventDispatcher_removeEventListener,
+    (slotinfo_t*)&flash_events_EventDispatcher_hasEventListener,
+    (slotinfo_t*)&flash_events_EventDispatcher_addEventListener,
+    (slotinfo_t*)&flash_events_EventDispatcher_dispatchEvent,
+    0};
+static slotinfo_t* const flash_events_EventPhase_static_members[] = {
+    (slotinfo_t*)&flash_events_EventPhase_BUBBLING_PHASE,
+    (slotinfo_t*)&flash_events_EventPhase_CAPTURING_PHASE,
+    (slotinfo_t*)&flash_events_EventPhase_AT_TARGET,
+    0};
+static slotinfo_t* const flash_events_FocusEvent_members[] = {
+    (slotinfo_t*)&flash_events_FocusEvent_keyCode,
+    (slotinfo_t*)&flash_events_FocusEvent_toString,
+    (slotinfo_t*)&flash_events_FocusEvent_isRelatedObjectInaccessible,
+    (slotinfo_t*)&flash_events_FocusEvent_clone,
+    (slotinfo_t*)&flash_events_FocusEvent_shiftKey,
+    (slotinfo_t*)&flash_events_FocusEvent_relatedObject,
+    0};
+static slotinfo_t* const flash_events_FocusEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_FocusEvent_FOCUS_IN,
+    (slotinfo_t*)&flash_events_FocusEvent_FOCUS_OUT,
+    (slotinfo_t*)&flash_events_FocusEvent_KEY_FOCUS_CHANGE,
+    (slotinfo_t*)&flash_events_FocusEvent_MOUSE_FOCUS_CHANGE,
+    0};
+static slotinfo_t* const flash_events_FullScreenEvent_members[] = {
+    (slotinfo_t*)&flash_events_FullScreenEvent_toString,
+    (slotinfo_t*)&flash_events_FullScreenEvent_clone,
+    (slotinfo_t*)&flash_events_FullScreenEvent_fullScreen,
+    0};
+static slotinfo_t* const flash_events_FullScreenEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_FullScreenEvent_FULL_SCREEN,
+    0};
+static slotinfo_t* const flash_events_HTTPStatusEvent_members[] = {
+    (slotinfo_t*)&flash_events_HTTPStatusEvent_toString,
+    (slotinfo_t*)&flash_events_HTTPStatusEvent_clone,
+    (slotinfo_t*)&flash_events_HTTPStatusEvent_status,
+    0};
+static slotinfo_t* const flash_events_HTTPStatusEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_HTTPStatusEvent_HTTP_STATUS,
+    0};
+static slotinfo_t* const flash_events_IEventDispatcher_members[] = {
+    (slotinfo_t*)&flash_events_IEventDispatcher_willTrigger,
+    (slotinfo_t*)&flash_events_IEventDispatcher_removeEventListener,
+    (slotinfo_t*)&flash_events_IEventDispatcher_hasEventListener,
+    (slotinfo_t*)&flash_events_IEventDispatcher_addEventListener,
+    (slotinfo_t*)&flash_events_IEventDispatcher_dispatchEvent,
+    0};
+static slotinfo_t* const flash_events_IMEEvent_members[] = {
+    (slotinfo_t*)&flash_events_IMEEvent_toString,
+    (slotinfo_t*)&flash_events_IMEEvent_clone,
+    0};
+static slotinfo_t* const flash_events_IMEEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_IMEEvent_IME_COMPOSITION,
+    0};
+static slotinfo_t* const flash_events_IOErrorEvent_members[] = {
+    (slotinfo_t*)&flash_events_IOErrorEvent_toString,
+    (slotinfo_t*)&flash_events_IOErrorEvent_clone,
+    0};
+static slotinfo_t* const flash_events_IOErrorEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_IOErrorEvent_IO_ERROR,
+    (slotinfo_t*)&flash_events_IOErrorEvent_VERIFY_ERROR,
+    (slotinfo_t*)&flash_events_IOErrorEvent_NETWORK_ERROR,
+    (slotinfo_t*)&flash_events_IOErrorEvent_DISK_ERROR,
+    0};
+static slotinfo_t* const flash_events_KeyboardEvent_members[] = {
+    (slotinfo_t*)&flash_events_KeyboardEvent_shiftKey,
+    (slotinfo_t*)&flash_events_KeyboardEvent_keyCode,
+    (slotinfo_t*)&flash_events_KeyboardEvent_keyLocation,
+    (slotinfo_t*)&flash_events_KeyboardEvent_updateAfterEvent,
+    (slotinfo_t*)&flash_events_KeyboardEvent_toString,
+    (slotinfo_t*)&flash_events_KeyboardEvent_altKey,
+    (slotinfo_t*)&flash_events_KeyboardEvent_ctrlKey,
+    (slotinfo_t*)&flash_events_KeyboardEvent_clone,
+    (slotinfo_t*)&flash_events_KeyboardEvent_charCode,
+    0};
+static slotinfo_t* const flash_events_KeyboardEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_KeyboardEvent_KEY_DOWN,
+    (slotinfo_t*)&flash_events_KeyboardEvent_KEY_UP,
+    0};
+static slotinfo_t* const flash_events_MouseEvent_members[] = {
+    (slotinfo_t*)&flash_events_MouseEvent_localY,
+    (slotinfo_t*)&flash_events_MouseEvent_updateAfterEvent,
+    (slotinfo_t*)&flash_events_MouseEvent_delta,
+    (slotinfo_t*)&flash_events_MouseEvent_stageX,
+    (slotinfo_t*)&flash_events_MouseEvent_toString,
+    (slotinfo_t*)&flash_events_MouseEvent_relatedObject,
+    (slotinfo_t*)&flash_events_MouseEvent_isRelatedObjectInaccessible,
+    (slotinfo_t*)&flash_events_MouseEvent_shiftKey,
+    (slotinfo_t*)&flash_events_MouseEvent_stageY,
+    (slotinfo_t*)&flash_events_MouseEvent_altKey,
+    (slotinfo_t*)&flash_events_MouseEvent_clone,
+    (slotinfo_t*)&flash_events_MouseEvent_ctrlKey,
+    (slotinfo_t*)&flash_events_MouseEvent_localX,
+    (slotinfo_t*)&flash_events_MouseEvent_buttonDown,
+    0};
+static slotinfo_t* const flash_events_MouseEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_MouseEvent_ROLL_OVER,
+    (slotinfo_t*)&flash_events_MouseEvent_ROLL_OUT,
+    (slotinfo_t*)&flash_events_MouseEvent_MOUSE_DOWN,
+    (slotinfo_t*)&flash_events_MouseEvent_DOUBLE_CLICK,
+    (slotinfo_t*)&flash_events_MouseEvent_MOUSE_WHEEL,
+    (slotinfo_t*)&flash_events_MouseEvent_CLICK,
+    (slotinfo_t*)&flash_events_MouseEvent_MOUSE_MOVE,
+    (slotinfo_t*)&flash_events_MouseEvent_MOUSE_UP,
+    (slotinfo_t*)&flash_events_MouseEvent_MOUSE_OVER,
+    (slotinfo_t*)&flash_events_MouseEvent_MOUSE_OUT,
+    0};
+static slotinfo_t* const flash_events_NetFilterEvent_members[] = {
+    (slotinfo_t*)&flash_events_NetFilterEvent_header,
+    (slotinfo_t*)&flash_events_NetFilterEvent_toString,
+    (slotinfo_t*)&flash_events_NetFilterEvent_clone,
+    (slotinfo_t*)&flash_events_NetFilterEvent_data,
+    0};
+static slotinfo_t* const flash_events_NetStatusEvent_members[] = {
+    (slotinfo_t*)&flash_events_NetStatusEvent_toString,
+    (slotinfo_t*)&flash_events_NetStatusEvent_info,
+    (slotinfo_t*)&flash_events_NetStatusEvent_clone,
+    0};
+static slotinfo_t* const flash_events_NetStatusEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_NetStatusEvent_NET_STATUS,
+    0};
+static slotinfo_t* const flash_events_ProgressEvent_members[] = {
+    (slotinfo_t*)&flash_events_ProgressEvent_bytesLoaded,
+    (slotinfo_t*)&flash_events_ProgressEvent_toString,
+    (slotinfo_t*)&flash_events_ProgressEvent_bytesTotal,
+    (slotinfo_t*)&flash_events_ProgressEvent_clone,
+    0};
+static slotinfo_t* const flash_events_ProgressEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_ProgressEvent_PROGRESS,
+    (slotinfo_t*)&flash_events_ProgressEvent_SOCKET_DATA,
+    0};
+static slotinfo_t* const flash_events_SampleDataEvent_members[] = {
+    (slotinfo_t*)&flash_events_SampleDataEvent_toString,
+    (slotinfo_t*)&flash_events_SampleDataEvent_position,
+    (slotinfo_t*)&flash_events_SampleDataEvent_clone,
+    (slotinfo_t*)&flash_events_SampleDataEvent_data,
+    0};
+static slotinfo_t* const flash_events_SampleDataEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_SampleDataEvent_SAMPLE_DATA,
+    0};
+static slotinfo_t* const flash_events_SecurityErrorEvent_members[] = {
+    (slotinfo_t*)&flash_events_SecurityErrorEvent_toString,
+    (slotinfo_t*)&flash_events_SecurityErrorEvent_clone,
+    0};
+static slotinfo_t* const flash_events_SecurityErrorEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_SecurityErrorEvent_SECURITY_ERROR,
+    0};
+static slotinfo_t* const flash_events_ShaderEvent_members[] = {
+    (slotinfo_t*)&flash_events_ShaderEvent_vector,
+    (slotinfo_t*)&flash_events_ShaderEvent_toString,
+    (slotinfo_t*)&flash_events_ShaderEvent_bitmapData,
+    (slotinfo_t*)&flash_events_ShaderEvent_clone,
+    (slotinfo_t*)&flash_events_ShaderEvent_byteArray,
+    0};
+static slotinfo_t* const flash_events_ShaderEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_ShaderEvent_COMPLETE,
+    0};
+static slotinfo_t* const flash_events_StatusEvent_members[] = {
+    (slotinfo_t*)&flash_events_StatusEvent_toString,
+    (slotinfo_t*)&flash_events_StatusEvent_code,
+    (slotinfo_t*)&flash_events_StatusEvent_clone,
+    (slotinfo_t*)&flash_events_StatusEvent_level,
+    0};
+static slotinfo_t* const flash_events_StatusEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_StatusEvent_STATUS,
+    0};
+static slotinfo_t* const flash_events_SyncEvent_members[] = {
+    (slotinfo_t*)&flash_events_SyncEvent_toString,
+    (slotinfo_t*)&flash_events_SyncEvent_clone,
+    (slotinfo_t*)&flash_events_SyncEvent_changeList,
+    0};
+static slotinfo_t* const flash_events_SyncEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_SyncEvent_SYNC,
+    0};
+static slotinfo_t* const flash_events_TextEvent_members[] = {
+    (slotinfo_t*)&flash_events_TextEvent_toString,
+    (slotinfo_t*)&flash_events_TextEvent_text,
+    (slotinfo_t*)&flash_events_TextEvent_clone,
+    0};
+static slotinfo_t* const flash_events_TextEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_TextEvent_LINK,
+    (slotinfo_t*)&flash_events_TextEvent_TEXT_INPUT,
+    0};
+static slotinfo_t* const flash_events_TimerEvent_members[] = {
+    (slotinfo_t*)&flash_events_TimerEvent_toString,
+    (slotinfo_t*)&flash_events_TimerEvent_clone,
+    (slotinfo_t*)&flash_events_TimerEvent_updateAfterEvent,
+    0};
+static slotinfo_t* const flash_events_TimerEvent_static_members[] = {
+    (slotinfo_t*)&flash_events_TimerEvent_TIMER_COMPLETE,
+    (slotinfo_t*)&flash_events_TimerEvent_TIMER,
+    0};
+static slotinfo_t* const flash_external_ExternalInterface_static_members[] = {
+    (slotinfo_t*)&flash_external_ExternalInterface_call,
+    (slotinfo_t*)&flash_external_ExternalInterface_available,
+    (slotinfo_t*)&flash_external_ExternalInterface_addCallback,
+    (slotinfo_t*)&flash_external_ExternalInterface_marshallExceptions,
+    (slotinfo_t*)&flash_external_ExternalInterface_objectID,
+    0};
+static slotinfo_t* const flash_filters_BevelFilter_members[] = {
+    (slotinfo_t*)&flash_filters_BevelFilter_type,
+    (slotinfo_t*)&flash_filters_BevelFilter_highlightColor,
+    (slotinfo_t*)&flash_filters_BevelFilter_knockout,
+    (slotinfo_t*)&flash_filters_BevelFilter_distance,
+    (slotinfo_t*)&flash_filters_BevelFilter_strength,
+    (slotinfo_t*)&flash_filters_BevelFilter_highlightAlpha,
+    (slotinfo_t*)&flash_filters_BevelFilter_blurY,
+    (slotinfo_t*)&flash_filters_BevelFilter_shadowColor,
+    (slotinfo_t*)&flash_filters_BevelFilter_angle,
+    (slotinfo_t*)&flash_filters_BevelFilter_blurX,
+    (slotinfo_t*)&flash_filters_BevelFilter_shadowAlpha,
+    (slotinfo_t*)&flash_filters_BevelFilter_quality,
+    (slotinfo_t*)&flash_filters_BevelFilter_clone,
+    0};
+static slotinfo_t* const flash_filters_BitmapFilter_members[] = {
+    (slotinfo_t*)&flash_filters_BitmapFilter_clone,
+    0};
+static slotinfo_t* const flash_filters_BitmapFilterQuality_static_members[] = {
+    (slotinfo_t*)&flash_filters_BitmapFilterQuality_LOW,
+    (slotinfo_t*)&flash_filters_BitmapFilterQuality_MEDIUM,
+    (slotinfo_t*)&flash_filters_BitmapFilterQuality_HIGH,
+    0};
+static slotinfo_t* const flash_filters_BitmapFilterType_static_members[] = {
+    (slotinfo_t*)&flash_filters_BitmapFilterType_FULL,
+    (slotinfo_t*)&flash_filters_BitmapFilterType_INNER,
+    (slotinfo_t*)&flash_filters_BitmapFilterType_OUTER,
+    0};
+static slotinfo_t* const flash_filters_BlurFilter_members[] = {
+    (slotinfo_t*)&flash_filters_BlurFilter_blurY,
+    (slotinfo_t*)&flash_filters_BlurFilter_clone,
+    (slotinfo_t*)&flash_filters_BlurFilter_quality,
+    (slotinfo_t*)&flash_filters_BlurFilter_blurX,
+    0};
+static slotinfo_t* const flash_filters_ColorMatrixFilter_members[] = {
+    (slotinfo_t*)&flash_filters_ColorMatrixFilter_matrix,
+    (slotinfo_t*)&flash_filters_ColorMatrixFilter_clone,
+    0};
+static slotinfo_t* const flash_filters_ConvolutionFilter_members[] = {
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_alpha,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_matrixX,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_matrix,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_bias,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_color,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_preserveAlpha,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_divisor,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_clone,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_clamp,
+    (slotinfo_t*)&flash_filters_ConvolutionFilter_matrixY,
+    0};
+static slotinfo_t* const flash_filters_DisplacementMapFilter_members[] = {
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_scaleY,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_mapPoint,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_scaleX,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_mapBitmap,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_mode,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_color,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_componentX,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_clone,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_alpha,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilter_componentY,
+    0};
+static slotinfo_t* const flash_filters_DisplacementMapFilterMode_static_members[] = {
+    (slotinfo_t*)&flash_filters_DisplacementMapFilterMode_COLOR,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilterMode_WRAP,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilterMode_CLAMP,
+    (slotinfo_t*)&flash_filters_DisplacementMapFilterMode_IGNORE,
+    0};
+static slotinfo_t* const flash_filters_DropShadowFilter_members[] = {
+    (slotinfo_t*)&flash_filters_DropShadowFilter_alpha,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_strength,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_quality,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_angle,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_knockout,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_color,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_hideObject,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_inner,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_blurX,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_blurY,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_distance,
+    (slotinfo_t*)&flash_filters_DropShadowFilter_clone,
+    0};
+static slotinfo_t* const flash_filters_GlowFilter_members[] = {
+    (slotinfo_t*)&flash_filters_GlowFilter_blurY,
+    (slotinfo_t*)&flash_filters_GlowFilter_strength,
+    (slotinfo_t*)&flash_filters_GlowFilter_inner,
+    (slotinfo_t*)&flash_filters_GlowFilter_color,
+    (slotinfo_t*)&flash_filters_GlowFilter_clone,
+    (slotinfo_t*)&flash_filters_GlowFilter_quality,
+    (slotinfo_t*)&flash_filters_GlowFilter_knockout,
+    (slotinfo_t*)&flash_filters_GlowFilter_alpha,
+    (slotinfo_t*)&flash_filters_GlowFilter_blurX,
+    0};
+static slotinfo_t* const flash_filters_GradientBevelFilter_members[] = {
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_strength,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_quality,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_angle,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_knockout,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_alphas,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_type,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_ratios,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_colors,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_blurX,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_blurY,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_distance,
+    (slotinfo_t*)&flash_filters_GradientBevelFilter_clone,
+    0};
+static slotinfo_t* const flash_filters_GradientGlowFilter_members[] = {
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_strength,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_quality,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_angle,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_knockout,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_type,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_alphas,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_ratios,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_colors,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_blurX,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_blurY,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_distance,
+    (slotinfo_t*)&flash_filters_GradientGlowFilter_clone,
+    0};
+static slotinfo_t* const flash_filters_ShaderFilter_members[] = {
+    (slotinfo_t*)&flash_filters_ShaderFilter_bottomExtension,
+    (slotinfo_t*)&flash_filters_ShaderFilter_shader,
+    (slotinfo_t*)&flash_filters_ShaderFilter_rightExtension,
+    (slotinfo_t*)&flash_filters_ShaderFilter_leftExtension,
+    (slotinfo_t*)&flash_filters_ShaderFilter_topExtension,
+    0};
+static slotinfo_t* const flash_geom_ColorTransform_members[] = {
+    (slotinfo_t*)&flash_geom_ColorTransform_blueOffset,
+    (slotinfo_t*)&flash_geom_ColorTransform_greenOffset,
+    (slotinfo_t*)&flash_geom_ColorTransform_greenMultiplier,
+    (slotinfo_t*)&flash_geom_ColorTransform_redMultiplier,
+    (slotinfo_t*)&flash_geom_ColorTransform_color,
+    (slotinfo_t*)&flash_geom_ColorTransform_concat,
+    (slotinfo_t*)&flash_geom_ColorTransform_alphaOffset,
+    (slotinfo_t*)&flash_geom_ColorTransform_blueMultiplier,
+    (slotinfo_t*)&flash_geom_ColorTransform_toString,
+    (slotinfo_t*)&flash_geom_ColorTransform_alphaMultiplier,
+    (slotinfo_t*)&flash_geom_ColorTransform_redOffset,
+    0};
+static slotinfo_t* const flash_geom_Matrix_members[] = {
+    (slotinfo_t*)&flash_geom_Matrix_b,
+    (slotinfo_t*)&flash_geom_Matrix_deltaTransformPoint,
+    (slotinfo_t*)&flash_geom_Matrix_identity,
+    (slotinfo_t*)&flash_geom_Matrix_ty,
+    (slotinfo_t*)&flash_geom_Matrix_translate,
+    (slotinfo_t*)&flash_geom_Matrix_concat,
+    (slotinfo_t*)&flash_geom_Matrix_c,
+    (slotinfo_t*)&flash_geom_Matrix_a,
+    (slotinfo_t*)&flash_geom_Matrix_scale,
+    (slotinfo_t*)&flash_geom_Matrix_d,
+    (slotinfo_t*)&flash_geom_Matrix_transformPoint,
+    (slotinfo_t*)&flash_geom_Matrix_rotate,
+    (slotinfo_t*)&flash_geom_Matrix_createGradientBox,
+    (slotinfo_t*)&flash_geom_Matrix_toString,
+    (slotinfo_t*)&flash_geom_Matrix_invert,
+    (slotinfo_t*)&flash_geom_Matrix_clone,
+    (slotinfo_t*)&flash_geom_Matrix_tx,
+    (slotinfo_t*)&flash_geom_Matrix_createBox,
+    0};
+static slotinfo_t* const flash_geom_Matrix3D_members[] = {
+    (slotinfo_t*)&flash_geom_Matrix3D_decompose,
+    (slotinfo_t*)&flash_geom_Matrix3D_pointAt,
+    (slotinfo_t*)&flash_geom_Matrix3D_identity,
+    (slotinfo_t*)&flash_geom_Matrix3D_transformVector,
+    (slotinfo_t*)&flash_geom_Matrix3D_appendRotation,
+    (slotinfo_t*)&flash_geom_Matrix3D_determinant,
+    (slotinfo_t*)&flash_geom_Matrix3D_prependRotation,
+    (slotinfo_t*)&flash_geom_Matrix3D_position,
+    (slotinfo_t*)&flash_geom_Matrix3D_interpolateTo,
+    (slotinfo_t*)&flash_geom_Matrix3D_appendScale,
+    (slotinfo_t*)&flash_geom_Matrix3D_prepend,
+    (slotinfo_t*)&flash_geom_Matrix3D_recompose,
+    (slotinfo_t*)&flash_geom_Matrix3D_appendTranslation,
+    (slotinfo_t*)&flash_geom_Matrix3D_invert,
+    (slotinfo_t*)&flash_geom_Matrix3D_rawData,
+    (slotinfo_t*)&flash_geom_Matrix3D_prependTranslation,
+    (slotinfo_t*)&flash_geom_Matrix3D_append,
+    (slotinfo_t*)&flash_geom_Matrix3D_clone,
+    (slotinfo_t*)&flash_geom_Matrix3D_prependScale,
+    (slotinfo_t*)&flash_geom_Matrix3D_deltaTransformVector,
+    (slotinfo_t*)&flash_geom_Matrix3D_transformVectors,
+    (slotinfo_t*)&flash_geom_Matrix3D_transpose,
+    0};
+static slotinfo_t* const flash_geom_Matrix3D_static_members[] = {
+    (slotinfo_t*)&flash_geom_Matrix3D_interpolate,
+    0};
+static slotinfo_t* const flash_geom_Orientation3D_static_members[] = {
+    (slotinfo_t*)&flash_geom_Orientation3D_QUATERNION,
+    (slotinfo_t*)&flash_geom_Orientation3D_EULER_ANGLES,
+    (slotinfo_t*)&flash_geom_Orientation3D_AXIS_ANGLE,
+    0};
+static slotinfo_t* const flash_geom_PerspectiveProjection_members[] = {
+    (slotinfo_t*)&flash_geom_PerspectiveProjection_fieldOfView,
+    (slotinfo_t*)&flash_geom_PerspectiveProjection_projectionCenter,
+    (slotinfo_t*)&flash_geom_PerspectiveProjection_toMatrix3D,
+    (slotinfo_t*)&flash_geom_PerspectiveProjection_focalLength,
+    0};
+static slotinfo_t* const flash_geom_Point_members[] = {
+    (slotinfo_t*)&flash_geom_Point_equals,
+    (slotinfo_t*)&flash_geom_Point_normalize,
+    (slotinfo_t*)&flash_geom_Point_x,
+    (slotinfo_t*)&flash_geom_Point_offset,
+    (slotinfo_t*)&flash_geom_Point_subtract,
+    (slotinfo_t*)&flash_geom_Point_y,
+    (slotinfo_t*)&flash_geom_Point_length,
+    (slotinfo_t*)&flash_geom_Point_add,
+    (slotinfo_t*)&flash_geom_Point_toString,
+    (slotinfo_t*)&flash_geom_Point_clone,
+    0};
+static slotinfo_t* const flash_geom_Point_static_members[] = {
+    (slotinfo_t*)&flash_geom_Point_polar,
+    (slotinfo_t*)&flash_geom_Point_distance,
+    (slotinfo_t*)&flash_geom_Point_interpolate,
+    0};
+static slotinfo_t* const flash_geom_Rectangle_members[] = {
+    (slotinfo_t*)&flash_geom_Rectangle_top,
+    (slotinfo_t*)&flash_geom_Rectangle_intersection,
+    (slotinfo_t*)&flash_geom_Rectangle_intersects,
+    (slotinfo_t*)&flash_geom_Rectangle_containsPoint,
+    (slotinfo_t*)&flash_geom_Rectangle_setEmpty,
+    (slotinfo_t*)&flash_geom_Rectangle_topLeft,
+    (slotinfo_t*)&flash_geom_Rectangle_width,
+    (slotinfo_t*)&flash_geom_Rectangle_containsRect,
+    (slotinfo_t*)&flash_geom_Rectangle_isEmpty,
+    (slotinfo_t*)&flash_geom_Rectangle_equals,
+    (slotinfo_t*)&flash_geom_Rectangle_height,
+    (slotinfo_t*)&flash_geom_Rectangle_left,
+    (slotinfo_t*)&flash_geom_Rectangle_inflate,
+    (slotinfo_t*)&flash_geom_Rectangle_inflatePoint,
+    (slotinfo_t*)&flash_geom_Rectangle_toString,
+    (slotinfo_t*)&flash_geom_Rectangle_offsetPoint,
+    (slotinfo_t*)&flash_geom_Rectangle_x,
+    (slotinfo_t*)&flash_geom_Rectangle_size,
+    (slotinfo_t*)&flash_geom_Rectangle_bottomRight,
+    (slotinfo_t*)&flash_geom_Rectangle_right,
+    (slotinfo_t*)&flash_geom_Rectangle_contains,
+    (slotinfo_t*)&flash_geom_Rectangle_union,
+    (slotinfo_t*)&flash_geom_Rectangle_bottom,
+    (slotinfo_t*)&flash_geom_Rectangle_clone,
+    (slotinfo_t*)&flash_geom_Rectangle_y,
+    (slotinfo_t*)&flash_geom_Rectangle_offset,
+    0};
+static slotinfo_t* const flash_geom_Transform_members[] = {
+    (slotinfo_t*)&flash_geom_Transform_matrix,
+    (slotinfo_t*)&flash_geom_Transform_perspectiveProjection,
+    (slotinfo_t*)&flash_geom_Transform_concatenatedMatrix,
+    (slotinfo_t*)&flash_geom_Transform_colorTransform,
+    (slotinfo_t*)&flash_geom_Transform_getRelativeMatrix3D,
+    (slotinfo_t*)&flash_geom_Transform_pixelBounds,
+    (slotinfo_t*)&flash_geom_Transform_matrix3D,
+    (slotinfo_t*)&flash_geom_Transform_concatenatedColorTransform,
+    0};
+static slotinfo_t* const flash_geom_Utils3D_static_members[] = {
+    (slotinfo_t*)&flash_geom_Utils3D_projectVectors,
+    (slotinfo_t*)&flash_geom_Utils3D_projectVector,
+    (slotinfo_t*)&flash_geom_Utils3D_pointTowards,
+    0};
+static slotinfo_t* const flash_geom_Vector3D_members[] = {
+    (slotinfo_t*)&flash_geom_Vector3D_subtract,
+    (slotinfo_t*)&flash_geom_Vector3D_scaleBy,
+    (slotinfo_t*)&flash_geom_Vector3D_decrementBy,
+    (slotinfo_t*)&flash_geom_Vector3D_equals,
+    (slotinfo_t*)&flash_geom_Vector3D_normalize,
+    (slotinfo_t*)&flash_geom_Vector3D_dotProduct,
+    (slotinfo_t*)&flash_geom_Vector3D_negate,
+    (slotinfo_t*)&flash_geom_Vector3D_toString,
+    (slotinfo_t*)&flash_geom_Vector3D_lengthSquared,
+    (slotinfo_t*)&flash_geom_Vector3D_x,
+    (slotinfo_t*)&flash_geom_Vector3D_incrementBy,
+    (slotinfo_t*)&flash_geom_Vector3D_w,
+    (slotinfo_t*)&flash_geom_Vector3D_z,
+    (slotinfo_t*)&flash_geom_Vector3D_add,
+    (slotinfo_t*)&flash_geom_Vector3D_project,
+    (slotinfo_t*)&flash_geom_Vector3D_crossProduct,
+    (slotinfo_t*)&flash_geom_Vector3D_nearEquals,
+    (slotinfo_t*)&flash_geom_Vector3D_clone,
+    (slotinfo_t*)&flash_geom_Vector3D_y,
+    (slotinfo_t*)&flash_geom_Vector3D_length,
+    0};
+static slotinfo_t* const flash_geom_Vector3D_static_members[] = {
+    (slotinfo_t*)&flash_geom_Vector3D_distance,
+    (slotinfo_t*)&flash_geom_Vector3D_Z_AXIS,
+    (slotinfo_t*)&flash_geom_Vector3D_X_AXIS,
+    (slotinfo_t*)&flash_geom_Vector3D_angleBetween,
+    (slotinfo_t*)&flash_geom_Vector3D_Y_AXIS,
+    0};
+static slotinfo_t* const flash_media_Camera_members[] = {
+    (slotinfo_t*)&flash_media_Camera_fps,
+    (slotinfo_t*)&flash_media_Camera_setMode,
+    (slotinfo_t*)&flash_media_Camera_keyFrameInterval,
+    (slotinfo_t*)&flash_media_Camera_motionTimeout,
+    (slotinfo_t*)&flash_media_Camera_width,
+    (slotinfo_t*)&flash_media_Camera_setCursor,
+    (slotinfo_t*)&flash_media_Camera_setLoopback,
+    (slotinfo_t*)&flash_media_Camera_height,
+    (slotinfo_t*)&flash_media_Camera_index,
+    (slotinfo_t*)&flash_media_Camera_name,
+    (slotinfo_t*)&flash_media_Camera_currentFPS,
+    (slotinfo_t*)&flash_media_Camera_setKeyFrameInterval,
+    (slotinfo_t*)&flash_media_Camera_quality,
+    (slotinfo_t*)&flash_media_Camera_motionLevel,
+    (slotinfo_t*)&flash_media_Camera_bandwidth,
+    (slotinfo_t*)&flash_media_Camera_muted,
+    (slotinfo_t*)&flash_media_Camera_activityLevel,
+    (slotinfo_t*)&flash_media_Camera_loopback,
+    (slotinfo_t*)&flash_media_Camera_setQuality,
+    (slotinfo_t*)&flash_media_Camera_setMotionLevel,
+    0};
+static slotinfo_t* const flash_media_Camera_static_members[] = {
+    (slotinfo_t*)&flash_media_Camera_getCamera,
+    (slotinfo_t*)&flash_media_Camera_names,
+    0};
+static slotinfo_t* const flash_media_ID3Info_members[] = {
+    (slotinfo_t*)&flash_media_ID3Info_comment,
+    (slotinfo_t*)&flash_media_ID3Info_year,
+    (slotinfo_t*)&flash_media_ID3Info_track,
+    (slotinfo_t*)&flash_media_ID3Info_artist,
+    (slotinfo_t*)&flash_media_ID3Info_songName,
+    (slotinfo_t*)&flash_media_ID3Info_genre,
+    (slotinfo_t*)&flash_media_ID3Info_album,
+    0};
+static slotinfo_t* const flash_media_Microphone_members[] = {
+    (slotinfo_t*)&flash_media_Microphone_codec,
+    (slotinfo_t*)&flash_media_Microphone_gain,
+    (slotinfo_t*)&flash_media_Microphone_index,
+    (slotinfo_t*)&flash_media_Microphone_setLoopBack,
+    (slotinfo_t*)&flash_media_Microphone_setSilenceLevel,
+    (slotinfo_t*)&flash_media_Microphone_name,
+    (slotinfo_t*)&flash_media_Microphone_setUseEchoSuppression,
+    (slotinfo_t*)&flash_media_Microphone_framesPerPacket,
+    (slotinfo_t*)&flash_media_Microphone_muted,
+    (slotinfo_t*)&flash_media_Microphone_soundTransform,
+    (slotinfo_t*)&flash_media_Microphone_encodeQuality,
+    (slotinfo_t*)&flash_media_Microphone_useEchoSuppression,
+    (slotinfo_t*)&flash_media_Microphone_silenceLevel,
+    (slotinfo_t*)&flash_media_Microphone_silenceTimeout,
+    (slotinfo_t*)&flash_media_Microphone_rate,
+    (slotinfo_t*)&flash_media_Microphone_activityLevel,
+    0};
+static slotinfo_t* const flash_media_Microphone_static_members[] = {
+    (slotinfo_t*)&flash_media_Microphone_names,
+    (slotinfo_t*)&flash_media_Microphone_getMicrophone,
+    0};
+static slotinfo_t* const flash_media_Sound_members[] = {
+    (slotinfo_t*)&flash_media_Sound_extract,
+    (slotinfo_t*)&flash_media_Sound_bytesLoaded,
+    (slotinfo_t*)&flash_media_Sound_id3,
+    (slotinfo_t*)&flash_media_Sound_play,
+    (slotinfo_t*)&flash_media_Sound_url,
+    (slotinfo_t*)&flash_media_Sound_isBuffering,
+    (slotinfo_t*)&flash_media_Sound_load,
+    (slotinfo_t*)&flash_media_Sound_bytesTotal,
+    (slotinfo_t*)&flash_media_Sound_length,
+    (slotinfo_t*)&flash_media_Sound_close,
+    0};
+static slotinfo_t* const flash_media_SoundChannel_members[] = {
+    (slotinfo_t*)&flash_media_SoundChannel_leftPeak,
+    (slotinfo_t*)&flash_media_SoundChannel_stop,
+    (slotinfo_t*)&flash_media_SoundChannel_position,
+    (slotinfo_t*)&flash_media_SoundChannel_soundTransform,
+    (slotinfo_t*)&flash_media_SoundChannel_rightPeak,
+    0};
+static slotinfo_t* const flash_media_SoundCodec_static_members[] = {
+    (slotinfo_t*)&flash_media_SoundCodec_NELLYMOSER,
+    (slotinfo_t*)&flash_media_SoundCodec_SPEEX,
+    0};
+static slotinfo_t* const flash_media_SoundLoaderContext_members[] = {
+    (slotinfo_t*)&flash_media_SoundLoaderContext_checkPolicyFile,
+    (slotinfo_t*)&flash_media_SoundLoaderContext_bufferTime,
+    0};
+static slotinfo_t* const flash_media_SoundMixer_static_members[] = {
+    (slotinfo_t*)&flash_media_SoundMixer_computeSpectrum,
+    (slotinfo_t*)&flash_media_SoundMixer_areSoundsInaccessible,
+    (slotinfo_t*)&flash_media_SoundMixer_soundTransform,
+    (slotinfo_t*)&flash_media_SoundMixer_bufferTime,
+    (slotinfo_t*)&flash_media_SoundMixer_stopAll,
+    0};
+static slotinfo_t* const flash_media_SoundTransform_members[] = {
+    (slotinfo_t*)&flash_media_SoundTransform_pan,
+    (slotinfo_t*)&flash_media_SoundTransform_leftToRight,
+    (slotinfo_t*)&flash_media_SoundTransform_rightToLeft,
+    (slotinfo_t*)&flash_media_SoundTransform_volume,
+    (slotinfo_t*)&flash_media_SoundTransform_leftToLeft,
+    (slotinfo_t*)&flash_media_SoundTransform_rightToRight,
+    0};
+static slotinfo_t* const flash_media_Video_members[] = {
+    (slotinfo_t*)&flash_media_Video_attachCamera,
+    (slotinfo_t*)&flash_media_Video_videoWidth,
+    (slotinfo_t*)&flash_media_Video_clear,
+    (slotinfo_t*)&flash_media_Video_deblocking,
+    (slotinfo_t*)&flash_media_Video_videoHeight,
+    (slotinfo_t*)&flash_media_Video_attachNetStream,
+    (slotinfo_t*)&flash_media_Video_smoothing,
+    0};
+static slotinfo_t* const flash_net_FileFilter_members[] = {
+    (slotinfo_t*)&flash_net_FileFilter_extension,
+    (slotinfo_t*)&flash_net_FileFilter_description,
+    (slotinfo_t*)&flash_net_FileFilter_macType,
+    0};
+static slotinfo_t* const flash_net_FileReference_members[] = {
+    (slotinfo_t*)&flash_net_FileReference_type,
+    (slotinfo_t*)&flash_net_FileReference_browse,
+    (slotinfo_t*)&flash_net_FileReference_creationDate,
+    (slotinfo_t*)&flash_net_FileReference_upload,
+    (slotinfo_t*)&flash_net_FileReference_download,
+    (slotinfo_t*)&flash_net_FileReference_save,
+    (slotinfo_t*)&flash_net_FileReference_cancel,
+    (slotinfo_t*)&flash_net_FileReference_creator,
+    (slotinfo_t*)&flash_net_FileReference_data,
+    (slotinfo_t*)&flash_net_FileReference_size,
+    (slotinfo_t*)&flash_net_FileReference_name,
+    (slotinfo_t*)&flash_net_FileReference_load,
+    (slotinfo_t*)&flash_net_FileReference_modificationDate,
+    0};
+static slotinfo_t* const flash_net_FileReferenceList_members[] = {
+    (slotinfo_t*)&flash_net_FileReferenceList_fileList,
+    (slotinfo_t*)&flash_net_FileReferenceList_browse,
+    0};
+static slotinfo_t* const flash_net_IDynamicPropertyOutput_members[] = {
+    (slotinfo_t*)&flash_net_IDynamicPropertyOutput_writeDynamicProperty,
+    0};
+static slotinfo_t* const flash_net_IDynamicPropertyWriter_members[] = {
+    (slotinfo_t*)&flash_net_IDynamicPropertyWriter_writeDynamicProperties,
+    0};
+static slotinfo_t* const flash_net_LocalConnection_members[] = {
+    (slotinfo_t*)&flash_net_LocalConnection_client,
+    (slotinfo_t*)&flash_net_LocalConnection_allowDomain,
+    (slotinfo_t*)&flash_net_LocalConnection_connect,
+    (slotinfo_t*)&flash_net_LocalConnection_domain,
+    (slotinfo_t*)&flash_net_LocalConnection_allowInsecureDomain,
+    (slotinfo_t*)&flash_net_LocalConnection_send,
+    (slotinfo_t*)&flash_net_LocalConnection_close,
+    0};
+static slotinfo_t* const flash_net_NetConnection_members[] = {
+    (slotinfo_t*)&flash_net_NetConnection_nearID,
+    (slotinfo_t*)&flash_net_NetConnection_client,
+    (slotinfo_t*)&flash_net_NetConnection_farNonce,
+    (slotinfo_t*)&flash_net_NetConnection_objectEncoding,
+    (slotinfo_t*)&flash_net_NetConnection_farID,
+    (slotinfo_t*)&flash_net_NetConnection_connected,
+    (slotinfo_t*)&flash_net_NetConnection_call,
+    (slotinfo_t*)&flash_net_NetConnection_usingTLS,
+    (slotinfo_t*)&flash_net_NetConnection_proxyType,
+    (slotinfo_t*)&flash_net_NetConnection_addHeader,
+    (slotinfo_t*)&flash_net_NetConnection_protocol,
+    (slotinfo_t*)&flash_net_NetConnection_close,
+    (slotinfo_t*)&flash_net_NetConnection_nearNonce,
+    (slotinfo_t*)&flash_net_NetConnection_connect,
+    (slotinfo_t*)&flash_net_NetConnection_unconnectedPeerStreams,
+    (slotinfo_t*)&flash_net_NetConnection_maxPeerConnections,
+    (slotinfo_t*)&flash_net_NetConnection_connectedProxyType,
+    (slotinfo_t*)&flash_net_NetConnection_uri,
+    0};
+static slotinfo_t* const flash_net_NetConnection_static_members[] = {
+    (slotinfo_t*)&flash_net_NetConnection_defaultObjectEncoding,
+    0};
+static slotinfo_t* const flash_net_NetStream_members[] = {
+    (slotinfo_t*)&flash_net_NetStream_videoCodec,
+    (slotinfo_t*)&flash_net_NetStream_info,
+    (slotinfo_t*)&flash_net_NetStream_attachCamera,
+    (slotinfo_t*)&flash_net_NetStream_farNonce,
+    (slotinfo_t*)&flash_net_NetStream_close,
+    (slotinfo_t*)&flash_net_NetStream_pause,
+    (slotinfo_t*)&flash_net_NetStream_onPeerConnect,
+    (slotinfo_t*)&flash_net_NetStream_client,
+    (slotinfo_t*)&flash_net_NetStream_resume,
+    (slotinfo_t*)&flash_net_NetStream_liveDelay,
+    (slotinfo_t*)&flash_net_NetStream_peerStreams,
+    (slotinfo_t*)&flash_net_NetStream_objectEncoding,
+    (slotinfo_t*)&flash_net_NetStream_bytesLoaded,
+    (slotinfo_t*)&flash_net_NetStream_receiveVideo,
+    (slotinfo_t*)&flash_net_NetStream_maxPauseBufferTime,
+    (slotinfo_t*)&flash_net_NetStream_play2,
+    (slotinfo_t*)&flash_net_NetStream_audioCodec,
+    (slotinfo_t*)&flash_net_NetStream_receiveVideoFPS,
+    (slotinfo_t*)&flash_net_NetStream_bytesTotal,
+    (slotinfo_t*)&flash_net_NetStream_farID,
+    (slotinfo_t*)&flash_net_NetStream_receiveAudio,
+    (slotinfo_t*)&flash_net_NetStream_bufferLength,
+    (slotinfo_t*)&flash_net_NetStream_seek,
+    (slotinfo_t*)&flash_net_NetStream_attachAudio,
+    (slotinfo_t*)&flash_net_NetStream_bufferTime,
+    (slotinfo_t*)&flash_net_NetStream_play,
+    (slotinfo_t*)&flash_net_NetStream_publish,
+    (slotinfo_t*)&flash_net_NetStream_togglePause,
+    (slotinfo_t*)&flash_net_NetStream_checkPolicyFile,
+    (slotinfo_t*)&flash_net_NetStream_nearNonce,
+    (slotinfo_t*)&flash_net_NetStream_decodedFrames,
+    (slotinfo_t*)&flash_net_NetStream_send,
+    (slotinfo_t*)&flash_net_NetStream_currentFPS,
+    (slotinfo_t*)&flash_net_NetStream_time,
+    (slotinfo_t*)&flash_net_NetStream_soundTransform,
+    0};
+static slotinfo_t* const flash_net_NetStream_static_members[] = {
+    (slotinfo_t*)&flash_net_NetStream_CONNECT_TO_FMS,
+    (slotinfo_t*)&flash_net_NetStream_DIRECT_CONNECTIONS,
+    0};
+static slotinfo_t* const flash_net_NetStreamInfo_members[] = {
+    (slotinfo_t*)&flash_net_NetStreamInfo_maxBytesPerSecond,
+    (slotinfo_t*)&flash_net_NetStreamInfo_dataBufferByteLength,
+    (slotinfo_t*)&flash_net_NetStreamInfo_videoByteCount,
+    (slotinfo_t*)&flash_net_NetStreamInfo_videoBufferLength,
+    (slotinfo_t*)&flash_net_NetStreamInfo_audioBufferByteLength,
+    (slotinfo_t*)&flash_net_NetStreamInfo_dataBytesPerSecond,
+    (slotinfo_t*)&flash_net_NetStreamInfo_SRTT,
+    (slotinfo_t*)&flash_net_NetStreamInfo_droppedFrames,
+    (slotinfo_t*)&flash_net_NetStreamInfo_audioByteCount,
+    (slotinfo_t*)&flash_net_NetStreamInfo_audioBufferLength,
+    (slotinfo_t*)&flash_net_NetStreamInfo_byteCount,
+    (slotinfo_t*)&flash_net_NetStreamInfo_toString,
+    (slotinfo_t*)&flash_net_NetStreamInfo_dataByteCount,
+    (slotinfo_t*)&flash_net_NetStreamInfo_videoBufferByteLength,
+    (slotinfo_t*)&flash_net_NetStreamInfo_dataBufferLength,
+    (slotinfo_t*)&flash_net_NetStreamInfo_audioLossRate,
+    (slotinfo_t*)&flash_net_NetStreamInfo_videoBytesPerSecond,
+    (slotinfo_t*)&flash_net_NetStreamInfo_currentBytesPerSecond,
+    (slotinfo_t*)&flash_net_NetStreamInfo_audioBytesPerSecond,
+    (slotinfo_t*)&flash_net_NetStreamInfo_playbackBytesPerSecond,
+    0};
+static slotinfo_t* const flash_net_NetStreamPlayOptions_members[] = {
+    (slotinfo_t*)&flash_net_NetStreamPlayOptions_len,
+    (slotinfo_t*)&flash_net_NetStreamPlayOptions_streamName,
+    (slotinfo_t*)&flash_net_NetStreamPlayOptions_start,
+    (slotinfo_t*)&flash_net_NetStreamPlayOptions_oldStreamName,
+    (slotinfo_t*)&flash_net_NetStreamPlayOptions_transition,
+    0};
+static slotinfo_t* const flash_net_NetStreamPlayTransitions_static_members[] = {
+    (slotinfo_t*)&flash_net_NetStreamPlayTransitions_RESET,
+    (slotinfo_t*)&flash_net_NetStreamPlayTransitions_APPEND,
+    (slotinfo_t*)&flash_net_NetStreamPlayTransitions_SWAP,
+    (slotinfo_t*)&flash_net_NetStreamPlayTransitions_SWITCH,
+    (slotinfo_t*)&flash_net_NetStreamPlayTransitions_STOP,
+    0};
+static slotinfo_t* const flash_net_ObjectEncoding_static_members[] = {
+    (slotinfo_t*)&flash_net_ObjectEncoding_dynamicPropertyWriter,
+    (slotinfo_t*)&flash_net_ObjectEncoding_DEFAULT,
+    (slotinfo_t*)&flash_net_ObjectEncoding_AMF0,
+    (slotinfo_t*)&flash_net_ObjectEncoding_AMF3,
+    0};
+static slotinfo_t* const flash_net_SharedObject_members[] = {
+    (slotinfo_t*)&flash_net_SharedObject_objectEncoding,
+    (slotinfo_t*)&flash_net_SharedObject_client,
+    (slotinfo_t*)&flash_net_SharedObject_setProperty,
+    (slotinfo_t*)&flash_net_SharedObject_clear,
+    (slotinfo_t*)&flash_net_SharedObject_flush,
+    (slotinfo_t*)&flash_net_SharedObject_connect,
+    (slotinfo_t*)&flash_net_SharedObject_size,
+    (slotinfo_t*)&flash_net_SharedObject_setDirty,
+    (slotinfo_t*)&flash_net_SharedObject_send,
+    (slotinfo_t*)&flash_net_SharedObject_close,
+    (slotinfo_t*)&flash_net_SharedObject_data,
+    0};
+static slotinfo_t* const flash_net_SharedObject_static_members[] = {
+    (slotinfo_t*)&flash_net_SharedObject_defaultObjectEncoding,
+    (slotinfo_t*)&flash_net_SharedObject_getDiskUsage,
+    (slotinfo_t*)&flash_net_SharedObject_getRemote,
+    (slotinfo_t*)&flash_net_SharedObject_deleteAll,
+    (slotinfo_t*)&flash_net_SharedObject_getLocal,
+    0};
+static slotinfo_t* const flash_net_SharedObjectFlushStatus_static_members[] = {
+    (slotinfo_t*)&flash_net_SharedObjectFlushStatus_FLUSHED,
+    (slotinfo_t*)&flash_net_SharedObjectFlushStatus_PENDING,
+    0};
+static slotinfo_t* const flash_net_Socket_members[] = {
+    (slotinfo_t*)&flash_net_Socket_writeBoolean,
+    (slotinfo_t*)&flash_net_Socket_connect,
+    (slotinfo_t*)&flash_net_Socket_readDouble,
+    (slotinfo_t*)&flash_net_Socket_writeByte,
+    (slotinfo_t*)&flash_net_Socket_writeObject,
+    (slotinfo_t*)&flash_net_Socket_readUTFBytes,
+    (slotinfo_t*)&flash_net_Socket_close,
+    (slotinfo_t*)&flash_net_Socket_writeMultiByte,
+    (slotinfo_t*)&flash_net_Socket_readUnsignedByte,
+    (slotinfo_t*)&flash_net_Socket_writeInt,
+    (slotinfo_t*)&flash_net_Socket_readMultiByte,
+    (slotinfo_t*)&flash_net_Socket_readBytes,
+    (slotinfo_t*)&flash_net_Socket_writeShort,
+    (slotinfo_t*)&flash_net_Socket_readShort,
+    (slotinfo_t*)&flash_net_Socket_writeUTF,
+    (slotinfo_t*)&flash_net_Socket_timeout,
+    (slotinfo_t*)&flash_net_Socket_writeBytes,
+    (slotinfo_t*)&flash_net_Socket_connected,
+    (slotinfo_t*)&flash_net_Socket_readObject,
+    (slotinfo_t*)&flash_net_Socket_objectEncoding,
+    (slotinfo_t*)&flash_net_Socket_flush,
+    (slotinfo_t*)&flash_net_Socket_writeUnsignedInt,
+    (slotinfo_t*)&flash_net_Socket_writeDouble,
+    (slotinfo_t*)&flash_net_Socket_writeFloat,
+    (slotinfo_t*)&flash_net_Socket_readInt,
+    (slotinfo_t*)&flash_net_Socket_readByte,
+    (slotinfo_t*)&flash_net_Socket_bytesAvailable,
+    (slotinfo_t*)&flash_net_Socket_endian,
+    (slotinfo_t*)&flash_net_Socket_readUnsignedShort,
+    (slotinfo_t*)&flash_net_Socket_readUnsignedInt,
+    (slotinfo_t*)&flash_net_Socket_readFloat,
+    (slotinfo_t*)&flash_net_Socket_writeUTFBytes,
+    (slotinfo_t*)&flash_net_Socket_readBoolean,
+    (slotinfo_t*)&flash_net_Socket_readUTF,
+    0};
+static slotinfo_t* const flash_net_URLLoader_members[] = {
+    (slotinfo_t*)&flash_net_URLLoader_close,
+    (slotinfo_t*)&flash_net_URLLoader_bytesLoaded,
+    (slotinfo_t*)&flash_net_URLLoader_load,
+    (slotinfo_t*)&flash_net_URLLoader_bytesTotal,
+    (slotinfo_t*)&flash_net_URLLoader_dataFormat,
+    (slotinfo_t*)&flash_net_URLLoader_data,
+    0};
+static slotinfo_t* const flash_net_URLLoaderDataFormat_static_members[] = {
+    (slotinfo_t*)&flash_net_URLLoaderDataFormat_VARIABLES,
+    (slotinfo_t*)&flash_net_URLLoaderDataFormat_BINARY,
+    (slotinfo_t*)&flash_net_URLLoaderDataFormat_TEXT,
+    0};
+static slotinfo_t* const flash_net_URLRequest_members[] = {
+    (slotinfo_t*)&flash_net_URLRequest_contentType,
+    (slotinfo_t*)&flash_net_URLRequest_url,
+    (slotinfo_t*)&flash_net_URLRequest_requestHeaders,
+    (slotinfo_t*)&flash_net_URLRequest_method,
+    (slotinfo_t*)&flash_net_URLRequest_digest,
+    (slotinfo_t*)&flash_net_URLRequest_data,
+    0};
+static slotinfo_t* const flash_net_URLRequestHeader_members[] = {
+    (slotinfo_t*)&flash_net_URLRequestHeader_value,
+    (slotinfo_t*)&flash_net_URLRequestHeader_name,
+    0};
+static slotinfo_t* const flash_net_URLRequestMethod_static_members[] = {
+    (slotinfo_t*)&flash_net_URLRequestMethod_GET,
+    (slotinfo_t*)&flash_net_URLRequestMethod_POST,
+    0};
+static slotinfo_t* const flash_net_URLStream_members[] = {
+    (slotinfo_t*)&flash_net_URLStream_readUTF,
+    (slotinfo_t*)&flash_net_URLStream_readByte,
+    (slotinfo_t*)&flash_net_URLStream_readUTFBytes,
+    (slotinfo_t*)&flash_net_URLStream_readShort,
+    (slotinfo_t*)&flash_net_URLStream_objectEncoding,
+    (slotinfo_t*)&flash_net_URLStream_connected,
+    (slotinfo_t*)&flash_net_URLStream_readUnsignedInt,
+    (slotinfo_t*)&flash_net_URLStream_readDouble,
+    (slotinfo_t*)&flash_net_URLStream_readBytes,
+    (slotinfo_t*)&flash_net_URLStream_readUnsignedByte,
+    (slotinfo_t*)&flash_net_URLStream_readMultiByte,
+    (slotinfo_t*)&flash_net_URLStream_readInt,
+    (slotinfo_t*)&flash_net_URLStream_bytesAvailable,
+    (slotinfo_t*)&flash_net_URLStream_load,
+    (slotinfo_t*)&flash_net_URLStream_close,
+    (slotinfo_t*)&flash_net_URLStream_readUnsignedShort,
+    (slotinfo_t*)&flash_net_URLStream_readObject,
+    (slotinfo_t*)&flash_net_URLStream_readFloat,
+    (slotinfo_t*)&flash_net_URLStream_endian,
+    (slotinfo_t*)&flash_net_URLStream_readBoolean,
+    0};
+static slotinfo_t* const flash_net_URLVariables_members[] = {
+    (slotinfo_t*)&flash_net_URLVariables_toString,
+    (slotinfo_t*)&flash_net_URLVariables_decode,
+    0};
+static slotinfo_t* const flash_net_XMLSocket_members[] = {
+    (slotinfo_t*)&flash_net_XMLSocket_close,
+    (slotinfo_t*)&flash_net_XMLSocket_connect,
+    (slotinfo_t*)&flash_net_XMLSocket_send,
+    (slotinfo_t*)&flash_net_XMLSocket_connected,
+    (slotinfo_t*)&flash_net_XMLSocket_timeout,
+    0};
+static slotinfo_t* const flash_printing_PrintJob_members[] = {
+    (slotinfo_t*)&flash_printing_PrintJob_paperWidth,
+    (slotinfo_t*)&flash_printing_PrintJob_addPage,
+    (slotinfo_t*)&flash_printing_PrintJob_pageHeight,
+    (slotinfo_t*)&flash_printing_PrintJob_start,
+    (slotinfo_t*)&flash_printing_PrintJob_pageWidth,
+    (slotinfo_t*)&flash_printing_PrintJob_send,
+    (slotinfo_t*)&flash_printing_PrintJob_paperHeight,
+    (slotinfo_t*)&flash_printing_PrintJob_orientation,
+    0};
+static slotinfo_t* const flash_printing_PrintJobOptions_members[] = {
+    (slotinfo_t*)&flash_printing_PrintJobOptions_printAsBitmap,
+    0};
+static slotinfo_t* const flash_printing_PrintJobOrientation_static_members[] = {
+    (slotinfo_t*)&flash_printing_PrintJobOrientation_LANDSCAPE,
+    (slotinfo_t*)&flash_printing_PrintJobOrientation_PORTRAIT,
+    0};
+static slotinfo_t* const flash_sampler_DeleteObjectSample_members[] = {
+    (slotinfo_t*)&flash_sampler_DeleteObjectSample_size,
+    (slotinfo_t*)&flash_sampler_DeleteObjectSample_id,
+    0};
+static slotinfo_t* const flash_sampler_NewObjectSample_members[] = {
+    (slotinfo_t*)&flash_sampler_NewObjectSample_type,
+    (slotinfo_t*)&flash_sampler_NewObjectSample_object,
+    (slotinfo_t*)&flash_sampler_NewObjectSample_id,
+    0};
+static slotinfo_t* const flash_sampler_Sample_members[] = {
+    (slotinfo_t*)&flash_sampler_Sample_time,
+    (slotinfo_t*)&flash_sampler_Sample_stack,
+    0};
+static slotinfo_t* const flash_sampler_StackFrame_members[] = {
+    (slotinfo_t*)&flash_sampler_StackFrame_name,
+    (slotinfo_t*)&flash_sampler_StackFrame_line,
+    (slotinfo_t*)&flash_sampler_StackFrame_toString,
+    (slotinfo_t*)&flash_sampler_StackFrame_file,
+    0};
+static slotinfo_t* const flash_system_ApplicationDomain_members[] = {
+    (slotinfo_t*)&flash_system_ApplicationDomain_hasDefinition,
+    (slotinfo_t*)&flash_system_ApplicationDomain_getDefinition,
+    (slotinfo_t*)&flash_system_ApplicationDomain_parentDomain,
+    (slotinfo_t*)&flash_system_ApplicationDomain_domainMemory,
+    0};
+static slotinfo_t* const flash_system_ApplicationDomain_static_members[] = {
+    (slotinfo_t*)&flash_system_ApplicationDomain_MIN_DOMAIN_MEMORY_LENGTH,
+    (slotinfo_t*)&flash_system_ApplicationDomain_currentDomain,
+    0};
+static slotinfo_t* const flash_system_Capabilities_static_members[] = {
+    (slotinfo_t*)&flash_system_Capabilities_maxLevelIDC,
+    (slotinfo_t*)&flash_system_Capabilities_isDebugger,
+    (slotinfo_t*)&flash_system_Capabilities_hasStreamingAudio,
+    (slotinfo_t*)&flash_system_Capabilities_screenColor,
+    (slotinfo_t*)&flash_system_Capabilities_hasIME,
+    (slotinfo_t*)&flash_system_Capabilities_hasEmbeddedVideo,
+    (slotinfo_t*)&flash_system_Capabilities_hasTLS,
+    (slotinfo_t*)&flash_system_Capabilities_isEmbeddedInAcrobat,
+    (slotinfo_t*)&flash_system_Capabilities_hasScreenPlayback,
+    (slotinfo_t*)&flash_system_Capabilities_hasVideoEncoder,
+    (slotinfo_t*)&flash_system_Capabilities_hasAudioEncoder,
+    (slotinfo_t*)&flash_system_Capabilities_pixelAspectRatio,
+    (slotinfo_t*)&flash_system_Capabilities_hasStreamingVideo,
+    (slotinfo_t*)&flash_system_Capabilities_screenResolutionX,
+    (slotinfo_t*)&flash_system_Capabilities_hasScreenBroadcast,
+    (slotinfo_t*)&flash_system_Capabilities_hasAudio,
+    (slotinfo_t*)&flash_system_Capabilities_language,
+    (slotinfo_t*)&flash_system_Capabilities_manufacturer,
+    (slotinfo_t*)&flash_system_Capabilities_hasPrinting,
+    (slotinfo_t*)&flash_system_Capabilities_os,
+    (slotinfo_t*)&flash_system_Capabilities_localFileReadDisable,
+    (slotinfo_t*)&flash_system_Capabilities_hasMP3,
+    (slotinfo_t*)&flash_system_Capabilities_avHardwareDisable,
+    (slotinfo_t*)&flash_system_Capabilities_hasAccessibility,
+    (slotinfo_t*)&flash_system_Capabilities_version,
+    (slotinfo_t*)&flash_system_Capabilities_screenDPI,
+    (slotinfo_t*)&flash_system_Capabilities_playerType,
+    (slotinfo_t*)&flash_system_Capabilities_screenResolutionY,
+    (slotinfo_t*)&flash_system_Capabilities__internal,
+    (slotinfo_t*)&flash_system_Capabilities_serverString,
+    0};
+static slotinfo_t* const flash_system_IME_static_members[] = {
+    (slotinfo_t*)&flash_system_IME_setCompositionString,
+    (slotinfo_t*)&flash_system_IME_enabled,
+    (slotinfo_t*)&flash_system_IME_doConversion,
+    (slotinfo_t*)&flash_system_IME_conversionMode,
+    0};
+static slotinfo_t* const flash_system_IMEConversionMode_static_members[] = {
+    (slotinfo_t*)&flash_system_IMEConversionMode_JAPANESE_KATAKANA_FULL,
+    (slotinfo_t*)&flash_system_IMEConversionMode_CHINESE,
+    (slotinfo_t*)&flash_system_IMEConversionMode_JAPANESE_KATAKANA_HALF,
+    (slotinfo_t*)&flash_system_IMEConversionMode_UNKNOWN,
+    (slotinfo_t*)&flash_system_IMEConversionMode_KOREAN,
+    (slotinfo_t*)&flash_system_IMEConversionMode_ALPHANUMERIC_HALF,
+    (slotinfo_t*)&flash_system_IMEConversionMode_ALPHANUMERIC_FULL,
+    (slotinfo_t*)&flash_system_IMEConversionMode_JAPANESE_HIRAGANA,
+    0};
+static slotinfo_t* const flash_system_JPEGLoaderContext_members[] = {
+    (slotinfo_t*)&flash_system_JPEGLoaderContext_deblockingFilter,
+    0};
+static slotinfo_t* const flash_system_LoaderContext_members[] = {
+    (slotinfo_t*)&flash_system_LoaderContext_checkPolicyFile,
+    (slotinfo_t*)&flash_system_LoaderContext_securityDomain,
+    (slotinfo_t*)&flash_system_LoaderContext_applicationDomain,
+    0};
+static slotinfo_t* const flash_system_Security_static_members[] = {
+    (slotinfo_t*)&flash_system_Security_sandboxType,
+    (slotinfo_t*)&flash_system_Security_LOCAL_WITH_NETWORK,
+    (slotinfo_t*)&flash_system_Security_loadPolicyFile,
+    (slotinfo_t*)&flash_system_Security_allowDomain,
+    (slotinfo_t*)&flash_system_Security_showSettings,
+    (slotinfo_t*)&flash_system_Security_LOCAL_TRUSTED,
+    (slotinfo_t*)&flash_system_Security_disableAVM1Loading,
+    (slotinfo_t*)&flash_system_Security_allowInsecureDomain,
+    (slotinfo_t*)&flash_system_Security_exactSettings,
+    (slotinfo_t*)&flash_system_Security_REMOTE,
+    (slotinfo_t*)&flash_system_Security_LOCAL_WITH_FILE,
+    0};
+static slotinfo_t* const flash_system_SecurityDomain_static_members[] = {
+    (slotinfo_t*)&flash_system_SecurityDomain_currentDomain,
+    0};
+static slotinfo_t* const flash_system_SecurityPanel_static_members[] = {
+    (slotinfo_t*)&flash_system_SecurityPanel_LOCAL_STORAGE,
+    (slotinfo_t*)&flash_system_SecurityPanel_CAMERA,
+    (slotinfo_t*)&flash_system_SecurityPanel_DEFAULT,
+    (slotinfo_t*)&flash_system_SecurityPanel_SETTINGS_MANAGER,
+    (slotinfo_t*)&flash_system_SecurityPanel_PRIVACY,
+    (slotinfo_t*)&flash_system_SecurityPanel_MICROPHONE,
+    (slotinfo_t*)&flash_system_SecurityPanel_DISPLAY,
+    0};
+static slotinfo_t* const flash_system_System_static_members[] = {
+    (slotinfo_t*)&flash_system_System_pause,
+    (slotinfo_t*)&flash_system_System_useCodePage,
+    (slotinfo_t*)&flash_system_System_exit,
+    (slotinfo_t*)&flash_system_System_setClipboard,
+    (slotinfo_t*)&flash_system_System_totalMemory,
+    (slotinfo_t*)&flash_system_System_gc,
+    (slotinfo_t*)&flash_system_System_resume,
+    (slotinfo_t*)&flash_system_System_vmVersion,
+    (slotinfo_t*)&flash_system_System_ime,
+    0};
+static slotinfo_t* const flash_text_AntiAliasType_static_members[] = {
+    (slotinfo_t*)&flash_text_AntiAliasType_NORMAL,
+    (slotinfo_t*)&flash_text_AntiAliasType_ADVANCED,
+    0};
+static slotinfo_t* const flash_text_CSMSettings_members[] = {
+    (slotinfo_t*)&flash_text_CSMSettings_fontSize,
+    (slotinfo_t*)&flash_text_CSMSettings_outsideCutoff,
+    (slotinfo_t*)&flash_text_CSMSettings_insideCutoff,
+    0};
+static slotinfo_t* const flash_text_Font_members[] = {
+    (slotinfo_t*)&flash_text_Font_hasGlyphs,
+    (slotinfo_t*)&flash_text_Font_fontName,
+    (slotinfo_t*)&flash_text_Font_fontStyle,
+    (slotinfo_t*)&flash_text_Font_fontType,
+    0};
+static slotinfo_t* const flash_text_Font_static_members[] = {
+    (slotinfo_t*)&flash_text_Font_enumerateFonts,
+    (slotinfo_t*)&flash_text_Font_registerFont,
+    0};
+static slotinfo_t* const flash_text_FontStyle_static_members[] = {
+    (slotinfo_t*)&flash_text_FontStyle_REGULAR,
+    (slotinfo_t*)&flash_text_FontStyle_BOLD,
+    (slotinfo_t*)&flash_text_FontStyle_BOLD_ITALIC,
+    (slotinfo_t*)&flash_text_FontStyle_ITALIC,
+    0};
+static slotinfo_t* const flash_text_FontType_static_members[] = {
+    (slotinfo_t*)&flash_text_FontType_EMBEDDED,
+    (slotinfo_t*)&flash_text_FontType_DEVICE,
+    (slotinfo_t*)&flash_text_FontType_EMBEDDED_CFF,
+    0};
+static slotinfo_t* const flash_text_GridFitType_static_members[] = {
+    (slotinfo_t*)&flash_text_GridFitType_SUBPIXEL,
+    (slotinfo_t*)&flash_text_GridFitType_PIXEL,
+    (slotinfo_t*)&flash_text_GridFitType_NONE,
+    0};
+static slotinfo_t* const flash_text_StaticText_members[] = {
+    (slotinfo_t*)&flash_text_StaticText_text,
+    0};
+static slotinfo_t* const flash_text_StyleSheet_members[] = {
+    (slotinfo_t*)&flash_text_StyleSheet_styleNames,
+    (slotinfo_t*)&flash_text_StyleSheet_clear,
+    (slotinfo_t*)&flash_text_StyleSheet_transform,
+    (slotinfo_t*)&flash_text_StyleSheet_getStyle,
+    (slotinfo_t*)&flash_text_StyleSheet_parseCSS,
+    (slotinfo_t*)&flash_text_StyleSheet_setStyle,
+    0};
+static slotinfo_t* const flash_text_TextColorType_static_members[] = {
+    (slotinfo_t*)&flash_text_TextColorType_DARK_COLOR,
+    (slotinfo_t*)&flash_text_TextColorType_LIGHT_COLOR,
+    0};
+static slotinfo_t* const flash_text_TextDisplayMode_static_members[] = {
+    (slotinfo_t*)&flash_text_TextDisplayMode_CRT,
+    (slotinfo_t*)&flash_text_TextDisplayMode_LCD,
+    (slotinfo_t*)&flash_text_TextDisplayMode_DEFAULT,
+    0};
+static slotinfo_t* const flash_text_TextExtent_members[] = {
+    (slotinfo_t*)&flash_text_TextExtent_descent,
+    (slotinfo_t*)&flash_text_TextExtent_width,
+    (slotinfo_t*)&flash_text_TextExtent_ascent,
+    (slotinfo_t*)&flash_text_TextExtent_textFieldHeight,
+    (slotinfo_t*)&flash_text_TextExtent_textFieldWidth,
+    (slotinfo_t*)&flash_text_TextExtent_height,
+    0};
+static slotinfo_t* const flash_text_TextField_members[] = {
+    (slotinfo_t*)&flash_text_TextField_getTextFormat,
+    (slotinfo_t*)&flash_text_TextField_border,
+    (slotinfo_t*)&flash_text_TextField_selectedText,
+    (slotinfo_t*)&flash_text_TextField_pasteRichText,
+    (slotinfo_t*)&flash_text_TextField_bottomScrollV,
+    (slotinfo_t*)&flash_text_TextField_getLineIndexOfChar,
+    (slotinfo_t*)&flash_text_TextField_replaceText,
+    (slotinfo_t*)&flash_text_TextField_defaultTextFormat,
+    (slotinfo_t*)&flash_text_TextField_restrict,
+    (slotinfo_t*)&flash_text_TextField_htmlText,
+    (slotinfo_t*)&flash_text_TextField_copyRichText,
+    (slotinfo_t*)&flash_text_TextField_getLineText,
+    (slotinfo_t*)&flash_text_TextField_getFirstCharInParagraph,
+    (slotinfo_t*)&flash_text_TextField_setSelection,
+    (slotinfo_t*)&flash_text_TextField_length,
+    (slotinfo_t*)&flash_text_TextField_wordWrap,
+    (slotinfo_t*)&flash_text_TextField_appendText,
+    (slotinfo_t*)&flash_text_TextField_caretIndex,
+    (slotinfo_t*)&flash_text_TextField_mouseWheelEnabled,
+    (slotinfo_t*)&flash_text_TextField_selectionBeginIndex,
+    (slotinfo_t*)&flash_text_TextField_sharpness,
+    (slotinfo_t*)&flash_text_TextField_type,
+    (slotinfo_t*)&flash_text_TextField_getLineIndexAtPoint,
+    (slotinfo_t*)&flash_text_TextField_getCharIndexAtPoint,
+    (slotinfo_t*)&flash_text_TextField_getXMLText,
+    (slotinfo_t*)&flash_text_TextField_getParagraphLength,
+    (slotinfo_t*)&flash_text_TextField_getRawText,
+    (slotinfo_t*)&flash_text_TextField_gridFitType,
+    (slotinfo_t*)&flash_text_TextField_getLineOffset,
+    (slotinfo_t*)&flash_text_TextField_backgroundColor,
+    (slotinfo_t*)&flash_text_TextField_multiline,
+    (slotinfo_t*)&flash_text_TextField_numLines,
+    (slotinfo_t*)&flash_text_TextField_getImageReference,
+    (slotinfo_t*)&flash_text_TextField_displayAsPassword,
+    (slotinfo_t*)&flash_text_TextField_textWidth,
+    (slotinfo_t*)&flash_text_TextField_autoSize,
+    (slotinfo_t*)&flash_text_TextField_selectable,
+    (slotinfo_t*)&flash_text_TextField_getCharBoundaries,
+    (slotinfo_t*)&flash_text_TextField_alwaysShowSelection,
+    (slotinfo_t*)&flash_text_TextField_thickness,
+    (slotinfo_t*)&flash_text_TextField_useRichTextClipboard,
+    (slotinfo_t*)&flash_text_TextField_scrollV,
+    (slotinfo_t*)&flash_text_TextField_getTextRuns,
+    (slotinfo_t*)&flash_text_TextField_setTextFormat,
+    (slotinfo_t*)&flash_text_TextField_textColor,
+    (slotinfo_t*)&flash_text_TextField_maxScrollV,
+    (slotinfo_t*)&flash_text_TextField_embedFonts,
+    (slotinfo_t*)&flash_text_TextField_scrollH,
+    (slotinfo_t*)&flash_text_TextField_text,
+    (slotinfo_t*)&flash_text_TextField_getLineLength,
+    (slotinfo_t*)&flash_text_TextField_textHeight,
+    (slotinfo_t*)&flash_text_TextField_antiAliasType,
+    (slotinfo_t*)&flash_text_TextField_styleSheet,
+    (slotinfo_t*)&flash_text_TextField_background,
+    (slotinfo_t*)&flash_text_TextField_replaceSelectedText,
+    (slotinfo_t*)&flash_text_TextField_borderColor,
+    (slotinfo_t*)&flash_text_TextField_maxScrollH,
+    (slotinfo_t*)&flash_text_TextField_maxChars,
+    (slotinfo_t*)&flash_text_TextField_getLineMetrics,
+    (slotinfo_t*)&flash_text_TextField_selectionEndIndex,
+    (slotinfo_t*)&flash_text_TextField_insertXMLText,
+    (slotinfo_t*)&flash_text_TextField_condenseWhite,
+    0};
+static slotinfo_t* const flash_text_TextField_static_members[] = {
+    (slotinfo_t*)&flash_text_TextField_isFontCompatible,
+    0};
+static slotinfo_t* const flash_text_TextFieldAutoSize_static_members[] = {
+    (slotinfo_t*)&flash_text_TextFieldAutoSize_LEFT,
+    (slotinfo_t*)&flash_text_TextFieldAutoSize_RIGHT,
+    (slotinfo_t*)&flash_text_TextFieldAutoSize_CENTER,
+    (slotinfo_t*)&flash_text_TextFieldAutoSize_NONE,
+    0};
+static slotinfo_t* const flash_text_TextFieldType_static_members[] = {
+    (slotinfo_t*)&flash_text_TextFieldType_DYNAMIC,
+    (slotinfo_t*)&flash_text_TextFieldType_INPUT,
+    0};
+static slotinfo_t* const flash_text_TextFormat_members[] = {
+    (slotinfo_t*)&flash_text_TextFormat_leading,
+    (slotinfo_t*)&flash_text_TextFormat_bold,
+    (slotinfo_t*)&flash_text_TextFormat_underline,
+    (slotinfo_t*)&flash_text_TextFormat_color,
+    (slotinfo_t*)&flash_text_TextFormat_letterSpacing,
+    (slotinfo_t*)&flash_text_TextFormat_kerning,
+    (slotinfo_t*)&flash_text_TextFormat_target,
+    (slotinfo_t*)&flash_text_TextFormat_italic,
+    (slotinfo_t*)&flash_text_TextFormat_rightMargin,
+    (slotinfo_t*)&flash_text_TextFormat_bullet,
+    (slotinfo_t*)&flash_text_TextFormat_url,
+    (slotinfo_t*)&flash_text_TextFormat_size,
+    (slotinfo_t*)&flash_text_TextFormat_indent,
+    (slotinfo_t*)&flash_text_TextFormat_leftMargin,
+    (slotinfo_t*)&flash_text_TextFormat_display,
+    (slotinfo_t*)&flash_text_TextFormat_align,
+    (slotinfo_t*)&flash_text_TextFormat_tabStops,
+    (slotinfo_t*)&flash_text_TextFormat_blockIndent,
+    (slotinfo_t*)&flash_text_TextFormat_font,
+    0};
+static slotinfo_t* const flash_text_TextFormatAlign_static_members[] = {
+    (slotinfo_t*)&flash_text_TextFormatAlign_LEFT,
+    (slotinfo_t*)&flash_text_TextFormatAlign_RIGHT,
+    (slotinfo_t*)&flash_text_TextFormatAlign_CENTER,
+    (slotinfo_t*)&flash_text_TextFormatAlign_JUSTIFY,
+    0};
+static slotinfo_t* const flash_text_TextFormatDisplay_static_members[] = {
+    (slotinfo_t*)&flash_text_TextFormatDisplay_INLINE,
+    (slotinfo_t*)&flash_text_TextFormatDisplay_BLOCK,
+    0};
+static slotinfo_t* const flash_text_TextLineMetrics_members[] = {
+    (slotinfo_t*)&flash_text_TextLineMetrics_descent,
+    (slotinfo_t*)&flash_text_TextLineMetrics_width,
+    (slotinfo_t*)&flash_text_TextLineMetrics_ascent,
+    (slotinfo_t*)&flash_text_TextLineMetrics_leading,
+    (slotinfo_t*)&flash_text_TextLineMetrics_height,
+    (slotinfo_t*)&flash_text_TextLineMetrics_x,
+    0};
+static slotinfo_t* const flash_text_TextRenderer_static_members[] = {
+    (slotinfo_t*)&flash_text_TextRenderer_displayMode,
+    (slotinfo_t*)&flash_text_TextRenderer_antiAliasType,
+    (slotinfo_t*)&flash_text_TextRenderer_maxLevel,
+    (slotinfo_t*)&flash_text_TextRenderer_setAdvancedAntiAliasingTable,
+    0};
+static slotinfo_t* const flash_text_TextRun_members[] = {
+    (slotinfo_t*)&flash_text_TextRun_beginIndex,
+    (slotinfo_t*)&flash_text_TextRun_endIndex,
+    (slotinfo_t*)&flash_text_TextRun_textFormat,
+    0};
+static slotinfo_t* const flash_text_TextSnapshot_members[] = {
+    (slotinfo_t*)&flash_text_TextSnapshot_setSelectColor,
+    (slotinfo_t*)&flash_text_TextSnapshot_setSelected,
+    (slotinfo_t*)&flash_text_TextSnapshot_getSelectedText,
+    (slotinfo_t*)&flash_text_TextSnapshot_getTextRunInfo,
+    (slotinfo_t*)&flash_text_TextSnapshot_charCount,
+    (slotinfo_t*)&flash_text_TextSnapshot_findText,
+    (slotinfo_t*)&flash_text_TextSnapshot_getSelected,
+    (slotinfo_t*)&flash_text_TextSnapshot_hitTestTextNearPos,
+    (slotinfo_t*)&flash_text_TextSnapshot_getText,
+    0};
+static slotinfo_t* const flash_text_engine_BreakOpportunity_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_BreakOpportunity_AUTO,
+    (slotinfo_t*)&flash_text_engine_BreakOpportunity_ANY,
+    (slotinfo_t*)&flash_text_engine_BreakOpportunity_ALL,
+    (slotinfo_t*)&flash_text_engine_BreakOpportunity_NONE,
+    0};
+static slotinfo_t* const flash_text_engine_CFFHinting_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_CFFHinting_HORIZONTAL_STEM,
+    (slotinfo_t*)&flash_text_engine_CFFHinting_NONE,
+    0};
+static slotinfo_t* const flash_text_engine_ContentElement_members[] = {
+    (slotinfo_t*)&flash_text_engine_ContentElement_eventMirror,
+    (slotinfo_t*)&flash_text_engine_ContentElement_groupElement,
+    (slotinfo_t*)&flash_text_engine_ContentElement_textRotation,
+    (slotinfo_t*)&flash_text_engine_ContentElement_text,
+    (slotinfo_t*)&flash_text_engine_ContentElement_userData,
+    (slotinfo_t*)&flash_text_engine_ContentElement_elementFormat,
+    (slotinfo_t*)&flash_text_engine_ContentElement_textBlock,
+    (slotinfo_t*)&flash_text_engine_ContentElement_rawText,
+    (slotinfo_t*)&flash_text_engine_ContentElement_textBlockBeginIndex,
+    0};
+static slotinfo_t* const flash_text_engine_ContentElement_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_ContentElement_GRAPHIC_ELEMENT,
+    0};
+static slotinfo_t* const flash_text_engine_DigitCase_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_DigitCase_OLD_STYLE,
+    (slotinfo_t*)&flash_text_engine_DigitCase_DEFAULT,
+    (slotinfo_t*)&flash_text_engine_DigitCase_LINING,
+    0};
+static slotinfo_t* const flash_text_engine_DigitWidth_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_DigitWidth_PROPORTIONAL,
+    (slotinfo_t*)&flash_text_engine_DigitWidth_DEFAULT,
+    (slotinfo_t*)&flash_text_engine_DigitWidth_TABULAR,
+    0};
+static slotinfo_t* const flash_text_engine_EastAsianJustifier_members[] = {
+    (slotinfo_t*)&flash_text_engine_EastAsianJustifier_justificationStyle,
+    (slotinfo_t*)&flash_text_engine_EastAsianJustifier_clone,
+    0};
+static slotinfo_t* const flash_text_engine_ElementFormat_members[] = {
+    (slotinfo_t*)&flash_text_engine_ElementFormat_getFontMetrics,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_digitCase,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_breakOpportunity,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_ligatureLevel,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_dominantBaseline,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_alignmentBaseline,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_color,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_digitWidth,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_kerning,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_fontSize,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_fontDescription,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_baselineShift,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_locale,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_typographicCase,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_trackingLeft,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_locked,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_clone,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_alpha,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_textRotation,
+    (slotinfo_t*)&flash_text_engine_ElementFormat_trackingRight,
+    0};
+static slotinfo_t* const flash_text_engine_FontDescription_members[] = {
+    (slotinfo_t*)&flash_text_engine_FontDescription_renderingMode,
+    (slotinfo_t*)&flash_text_engine_FontDescription_cffHinting,
+    (slotinfo_t*)&flash_text_engine_FontDescription_fontPosture,
+    (slotinfo_t*)&flash_text_engine_FontDescription_fontName,
+    (slotinfo_t*)&flash_text_engine_FontDescription_fontLookup,
+    (slotinfo_t*)&flash_text_engine_FontDescription_locked,
+    (slotinfo_t*)&flash_text_engine_FontDescription_fontWeight,
+    (slotinfo_t*)&flash_text_engine_FontDescription_clone,
+    0};
+static slotinfo_t* const flash_text_engine_FontDescription_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_FontDescription_isFontCompatible,
+    0};
+static slotinfo_t* const flash_text_engine_FontLookup_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_FontLookup_DEVICE,
+    (slotinfo_t*)&flash_text_engine_FontLookup_EMBEDDED_CFF,
+    0};
+static slotinfo_t* const flash_text_engine_FontMetrics_members[] = {
+    (slotinfo_t*)&flash_text_engine_FontMetrics_superscriptOffset,
+    (slotinfo_t*)&flash_text_engine_FontMetrics_underlineThickness,
+    (slotinfo_t*)&flash_text_engine_FontMetrics_subscriptScale,
+    (slotinfo_t*)&flash_text_engine_FontMetrics_strikethroughOffset,
+    (slotinfo_t*)&flash_text_engine_FontMetrics_emBox,
+    (slotinfo_t*)&flash_text_engine_FontMetrics_strikethroughThickness,
+    (slotinfo_t*)&flash_text_engine_FontMetrics_superscriptScale,
+    (slotinfo_t*)&flash_text_engine_FontMetrics_subscriptOffset,
+    (slotinfo_t*)&flash_text_engine_FontMetrics_underlineOffset,
+    0};
+static slotinfo_t* const flash_text_engine_FontPosture_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_FontPosture_NORMAL,
+    (slotinfo_t*)&flash_text_engine_FontPosture_ITALIC,
+    0};
+static slotinfo_t* const flash_text_engine_FontWeight_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_FontWeight_NORMAL,
+    (slotinfo_t*)&flash_text_engine_FontWeight_BOLD,
+    0};
+static slotinfo_t* const flash_text_engine_GraphicElement_members[] = {
+    (slotinfo_t*)&flash_text_engine_GraphicElement_graphic,
+    (slotinfo_t*)&flash_text_engine_GraphicElement_elementWidth,
+    (slotinfo_t*)&flash_text_engine_GraphicElement_elementHeight,
+    0};
+static slotinfo_t* const flash_text_engine_GroupElement_members[] = {
+    (slotinfo_t*)&flash_text_engine_GroupElement_groupElements,
+    (slotinfo_t*)&flash_text_engine_GroupElement_splitTextElement,
+    (slotinfo_t*)&flash_text_engine_GroupElement_mergeTextElements,
+    (slotinfo_t*)&flash_text_engine_GroupElement_getElementAtCharIndex,
+    (slotinfo_t*)&flash_text_engine_GroupElement_elementCount,
+    (slotinfo_t*)&flash_text_engine_GroupElement_setElements,
+    (slotinfo_t*)&flash_text_engine_GroupElement_getElementAt,
+    (slotinfo_t*)&flash_text_engine_GroupElement_ungroupElements,
+    (slotinfo_t*)&flash_text_engine_GroupElement_replaceElements,
+    (slotinfo_t*)&flash_text_engine_GroupElement_getElementIndex,
+    0};
+static slotinfo_t* const flash_text_engine_JustificationStyle_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_JustificationStyle_PUSH_OUT_ONLY,
+    (slotinfo_t*)&flash_text_engine_JustificationStyle_PRIORITIZE_LEAST_ADJUSTMENT,
+    (slotinfo_t*)&flash_text_engine_JustificationStyle_PUSH_IN_KINSOKU,
+    0};
+static slotinfo_t* const flash_text_engine_Kerning_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_Kerning_AUTO,
+    (slotinfo_t*)&flash_text_engine_Kerning_OFF,
+    (slotinfo_t*)&flash_text_engine_Kerning_ON,
+    0};
+static slotinfo_t* const flash_text_engine_LigatureLevel_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_LigatureLevel_UNCOMMON,
+    (slotinfo_t*)&flash_text_engine_LigatureLevel_COMMON,
+    (slotinfo_t*)&flash_text_engine_LigatureLevel_EXOTIC,
+    (slotinfo_t*)&flash_text_engine_LigatureLevel_MINIMUM,
+    (slotinfo_t*)&flash_text_engine_LigatureLevel_NONE,
+    0};
+static slotinfo_t* const flash_text_engine_LineJustification_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_LineJustification_ALL_INCLUDING_LAST,
+    (slotinfo_t*)&flash_text_engine_LineJustification_UNJUSTIFIED,
+    (slotinfo_t*)&flash_text_engine_LineJustification_ALL_BUT_LAST,
+    0};
+static slotinfo_t* const flash_text_engine_RenderingMode_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_RenderingMode_NORMAL,
+    (slotinfo_t*)&flash_text_engine_RenderingMode_CFF,
+    0};
+static slotinfo_t* const flash_text_engine_SpaceJustifier_members[] = {
+    (slotinfo_t*)&flash_text_engine_SpaceJustifier_clone,
+    (slotinfo_t*)&flash_text_engine_SpaceJustifier_letterSpacing,
+    0};
+static slotinfo_t* const flash_text_engine_TabAlignment_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_TabAlignment_END,
+    (slotinfo_t*)&flash_text_engine_TabAlignment_CENTER,
+    (slotinfo_t*)&flash_text_engine_TabAlignment_START,
+    (slotinfo_t*)&flash_text_engine_TabAlignment_DECIMAL,
+    0};
+static slotinfo_t* const flash_text_engine_TabStop_members[] = {
+    (slotinfo_t*)&flash_text_engine_TabStop_alignment,
+    (slotinfo_t*)&flash_text_engine_TabStop_position,
+    (slotinfo_t*)&flash_text_engine_TabStop_decimalAlignmentToken,
+    0};
+static slotinfo_t* const flash_text_engine_TextBaseline_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextBaseline_ROMAN,
+    (slotinfo_t*)&flash_text_engine_TextBaseline_DESCENT,
+    (slotinfo_t*)&flash_text_engine_TextBaseline_IDEOGRAPHIC_CENTER,
+    (slotinfo_t*)&flash_text_engine_TextBaseline_USE_DOMINANT_BASELINE,
+    (slotinfo_t*)&flash_text_engine_TextBaseline_IDEOGRAPHIC_BOTTOM,
+    (slotinfo_t*)&flash_text_engine_TextBaseline_ASCENT,
+    (slotinfo_t*)&flash_text_engine_TextBaseline_IDEOGRAPHIC_TOP,
+    0};
+static slotinfo_t* const flash_text_engine_TextBlock_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextBlock_createTextLine,
+    (slotinfo_t*)&flash_text_engine_TextBlock_bidiLevel,
+    (slotinfo_t*)&flash_text_engine_TextBlock_getTextLineAtCharIndex,
+    (slotinfo_t*)&flash_text_engine_TextBlock_lastLine,
+    (slotinfo_t*)&flash_text_engine_TextBlock_findPreviousWordBoundary,
+    (slotinfo_t*)&flash_text_engine_TextBlock_findPreviousAtomBoundary,
+    (slotinfo_t*)&flash_text_engine_TextBlock_baselineZero,
+    (slotinfo_t*)&flash_text_engine_TextBlock_applyNonLinearFontScaling,
+    (slotinfo_t*)&flash_text_engine_TextBlock_firstLine,
+    (slotinfo_t*)&flash_text_engine_TextBlock_textJustifier,
+    (slotinfo_t*)&flash_text_engine_TextBlock_releaseLines,
+    (slotinfo_t*)&flash_text_engine_TextBlock_firstInvalidLine,
+    (slotinfo_t*)&flash_text_engine_TextBlock_baselineFontSize,
+    (slotinfo_t*)&flash_text_engine_TextBlock_lineRotation,
+    (slotinfo_t*)&flash_text_engine_TextBlock_userData,
+    (slotinfo_t*)&flash_text_engine_TextBlock_content,
+    (slotinfo_t*)&flash_text_engine_TextBlock_textLineCreationResult,
+    (slotinfo_t*)&flash_text_engine_TextBlock_baselineFontDescription,
+    (slotinfo_t*)&flash_text_engine_TextBlock_findNextAtomBoundary,
+    (slotinfo_t*)&flash_text_engine_TextBlock_findNextWordBoundary,
+    (slotinfo_t*)&flash_text_engine_TextBlock_tabStops,
+    (slotinfo_t*)&flash_text_engine_TextBlock_dump,
+    0};
+static slotinfo_t* const flash_text_engine_TextElement_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextElement_replaceText,
+    0};
+static slotinfo_t* const flash_text_engine_TextJustifier_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextJustifier_lineJustification,
+    (slotinfo_t*)&flash_text_engine_TextJustifier_locale,
+    (slotinfo_t*)&flash_text_engine_TextJustifier_clone,
+    0};
+static slotinfo_t* const flash_text_engine_TextJustifier_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextJustifier_getJustifierForLocale,
+    0};
+static slotinfo_t* const flash_text_engine_TextLine_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextLine_previousLine,
+    (slotinfo_t*)&flash_text_engine_TextLine_validity,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomTextBlockBeginIndex,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomWordBoundaryOnLeft,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomTextRotation,
+    (slotinfo_t*)&flash_text_engine_TextLine_textHeight,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomCenter,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomBounds,
+    (slotinfo_t*)&flash_text_engine_TextLine_mirrorRegions,
+    (slotinfo_t*)&flash_text_engine_TextLine_rawTextLength,
+    (slotinfo_t*)&flash_text_engine_TextLine_userData,
+    (slotinfo_t*)&flash_text_engine_TextLine_textWidth,
+    (slotinfo_t*)&flash_text_engine_TextLine_textBlock,
+    (slotinfo_t*)&flash_text_engine_TextLine_textBlockBeginIndex,
+    (slotinfo_t*)&flash_text_engine_TextLine_unjustifiedTextWidth,
+    (slotinfo_t*)&flash_text_engine_TextLine_ascent,
+    (slotinfo_t*)&flash_text_engine_TextLine_getBaselinePosition,
+    (slotinfo_t*)&flash_text_engine_TextLine_specifiedWidth,
+    (slotinfo_t*)&flash_text_engine_TextLine_getMirrorRegion,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomGraphic,
+    (slotinfo_t*)&flash_text_engine_TextLine_hasGraphicElement,
+    (slotinfo_t*)&flash_text_engine_TextLine_flushAtomData,
+    (slotinfo_t*)&flash_text_engine_TextLine_dump,
+    (slotinfo_t*)&flash_text_engine_TextLine_nextLine,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomIndexAtCharIndex,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomTextBlockEndIndex,
+    (slotinfo_t*)&flash_text_engine_TextLine_atomCount,
+    (slotinfo_t*)&flash_text_engine_TextLine_descent,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomBidiLevel,
+    (slotinfo_t*)&flash_text_engine_TextLine_getAtomIndexAtPoint,
+    0};
+static slotinfo_t* const flash_text_engine_TextLine_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextLine_MAX_LINE_WIDTH,
+    0};
+static slotinfo_t* const flash_text_engine_TextLineCreationResult_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextLineCreationResult_EMERGENCY,
+    (slotinfo_t*)&flash_text_engine_TextLineCreationResult_COMPLETE,
+    (slotinfo_t*)&flash_text_engine_TextLineCreationResult_SUCCESS,
+    (slotinfo_t*)&flash_text_engine_TextLineCreationResult_INSUFFICIENT_WIDTH,
+    0};
+static slotinfo_t* const flash_text_engine_TextLineMirrorRegion_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextLineMirrorRegion_mirror,
+    (slotinfo_t*)&flash_text_engine_TextLineMirrorRegion_previousRegion,
+    (slotinfo_t*)&flash_text_engine_TextLineMirrorRegion_bounds,
+    (slotinfo_t*)&flash_text_engine_TextLineMirrorRegion_nextRegion,
+    (slotinfo_t*)&flash_text_engine_TextLineMirrorRegion_element,
+    (slotinfo_t*)&flash_text_engine_TextLineMirrorRegion_textLine,
+    0};
+static slotinfo_t* const flash_text_engine_TextLineValidity_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextLineValidity_STATIC,
+    (slotinfo_t*)&flash_text_engine_TextLineValidity_VALID,
+    (slotinfo_t*)&flash_text_engine_TextLineValidity_INVALID,
+    (slotinfo_t*)&flash_text_engine_TextLineValidity_POSSIBLY_INVALID,
+    0};
+static slotinfo_t* const flash_text_engine_TextRotation_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_TextRotation_ROTATE_270,
+    (slotinfo_t*)&flash_text_engine_TextRotation_AUTO,
+    (slotinfo_t*)&flash_text_engine_TextRotation_ROTATE_0,
+    (slotinfo_t*)&flash_text_engine_TextRotation_ROTATE_90,
+    (slotinfo_t*)&flash_text_engine_TextRotation_ROTATE_180,
+    0};
+static slotinfo_t* const flash_text_engine_TypographicCase_static_members[] = {
+    (slotinfo_t*)&flash_text_engine_TypographicCase_UPPERCASE,
+    (slotinfo_t*)&flash_text_engine_TypographicCase_DEFAULT,
+    (slotinfo_t*)&flash_text_engine_TypographicCase_LOWERCASE,
+    (slotinfo_t*)&flash_text_engine_TypographicCase_SMALL_CAPS,
+    (slotinfo_t*)&flash_text_engine_TypographicCase_TITLE,
+    (slotinfo_t*)&flash_text_engine_TypographicCase_CAPS,
+    (slotinfo_t*)&flash_text_engine_TypographicCase_CAPS_AND_SMALL_CAPS,
+    0};
+static slotinfo_t* const flash_trace_Trace_static_members[] = {
+    (slotinfo_t*)&flash_trace_Trace_METHODS_AND_LINES_WITH_ARGS,
+    (slotinfo_t*)&flash_trace_Trace_FILE,
+    (slotinfo_t*)&flash_trace_Trace_METHODS_WITH_ARGS,
+    (slotinfo_t*)&flash_trace_Trace_OFF,
+    (slotinfo_t*)&flash_trace_Trace_METHODS_AND_LINES,
+    (slotinfo_t*)&flash_trace_Trace_LISTENER,
+    (slotinfo_t*)&flash_trace_Trace_getLevel,
+    (slotinfo_t*)&flash_trace_Trace_setLevel,
+    (slotinfo_t*)&flash_trace_Trace_setListener,
+    (slotinfo_t*)&flash_trace_Trace_getListener,
+    (slotinfo_t*)&flash_trace_Trace_METHODS,
+    0};
+static slotinfo_t* const flash_ui_ContextMenu_members[] = {
+    (slotinfo_t*)&flash_ui_ContextMenu_hideBuiltInItems,
+    (slotinfo_t*)&flash_ui_ContextMenu_clipboardItems,
+    (slotinfo_t*)&flash_ui_ContextMenu_builtInItems,
+    (slotinfo_t*)&flash_ui_ContextMenu_customItems,
+    (slotinfo_t*)&flash_ui_ContextMenu_clone,
+    (slotinfo_t*)&flash_ui_ContextMenu_link,
+    (slotinfo_t*)&flash_ui_ContextMenu_clipboardMenu,
+    0};
+static slotinfo_t* const flash_ui_ContextMenuBuiltInItems_members[] = {
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_zoom,
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_save,
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_loop,
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_print,
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_forwardAndBack,
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_rewind,
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_clone,
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_quality,
+    (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems_play,
+    0};
+static slotinfo_t* const flash_ui_ContextMenuClipboardItems_members[] = {
+    (slotinfo_t*)&flash_ui_ContextMenuClipboardItems_clear,
+    (slotinfo_t*)&flash_ui_ContextMenuClipboardItems_clone,
+    (slotinfo_t*)&flash_ui_ContextMenuClipboardItems_paste,
+    (slotinfo_t*)&flash_ui_ContextMenuClipboardItems_selectAll,
+    (slotinfo_t*)&flash_ui_ContextMenuClipboardItems_copy,
+    (slotinfo_t*)&flash_ui_ContextMenuClipboardItems_cut,
+    0};
+static slotinfo_t* const flash_ui_ContextMenuItem_members[] = {
+    (slotinfo_t*)&flash_ui_ContextMenuItem_separatorBefore,
+    (slotinfo_t*)&flash_ui_ContextMenuItem_enabled,
+    (slotinfo_t*)&flash_ui_ContextMenuItem_caption,
+    (slotinfo_t*)&flash_ui_ContextMenuItem_clone,
+    (slotinfo_t*)&flash_ui_ContextMenuItem_visible,
+    0};
+static slotinfo_t* const flash_ui_KeyLocation_static_members[] = {
+    (slotinfo_t*)&flash_ui_KeyLocation_LEFT,
+    (slotinfo_t*)&flash_ui_KeyLocation_RIGHT,
+    (slotinfo_t*)&flash_ui_KeyLocation_NUM_PAD,
+    (slotinfo_t*)&flash_ui_KeyLocation_STANDARD,
+    0};
+static slotinfo_t* const flash_ui_Keyboard_static_members[] = {
+    (slotinfo_t*)&flash_ui_Keyboard_PAGE_DOWN,
+    (slotinfo_t*)&flash_ui_Keyboard_F4,
+    (slotinfo_t*)&flash_ui_Keyboard_ENTER,
+    (slotinfo_t*)&flash_ui_Keyboard_CONTROL,
+    (slotinfo_t*)&flash_ui_Keyboard_F7,
+    (slotinfo_t*)&flash_ui_Keyboard_F14,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_3,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_DECIMAL,
+    (slotinfo_t*)&flash_ui_Keyboard_CAPS_LOCK,
+    (slotinfo_t*)&flash_ui_Keyboard_SHIFT,
+    (slotinfo_t*)&flash_ui_Keyboard_TAB,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_0,
+    (slotinfo_t*)&flash_ui_Keyboard_END,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_1,
+    (slotinfo_t*)&flash_ui_Keyboard_LEFT,
+    (slotinfo_t*)&flash_ui_Keyboard_F8,
+    (slotinfo_t*)&flash_ui_Keyboard_F9,
+    (slotinfo_t*)&flash_ui_Keyboard_numLock,
+    (slotinfo_t*)&flash_ui_Keyboard_F2,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_4,
+    (slotinfo_t*)&flash_ui_Keyboard_F3,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_2,
+    (slotinfo_t*)&flash_ui_Keyboard_HOME,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_7,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_6,
+    (slotinfo_t*)&flash_ui_Keyboard_F6,
+    (slotinfo_t*)&flash_ui_Keyboard_F5,
+    (slotinfo_t*)&flash_ui_Keyboard_INSERT,
+    (slotinfo_t*)&flash_ui_Keyboard_ESCAPE,
+    (slotinfo_t*)&flash_ui_Keyboard_F1,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_SUBTRACT,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_8,
+    (slotinfo_t*)&flash_ui_Keyboard_SPACE,
+    (slotinfo_t*)&flash_ui_Keyboard_BACKSPACE,
+    (slotinfo_t*)&flash_ui_Keyboard_DELETE,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_MULTIPLY,
+    (slotinfo_t*)&flash_ui_Keyboard_F13,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_ADD,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_9,
+    (slotinfo_t*)&flash_ui_Keyboard_F12,
+    (slotinfo_t*)&flash_ui_Keyboard_RIGHT,
+    (slotinfo_t*)&flash_ui_Keyboard_F15,
+    (slotinfo_t*)&flash_ui_Keyboard_F11,
+    (slotinfo_t*)&flash_ui_Keyboard_UP,
+    (slotinfo_t*)&flash_ui_Keyboard_isAccessible,
+    (slotinfo_t*)&flash_ui_Keyboard_DOWN,
+    (slotinfo_t*)&flash_ui_Keyboard_capsLock,
+    (slotinfo_t*)&flash_ui_Keyboard_PAGE_UP,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_ENTER,
+    (slotinfo_t*)&flash_ui_Keyboard_F10,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_5,
+    (slotinfo_t*)&flash_ui_Keyboard_NUMPAD_DIVIDE,
+    0};
+static slotinfo_t* const flash_ui_Mouse_static_members[] = {
+    (slotinfo_t*)&flash_ui_Mouse_cursor,
+    (slotinfo_t*)&flash_ui_Mouse_show,
+    (slotinfo_t*)&flash_ui_Mouse_hide,
+    0};
+static slotinfo_t* const flash_ui_MouseCursor_static_members[] = {
+    (slotinfo_t*)&flash_ui_MouseCursor_BUTTON,
+    (slotinfo_t*)&flash_ui_MouseCursor_AUTO,
+    (slotinfo_t*)&flash_ui_MouseCursor_ARROW,
+    (slotinfo_t*)&flash_ui_MouseCursor_IBEAM,
+    (slotinfo_t*)&flash_ui_MouseCursor_HAND,
+    0};
+static slotinfo_t* const flash_utils_ByteArray_members[] = {
+    (slotinfo_t*)&flash_utils_ByteArray_writeBoolean,
+    (slotinfo_t*)&flash_utils_ByteArray_readDouble,
+    (slotinfo_t*)&flash_utils_ByteArray_toString,
+    (slotinfo_t*)&flash_utils_ByteArray_writeByte,
+    (slotinfo_t*)&flash_utils_ByteArray_writeObject,
+    (slotinfo_t*)&flash_utils_ByteArray_readUTFBytes,
+    (slotinfo_t*)&flash_utils_ByteArray_writeMultiByte,
+    (slotinfo_t*)&flash_utils_ByteArray_uncompress,
+    (slotinfo_t*)&flash_utils_ByteArray_readUnsignedByte,
+    (slotinfo_t*)&flash_utils_ByteArray_writeInt,
+    (slotinfo_t*)&flash_utils_ByteArray_deflate,
+    (slotinfo_t*)&flash_utils_ByteArray_readMultiByte,
+    (slotinfo_t*)&flash_utils_ByteArray_readBytes,
+    (slotinfo_t*)&flash_utils_ByteArray_writeShort,
+    (slotinfo_t*)&flash_utils_ByteArray_position,
+    (slotinfo_t*)&flash_utils_ByteArray_readShort,
+    (slotinfo_t*)&flash_utils_ByteArray_writeUTF,
+    (slotinfo_t*)&flash_utils_ByteArray_writeBytes,
+    (slotinfo_t*)&flash_utils_ByteArray_objectEncoding,
+    (slotinfo_t*)&flash_utils_ByteArray_readObject,
+    (slotinfo_t*)&flash_utils_ByteArray_length,
+    (slotinfo_t*)&flash_utils_ByteArray_writeUnsignedInt,
+    (slotinfo_t*)&flash_utils_ByteArray_writeDouble,
+    (slotinfo_t*)&flash_utils_ByteArray_writeFloat,
+    (slotinfo_t*)&flash_utils_ByteArray_readInt,
+    (slotinfo_t*)&flash_utils_ByteArray_readByte,
+    (slotinfo_t*)&flash_utils_ByteArray_bytesAvailable,
+    (slotinfo_t*)&flash_utils_ByteArray_clear,
+    (slotinfo_t*)&flash_utils_ByteArray_endian,
+    (slotinfo_t*)&flash_utils_ByteArray_readUnsignedShort,
+    (slotinfo_t*)&flash_utils_ByteArray_readUnsignedInt,
+    (slotinfo_t*)&flash_utils_ByteArray_readFloat,
+    (slotinfo_t*)&flash_utils_ByteArray_compress,
+    (slotinfo_t*)&flash_utils_ByteArray_writeUTFBytes,
+    (slotinfo_t*)&flash_utils_ByteArray_readBoolean,
+    (slotinfo_t*)&flash_utils_ByteArray_inflate,
+    (slotinfo_t*)&flash_utils_ByteArray_readUTF,
+    0};
+static slotinfo_t* const flash_utils_ByteArray_static_members[] = {
+    (slotinfo_t*)&flash_utils_ByteArray_defaultObjectEncoding,
+    0};
+static slotinfo_t* const flash_utils_Endian_static_members[] = {
+    (slotinfo_t*)&flash_utils_Endian_LITTLE_ENDIAN,
+    (slotinfo_t*)&flash_utils_Endian_BIG_ENDIAN,
+    0};
+static slotinfo_t* const flash_utils_IDataInput_members[] = {
+    (slotinfo_t*)&flash_utils_IDataInput_readUTF,
+    (slotinfo_t*)&flash_utils_IDataInput_readByte,
+    (slotinfo_t*)&flash_utils_IDataInput_readUTFBytes,
+    (slotinfo_t*)&flash_utils_IDataInput_readShort,
+    (slotinfo_t*)&flash_utils_IDataInput_objectEncoding,
+    (slotinfo_t*)&flash_utils_IDataInput_readUnsignedInt,
+    (slotinfo_t*)&flash_utils_IDataInput_readDouble,
+    (slotinfo_t*)&flash_utils_IDataInput_readBytes,
+    (slotinfo_t*)&flash_utils_IDataInput_readUnsignedByte,
+    (slotinfo_t*)&flash_utils_IDataInput_readMultiByte,
+    (slotinfo_t*)&flash_utils_IDataInput_readInt,
+    (slotinfo_t*)&flash_utils_IDataInput_bytesAvailable,
+    (slotinfo_t*)&flash_utils_IDataInput_readUnsignedShort,
+    (slotinfo_t*)&flash_utils_IDataInput_readObject,
+    (slotinfo_t*)&flash_utils_IDataInput_readFloat,
+    (slotinfo_t*)&flash_utils_IDataInput_endian,
+    (slotinfo_t*)&flash_utils_IDataInput_readBoolean,
+    0};
+static slotinfo_t* const flash_utils_IDataOutput_members[] = {
+    (slotinfo_t*)&flash_utils_IDataOutput_writeUnsignedInt,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeInt,
+    (slotinfo_t*)&flash_utils_IDataOutput_objectEncoding,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeUTFBytes,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeObject,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeMultiByte,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeShort,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeFloat,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeUTF,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeByte,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeBoolean,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeDouble,
+    (slotinfo_t*)&flash_utils_IDataOutput_writeBytes,
+    (slotinfo_t*)&flash_utils_IDataOutput_endian,
+    0};
+static slotinfo_t* const flash_utils_IExternalizable_members[] = {
+    (slotinfo_t*)&flash_utils_IExternalizable_readExternal,
+    (slotinfo_t*)&flash_utils_IExternalizable_writeExternal,
+    0};
+static slotinfo_t* const flash_utils_Proxy_members[] = {
+    (slotinfo_t*)&flash_utils_Proxy_callProperty,
+    (slotinfo_t*)&flash_utils_Proxy_setProperty,
+    (slotinfo_t*)&flash_utils_Proxy_getProperty,
+    (slotinfo_t*)&flash_utils_Proxy_nextName,
+    (slotinfo_t*)&flash_utils_Proxy_nextNameIndex,
+    (slotinfo_t*)&flash_utils_Proxy_hasProperty,
+    (slotinfo_t*)&flash_utils_Proxy_deleteProperty,
+    (slotinfo_t*)&flash_utils_Proxy_getDescendants,
+    (slotinfo_t*)&flash_utils_Proxy_isAttribute,
+    (slotinfo_t*)&flash_utils_Proxy_nextValue,
+    0};
+static slotinfo_t* const flash_utils_Timer_members[] = {
+    (slotinfo_t*)&flash_utils_Timer_reset,
+    (slotinfo_t*)&flash_utils_Timer_running,
+    (slotinfo_t*)&flash_utils_Timer_repeatCount,
+    (slotinfo_t*)&flash_utils_Timer_stop,
+    (slotinfo_t*)&flash_utils_Timer_start,
+    (slotinfo_t*)&flash_utils_Timer_currentCount,
+    (slotinfo_t*)&flash_utils_Timer_delay,
+    0};
+static slotinfo_t* const flash_xml_XMLDocument_members[] = {
+    (slotinfo_t*)&flash_xml_XMLDocument_docTypeDecl,
+    (slotinfo_t*)&flash_xml_XMLDocument_idMap,
+    (slotinfo_t*)&flash_xml_XMLDocument_toString,
+    (slotinfo_t*)&flash_xml_XMLDocument_xmlDecl,
+    (slotinfo_t*)&flash_xml_XMLDocument_createElement,
+    (slotinfo_t*)&flash_xml_XMLDocument_ignoreWhite,
+    (slotinfo_t*)&flash_xml_XMLDocument_createTextNode,
+    (slotinfo_t*)&flash_xml_XMLDocument_parseXML,
+    0};
+static slotinfo_t* const flash_xml_XMLNode_members[] = {
+    (slotinfo_t*)&flash_xml_XMLNode_childNodes,
+    (slotinfo_t*)&flash_xml_XMLNode_appendChild,
+    (slotinfo_t*)&flash_xml_XMLNode_nextSibling,
+    (slotinfo_t*)&flash_xml_XMLNode_nodeType,
+    (slotinfo_t*)&flash_xml_XMLNode_attributes,
+    (slotinfo_t*)&flash_xml_XMLNode_firstChild,
+    (slotinfo_t*)&flash_xml_XMLNode_parentNode,
+    (slotinfo_t*)&flash_xml_XMLNode_toString,
+    (slotinfo_t*)&flash_xml_XMLNode_prefix,
+    (slotinfo_t*)&flash_xml_XMLNode_localName,
+    (slotinfo_t*)&flash_xml_XMLNode_nodeName,
+    (slotinfo_t*)&flash_xml_XMLNode_getNamespaceForPrefix,
+    (slotinfo_t*)&flash_xml_XMLNode_insertBefore,
+    (slotinfo_t*)&flash_xml_XMLNode_lastChild,
+    (slotinfo_t*)&flash_xml_XMLNode_cloneNode,
+    (slotinfo_t*)&flash_xml_XMLNode_removeNode,
+    (slotinfo_t*)&flash_xml_XMLNode_namespaceURI,
+    (slotinfo_t*)&flash_xml_XMLNode_previousSibling,
+    (slotinfo_t*)&flash_xml_XMLNode_hasChildNodes,
+    (slotinfo_t*)&flash_xml_XMLNode_getPrefixForNamespace,
+    (slotinfo_t*)&flash_xml_XMLNode_nodeValue,
+    0};
+static slotinfo_t* const flash_xml_XMLNodeType_static_members[] = {
+    (slotinfo_t*)&flash_xml_XMLNodeType_PROCESSING_INSTRUCTION_NODE,
+    (slotinfo_t*)&flash_xml_XMLNodeType_CDATA_NODE,
+    (slotinfo_t*)&flash_xml_XMLNodeType_DOCUMENT_TYPE_NODE,
+    (slotinfo_t*)&flash_xml_XMLNodeType_COMMENT_NODE,
+    (slotinfo_t*)&flash_xml_XMLNodeType_XML_DECLARATION,
+    (slotinfo_t*)&flash_xml_XMLNodeType_TEXT_NODE,
+    (slotinfo_t*)&flash_xml_XMLNodeType_ELEMENT_NODE,
+    0};
+
+static const builtin_t builtins[] = {
+    {"", "AS3", (slotinfo_t*)&_AS3, 0, 0},
+    {"", "ArgumentError", (slotinfo_t*)&_ArgumentError, 0, _ArgumentError_static_members},
+    {"", "Array", (slotinfo_t*)&_Array, _Array_members, _Array_static_members},
+    {"", "Boolean", (slotinfo_t*)&_Boolean, _Boolean_members, _Boolean_static_members},
+    {"", "Class", (slotinfo_t*)&_Class, _Class_members, _Class_static_members},
+    {"", "Date", (slotinfo_t*)&_Date, _Date_members, _Date_static_members},
+    {"", "DefinitionError", (slotinfo_t*)&_DefinitionError, 0, _DefinitionError_static_members},
+    {"", "Error", (slotinfo_t*)&_Error, _Error_members, _Error_static_members},
+    {"", "EvalError", (slotinfo_t*)&_EvalError, 0, _EvalError_static_members},
+    {"", "Function", (slotinfo_t*)&_Function, _Function_members, 0},
+    {"", "Infinity", (slotinfo_t*)&_Infinity, 0, 0},
+    {"", "Math", (slotinfo_t*)&_Math, 0, _Math_static_members},
+    {"", "NaN", (slotinfo_t*)&_NaN, 0, 0},
+    {"", "Namespace", (slotinfo_t*)&_Namespace, _Namespace_members, _Namespace_static_members},
+    {"", "Number", (slotinfo_t*)&_Number, _Number_members, _Number_static_members},
+    {"", "Object", (slotinfo_t*)&_Object, _Object_members, _Object_static_members},
+    {"", "QName", (slotinfo_t*)&_QName, _QName_members, _QName_static_members},
+    {"", "RangeError", (slotinfo_t*)&_RangeError, 0, _RangeError_static_members},
+    {"", "ReferenceError", (slotinfo_t*)&_ReferenceError, 0, _ReferenceError_static_members},
+    {"", "RegExp", (slotinfo_t*)&_RegExp, _RegExp_members, _RegExp_static_members},
+    {"", "SecurityError", (slotinfo_t*)&_SecurityError, 0, _SecurityError_static_members},
+    {"", "String", (slotinfo_t*)&_String, _String_members, _String_static_members},
+    {"", "SyntaxError", (slotinfo_t*)&_SyntaxError, 0, _SyntaxError_static_members},
+    {"", "TypeError", (slotinfo_t*)&_TypeError, 0, _TypeError_static_members},
+    {"", "URIError", (slotinfo_t*)&_URIError, 0, _URIError_static_members},
+    {"", "UninitializedError", (slotinfo_t*)&_UninitializedError, 0, _UninitializedError_static_members},
+    {"", "VerifyError", (slotinfo_t*)&_VerifyError, 0, _VerifyError_static_members},
+    {"", "XML", (slotinfo_t*)&_XML, _XML_members, _XML_static_members},
+    {"", "XMLList", (slotinfo_t*)&_XMLList, _XMLList_members, 0},
+    {"", "decodeURI", (slotinfo_t*)&_decodeURI, 0, 0},
+    {"", "decodeURIComponent", (slotinfo_t*)&_decodeURIComponent, 0, 0},
+    {"", "encodeURI", (slotinfo_t*)&_encodeURI, 0, 0},
+    {"", "encodeURIComponent", (slotinfo_t*)&_encodeURIComponent, 0, 0},
+    {"", "escape", (slotinfo_t*)&_escape, 0, 0},
+    {"", "int", (slotinfo_t*)&_int, _int_members, _int_static_members},
+    {"", "isFinite", (slotinfo_t*)&_isFinite, 0, 0},
+    {"", "isNaN", (slotinfo_t*)&_isNaN, 0, 0},
+    {"", "isXMLName", (slotinfo_t*)&_isXMLName, 0, 0},
+    {"", "parseFloat", (slotinfo_t*)&_parseFloat, 0, 0},
+    {"", "parseInt", (slotinfo_t*)&_parseInt, 0, 0},
+    {"", "trace", (slotinfo_t*)&_trace, 0, 0},
+    {"", "uint", (slotinfo_t*)&_uint, _uint_members, _uint_static_members},
+    {"", "undefined", (slotinfo_t*)&_undefined, 0, 0},
+    {"", "unescape", (slotinfo_t*)&_unescape, 0, 0},
+    {"__AS3__.vec", "Vector", (slotinfo_t*)&__AS3___vec_Vector, 0, 0},
+    {"adobe.utils", "CustomActions", (slotinfo_t*)&adobe_utils_CustomActions, 0, adobe_utils_CustomActions_static_members},
+    {"adobe.utils", "MMEndCommand", (slotinfo_t*)&adobe_utils_MMEndCommand, 0, 0},
+    {"adobe.utils", "MMExecute", (slotinfo_t*)&adobe_utils_MMExecute, 0, 0},
+    {"adobe.utils", "ProductManager", (slotinfo_t*)&adobe_utils_ProductManager, adobe_utils_ProductManager_members, 0},
+    {"adobe.utils", "XMLUI", (slotinfo_t*)&adobe_utils_XMLUI, 0, adobe_utils_XMLUI_static_members},
+    {"flash.accessibility", "Accessibility", (slotinfo_t*)&flash_accessibility_Accessibility, 0, flash_accessibility_Accessibility_static_members},
+    {"flash.accessibility", "AccessibilityImplementation", (slotinfo_t*)&flash_accessibility_AccessibilityImplementation, flash_accessibility_AccessibilityImplementation_members, 0},
+    {"flash.accessibility", "AccessibilityProperties", (slotinfo_t*)&flash_accessibility_AccessibilityProperties, flash_accessibility_AccessibilityProperties_members, 0},
+    {"flash.debugger", "enterDebugger", (slotinfo_t*)&flash_debugger_enterDebugger, 0, 0},
+    {"flash.desktop", "Clipboard", (slotinfo_t*)&flash_desktop_Clipboard, flash_desktop_Clipboard_members, flash_desktop_Clipboard_static_members},
+    {"flash.desktop", "ClipboardFormats", (slotinfo_t*)&flash_desktop_ClipboardFormats, 0, flash_desktop_ClipboardFormats_static_members},
+    {"flash.desktop", "ClipboardTransferMode", (slotinfo_t*)&flash_desktop_ClipboardTransferMode, 0, flash_desktop_ClipboardTransferMode_static_members},
+    {"flash.display", "AVM1Movie", (slotinfo_t*)&flash_display_AVM1Movie, flash_display_AVM1Movie_members, 0},
+    {"flash.display", "ActionScriptVersion", (slotinfo_t*)&flash_display_ActionScriptVersion, 0, flash_display_ActionScriptVersion_static_members},
+    {"flash.display", "Bitmap", (slotinfo_t*)&flash_display_Bitmap, flash_display_Bitmap_members, 0},
+    {"flash.display", "BitmapData", (slotinfo_t*)&flash_display_BitmapData, flash_display_BitmapData_members, 0},
+    {"flash.display", "BitmapDataChannel", (slotinfo_t*)&flash_display_BitmapDataChannel, 0, flash_display_BitmapDataChannel_static_members},
+    {"flash.display", "BlendMode", (slotinfo_t*)&flash_display_BlendMode, 0, flash_display_BlendMode_static_members},
+    {"flash.display", "CapsStyle", (slotinfo_t*)&flash_display_CapsStyle, 0, flash_display_CapsStyle_static_members},
+    {"flash.display", "ColorCorrection", (slotinfo_t*)&flash_display_ColorCorrection, 0, flash_display_ColorCorrection_static_members},
+    {"flash.display", "ColorCorrectionSupport", (slotinfo_t*)&flash_display_ColorCorrectionSupport, 0, flash_display_ColorCorrectionSupport_static_members},
+    {"flash.display", "DisplayObject", (slotinfo_t*)&flash_display_DisplayObject, flash_display_DisplayObject_members, 0},
+    {"flash.display", "DisplayObjectContainer", (slotinfo_t*)&flash_display_DisplayObjectContainer, flash_display_DisplayObjectContainer_members, 0},
+    {"flash.display", "FrameLabel", (slotinfo_t*)&flash_display_FrameLabel, flash_display_FrameLabel_members, 0},
+    {"flash.display", "GradientType", (slotinfo_t*)&flash_display_GradientType, 0, flash_display_GradientType_static_members},
+    {"flash.display", "Graphics", (slotinfo_t*)&flash_display_Graphics, flash_display_Graphics_members, 0},
+    {"flash.display", "GraphicsBitmapFill", (slotinfo_t*)&flash_display_GraphicsBitmapFill, flash_display_GraphicsBitmapFill_members, 0},
+    {"flash.display", "GraphicsEndFill", (slotinfo_t*)&flash_display_GraphicsEndFill, 0, 0},
+    {"flash.display", "GraphicsGradientFill", (slotinfo_t*)&flash_display_GraphicsGradientFill, flash_display_GraphicsGradientFill_members, 0},
+    {"flash.display", "GraphicsPath", (slotinfo_t*)&flash_display_GraphicsPath, flash_display_GraphicsPath_members, 0},
+    {"flash.display", "GraphicsPathCommand", (slotinfo_t*)&flash_display_GraphicsPathCommand, 0, flash_display_GraphicsPathCommand_static_members},
+    {"flash.display", "GraphicsPathWinding", (slotinfo_t*)&flash_display_GraphicsPathWinding, 0, flash_display_GraphicsPathWinding_static_members},
+    {"flash.display", "GraphicsShaderFill", (slotinfo_t*)&flash_display_GraphicsShaderFill, flash_display_GraphicsShaderFill_members, 0},
+    {"flash.display", "GraphicsSolidFill", (slotinfo_t*)&flash_display_GraphicsSolidFill, flash_display_GraphicsSolidFill_members, 0},
+    {"flash.display", "GraphicsStroke", (slotinfo_t*)&flash_display_GraphicsStroke, flash_display_GraphicsStroke_members, 0},
+    {"flash.display", "GraphicsTrianglePath", (slotinfo_t*)&flash_display_GraphicsTrianglePath, flash_display_GraphicsTrianglePath_members, 0},
+    {"flash.display", "IBitmapDrawable", (slotinfo_t*)&flash_display_IBitmapDrawable, 0, 0},
+    {"flash.display", "IGraphicsData", (slotinfo_t*)&flash_display_IGraphicsData, 0, 0},
+    {"flash.display", "IGraphicsFill", (slotinfo_t*)&flash_display_IGraphicsFill, 0, 0},
+    {"flash.display", "IGraphicsPath", (slotinfo_t*)&flash_display_IGraphicsPath, 0, 0},
+    {"flash.display", "IGraphicsStroke", (slotinfo_t*)&flash_display_IGraphicsStroke, 0, 0},
+    {"flash.display", "InteractiveObject", (slotinfo_t*)&flash_display_InteractiveObject, flash_display_InteractiveObject_members, 0},
+    {"flash.display", "InterpolationMethod", (slotinfo_t*)&flash_display_InterpolationMethod, 0, flash_display_InterpolationMethod_static_members},
+    {"flash.display", "JointStyle", (slotinfo_t*)&flash_display_JointStyle, 0, flash_display_JointStyle_static_members},
+    {"flash.display", "LineScaleMode", (slotinfo_t*)&flash_display_LineScaleMode, 0, flash_display_LineScaleMode_static_members},
+    {"flash.display", "Loader", (slotinfo_t*)&flash_display_Loader, flash_display_Loader_members, 0},
+    {"flash.display", "LoaderInfo", (slotinfo_t*)&flash_display_LoaderInfo, flash_display_LoaderInfo_members, flash_display_LoaderInfo_static_members},
+    {"flash.display", "MorphShape", (slotinfo_t*)&flash_display_MorphShape, 0, 0},
+    {"flash.display", "MovieClip", (slotinfo_t*)&flash_display_MovieClip, flash_display_MovieClip_members, 0},
+    {"flash.display", "PixelSnapping", (slotinfo_t*)&flash_display_PixelSnapping, 0, flash_display_PixelSnapping_static_members},
+    {"flash.display", "SWFVersion", (slotinfo_t*)&flash_display_SWFVersion, 0, flash_display_SWFVersion_static_members},
+    {"flash.display", "Scene", (slotinfo_t*)&flash_display_Scene, flash_display_Scene_members, 0},
+    {"flash.display", "Shader", (slotinfo_t*)&flash_display_Shader, flash_display_Shader_members, 0},
+    {"flash.display", "ShaderData", (slotinfo_t*)&flash_display_ShaderData, 0, 0},
+    {"flash.display", "ShaderInput", (slotinfo_t*)&flash_display_ShaderInput, flash_display_ShaderInput_members, 0},
+    {"flash.display", "ShaderJob", (slotinfo_t*)&flash_display_ShaderJob, flash_display_ShaderJob_members, 0},
+    {"flash.display", "ShaderParameter", (slotinfo_t*)&flash_display_ShaderParameter, flash_display_ShaderParameter_members, 0},
+    {"flash.display", "ShaderParameterType", (slotinfo_t*)&flash_display_ShaderParameterType, 0, flash_display_ShaderParameterType_static_members},
+    {"flash.display", "ShaderPrecision", (slotinfo_t*)&flash_display_ShaderPrecision, 0, flash_display_ShaderPrecision_static_members},
+    {"flash.display", "Shape", (slotinfo_t*)&flash_display_Shape, flash_display_Shape_members, 0},
+    {"flash.display", "SimpleButton", (slotinfo_t*)&flash_display_SimpleButton, flash_display_SimpleButton_members, 0},
+    {"flash.display", "SpreadMethod", (slotinfo_t*)&flash_display_SpreadMethod, 0, flash_display_SpreadMethod_static_members},
+    {"flash.display", "Sprite", (slotinfo_t*)&flash_display_Sprite, flash_display_Sprite_members, 0},
+    {"flash.display", "Stage", (slotinfo_t*)&flash_display_Stage, flash_display_Stage_members, 0},
+    {"flash.display", "StageAlign", (slotinfo_t*)&flash_display_StageAlign, 0, flash_display_StageAlign_static_members},
+    {"flash.display", "StageDisplayState", (slotinfo_t*)&flash_display_StageDisplayState, 0, flash_display_StageDisplayState_static_members},
+    {"flash.display", "StageQuality", (slotinfo_t*)&flash_display_StageQuality, 0, flash_display_StageQuality_static_members},
+    {"flash.display", "StageScaleMode", (slotinfo_t*)&flash_display_StageScaleMode, 0, flash_display_StageScaleMode_static_members},
+    {"flash.display", "TriangleCulling", (slotinfo_t*)&flash_display_TriangleCulling, 0, flash_display_TriangleCulling_static_members},
+    {"flash.errors", "EOFError", (slotinfo_t*)&flash_errors_EOFError, 0, 0},
+    {"flash.errors", "IOError", (slotinfo_t*)&flash_errors_IOError, 0, 0},
+    {"flash.errors", "IllegalOperationError", (slotinfo_t*)&flash_errors_IllegalOperationError, 0, 0},
+    {"flash.errors", "InvalidSWFError", (slotinfo_t*)&flash_errors_InvalidSWFError, 0, 0},
+    {"flash.errors", "MemoryError", (slotinfo_t*)&flash_errors_MemoryError, 0, 0},
+    {"flash.errors", "ScriptTimeoutError", (slotinfo_t*)&flash_errors_ScriptTimeoutError, 0, 0},
+    {"flash.errors", "StackOverflowError", (slotinfo_t*)&flash_errors_StackOverflowError, 0, 0},
+    {"flash.events", "ActivityEvent", (slotinfo_t*)&flash_events_ActivityEvent, flash_events_ActivityEvent_members, flash_events_ActivityEvent_static_members},
+    {"flash.events", "AsyncErrorEvent", (slotinfo_t*)&flash_events_AsyncErrorEvent, flash_events_AsyncErrorEvent_members, flash_events_AsyncErrorEvent_static_members},
+    {"flash.events", "ContextMenuEvent", (slotinfo_t*)&flash_events_ContextMenuEvent, flash_events_ContextMenuEvent_members, flash_events_ContextMenuEvent_static_members},
+    {"flash.events", "DataEvent", (slotinfo_t*)&flash_events_DataEvent, flash_events_DataEvent_members, flash_events_DataEvent_static_members},
+    {"flash.events", "ErrorEvent", (slotinfo_t*)&flash_events_ErrorEvent, flash_events_ErrorEvent_members, flash_events_ErrorEvent_static_members},
+    {"flash.events", "Event", (slotinfo_t*)&flash_events_Event, flash_events_Event_members, flash_events_Event_static_members},
+    {"flash.events", "EventDispatcher", (slotinfo_t*)&flash_events_EventDispatcher, flash_events_EventDispatcher_members, 0},
+    {"flash.events", "EventPhase", (slotinfo_t*)&flash_events_EventPhase, 0, flash_events_EventPhase_static_members},
+    {"flash.events", "FocusEvent", (slotinfo_t*)&flash_events_FocusEvent, flash_events_FocusEvent_members, flash_events_FocusEvent_static_members},
+    {"flash.events", "FullScreenEvent", (slotinfo_t*)&flash_events_FullScreenEvent, flash_events_FullScreenEvent_members, flash_events_FullScreenEvent_static_members},
+    {"flash.events", "HTTPStatusEvent", (slotinfo_t*)&flash_events_HTTPStatusEvent, flash_events_HTTPStatusEvent_members, flash_events_HTTPStatusEvent_static_members},
+    {"flash.events", "IEventDispatcher", (slotinfo_t*)&flash_events_IEventDispatcher, flash_events_IEventDispatcher_members, 0},
+    {"flash.events", "IMEEvent", (slotinfo_t*)&flash_events_IMEEvent, flash_events_IMEEvent_members, flash_events_IMEEvent_static_members},
+    {"flash.events", "IOErrorEvent", (slotinfo_t*)&flash_events_IOErrorEvent, flash_events_IOErrorEvent_members, flash_events_IOErrorEvent_static_members},
+    {"flash.events", "KeyboardEvent", (slotinfo_t*)&flash_events_KeyboardEvent, flash_events_KeyboardEvent_members, flash_events_KeyboardEvent_static_members},
+    {"flash.events", "MouseEvent", (slotinfo_t*)&flash_events_MouseEvent, flash_events_MouseEvent_members, flash_events_MouseEvent_static_members},
+    {"flash.events", "NetFilterEvent", (slotinfo_t*)&flash_events_NetFilterEvent, flash_events_NetFilterEvent_members, 0},
+    {"flash.events", "NetStatusEvent", (slotinfo_t*)&flash_events_NetStatusEvent, flash_events_NetStatusEvent_members, flash_events_NetStatusEvent_static_members},
+    {"flash.events", "ProgressEvent", (slotinfo_t*)&flash_events_ProgressEvent, flash_events_ProgressEvent_members, flash_events_ProgressEvent_static_members},
+    {"flash.events", "SampleDataEvent", (slotinfo_t*)&flash_events_SampleDataEvent, flash_events_SampleDataEvent_members, flash_events_SampleDataEvent_static_members},
+    {"flash.events", "SecurityErrorEvent", (slotinfo_t*)&flash_events_SecurityErrorEvent, flash_events_SecurityErrorEvent_members, flash_events_SecurityErrorEvent_static_members},
+    {"flash.events", "ShaderEvent", (slotinfo_t*)&flash_events_ShaderEvent, flash_events_ShaderEvent_members, flash_events_ShaderEvent_static_members},
+    {"flash.events", "StatusEvent", (slotinfo_t*)&flash_events_StatusEvent, flash_events_StatusEvent_members, flash_events_StatusEvent_static_members},
+    {"flash.events", "SyncEvent", (slotinfo_t*)&flash_events_SyncEvent, flash_events_SyncEvent_members, flash_events_SyncEvent_static_members},
+    {"flash.events", "TextEvent", (slotinfo_t*)&flash_events_TextEvent, flash_events_TextEvent_members, flash_events_TextEvent_static_members},
+    {"flash.events", "TimerEvent", (slotinfo_t*)&flash_events_TimerEvent, flash_events_TimerEvent_members, flash_events_TimerEvent_static_members},
+    {"flash.external", "ExternalInterface", (slotinfo_t*)&flash_external_ExternalInterface, 0, flash_external_ExternalInterface_static_members},
+    {"flash.filters", "BevelFilter", (slotinfo_t*)&flash_filters_BevelFilter, flash_filters_BevelFilter_members, 0},
+    {"flash.filters", "BitmapFilter", (slotinfo_t*)&flash_filters_BitmapFilter, flash_filters_BitmapFilter_members, 0},
+    {"flash.filters", "BitmapFilterQuality", (slotinfo_t*)&flash_filters_BitmapFilterQuality, 0, flash_filters_BitmapFilterQuality_static_members},
+    {"flash.filters", "BitmapFilterType", (slotinfo_t*)&flash_filters_BitmapFilterType, 0, flash_filters_BitmapFilterType_static_members},
+    {"flash.filters", "BlurFilter", (slotinfo_t*)&flash_filters_BlurFilter, flash_filters_BlurFilter_members, 0},
+    {"flash.filters", "ColorMatrixFilter", (slotinfo_t*)&flash_filters_ColorMatrixFilter, flash_filters_ColorMatrixFilter_members, 0},
+    {"flash.filters", "ConvolutionFilter", (slotinfo_t*)&flash_filters_ConvolutionFilter, flash_filters_ConvolutionFilter_members, 0},
+    {"flash.filters", "DisplacementMapFilter", (slotinfo_t*)&flash_filters_DisplacementMapFilter, flash_filters_DisplacementMapFilter_members, 0},
+    {"flash.filters", "DisplacementMapFilterMode", (slotinfo_t*)&flash_filters_DisplacementMapFilterMode, 0, flash_filters_DisplacementMapFilterMode_static_members},
+    {"flash.filters", "DropShadowFilter", (slotinfo_t*)&flash_filters_DropShadowFilter, flash_filters_DropShadowFilter_members, 0},
+    {"flash.filters", "GlowFilter", (slotinfo_t*)&flash_filters_GlowFilter, flash_filters_GlowFilter_members, 0},
+    {"flash.filters", "GradientBevelFilter", (slotinfo_t*)&flash_filters_GradientBevelFilter, flash_filters_GradientBevelFilter_members, 0},
+    {"flash.filters", "GradientGlowFilter", (slotinfo_t*)&flash_filters_GradientGlowFilter, flash_filters_GradientGlowFilter_members, 0},
+    {"flash.filters", "ShaderFilter", (slotinfo_t*)&flash_filters_ShaderFilter, flash_filters_ShaderFilter_members, 0},
+    {"flash.geom", "ColorTransform", (slotinfo_t*)&flash_geom_ColorTransform, flash_geom_ColorTransform_members, 0},
+    {"flash.geom", "Matrix", (slotinfo_t*)&flash_geom_Matrix, flash_geom_Matrix_members, 0},
+    {"flash.geom", "Matrix3D", (slotinfo_t*)&flash_geom_Matrix3D, flash_geom_Matrix3D_members, flash_geom_Matrix3D_static_members},
+    {"flash.geom", "Orientation3D", (slotinfo_t*)&flash_geom_Orientation3D, 0, flash_geom_Orientation3D_static_members},
+    {"flash.geom", "PerspectiveProjection", (slotinfo_t*)&flash_geom_PerspectiveProjection, flash_geom_PerspectiveProjection_members, 0},
+    {"flash.geom", "Point", (slotinfo_t*)&flash_geom_Point, flash_geom_Point_members, flash_geom_Point_static_members},
+    {"flash.geom", "Rectangle", (slotinfo_t*)&flash_geom_Rectangle, flash_geom_Rectangle_members, 0},
+    {"flash.geom", "Transform", (slotinfo_t*)&flash_geom_Transform, flash_geom_Transform_members, 0},
+    {"flash.geom", "Utils3D", (slotinfo_t*)&flash_geom_Utils3D, 0, flash_geom_Utils3D_static_members},
+    {"flash.geom", "Vector3D", (slotinfo_t*)&flash_geom_Vector3D, flash_geom_Vector3D_members, flash_geom_Vector3D_static_members},
+    {"flash.media", "Camera", (slotinfo_t*)&flash_media_Camera, flash_media_Camera_members, flash_media_Camera_static_members},
+    {"flash.media", "ID3Info", (slotinfo_t*)&flash_media_ID3Info, flash_media_ID3Info_members, 0},
+    {"flash.media", "Microphone", (slotinfo_t*)&flash_media_Microphone, flash_media_Microphone_members, flash_media_Microphone_static_members},
+    {"flash.media", "Sound", (slotinfo_t*)&flash_media_Sound, flash_media_Sound_members, 0},
+    {"flash.media", "SoundChannel", (slotinfo_t*)&flash_media_SoundChannel, flash_media_SoundChannel_members, 0},
+    {"flash.media", "SoundCodec", (slotinfo_t*)&flash_media_SoundCodec, 0, flash_media_SoundCodec_static_members},
+    {"flash.media", "SoundLoaderContext", (slotinfo_t*)&flash_media_SoundLoaderContext, flash_media_SoundLoaderContext_members, 0},
+    {"flash.media", "SoundMixer", (slotinfo_t*)&flash_media_SoundMixer, 0, flash_media_SoundMixer_static_members},
+    {"flash.media", "SoundTransform", (slotinfo_t*)&flash_media_SoundTransform, flash_media_SoundTransform_members, 0},
+    {"flash.media", "Video", (slotinfo_t*)&flash_media_Video, flash_media_Video_members, 0},
+    {"flash.net", "FileFilter", (slotinfo_t*)&flash_net_FileFilter, flash_net_FileFilter_members, 0},
+    {"flash.net", "FileReference", (slotinfo_t*)&flash_net_FileReference, flash_net_FileReference_members, 0},
+    {"flash.net", "FileReferenceList", (slotinfo_t*)&flash_net_FileReferenceList, flash_net_FileReferenceList_members, 0},
+    {"flash.net", "IDynamicPropertyOutput", (slotinfo_t*)&flash_net_IDynamicPropertyOutput, flash_net_IDynamicPropertyOutput_members, 0},
+    {"flash.net", "IDynamicPropertyWriter", (slotinfo_t*)&flash_net_IDynamicPropertyWriter, flash_net_IDynamicPropertyWriter_members, 0},
+    {"flash.net", "LocalConnection", (slotinfo_t*)&flash_net_LocalConnection, flash_net_LocalConnection_members, 0},
+    {"flash.net", "NetConnection", (slotinfo_t*)&flash_net_NetConnection, flash_net_NetConnection_members, flash_net_NetConnection_static_members},
+    {"flash.net", "NetStream", (slotinfo_t*)&flash_net_NetStream, flash_net_NetStream_members, flash_net_NetStream_static_members},
+    {"flash.net", "NetStreamInfo", (slotinfo_t*)&flash_net_NetStreamInfo, flash_net_NetStreamInfo_members, 0},
+    {"flash.net", "NetStreamPlayOptions", (slotinfo_t*)&flash_net_NetStreamPlayOptions, flash_net_NetStreamPlayOptions_members, 0},
+    {"flash.net", "NetStreamPlayTransitions", (slotinfo_t*)&flash_net_NetStreamPlayTransitions, 0, flash_net_NetStreamPlayTransitions_static_members},
+    {"flash.net", "ObjectEncoding", (slotinfo_t*)&flash_net_ObjectEncoding, 0, flash_net_ObjectEncoding_static_members},
+    {"flash.net", "Responder", (slotinfo_t*)&flash_net_Responder, 0, 0},
+    {"flash.net", "SharedObject", (slotinfo_t*)&flash_net_SharedObject, flash_net_SharedObject_members, flash_net_SharedObject_static_members},
+    {"flash.net", "SharedObjectFlushStatus", (slotinfo_t*)&flash_net_SharedObjectFlushStatus, 0, flash_net_SharedObjectFlushStatus_static_members},
+    {"flash.net", "Socket", (slotinfo_t*)&flash_net_Socket, flash_net_Socket_members, 0},
+    {"flash.net", "URLLoader", (slotinfo_t*)&flash_net_URLLoader, flash_net_URLLoader_members, 0},
+    {"flash.net", "URLLoaderDataFormat", (slotinfo_t*)&flash_net_URLLoaderDataFormat, 0, flash_net_URLLoaderDataFormat_static_members},
+    {"flash.net", "URLRequest", (slotinfo_t*)&flash_net_URLRequest, flash_net_URLRequest_members, 0},
+    {"flash.net", "URLRequestHeader", (slotinfo_t*)&flash_net_URLRequestHeader, flash_net_URLRequestHeader_members, 0},
+    {"flash.net", "URLRequestMethod", (slotinfo_t*)&flash_net_URLRequestMethod, 0, flash_net_URLRequestMethod_static_members},
+    {"flash.net", "URLStream", (slotinfo_t*)&flash_net_URLStream, flash_net_URLStream_members, 0},
+    {"flash.net", "URLVariables", (slotinfo_t*)&flash_net_URLVariables, flash_net_URLVariables_members, 0},
+    {"flash.net", "XMLSocket", (slotinfo_t*)&flash_net_XMLSocket, flash_net_XMLSocket_members, 0},
+    {"flash.net", "getClassByAlias", (slotinfo_t*)&flash_net_getClassByAlias, 0, 0},
+    {"flash.net", "navigateToURL", (slotinfo_t*)&flash_net_navigateToURL, 0, 0},
+    {"flash.net", "registerClassAlias", (slotinfo_t*)&flash_net_registerClassAlias, 0, 0},
+    {"flash.net", "sendToURL", (slotinfo_t*)&flash_net_sendToURL, 0, 0},
+    {"flash.printing", "PrintJob", (slotinfo_t*)&flash_printing_PrintJob, flash_printing_PrintJob_members, 0},
+    {"flash.printing", "PrintJobOptions", (slotinfo_t*)&flash_printing_PrintJobOptions, flash_printing_PrintJobOptions_members, 0},
+    {"flash.printing", "PrintJobOrientation", (slotinfo_t*)&flash_printing_PrintJobOrientation, 0, flash_printing_PrintJobOrientation_static_members},
+    {"flash.profiler", "profile", (slotinfo_t*)&flash_profiler_profile, 0, 0},
+    {"flash.profiler", "showRedrawRegions", (slotinfo_t*)&flash_profiler_showRedrawRegions, 0, 0},
+    {"flash.sampler", "DeleteObjectSample", (slotinfo_t*)&flash_sampler_DeleteObjectSample, flash_sampler_DeleteObjectSample_members, 0},
+    {"flash.sampler", "NewObjectSample", (slotinfo_t*)&flash_sampler_NewObjectSample, flash_sampler_NewObjectSample_members, 0},
+    {"flash.sampler", "Sample", (slotinfo_t*)&flash_sampler_Sample, flash_sampler_Sample_members, 0},
+    {"flash.sampler", "StackFrame", (slotinfo_t*)&flash_sampler_StackFrame, flash_sampler_StackFrame_members, 0},
+    {"flash.sampler", "_getInvocationCount", (slotinfo_t*)&flash_sampler__getInvocationCount, 0, 0},
+    {"flash.sampler", "clearSamples", (slotinfo_t*)&flash_sampler_clearSamples, 0, 0},
+    {"flash.sampler", "getGetterInvocationCount", (slotinfo_t*)&flash_sampler_getGetterInvocationCount, 0, 0},
+    {"flash.sampler", "getInvocationCount", (slotinfo_t*)&flash_sampler_getInvocationCount, 0, 0},
+    {"flash.sampler", "getMemberNames", (slotinfo_t*)&flash_sampler_getMemberNames, 0, 0},
+    {"flash.sampler", "getSampleCount", (slotinfo_t*)&flash_sampler_getSampleCount, 0, 0},
+    {"flash.sampler", "getSamples", (slotinfo_t*)&flash_sampler_getSamples, 0, 0},
+    {"flash.sampler", "getSetterInvocationCount", (slotinfo_t*)&flash_sampler_getSetterInvocationCount, 0, 0},
+    {"flash.sampler", "getSize", (slotinfo_t*)&flash_sampler_getSize, 0, 0},
+    {"flash.sampler", "isGetterSetter", (slotinfo_t*)&flash_sampler_isGetterSetter, 0, 0},
+    {"flash.sampler", "pauseSampling", (slotinfo_t*)&flash_sampler_pauseSampling, 0, 0},
+    {"flash.sampler", "startSampling", (slotinfo_t*)&flash_sampler_startSampling, 0, 0},
+    {"flash.sampler", "stopSampling", (slotinfo_t*)&flash_sampler_stopSampling, 0, 0},
+    {"flash.system", "ApplicationDomain", (slotinfo_t*)&flash_system_ApplicationDomain, flash_system_ApplicationDomain_members, flash_system_ApplicationDomain_static_members},
+    {"flash.system", "Capabilities", (slotinfo_t*)&flash_system_Capabilities, 0, flash_system_Capabilities_static_members},
+    {"flash.system", "IME", (slotinfo_t*)&flash_system_IME, 0, flash_system_IME_static_members},
+    {"flash.system", "IMEConversionMode", (slotinfo_t*)&flash_system_IMEConversionMode, 0, flash_system_IMEConversionMode_static_members},
+    {"flash.system", "JPEGLoaderContext", (slotinfo_t*)&flash_system_JPEGLoaderContext, flash_system_JPEGLoaderContext_members, 0},
+    {"flash.system", "LoaderContext", (slotinfo_t*)&flash_system_LoaderContext, flash_system_LoaderContext_members, 0},
+    {"flash.system", "Security", (slotinfo_t*)&flash_system_Security, 0, flash_system_Security_static_members},
+    {"flash.system", "SecurityDomain", (slotinfo_t*)&flash_system_SecurityDomain, 0, flash_system_SecurityDomain_static_members},
+    {"flash.system", "SecurityPanel", (slotinfo_t*)&flash_system_SecurityPanel, 0, flash_system_SecurityPanel_static_members},
+    {"flash.system", "System", (slotinfo_t*)&flash_system_System, 0, flash_system_System_static_members},
+    {"flash.system", "fscommand", (slotinfo_t*)&flash_system_fscommand, 0, 0},
+    {"flash.text", "AntiAliasType", (slotinfo_t*)&flash_text_AntiAliasType, 0, flash_text_AntiAliasType_static_members},
+    {"flash.text", "CSMSettings", (slotinfo_t*)&flash_text_CSMSettings, flash_text_CSMSettings_members, 0},
+    {"flash.text", "Font", (slotinfo_t*)&flash_text_Font, flash_text_Font_members, flash_text_Font_static_members},
+    {"flash.text", "FontStyle", (slotinfo_t*)&flash_text_FontStyle, 0, flash_text_FontStyle_static_members},
+    {"flash.text", "FontType", (slotinfo_t*)&flash_text_FontType, 0, flash_text_FontType_static_members},
+    {"flash.text", "GridFitType", (slotinfo_t*)&flash_text_GridFitType, 0, flash_text_GridFitType_static_members},
+    {"flash.text", "StaticText", (slotinfo_t*)&flash_text_StaticText, flash_text_StaticText_members, 0},
+    {"flash.text", "StyleSheet", (slotinfo_t*)&flash_text_StyleSheet, flash_text_StyleSheet_members, 0},
+    {"flash.text", "TextColorType", (slotinfo_t*)&flash_text_TextColorType, 0, flash_text_TextColorType_static_members},
+    {"flash.text", "TextDisplayMode", (slotinfo_t*)&flash_text_TextDisplayMode, 0, flash_text_TextDisplayMode_static_members},
+    {"flash.text", "TextExtent", (slotinfo_t*)&flash_text_TextExtent, flash_text_TextExtent_members, 0},
+    {"flash.text", "TextField", (slotinfo_t*)&flash_text_TextField, flash_text_TextField_members, flash_text_TextField_static_members},
+    {"flash.text", "TextFieldAutoSize", (slotinfo_t*)&flash_text_TextFieldAutoSize, 0, flash_text_TextFieldAutoSize_static_members},
+    {"flash.text", "TextFieldType", (slotinfo_t*)&flash_text_TextFieldType, 0, flash_text_TextFieldType_static_members},
+    {"flash.text", "TextFormat", (slotinfo_t*)&flash_text_TextFormat, flash_text_TextFormat_members, 0},
+    {"flash.text", "TextFormatAlign", (slotinfo_t*)&flash_text_TextFormatAlign, 0, flash_text_TextFormatAlign_static_members},
+    {"flash.text", "TextFormatDisplay", (slotinfo_t*)&flash_text_TextFormatDisplay, 0, flash_text_TextFormatDisplay_static_members},
+    {"flash.text", "TextLineMetrics", (slotinfo_t*)&flash_text_TextLineMetrics, flash_text_TextLineMetrics_members, 0},
+    {"flash.text", "TextRenderer", (slotinfo_t*)&flash_text_TextRenderer, 0, flash_text_TextRenderer_static_members},
+    {"flash.text", "TextRun", (slotinfo_t*)&flash_text_TextRun, flash_text_TextRun_members, 0},
+    {"flash.text", "TextSnapshot", (slotinfo_t*)&flash_text_TextSnapshot, flash_text_TextSnapshot_members, 0},
+    {"flash.text.engine", "BreakOpportunity", (slotinfo_t*)&flash_text_engine_BreakOpportunity, 0, flash_text_engine_BreakOpportunity_static_members},
+    {"flash.text.engine", "CFFHinting", (slotinfo_t*)&flash_text_engine_CFFHinting, 0, flash_text_engine_CFFHinting_static_members},
+    {"flash.text.engine", "ContentElement", (slotinfo_t*)&flash_text_engine_ContentElement, flash_text_engine_ContentElement_members, flash_text_engine_ContentElement_static_members},
+    {"flash.text.engine", "DigitCase", (slotinfo_t*)&flash_text_engine_DigitCase, 0, flash_text_engine_DigitCase_static_members},
+    {"flash.text.engine", "DigitWidth", (slotinfo_t*)&flash_text_engine_DigitWidth, 0, flash_text_engine_DigitWidth_static_members},
+    {"flash.text.engine", "EastAsianJustifier", (slotinfo_t*)&flash_text_engine_EastAsianJustifier, flash_text_engine_EastAsianJustifier_members, 0},
+    {"flash.text.engine", "ElementFormat", (slotinfo_t*)&flash_text_engine_ElementFormat, flash_text_engine_ElementFormat_members, 0},
+    {"flash.text.engine", "FontDescription", (slotinfo_t*)&flash_text_engine_FontDescription, flash_text_engine_FontDescription_members, flash_text_engine_FontDescription_static_members},
+    {"flash.text.engine", "FontLookup", (slotinfo_t*)&flash_text_engine_FontLookup, 0, flash_text_engine_FontLookup_static_members},
+    {"flash.text.engine", "FontMetrics", (slotinfo_t*)&flash_text_engine_FontMetrics, flash_text_engine_FontMetrics_members, 0},
+    {"flash.text.engine", "FontPosture", (slotinfo_t*)&flash_text_engine_FontPosture, 0, flash_text_engine_FontPosture_static_members},
+    {"flash.text.engine", "FontWeight", (slotinfo_t*)&flash_text_engine_FontWeight, 0, flash_text_engine_FontWeight_static_members},
+    {"flash.text.engine", "GraphicElement", (slotinfo_t*)&flash_text_engine_GraphicElement, flash_text_engine_GraphicElement_members, 0},
+    {"flash.text.engine", "GroupElement", (slotinfo_t*)&flash_text_engine_GroupElement, flash_text_engine_GroupElement_members, 0},
+    {"flash.text.engine", "JustificationStyle", (slotinfo_t*)&flash_text_engine_JustificationStyle, 0, flash_text_engine_JustificationStyle_static_members},
+    {"flash.text.engine", "Kerning", (slotinfo_t*)&flash_text_engine_Kerning, 0, flash_text_engine_Kerning_static_members},
+    {"flash.text.engine", "LigatureLevel", (slotinfo_t*)&flash_text_engine_LigatureLevel, 0, flash_text_engine_LigatureLevel_static_members},
+    {"flash.text.engine", "LineJustification", (slotinfo_t*)&flash_text_engine_LineJustification, 0, flash_text_engine_LineJustification_static_members},
+    {"flash.text.engine", "RenderingMode", (slotinfo_t*)&flash_text_engine_RenderingMode, 0, flash_text_engine_RenderingMode_static_members},
+    {"flash.text.engine", "SpaceJustifier", (slotinfo_t*)&flash_text_engine_SpaceJustifier, flash_text_engine_SpaceJustifier_members, 0},
+    {"flash.text.engine", "TabAlignment", (slotinfo_t*)&flash_text_engine_TabAlignment, 0, flash_text_engine_TabAlignment_static_members},
+    {"flash.text.engine", "TabStop", (slotinfo_t*)&flash_text_engine_TabStop, flash_text_engine_TabStop_members, 0},
+    {"flash.text.engine", "TextBaseline", (slotinfo_t*)&flash_text_engine_TextBaseline, 0, flash_text_engine_TextBaseline_static_members},
+    {"flash.text.engine", "TextBlock", (slotinfo_t*)&flash_text_engine_TextBlock, flash_text_engine_TextBlock_members, 0},
+    {"flash.text.engine", "TextElement", (slotinfo_t*)&flash_text_engine_TextElement, flash_text_engine_TextElement_members, 0},
+    {"flash.text.engine", "TextJustifier", (slotinfo_t*)&flash_text_engine_TextJustifier, flash_text_engine_TextJustifier_members, flash_text_engine_TextJustifier_static_members},
+    {"flash.text.engine", "TextLine", (slotinfo_t*)&flash_text_engine_TextLine, flash_text_engine_TextLine_members, flash_text_engine_TextLine_static_members},
+    {"flash.text.engine", "TextLineCreationResult", (slotinfo_t*)&flash_text_engine_TextLineCreationResult, 0, flash_text_engine_TextLineCreationResult_static_members},
+    {"flash.text.engine", "TextLineMirrorRegion", (slotinfo_t*)&flash_text_engine_TextLineMirrorRegion, flash_text_engine_TextLineMirrorRegion_members, 0},
+    {"flash.text.engine", "TextLineValidity", (slotinfo_t*)&flash_text_engine_TextLineValidity, 0, flash_text_engine_TextLineValidity_static_members},
+    {"flash.text.engine", "TextRotation", (slotinfo_t*)&flash_text_engine_TextRotation, 0, flash_text_engine_TextRotation_static_members},
+    {"flash.text.engine", "TypographicCase", (slotinfo_t*)&flash_text_engine_TypographicCase, 0, flash_text_engine_TypographicCase_static_members},
+    {"flash.trace", "Trace", (slotinfo_t*)&flash_trace_Trace, 0, flash_trace_Trace_static_members},
+    {"flash.ui", "ContextMenu", (slotinfo_t*)&flash_ui_ContextMenu, flash_ui_ContextMenu_members, 0},
+    {"flash.ui", "ContextMenuBuiltInItems", (slotinfo_t*)&flash_ui_ContextMenuBuiltInItems, flash_ui_ContextMenuBuiltInItems_members, 0},
+    {"flash.ui", "ContextMenuClipboardItems", (slotinfo_t*)&flash_ui_ContextMenuClipboardItems, flash_ui_ContextMenuClipboardItems_members, 0},
+    {"flash.ui", "ContextMenuItem", (slotinfo_t*)&flash_ui_ContextMenuItem, flash_ui_ContextMenuItem_members, 0},
+    {"flash.ui", "KeyLocation", (slotinfo_t*)&flash_ui_KeyLocation, 0, flash_ui_KeyLocation_static_members},
+    {"flash.ui", "Keyboard", (slotinfo_t*)&flash_ui_Keyboard, 0, flash_ui_Keyboard_static_members},
+    {"flash.ui", "Mouse", (slotinfo_t*)&flash_ui_Mouse, 0, flash_ui_Mouse_static_members},
+    {"flash.ui", "MouseCursor", (slotinfo_t*)&flash_ui_MouseCursor, 0, flash_ui_MouseCursor_static_members},
+    {"flash.utils", "ByteArray", (slotinfo_t*)&flash_utils_ByteArray, flash_utils_ByteArray_members, flash_utils_ByteArray_static_members},
+    {"flash.utils", "Dictionary", (slotinfo_t*)&flash_utils_Dictionary, 0, 0},
+    {"flash.utils", "Endian", (slotinfo_t*)&flash_utils_Endian, 0, flash_utils_Endian_static_members},
+    {"flash.utils", "IDataInput", (slotinfo_t*)&flash_utils_IDataInput, flash_utils_IDataInput_members, 0},
+    {"flash.utils", "IDataOutput", (slotinfo_t*)&flash_utils_IDataOutput, flash_utils_IDataOutput_members, 0},
+    {"flash.utils", "IExternalizable", (slotinfo_t*)&flash_utils_IExternalizable, flash_utils_IExternalizable_members, 0},
+    {"flash.utils", "Proxy", (slotinfo_t*)&flash_utils_Proxy, flash_utils_Proxy_members, 0},
+    {"flash.utils", "Timer", (slotinfo_t*)&flash_utils_Timer, flash_utils_Timer_members, 0},
+    {"flash.utils", "clearInterval", (slotinfo_t*)&flash_utils_clearInterval, 0, 0},
+    {"flash.utils", "clearTimeout", (slotinfo_t*)&flash_utils_clearTimeout, 0, 0},
+    {"flash.utils", "describeType", (slotinfo_t*)&flash_utils_describeType, 0, 0},
+    {"flash.utils", "escapeMultiByte", (slotinfo_t*)&flash_utils_escapeMultiByte, 0, 0},
+    {"flash.utils", "flash_proxy", (slotinfo_t*)&flash_utils_flash_proxy, 0, 0},
+    {"flash.utils", "getDefinitionByName", (slotinfo_t*)&flash_utils_getDefinitionByName, 0, 0},
+    {"flash.utils", "getQualifiedClassName", (slotinfo_t*)&flash_utils_getQualifiedClassName, 0, 0},
+    {"flash.utils", "getQualifiedSuperclassName", (slotinfo_t*)&flash_utils_getQualifiedSuperclassName, 0, 0},
+    {"flash.utils", "getTimer", (slotinfo_t*)&flash_utils_getTimer, 0, 0},
+    {"flash.utils", "setInterval", (slotinfo_t*)&flash_utils_setInterval, 0, 0},
+    {"flash.utils", "setTimeout", (slotinfo_t*)&flash_utils_setTimeout, 0, 0},
+    {"flash.utils", "unescapeMultiByte", (slotinfo_t*)&flash_utils_unescapeMultiByte, 0, 0},
+    {"flash.xml", "XMLDocument", (slotinfo_t*)&flash_xml_XMLDocument, flash_xml_XMLDocument_members, 0},
+    {"flash.xml", "XMLNode", (slotinfo_t*)&flash_xml_XMLNode, flash_xml_XMLNode_members, 0},
+    {"flash.xml", "XMLNodeType", (slotinfo_t*)&flash_xml_XMLNodeType, 0, flash_xml_XMLNodeType_static_members},
+};
+
+const builtin_t* builtin_getclasses(int*num)
 {
-    dict_t*d = dict_new2(&slotinfo_type);
-    dict_put(d, &flash_text_TextFormat, &flash_text_TextFormat);
-    dict_init2(&flash_text_TextFormat.members, &memberinfo_type, 31);
-    dict_init2(&flash_text_TextFormat.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_leading, &flash_text_TextFormat_leading);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_bold, &flash_text_TextFormat_bold);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_underline, &flash_text_TextFormat_underline);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_color, &flash_text_TextFormat_color);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_letterSpacing, &flash_text_TextFormat_letterSpacing);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_kerning, &flash_text_TextFormat_kerning);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_target, &flash_text_TextFormat_target);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_italic, &flash_text_TextFormat_italic);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_rightMargin, &flash_text_TextFormat_rightMargin);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_bullet, &flash_text_TextFormat_bullet);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_url, &flash_text_TextFormat_url);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_size, &flash_text_TextFormat_size);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_indent, &flash_text_TextFormat_indent);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_leftMargin, &flash_text_TextFormat_leftMargin);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_display, &flash_text_TextFormat_display);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_align, &flash_text_TextFormat_align);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_tabStops, &flash_text_TextFormat_tabStops);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_blockIndent, &flash_text_TextFormat_blockIndent);
-    dict_put(&flash_text_TextFormat.members, &flash_text_TextFormat_font, &flash_text_TextFormat_font);
-    dict_put(d, &flash_filters_BitmapFilter, &flash_filters_BitmapFilter);
-    dict_init2(&flash_filters_BitmapFilter.members, &memberinfo_type, 8);
-    dict_init2(&flash_filters_BitmapFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_BitmapFilter.members, &flash_filters_BitmapFilter_clone, &flash_filters_BitmapFilter_clone);
-    dict_put(d, &flash_filters_DropShadowFilter, &flash_filters_DropShadowFilter);
-    dict_init2(&flash_filters_DropShadowFilter.members, &memberinfo_type, 15);
-    dict_init2(&flash_filters_DropShadowFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_alpha, &flash_filters_DropShadowFilter_alpha);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_strength, &flash_filters_DropShadowFilter_strength);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_quality, &flash_filters_DropShadowFilter_quality);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_angle, &flash_filters_DropShadowFilter_angle);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_knockout, &flash_filters_DropShadowFilter_knockout);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_color, &flash_filters_DropShadowFilter_color);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_hideObject, &flash_filters_DropShadowFilter_hideObject);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_inner, &flash_filters_DropShadowFilter_inner);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_blurX, &flash_filters_DropShadowFilter_blurX);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_blurY, &flash_filters_DropShadowFilter_blurY);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_distance, &flash_filters_DropShadowFilter_distance);
-    dict_put(&flash_filters_DropShadowFilter.members, &flash_filters_DropShadowFilter_clone, &flash_filters_DropShadowFilter_clone);
-    dict_put(d, &adobe_utils_CustomActions, &adobe_utils_CustomActions);
-    dict_init2(&adobe_utils_CustomActions.members, &memberinfo_type, 8);
-    dict_init2(&adobe_utils_CustomActions.static_members, &memberinfo_type, 8);
-    dict_put(&adobe_utils_CustomActions.static_members, &adobe_utils_CustomActions_actionsList, &adobe_utils_CustomActions_actionsList);
-    dict_put(&adobe_utils_CustomActions.static_members, &adobe_utils_CustomActions_uninstallActions, &adobe_utils_CustomActions_uninstallActions);
-    dict_put(&adobe_utils_CustomActions.static_members, &adobe_utils_CustomActions_getActions, &adobe_utils_CustomActions_getActions);
-    dict_put(&adobe_utils_CustomActions.static_members, &adobe_utils_CustomActions_installActions, &adobe_utils_CustomActions_installActions);
-    dict_put(d, &flash_text_engine_TextLineValidity, &flash_text_engine_TextLineValidity);
-    dict_init2(&flash_text_engine_TextLineValidity.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TextLineValidity.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextLineValidity.static_members, &flash_text_engine_TextLineValidity_STATIC, &flash_text_engine_TextLineValidity_STATIC);
-    dict_put(&flash_text_engine_TextLineValidity.static_members, &flash_text_engine_TextLineValidity_VALID, &flash_text_engine_TextLineValidity_VALID);
-    dict_put(&flash_text_engine_TextLineValidity.static_members, &flash_text_engine_TextLineValidity_INVALID, &flash_text_engine_TextLineValidity_INVALID);
-    dict_put(&flash_text_engine_TextLineValidity.static_members, &flash_text_engine_TextLineValidity_POSSIBLY_INVALID, &flash_text_engine_TextLineValidity_POSSIBLY_INVALID);
-    dict_put(d, &flash_display_LineScaleMode, &flash_display_LineScaleMode);
-    dict_init2(&flash_display_LineScaleMode.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_LineScaleMode.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_LineScaleMode.static_members, &flash_display_LineScaleMode_NORMAL, &flash_display_LineScaleMode_NORMAL);
-    dict_put(&flash_display_LineScaleMode.static_members, &flash_display_LineScaleMode_VERTICAL, &flash_display_LineScaleMode_VERTICAL);
-    dict_put(&flash_display_LineScaleMode.static_members, &flash_display_LineScaleMode_NONE, &flash_display_LineScaleMode_NONE);
-    dict_put(&flash_display_LineScaleMode.static_members, &flash_display_LineScaleMode_HORIZONTAL, &flash_display_LineScaleMode_HORIZONTAL);
-    dict_put(d, &flash_geom_Transform, &flash_geom_Transform);
-    dict_init2(&flash_geom_Transform.members, &memberinfo_type, 15);
-    dict_init2(&flash_geom_Transform.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_Transform.members, &flash_geom_Transform_matrix, &flash_geom_Transform_matrix);
-    dict_put(&flash_geom_Transform.members, &flash_geom_Transform_perspectiveProjection, &flash_geom_Transform_perspectiveProjection);
-    dict_put(&flash_geom_Transform.members, &flash_geom_Transform_concatenatedMatrix, &flash_geom_Transform_concatenatedMatrix);
-    dict_put(&flash_geom_Transform.members, &flash_geom_Transform_colorTransform, &flash_geom_Transform_colorTransform);
-    dict_put(&flash_geom_Transform.members, &flash_geom_Transform_getRelativeMatrix3D, &flash_geom_Transform_getRelativeMatrix3D);
-    dict_put(&flash_geom_Transform.members, &flash_geom_Transform_pixelBounds, &flash_geom_Transform_pixelBounds);
-    dict_put(&flash_geom_Transform.members, &flash_geom_Transform_matrix3D, &flash_geom_Transform_matrix3D);
-    dict_put(&flash_geom_Transform.members, &flash_geom_Transform_concatenatedColorTransform, &flash_geom_Transform_concatenatedColorTransform);
-    dict_put(d, &flash_ui_KeyLocation, &flash_ui_KeyLocation);
-    dict_init2(&flash_ui_KeyLocation.members, &memberinfo_type, 8);
-    dict_init2(&flash_ui_KeyLocation.static_members, &memberinfo_type, 8);
-    dict_put(&flash_ui_KeyLocation.static_members, &flash_ui_KeyLocation_LEFT, &flash_ui_KeyLocation_LEFT);
-    dict_put(&flash_ui_KeyLocation.static_members, &flash_ui_KeyLocation_RIGHT, &flash_ui_KeyLocation_RIGHT);
-    dict_put(&flash_ui_KeyLocation.static_members, &flash_ui_KeyLocation_NUM_PAD, &flash_ui_KeyLocation_NUM_PAD);
-    dict_put(&flash_ui_KeyLocation.static_members, &flash_ui_KeyLocation_STANDARD, &flash_ui_KeyLocation_STANDARD);
-    dict_put(d, &flash_events_MouseEvent, &flash_events_MouseEvent);
-    dict_init2(&flash_events_MouseEvent.members, &memberinfo_type, 31);
-    dict_init2(&flash_events_MouseEvent.static_members, &memberinfo_type, 15);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_localY, &flash_events_MouseEvent_localY);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_updateAfterEvent, &flash_events_MouseEvent_updateAfterEvent);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_delta, &flash_events_MouseEvent_delta);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_stageX, &flash_events_MouseEvent_stageX);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_toString, &flash_events_MouseEvent_toString);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_relatedObject, &flash_events_MouseEvent_relatedObject);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_isRelatedObjectInaccessible, &flash_events_MouseEvent_isRelatedObjectInaccessible);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_shiftKey, &flash_events_MouseEvent_shiftKey);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_stageY, &flash_events_MouseEvent_stageY);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_altKey, &flash_events_MouseEvent_altKey);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_clone, &flash_events_MouseEvent_clone);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_ctrlKey, &flash_events_MouseEvent_ctrlKey);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_localX, &flash_events_MouseEvent_localX);
-    dict_put(&flash_events_MouseEvent.members, &flash_events_MouseEvent_buttonDown, &flash_events_MouseEvent_buttonDown);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_ROLL_OVER, &flash_events_MouseEvent_ROLL_OVER);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_ROLL_OUT, &flash_events_MouseEvent_ROLL_OUT);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_MOUSE_DOWN, &flash_events_MouseEvent_MOUSE_DOWN);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_DOUBLE_CLICK, &flash_events_MouseEvent_DOUBLE_CLICK);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_MOUSE_WHEEL, &flash_events_MouseEvent_MOUSE_WHEEL);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_CLICK, &flash_events_MouseEvent_CLICK);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_MOUSE_MOVE, &flash_events_MouseEvent_MOUSE_MOVE);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_MOUSE_UP, &flash_events_MouseEvent_MOUSE_UP);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_MOUSE_OVER, &flash_events_MouseEvent_MOUSE_OVER);
-    dict_put(&flash_events_MouseEvent.static_members, &flash_events_MouseEvent_MOUSE_OUT, &flash_events_MouseEvent_MOUSE_OUT);
-    dict_put(d, &flash_text_engine_LineJustification, &flash_text_engine_LineJustification);
-    dict_init2(&flash_text_engine_LineJustification.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_LineJustification.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_LineJustification.static_members, &flash_text_engine_LineJustification_ALL_INCLUDING_LAST, &flash_text_engine_LineJustification_ALL_INCLUDING_LAST);
-    dict_put(&flash_text_engine_LineJustification.static_members, &flash_text_engine_LineJustification_UNJUSTIFIED, &flash_text_engine_LineJustification_UNJUSTIFIED);
-    dict_put(&flash_text_engine_LineJustification.static_members, &flash_text_engine_LineJustification_ALL_BUT_LAST, &flash_text_engine_LineJustification_ALL_BUT_LAST);
-    dict_put(d, &flash_media_Camera, &flash_media_Camera);
-    dict_init2(&flash_media_Camera.members, &memberinfo_type, 31);
-    dict_init2(&flash_media_Camera.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_fps, &flash_media_Camera_fps);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_setMode, &flash_media_Camera_setMode);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_keyFrameInterval, &flash_media_Camera_keyFrameInterval);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_motionTimeout, &flash_media_Camera_motionTimeout);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_width, &flash_media_Camera_width);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_setCursor, &flash_media_Camera_setCursor);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_setLoopback, &flash_media_Camera_setLoopback);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_height, &flash_media_Camera_height);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_index, &flash_media_Camera_index);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_name, &flash_media_Camera_name);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_currentFPS, &flash_media_Camera_currentFPS);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_setKeyFrameInterval, &flash_media_Camera_setKeyFrameInterval);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_quality, &flash_media_Camera_quality);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_motionLevel, &flash_media_Camera_motionLevel);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_bandwidth, &flash_media_Camera_bandwidth);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_muted, &flash_media_Camera_muted);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_activityLevel, &flash_media_Camera_activityLevel);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_loopback, &flash_media_Camera_loopback);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_setQuality, &flash_media_Camera_setQuality);
-    dict_put(&flash_media_Camera.members, &flash_media_Camera_setMotionLevel, &flash_media_Camera_setMotionLevel);
-    dict_put(&flash_media_Camera.static_members, &flash_media_Camera_getCamera, &flash_media_Camera_getCamera);
-    dict_put(&flash_media_Camera.static_members, &flash_media_Camera_names, &flash_media_Camera_names);
-    dict_put(d, &flash_net_registerClassAlias, &flash_net_registerClassAlias);
-    dict_put(d, &flash_accessibility_AccessibilityImplementation, &flash_accessibility_AccessibilityImplementation);
-    dict_init2(&flash_accessibility_AccessibilityImplementation.members, &memberinfo_type, 15);
-    dict_init2(&flash_accessibility_AccessibilityImplementation.static_members, &memberinfo_type, 8);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_get_accState, &flash_accessibility_AccessibilityImplementation_get_accState);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_get_accName, &flash_accessibility_AccessibilityImplementation_get_accName);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_get_accSelection, &flash_accessibility_AccessibilityImplementation_get_accSelection);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_accDoDefaultAction, &flash_accessibility_AccessibilityImplementation_accDoDefaultAction);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_get_accFocus, &flash_accessibility_AccessibilityImplementation_get_accFocus);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_get_accDefaultAction, &flash_accessibility_AccessibilityImplementation_get_accDefaultAction);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_accSelect, &flash_accessibility_AccessibilityImplementation_accSelect);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_get_accValue, &flash_accessibility_AccessibilityImplementation_get_accValue);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_stub, &flash_accessibility_AccessibilityImplementation_stub);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_get_accRole, &flash_accessibility_AccessibilityImplementation_get_accRole);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_errno, &flash_accessibility_AccessibilityImplementation_errno);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_isLabeledBy, &flash_accessibility_AccessibilityImplementation_isLabeledBy);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_accLocation, &flash_accessibility_AccessibilityImplementation_accLocation);
-    dict_put(&flash_accessibility_AccessibilityImplementation.members, &flash_accessibility_AccessibilityImplementation_getChildIDArray, &flash_accessibility_AccessibilityImplementation_getChildIDArray);
-    dict_put(d, &flash_utils_ByteArray, &flash_utils_ByteArray);
-    dict_init2(&flash_utils_ByteArray.members, &memberinfo_type, 63);
-    dict_init2(&flash_utils_ByteArray.static_members, &memberinfo_type, 8);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeBoolean, &flash_utils_ByteArray_writeBoolean);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readDouble, &flash_utils_ByteArray_readDouble);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_toString, &flash_utils_ByteArray_toString);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeByte, &flash_utils_ByteArray_writeByte);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeObject, &flash_utils_ByteArray_writeObject);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readUTFBytes, &flash_utils_ByteArray_readUTFBytes);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeMultiByte, &flash_utils_ByteArray_writeMultiByte);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_uncompress, &flash_utils_ByteArray_uncompress);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readUnsignedByte, &flash_utils_ByteArray_readUnsignedByte);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeInt, &flash_utils_ByteArray_writeInt);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_deflate, &flash_utils_ByteArray_deflate);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readMultiByte, &flash_utils_ByteArray_readMultiByte);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readBytes, &flash_utils_ByteArray_readBytes);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeShort, &flash_utils_ByteArray_writeShort);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_position, &flash_utils_ByteArray_position);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readShort, &flash_utils_ByteArray_readShort);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeUTF, &flash_utils_ByteArray_writeUTF);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeBytes, &flash_utils_ByteArray_writeBytes);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_objectEncoding, &flash_utils_ByteArray_objectEncoding);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readObject, &flash_utils_ByteArray_readObject);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_length, &flash_utils_ByteArray_length);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeUnsignedInt, &flash_utils_ByteArray_writeUnsignedInt);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeDouble, &flash_utils_ByteArray_writeDouble);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeFloat, &flash_utils_ByteArray_writeFloat);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readInt, &flash_utils_ByteArray_readInt);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readByte, &flash_utils_ByteArray_readByte);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_bytesAvailable, &flash_utils_ByteArray_bytesAvailable);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_clear, &flash_utils_ByteArray_clear);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_endian, &flash_utils_ByteArray_endian);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readUnsignedShort, &flash_utils_ByteArray_readUnsignedShort);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readUnsignedInt, &flash_utils_ByteArray_readUnsignedInt);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readFloat, &flash_utils_ByteArray_readFloat);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_compress, &flash_utils_ByteArray_compress);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_writeUTFBytes, &flash_utils_ByteArray_writeUTFBytes);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readBoolean, &flash_utils_ByteArray_readBoolean);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_inflate, &flash_utils_ByteArray_inflate);
-    dict_put(&flash_utils_ByteArray.members, &flash_utils_ByteArray_readUTF, &flash_utils_ByteArray_readUTF);
-    dict_put(&flash_utils_ByteArray.static_members, &flash_utils_ByteArray_defaultObjectEncoding, &flash_utils_ByteArray_defaultObjectEncoding);
-    dict_put(d, &flash_sampler_stopSampling, &flash_sampler_stopSampling);
-    dict_put(d, &flash_events_SyncEvent, &flash_events_SyncEvent);
-    dict_init2(&flash_events_SyncEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_SyncEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_SyncEvent.members, &flash_events_SyncEvent_toString, &flash_events_SyncEvent_toString);
-    dict_put(&flash_events_SyncEvent.members, &flash_events_SyncEvent_clone, &flash_events_SyncEvent_clone);
-    dict_put(&flash_events_SyncEvent.members, &flash_events_SyncEvent_changeList, &flash_events_SyncEvent_changeList);
-    dict_put(&flash_events_SyncEvent.static_members, &flash_events_SyncEvent_SYNC, &flash_events_SyncEvent_SYNC);
-    dict_put(d, &_encodeURIComponent, &_encodeURIComponent);
-    dict_put(d, &flash_net_Socket, &flash_net_Socket);
-    dict_init2(&flash_net_Socket.members, &memberinfo_type, 63);
-    dict_init2(&flash_net_Socket.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeBoolean, &flash_net_Socket_writeBoolean);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_connect, &flash_net_Socket_connect);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readDouble, &flash_net_Socket_readDouble);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeByte, &flash_net_Socket_writeByte);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeObject, &flash_net_Socket_writeObject);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readUTFBytes, &flash_net_Socket_readUTFBytes);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_close, &flash_net_Socket_close);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeMultiByte, &flash_net_Socket_writeMultiByte);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readUnsignedByte, &flash_net_Socket_readUnsignedByte);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeInt, &flash_net_Socket_writeInt);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readMultiByte, &flash_net_Socket_readMultiByte);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readBytes, &flash_net_Socket_readBytes);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeShort, &flash_net_Socket_writeShort);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readShort, &flash_net_Socket_readShort);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeUTF, &flash_net_Socket_writeUTF);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_timeout, &flash_net_Socket_timeout);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeBytes, &flash_net_Socket_writeBytes);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_connected, &flash_net_Socket_connected);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readObject, &flash_net_Socket_readObject);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_objectEncoding, &flash_net_Socket_objectEncoding);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_flush, &flash_net_Socket_flush);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeUnsignedInt, &flash_net_Socket_writeUnsignedInt);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeDouble, &flash_net_Socket_writeDouble);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeFloat, &flash_net_Socket_writeFloat);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readInt, &flash_net_Socket_readInt);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readByte, &flash_net_Socket_readByte);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_bytesAvailable, &flash_net_Socket_bytesAvailable);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_endian, &flash_net_Socket_endian);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readUnsignedShort, &flash_net_Socket_readUnsignedShort);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readUnsignedInt, &flash_net_Socket_readUnsignedInt);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readFloat, &flash_net_Socket_readFloat);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_writeUTFBytes, &flash_net_Socket_writeUTFBytes);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readBoolean, &flash_net_Socket_readBoolean);
-    dict_put(&flash_net_Socket.members, &flash_net_Socket_readUTF, &flash_net_Socket_readUTF);
-    dict_put(d, &_unescape, &_unescape);
-    dict_put(d, &flash_utils_Timer, &flash_utils_Timer);
-    dict_init2(&flash_utils_Timer.members, &memberinfo_type, 8);
-    dict_init2(&flash_utils_Timer.static_members, &memberinfo_type, 8);
-    dict_put(&flash_utils_Timer.members, &flash_utils_Timer_reset, &flash_utils_Timer_reset);
-    dict_put(&flash_utils_Timer.members, &flash_utils_Timer_running, &flash_utils_Timer_running);
-    dict_put(&flash_utils_Timer.members, &flash_utils_Timer_repeatCount, &flash_utils_Timer_repeatCount);
-    dict_put(&flash_utils_Timer.members, &flash_utils_Timer_stop, &flash_utils_Timer_stop);
-    dict_put(&flash_utils_Timer.members, &flash_utils_Timer_start, &flash_utils_Timer_start);
-    dict_put(&flash_utils_Timer.members, &flash_utils_Timer_currentCount, &flash_utils_Timer_currentCount);
-    dict_put(&flash_utils_Timer.members, &flash_utils_Timer_delay, &flash_utils_Timer_delay);
-    dict_put(d, &_Array, &_Array);
-    dict_init2(&_Array.members, &memberinfo_type, 31);
-    dict_init2(&_Array.static_members, &memberinfo_type, 8);
-    dict_put(&_Array.members, &_Array_forEach, &_Array_forEach);
-    dict_put(&_Array.members, &_Array_sortOn, &_Array_sortOn);
-    dict_put(&_Array.members, &_Array_indexOf, &_Array_indexOf);
-    dict_put(&_Array.members, &_Array_splice, &_Array_splice);
-    dict_put(&_Array.members, &_Array_lastIndexOf, &_Array_lastIndexOf);
-    dict_put(&_Array.members, &_Array_map, &_Array_map);
-    dict_put(&_Array.members, &_Array_concat, &_Array_concat);
-    dict_put(&_Array.members, &_Array_shift, &_Array_shift);
-    dict_put(&_Array.members, &_Array_unshift, &_Array_unshift);
-    dict_put(&_Array.members, &_Array_some, &_Array_some);
-    dict_put(&_Array.members, &_Array_filter, &_Array_filter);
-    dict_put(&_Array.members, &_Array_join, &_Array_join);
-    dict_put(&_Array.members, &_Array_slice, &_Array_slice);
-    dict_put(&_Array.members, &_Array_every, &_Array_every);
-    dict_put(&_Array.members, &_Array_pop, &_Array_pop);
-    dict_put(&_Array.members, &_Array_sort, &_Array_sort);
-    dict_put(&_Array.members, &_Array_reverse, &_Array_reverse);
-    dict_put(&_Array.members, &_Array_push, &_Array_push);
-    dict_put(&_Array.members, &_Array_length, &_Array_length);
-    dict_put(&_Array.static_members, &_Array_DESCENDING, &_Array_DESCENDING);
-    dict_put(&_Array.static_members, &_Array_UNIQUESORT, &_Array_UNIQUESORT);
-    dict_put(&_Array.static_members, &_Array_RETURNINDEXEDARRAY, &_Array_RETURNINDEXEDARRAY);
-    dict_put(&_Array.static_members, &_Array_CASEINSENSITIVE, &_Array_CASEINSENSITIVE);
-    dict_put(&_Array.static_members, &_Array_NUMERIC, &_Array_NUMERIC);
-    dict_put(d, &flash_geom_ColorTransform, &flash_geom_ColorTransform);
-    dict_init2(&flash_geom_ColorTransform.members, &memberinfo_type, 15);
-    dict_init2(&flash_geom_ColorTransform.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_blueOffset, &flash_geom_ColorTransform_blueOffset);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_greenOffset, &flash_geom_ColorTransform_greenOffset);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_greenMultiplier, &flash_geom_ColorTransform_greenMultiplier);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_redMultiplier, &flash_geom_ColorTransform_redMultiplier);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_color, &flash_geom_ColorTransform_color);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_concat, &flash_geom_ColorTransform_concat);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_alphaOffset, &flash_geom_ColorTransform_alphaOffset);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_blueMultiplier, &flash_geom_ColorTransform_blueMultiplier);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_toString, &flash_geom_ColorTransform_toString);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_alphaMultiplier, &flash_geom_ColorTransform_alphaMultiplier);
-    dict_put(&flash_geom_ColorTransform.members, &flash_geom_ColorTransform_redOffset, &flash_geom_ColorTransform_redOffset);
-    dict_put(d, &flash_text_GridFitType, &flash_text_GridFitType);
-    dict_init2(&flash_text_GridFitType.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_GridFitType.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_GridFitType.static_members, &flash_text_GridFitType_SUBPIXEL, &flash_text_GridFitType_SUBPIXEL);
-    dict_put(&flash_text_GridFitType.static_members, &flash_text_GridFitType_PIXEL, &flash_text_GridFitType_PIXEL);
-    dict_put(&flash_text_GridFitType.static_members, &flash_text_GridFitType_NONE, &flash_text_GridFitType_NONE);
-    dict_put(d, &flash_filters_DisplacementMapFilterMode, &flash_filters_DisplacementMapFilterMode);
-    dict_init2(&flash_filters_DisplacementMapFilterMode.members, &memberinfo_type, 8);
-    dict_init2(&flash_filters_DisplacementMapFilterMode.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_DisplacementMapFilterMode.static_members, &flash_filters_DisplacementMapFilterMode_COLOR, &flash_filters_DisplacementMapFilterMode_COLOR);
-    dict_put(&flash_filters_DisplacementMapFilterMode.static_members, &flash_filters_DisplacementMapFilterMode_WRAP, &flash_filters_DisplacementMapFilterMode_WRAP);
-    dict_put(&flash_filters_DisplacementMapFilterMode.static_members, &flash_filters_DisplacementMapFilterMode_CLAMP, &flash_filters_DisplacementMapFilterMode_CLAMP);
-    dict_put(&flash_filters_DisplacementMapFilterMode.static_members, &flash_filters_DisplacementMapFilterMode_IGNORE, &flash_filters_DisplacementMapFilterMode_IGNORE);
-    dict_put(d, &flash_text_TextFieldType, &flash_text_TextFieldType);
-    dict_init2(&flash_text_TextFieldType.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextFieldType.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextFieldType.static_members, &flash_text_TextFieldType_DYNAMIC, &flash_text_TextFieldType_DYNAMIC);
-    dict_put(&flash_text_TextFieldType.static_members, &flash_text_TextFieldType_INPUT, &flash_text_TextFieldType_INPUT);
-    dict_put(d, &flash_display_IGraphicsStroke, &flash_display_IGraphicsStroke);
-    dict_init2(&flash_display_IGraphicsStroke.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_IGraphicsStroke.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_media_SoundLoaderContext, &flash_media_SoundLoaderContext);
-    dict_init2(&flash_media_SoundLoaderContext.members, &memberinfo_type, 8);
-    dict_init2(&flash_media_SoundLoaderContext.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_SoundLoaderContext.members, &flash_media_SoundLoaderContext_checkPolicyFile, &flash_media_SoundLoaderContext_checkPolicyFile);
-    dict_put(&flash_media_SoundLoaderContext.members, &flash_media_SoundLoaderContext_bufferTime, &flash_media_SoundLoaderContext_bufferTime);
-    dict_put(d, &flash_net_IDynamicPropertyOutput, &flash_net_IDynamicPropertyOutput);
-    dict_init2(&flash_net_IDynamicPropertyOutput.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_IDynamicPropertyOutput.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_IDynamicPropertyOutput.members, &flash_net_IDynamicPropertyOutput_writeDynamicProperty, &flash_net_IDynamicPropertyOutput_writeDynamicProperty);
-    dict_put(d, &flash_display_IGraphicsData, &flash_display_IGraphicsData);
-    dict_init2(&flash_display_IGraphicsData.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_IGraphicsData.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_utils_getDefinitionByName, &flash_utils_getDefinitionByName);
-    dict_put(d, &_Function, &_Function);
-    dict_init2(&_Function.members, &memberinfo_type, 8);
-    dict_init2(&_Function.static_members, &memberinfo_type, 8);
-    dict_put(&_Function.members, &_Function_length, &_Function_length);
-    dict_put(&_Function.members, &_Function_apply, &_Function_apply);
-    dict_put(&_Function.members, &_Function_call, &_Function_call);
-    dict_put(&_Function.members, &_Function_prototype, &_Function_prototype);
-    dict_put(d, &flash_geom_PerspectiveProjection, &flash_geom_PerspectiveProjection);
-    dict_init2(&flash_geom_PerspectiveProjection.members, &memberinfo_type, 8);
-    dict_init2(&flash_geom_PerspectiveProjection.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_PerspectiveProjection.members, &flash_geom_PerspectiveProjection_fieldOfView, &flash_geom_PerspectiveProjection_fieldOfView);
-    dict_put(&flash_geom_PerspectiveProjection.members, &flash_geom_PerspectiveProjection_projectionCenter, &flash_geom_PerspectiveProjection_projectionCenter);
-    dict_put(&flash_geom_PerspectiveProjection.members, &flash_geom_PerspectiveProjection_toMatrix3D, &flash_geom_PerspectiveProjection_toMatrix3D);
-    dict_put(&flash_geom_PerspectiveProjection.members, &flash_geom_PerspectiveProjection_focalLength, &flash_geom_PerspectiveProjection_focalLength);
-    dict_put(d, &flash_text_engine_BreakOpportunity, &flash_text_engine_BreakOpportunity);
-    dict_init2(&flash_text_engine_BreakOpportunity.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_BreakOpportunity.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_BreakOpportunity.static_members, &flash_text_engine_BreakOpportunity_AUTO, &flash_text_engine_BreakOpportunity_AUTO);
-    dict_put(&flash_text_engine_BreakOpportunity.static_members, &flash_text_engine_BreakOpportunity_ANY, &flash_text_engine_BreakOpportunity_ANY);
-    dict_put(&flash_text_engine_BreakOpportunity.static_members, &flash_text_engine_BreakOpportunity_ALL, &flash_text_engine_BreakOpportunity_ALL);
-    dict_put(&flash_text_engine_BreakOpportunity.static_members, &flash_text_engine_BreakOpportunity_NONE, &flash_text_engine_BreakOpportunity_NONE);
-    dict_put(d, &flash_sampler__getInvocationCount, &flash_sampler__getInvocationCount);
-    dict_put(d, &_parseFloat, &_parseFloat);
-    dict_put(d, &flash_events_NetStatusEvent, &flash_events_NetStatusEvent);
-    dict_init2(&flash_events_NetStatusEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_NetStatusEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_NetStatusEvent.members, &flash_events_NetStatusEvent_toString, &flash_events_NetStatusEvent_toString);
-    dict_put(&flash_events_NetStatusEvent.members, &flash_events_NetStatusEvent_info, &flash_events_NetStatusEvent_info);
-    dict_put(&flash_events_NetStatusEvent.members, &flash_events_NetStatusEvent_clone, &flash_events_NetStatusEvent_clone);
-    dict_put(&flash_events_NetStatusEvent.static_members, &flash_events_NetStatusEvent_NET_STATUS, &flash_events_NetStatusEvent_NET_STATUS);
-    dict_put(d, &flash_display_ShaderJob, &flash_display_ShaderJob);
-    dict_init2(&flash_display_ShaderJob.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ShaderJob.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_ShaderJob.members, &flash_display_ShaderJob_cancel, &flash_display_ShaderJob_cancel);
-    dict_put(&flash_display_ShaderJob.members, &flash_display_ShaderJob_width, &flash_display_ShaderJob_width);
-    dict_put(&flash_display_ShaderJob.members, &flash_display_ShaderJob_start, &flash_display_ShaderJob_start);
-    dict_put(&flash_display_ShaderJob.members, &flash_display_ShaderJob_shader, &flash_display_ShaderJob_shader);
-    dict_put(&flash_display_ShaderJob.members, &flash_display_ShaderJob_height, &flash_display_ShaderJob_height);
-    dict_put(&flash_display_ShaderJob.members, &flash_display_ShaderJob_target, &flash_display_ShaderJob_target);
-    dict_put(&flash_display_ShaderJob.members, &flash_display_ShaderJob_progress, &flash_display_ShaderJob_progress);
-    dict_put(d, &_VerifyError, &_VerifyError);
-    dict_init2(&_VerifyError.members, &memberinfo_type, 8);
-    dict_init2(&_VerifyError.static_members, &memberinfo_type, 8);
-    dict_put(&_VerifyError.static_members, &_VerifyError_length, &_VerifyError_length);
-    dict_put(d, &flash_events_AsyncErrorEvent, &flash_events_AsyncErrorEvent);
-    dict_init2(&flash_events_AsyncErrorEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_AsyncErrorEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_AsyncErrorEvent.members, &flash_events_AsyncErrorEvent_toString, &flash_events_AsyncErrorEvent_toString);
-    dict_put(&flash_events_AsyncErrorEvent.members, &flash_events_AsyncErrorEvent_error, &flash_events_AsyncErrorEvent_error);
-    dict_put(&flash_events_AsyncErrorEvent.members, &flash_events_AsyncErrorEvent_clone, &flash_events_AsyncErrorEvent_clone);
-    dict_put(&flash_events_AsyncErrorEvent.static_members, &flash_events_AsyncErrorEvent_ASYNC_ERROR, &flash_events_AsyncErrorEvent_ASYNC_ERROR);
-    dict_put(d, &flash_net_SharedObject, &flash_net_SharedObject);
-    dict_init2(&flash_net_SharedObject.members, &memberinfo_type, 15);
-    dict_init2(&flash_net_SharedObject.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_objectEncoding, &flash_net_SharedObject_objectEncoding);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_client, &flash_net_SharedObject_client);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_setProperty, &flash_net_SharedObject_setProperty);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_clear, &flash_net_SharedObject_clear);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_flush, &flash_net_SharedObject_flush);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_connect, &flash_net_SharedObject_connect);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_size, &flash_net_SharedObject_size);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_setDirty, &flash_net_SharedObject_setDirty);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_send, &flash_net_SharedObject_send);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_close, &flash_net_SharedObject_close);
-    dict_put(&flash_net_SharedObject.members, &flash_net_SharedObject_data, &flash_net_SharedObject_data);
-    dict_put(&flash_net_SharedObject.static_members, &flash_net_SharedObject_defaultObjectEncoding, &flash_net_SharedObject_defaultObjectEncoding);
-    dict_put(&flash_net_SharedObject.static_members, &flash_net_SharedObject_getDiskUsage, &flash_net_SharedObject_getDiskUsage);
-    dict_put(&flash_net_SharedObject.static_members, &flash_net_SharedObject_getRemote, &flash_net_SharedObject_getRemote);
-    dict_put(&flash_net_SharedObject.static_members, &flash_net_SharedObject_deleteAll, &flash_net_SharedObject_deleteAll);
-    dict_put(&flash_net_SharedObject.static_members, &flash_net_SharedObject_getLocal, &flash_net_SharedObject_getLocal);
-    dict_put(d, &_Namespace, &_Namespace);
-    dict_init2(&_Namespace.members, &memberinfo_type, 8);
-    dict_init2(&_Namespace.static_members, &memberinfo_type, 8);
-    dict_put(&_Namespace.members, &_Namespace_valueOf, &_Namespace_valueOf);
-    dict_put(&_Namespace.members, &_Namespace_toString, &_Namespace_toString);
-    dict_put(&_Namespace.members, &_Namespace_uri, &_Namespace_uri);
-    dict_put(&_Namespace.members, &_Namespace_prefix, &_Namespace_prefix);
-    dict_put(&_Namespace.static_members, &_Namespace_length, &_Namespace_length);
-    dict_put(d, &flash_utils_setTimeout, &flash_utils_setTimeout);
-    dict_put(d, &flash_geom_Matrix3D, &flash_geom_Matrix3D);
-    dict_init2(&flash_geom_Matrix3D.members, &memberinfo_type, 31);
-    dict_init2(&flash_geom_Matrix3D.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_decompose, &flash_geom_Matrix3D_decompose);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_pointAt, &flash_geom_Matrix3D_pointAt);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_identity, &flash_geom_Matrix3D_identity);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_transformVector, &flash_geom_Matrix3D_transformVector);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_appendRotation, &flash_geom_Matrix3D_appendRotation);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_determinant, &flash_geom_Matrix3D_determinant);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_prependRotation, &flash_geom_Matrix3D_prependRotation);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_position, &flash_geom_Matrix3D_position);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_interpolateTo, &flash_geom_Matrix3D_interpolateTo);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_appendScale, &flash_geom_Matrix3D_appendScale);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_prepend, &flash_geom_Matrix3D_prepend);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_recompose, &flash_geom_Matrix3D_recompose);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_appendTranslation, &flash_geom_Matrix3D_appendTranslation);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_invert, &flash_geom_Matrix3D_invert);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_rawData, &flash_geom_Matrix3D_rawData);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_prependTranslation, &flash_geom_Matrix3D_prependTranslation);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_append, &flash_geom_Matrix3D_append);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_clone, &flash_geom_Matrix3D_clone);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_prependScale, &flash_geom_Matrix3D_prependScale);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_deltaTransformVector, &flash_geom_Matrix3D_deltaTransformVector);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_transformVectors, &flash_geom_Matrix3D_transformVectors);
-    dict_put(&flash_geom_Matrix3D.members, &flash_geom_Matrix3D_transpose, &flash_geom_Matrix3D_transpose);
-    dict_put(&flash_geom_Matrix3D.static_members, &flash_geom_Matrix3D_interpolate, &flash_geom_Matrix3D_interpolate);
-    dict_put(d, &flash_sampler_pauseSampling, &flash_sampler_pauseSampling);
-    dict_put(d, &flash_system_Capabilities, &flash_system_Capabilities);
-    dict_init2(&flash_system_Capabilities.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_Capabilities.static_members, &memberinfo_type, 63);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_maxLevelIDC, &flash_system_Capabilities_maxLevelIDC);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_isDebugger, &flash_system_Capabilities_isDebugger);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasStreamingAudio, &flash_system_Capabilities_hasStreamingAudio);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_screenColor, &flash_system_Capabilities_screenColor);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasIME, &flash_system_Capabilities_hasIME);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasEmbeddedVideo, &flash_system_Capabilities_hasEmbeddedVideo);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasTLS, &flash_system_Capabilities_hasTLS);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_isEmbeddedInAcrobat, &flash_system_Capabilities_isEmbeddedInAcrobat);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasScreenPlayback, &flash_system_Capabilities_hasScreenPlayback);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasVideoEncoder, &flash_system_Capabilities_hasVideoEncoder);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasAudioEncoder, &flash_system_Capabilities_hasAudioEncoder);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_pixelAspectRatio, &flash_system_Capabilities_pixelAspectRatio);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasStreamingVideo, &flash_system_Capabilities_hasStreamingVideo);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_screenResolutionX, &flash_system_Capabilities_screenResolutionX);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasScreenBroadcast, &flash_system_Capabilities_hasScreenBroadcast);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasAudio, &flash_system_Capabilities_hasAudio);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_language, &flash_system_Capabilities_language);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_manufacturer, &flash_system_Capabilities_manufacturer);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasPrinting, &flash_system_Capabilities_hasPrinting);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_os, &flash_system_Capabilities_os);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_localFileReadDisable, &flash_system_Capabilities_localFileReadDisable);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasMP3, &flash_system_Capabilities_hasMP3);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_avHardwareDisable, &flash_system_Capabilities_avHardwareDisable);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_hasAccessibility, &flash_system_Capabilities_hasAccessibility);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_version, &flash_system_Capabilities_version);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_screenDPI, &flash_system_Capabilities_screenDPI);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_playerType, &flash_system_Capabilities_playerType);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_screenResolutionY, &flash_system_Capabilities_screenResolutionY);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities__internal, &flash_system_Capabilities__internal);
-    dict_put(&flash_system_Capabilities.static_members, &flash_system_Capabilities_serverString, &flash_system_Capabilities_serverString);
-    dict_put(d, &flash_sampler_getSetterInvocationCount, &flash_sampler_getSetterInvocationCount);
-    dict_put(d, &flash_sampler_getGetterInvocationCount, &flash_sampler_getGetterInvocationCount);
-    dict_put(d, &flash_filters_BlurFilter, &flash_filters_BlurFilter);
-    dict_init2(&flash_filters_BlurFilter.members, &memberinfo_type, 8);
-    dict_init2(&flash_filters_BlurFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_BlurFilter.members, &flash_filters_BlurFilter_blurY, &flash_filters_BlurFilter_blurY);
-    dict_put(&flash_filters_BlurFilter.members, &flash_filters_BlurFilter_clone, &flash_filters_BlurFilter_clone);
-    dict_put(&flash_filters_BlurFilter.members, &flash_filters_BlurFilter_quality, &flash_filters_BlurFilter_quality);
-    dict_put(&flash_filters_BlurFilter.members, &flash_filters_BlurFilter_blurX, &flash_filters_BlurFilter_blurX);
-    dict_put(d, &_isFinite, &_isFinite);
-    dict_put(d, &flash_media_Video, &flash_media_Video);
-    dict_init2(&flash_media_Video.members, &memberinfo_type, 8);
-    dict_init2(&flash_media_Video.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_Video.members, &flash_media_Video_attachCamera, &flash_media_Video_attachCamera);
-    dict_put(&flash_media_Video.members, &flash_media_Video_videoWidth, &flash_media_Video_videoWidth);
-    dict_put(&flash_media_Video.members, &flash_media_Video_clear, &flash_media_Video_clear);
-    dict_put(&flash_media_Video.members, &flash_media_Video_deblocking, &flash_media_Video_deblocking);
-    dict_put(&flash_media_Video.members, &flash_media_Video_videoHeight, &flash_media_Video_videoHeight);
-    dict_put(&flash_media_Video.members, &flash_media_Video_attachNetStream, &flash_media_Video_attachNetStream);
-    dict_put(&flash_media_Video.members, &flash_media_Video_smoothing, &flash_media_Video_smoothing);
-    dict_put(d, &flash_text_engine_TextLineCreationResult, &flash_text_engine_TextLineCreationResult);
-    dict_init2(&flash_text_engine_TextLineCreationResult.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TextLineCreationResult.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextLineCreationResult.static_members, &flash_text_engine_TextLineCreationResult_EMERGENCY, &flash_text_engine_TextLineCreationResult_EMERGENCY);
-    dict_put(&flash_text_engine_TextLineCreationResult.static_members, &flash_text_engine_TextLineCreationResult_COMPLETE, &flash_text_engine_TextLineCreationResult_COMPLETE);
-    dict_put(&flash_text_engine_TextLineCreationResult.static_members, &flash_text_engine_TextLineCreationResult_SUCCESS, &flash_text_engine_TextLineCreationResult_SUCCESS);
-    dict_put(&flash_text_engine_TextLineCreationResult.static_members, &flash_text_engine_TextLineCreationResult_INSUFFICIENT_WIDTH, &flash_text_engine_TextLineCreationResult_INSUFFICIENT_WIDTH);
-    dict_put(d, &_Error, &_Error);
-    dict_init2(&_Error.members, &memberinfo_type, 8);
-    dict_init2(&_Error.static_members, &memberinfo_type, 8);
-    dict_put(&_Error.members, &_Error_message, &_Error_message);
-    dict_put(&_Error.members, &_Error_errorID, &_Error_errorID);
-    dict_put(&_Error.members, &_Error_getStackTrace, &_Error_getStackTrace);
-    dict_put(&_Error.members, &_Error_name, &_Error_name);
-    dict_put(&_Error.static_members, &_Error_length, &_Error_length);
-    dict_put(&_Error.static_members, &_Error_getErrorMessage, &_Error_getErrorMessage);
-    dict_put(&_Error.static_members, &_Error_throwError, &_Error_throwError);
-    dict_put(d, &flash_xml_XMLNode, &flash_xml_XMLNode);
-    dict_init2(&flash_xml_XMLNode.members, &memberinfo_type, 31);
-    dict_init2(&flash_xml_XMLNode.static_members, &memberinfo_type, 8);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_childNodes, &flash_xml_XMLNode_childNodes);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_appendChild, &flash_xml_XMLNode_appendChild);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_nextSibling, &flash_xml_XMLNode_nextSibling);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_nodeType, &flash_xml_XMLNode_nodeType);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_attributes, &flash_xml_XMLNode_attributes);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_firstChild, &flash_xml_XMLNode_firstChild);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_parentNode, &flash_xml_XMLNode_parentNode);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_toString, &flash_xml_XMLNode_toString);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_prefix, &flash_xml_XMLNode_prefix);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_localName, &flash_xml_XMLNode_localName);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_nodeName, &flash_xml_XMLNode_nodeName);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_getNamespaceForPrefix, &flash_xml_XMLNode_getNamespaceForPrefix);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_insertBefore, &flash_xml_XMLNode_insertBefore);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_lastChild, &flash_xml_XMLNode_lastChild);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_cloneNode, &flash_xml_XMLNode_cloneNode);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_removeNode, &flash_xml_XMLNode_removeNode);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_namespaceURI, &flash_xml_XMLNode_namespaceURI);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_previousSibling, &flash_xml_XMLNode_previousSibling);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_hasChildNodes, &flash_xml_XMLNode_hasChildNodes);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_getPrefixForNamespace, &flash_xml_XMLNode_getPrefixForNamespace);
-    dict_put(&flash_xml_XMLNode.members, &flash_xml_XMLNode_nodeValue, &flash_xml_XMLNode_nodeValue);
-    dict_put(d, &flash_net_URLVariables, &flash_net_URLVariables);
-    dict_init2(&flash_net_URLVariables.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_URLVariables.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_URLVariables.members, &flash_net_URLVariables_toString, &flash_net_URLVariables_toString);
-    dict_put(&flash_net_URLVariables.members, &flash_net_URLVariables_decode, &flash_net_URLVariables_decode);
-    dict_put(d, &flash_display_LoaderInfo, &flash_display_LoaderInfo);
-    dict_init2(&flash_display_LoaderInfo.members, &memberinfo_type, 31);
-    dict_init2(&flash_display_LoaderInfo.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_actionScriptVersion, &flash_display_LoaderInfo_actionScriptVersion);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_contentType, &flash_display_LoaderInfo_contentType);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_sameDomain, &flash_display_LoaderInfo_sameDomain);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_bytesTotal, &flash_display_LoaderInfo_bytesTotal);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_loaderURL, &flash_display_LoaderInfo_loaderURL);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_width, &flash_display_LoaderInfo_width);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_dispatchEvent, &flash_display_LoaderInfo_dispatchEvent);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_height, &flash_display_LoaderInfo_height);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_frameRate, &flash_display_LoaderInfo_frameRate);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_parameters, &flash_display_LoaderInfo_parameters);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_bytesLoaded, &flash_display_LoaderInfo_bytesLoaded);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_url, &flash_display_LoaderInfo_url);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_content, &flash_display_LoaderInfo_content);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_swfVersion, &flash_display_LoaderInfo_swfVersion);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_bytes, &flash_display_LoaderInfo_bytes);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_loader, &flash_display_LoaderInfo_loader);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_applicationDomain, &flash_display_LoaderInfo_applicationDomain);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_parentAllowsChild, &flash_display_LoaderInfo_parentAllowsChild);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_childAllowsParent, &flash_display_LoaderInfo_childAllowsParent);
-    dict_put(&flash_display_LoaderInfo.members, &flash_display_LoaderInfo_sharedEvents, &flash_display_LoaderInfo_sharedEvents);
-    dict_put(&flash_display_LoaderInfo.static_members, &flash_display_LoaderInfo_getLoaderInfoByDefinition, &flash_display_LoaderInfo_getLoaderInfoByDefinition);
-    dict_put(d, &flash_sampler_Sample, &flash_sampler_Sample);
-    dict_init2(&flash_sampler_Sample.members, &memberinfo_type, 8);
-    dict_init2(&flash_sampler_Sample.static_members, &memberinfo_type, 8);
-    dict_put(&flash_sampler_Sample.members, &flash_sampler_Sample_time, &flash_sampler_Sample_time);
-    dict_put(&flash_sampler_Sample.members, &flash_sampler_Sample_stack, &flash_sampler_Sample_stack);
-    dict_put(d, &flash_text_engine_DigitWidth, &flash_text_engine_DigitWidth);
-    dict_init2(&flash_text_engine_DigitWidth.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_DigitWidth.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_DigitWidth.static_members, &flash_text_engine_DigitWidth_PROPORTIONAL, &flash_text_engine_DigitWidth_PROPORTIONAL);
-    dict_put(&flash_text_engine_DigitWidth.static_members, &flash_text_engine_DigitWidth_DEFAULT, &flash_text_engine_DigitWidth_DEFAULT);
-    dict_put(&flash_text_engine_DigitWidth.static_members, &flash_text_engine_DigitWidth_TABULAR, &flash_text_engine_DigitWidth_TABULAR);
-    dict_put(d, &flash_net_URLRequestMethod, &flash_net_URLRequestMethod);
-    dict_init2(&flash_net_URLRequestMethod.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_URLRequestMethod.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_URLRequestMethod.static_members, &flash_net_URLRequestMethod_GET, &flash_net_URLRequestMethod_GET);
-    dict_put(&flash_net_URLRequestMethod.static_members, &flash_net_URLRequestMethod_POST, &flash_net_URLRequestMethod_POST);
-    dict_put(d, &adobe_utils_MMExecute, &adobe_utils_MMExecute);
-    dict_put(d, &flash_system_System, &flash_system_System);
-    dict_init2(&flash_system_System.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_System.static_members, &memberinfo_type, 15);
-    dict_put(&flash_system_System.static_members, &flash_system_System_pause, &flash_system_System_pause);
-    dict_put(&flash_system_System.static_members, &flash_system_System_useCodePage, &flash_system_System_useCodePage);
-    dict_put(&flash_system_System.static_members, &flash_system_System_exit, &flash_system_System_exit);
-    dict_put(&flash_system_System.static_members, &flash_system_System_setClipboard, &flash_system_System_setClipboard);
-    dict_put(&flash_system_System.static_members, &flash_system_System_totalMemory, &flash_system_System_totalMemory);
-    dict_put(&flash_system_System.static_members, &flash_system_System_gc, &flash_system_System_gc);
-    dict_put(&flash_system_System.static_members, &flash_system_System_resume, &flash_system_System_resume);
-    dict_put(&flash_system_System.static_members, &flash_system_System_vmVersion, &flash_system_System_vmVersion);
-    dict_put(&flash_system_System.static_members, &flash_system_System_ime, &flash_system_System_ime);
-    dict_put(d, &flash_filters_BitmapFilterQuality, &flash_filters_BitmapFilterQuality);
-    dict_init2(&flash_filters_BitmapFilterQuality.members, &memberinfo_type, 8);
-    dict_init2(&flash_filters_BitmapFilterQuality.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_BitmapFilterQuality.static_members, &flash_filters_BitmapFilterQuality_LOW, &flash_filters_BitmapFilterQuality_LOW);
-    dict_put(&flash_filters_BitmapFilterQuality.static_members, &flash_filters_BitmapFilterQuality_MEDIUM, &flash_filters_BitmapFilterQuality_MEDIUM);
-    dict_put(&flash_filters_BitmapFilterQuality.static_members, &flash_filters_BitmapFilterQuality_HIGH, &flash_filters_BitmapFilterQuality_HIGH);
-    dict_put(d, &flash_display_DisplayObjectContainer, &flash_display_DisplayObjectContainer);
-    dict_init2(&flash_display_DisplayObjectContainer.members, &memberinfo_type, 31);
-    dict_init2(&flash_display_DisplayObjectContainer.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_addChild, &flash_display_DisplayObjectContainer_addChild);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_getObjectsUnderPoint, &flash_display_DisplayObjectContainer_getObjectsUnderPoint);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_removeChildAt, &flash_display_DisplayObjectContainer_removeChildAt);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_swapChildren, &flash_display_DisplayObjectContainer_swapChildren);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_areInaccessibleObjectsUnderPoint, &flash_display_DisplayObjectContainer_areInaccessibleObjectsUnderPoint);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_setChildIndex, &flash_display_DisplayObjectContainer_setChildIndex);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_numChildren, &flash_display_DisplayObjectContainer_numChildren);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_getChildIndex, &flash_display_DisplayObjectContainer_getChildIndex);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_getChildAt, &flash_display_DisplayObjectContainer_getChildAt);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_removeChild, &flash_display_DisplayObjectContainer_removeChild);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_addChildAt, &flash_display_DisplayObjectContainer_addChildAt);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_contains, &flash_display_DisplayObjectContainer_contains);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_getChildByName, &flash_display_DisplayObjectContainer_getChildByName);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_swapChildrenAt, &flash_display_DisplayObjectContainer_swapChildrenAt);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_mouseChildren, &flash_display_DisplayObjectContainer_mouseChildren);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_tabChildren, &flash_display_DisplayObjectContainer_tabChildren);
-    dict_put(&flash_display_DisplayObjectContainer.members, &flash_display_DisplayObjectContainer_textSnapshot, &flash_display_DisplayObjectContainer_textSnapshot);
-    dict_put(d, &flash_system_LoaderContext, &flash_system_LoaderContext);
-    dict_init2(&flash_system_LoaderContext.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_LoaderContext.static_members, &memberinfo_type, 8);
-    dict_put(&flash_system_LoaderContext.members, &flash_system_LoaderContext_checkPolicyFile, &flash_system_LoaderContext_checkPolicyFile);
-    dict_put(&flash_system_LoaderContext.members, &flash_system_LoaderContext_securityDomain, &flash_system_LoaderContext_securityDomain);
-    dict_put(&flash_system_LoaderContext.members, &flash_system_LoaderContext_applicationDomain, &flash_system_LoaderContext_applicationDomain);
-    dict_put(d, &flash_utils_clearTimeout, &flash_utils_clearTimeout);
-    dict_put(d, &_isXMLName, &_isXMLName);
-    dict_put(d, &flash_xml_XMLNodeType, &flash_xml_XMLNodeType);
-    dict_init2(&flash_xml_XMLNodeType.members, &memberinfo_type, 8);
-    dict_init2(&flash_xml_XMLNodeType.static_members, &memberinfo_type, 8);
-    dict_put(&flash_xml_XMLNodeType.static_members, &flash_xml_XMLNodeType_PROCESSING_INSTRUCTION_NODE, &flash_xml_XMLNodeType_PROCESSING_INSTRUCTION_NODE);
-    dict_put(&flash_xml_XMLNodeType.static_members, &flash_xml_XMLNodeType_CDATA_NODE, &flash_xml_XMLNodeType_CDATA_NODE);
-    dict_put(&flash_xml_XMLNodeType.static_members, &flash_xml_XMLNodeType_DOCUMENT_TYPE_NODE, &flash_xml_XMLNodeType_DOCUMENT_TYPE_NODE);
-    dict_put(&flash_xml_XMLNodeType.static_members, &flash_xml_XMLNodeType_COMMENT_NODE, &flash_xml_XMLNodeType_COMMENT_NODE);
-    dict_put(&flash_xml_XMLNodeType.static_members, &flash_xml_XMLNodeType_XML_DECLARATION, &flash_xml_XMLNodeType_XML_DECLARATION);
-    dict_put(&flash_xml_XMLNodeType.static_members, &flash_xml_XMLNodeType_TEXT_NODE, &flash_xml_XMLNodeType_TEXT_NODE);
-    dict_put(&flash_xml_XMLNodeType.static_members, &flash_xml_XMLNodeType_ELEMENT_NODE, &flash_xml_XMLNodeType_ELEMENT_NODE);
-    dict_put(d, &flash_events_ErrorEvent, &flash_events_ErrorEvent);
-    dict_init2(&flash_events_ErrorEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_ErrorEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_ErrorEvent.members, &flash_events_ErrorEvent_toString, &flash_events_ErrorEvent_toString);
-    dict_put(&flash_events_ErrorEvent.members, &flash_events_ErrorEvent_clone, &flash_events_ErrorEvent_clone);
-    dict_put(&flash_events_ErrorEvent.static_members, &flash_events_ErrorEvent_ERROR, &flash_events_ErrorEvent_ERROR);
-    dict_put(d, &flash_utils_IDataOutput, &flash_utils_IDataOutput);
-    dict_init2(&flash_utils_IDataOutput.members, &memberinfo_type, 31);
-    dict_init2(&flash_utils_IDataOutput.static_members, &memberinfo_type, 8);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeUnsignedInt, &flash_utils_IDataOutput_writeUnsignedInt);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeInt, &flash_utils_IDataOutput_writeInt);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_objectEncoding, &flash_utils_IDataOutput_objectEncoding);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeUTFBytes, &flash_utils_IDataOutput_writeUTFBytes);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeObject, &flash_utils_IDataOutput_writeObject);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeMultiByte, &flash_utils_IDataOutput_writeMultiByte);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeShort, &flash_utils_IDataOutput_writeShort);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeFloat, &flash_utils_IDataOutput_writeFloat);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeUTF, &flash_utils_IDataOutput_writeUTF);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeByte, &flash_utils_IDataOutput_writeByte);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeBoolean, &flash_utils_IDataOutput_writeBoolean);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeDouble, &flash_utils_IDataOutput_writeDouble);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_writeBytes, &flash_utils_IDataOutput_writeBytes);
-    dict_put(&flash_utils_IDataOutput.members, &flash_utils_IDataOutput_endian, &flash_utils_IDataOutput_endian);
-    dict_put(d, &flash_geom_Utils3D, &flash_geom_Utils3D);
-    dict_init2(&flash_geom_Utils3D.members, &memberinfo_type, 8);
-    dict_init2(&flash_geom_Utils3D.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_Utils3D.static_members, &flash_geom_Utils3D_projectVectors, &flash_geom_Utils3D_projectVectors);
-    dict_put(&flash_geom_Utils3D.static_members, &flash_geom_Utils3D_projectVector, &flash_geom_Utils3D_projectVector);
-    dict_put(&flash_geom_Utils3D.static_members, &flash_geom_Utils3D_pointTowards, &flash_geom_Utils3D_pointTowards);
-    dict_put(d, &flash_events_TextEvent, &flash_events_TextEvent);
-    dict_init2(&flash_events_TextEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_TextEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_TextEvent.members, &flash_events_TextEvent_toString, &flash_events_TextEvent_toString);
-    dict_put(&flash_events_TextEvent.members, &flash_events_TextEvent_text, &flash_events_TextEvent_text);
-    dict_put(&flash_events_TextEvent.members, &flash_events_TextEvent_clone, &flash_events_TextEvent_clone);
-    dict_put(&flash_events_TextEvent.static_members, &flash_events_TextEvent_LINK, &flash_events_TextEvent_LINK);
-    dict_put(&flash_events_TextEvent.static_members, &flash_events_TextEvent_TEXT_INPUT, &flash_events_TextEvent_TEXT_INPUT);
-    dict_put(d, &flash_utils_Proxy, &flash_utils_Proxy);
-    dict_init2(&flash_utils_Proxy.members, &memberinfo_type, 15);
-    dict_init2(&flash_utils_Proxy.static_members, &memberinfo_type, 8);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_callProperty, &flash_utils_Proxy_callProperty);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_setProperty, &flash_utils_Proxy_setProperty);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_getProperty, &flash_utils_Proxy_getProperty);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_nextName, &flash_utils_Proxy_nextName);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_nextNameIndex, &flash_utils_Proxy_nextNameIndex);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_hasProperty, &flash_utils_Proxy_hasProperty);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_deleteProperty, &flash_utils_Proxy_deleteProperty);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_getDescendants, &flash_utils_Proxy_getDescendants);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_isAttribute, &flash_utils_Proxy_isAttribute);
-    dict_put(&flash_utils_Proxy.members, &flash_utils_Proxy_nextValue, &flash_utils_Proxy_nextValue);
-    dict_put(d, &flash_text_engine_FontPosture, &flash_text_engine_FontPosture);
-    dict_init2(&flash_text_engine_FontPosture.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_FontPosture.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_FontPosture.static_members, &flash_text_engine_FontPosture_NORMAL, &flash_text_engine_FontPosture_NORMAL);
-    dict_put(&flash_text_engine_FontPosture.static_members, &flash_text_engine_FontPosture_ITALIC, &flash_text_engine_FontPosture_ITALIC);
-    dict_put(d, &flash_xml_XMLDocument, &flash_xml_XMLDocument);
-    dict_init2(&flash_xml_XMLDocument.members, &memberinfo_type, 8);
-    dict_init2(&flash_xml_XMLDocument.static_members, &memberinfo_type, 8);
-    dict_put(&flash_xml_XMLDocument.members, &flash_xml_XMLDocument_docTypeDecl, &flash_xml_XMLDocument_docTypeDecl);
-    dict_put(&flash_xml_XMLDocument.members, &flash_xml_XMLDocument_idMap, &flash_xml_XMLDocument_idMap);
-    dict_put(&flash_xml_XMLDocument.members, &flash_xml_XMLDocument_toString, &flash_xml_XMLDocument_toString);
-    dict_put(&flash_xml_XMLDocument.members, &flash_xml_XMLDocument_xmlDecl, &flash_xml_XMLDocument_xmlDecl);
-    dict_put(&flash_xml_XMLDocument.members, &flash_xml_XMLDocument_createElement, &flash_xml_XMLDocument_createElement);
-    dict_put(&flash_xml_XMLDocument.members, &flash_xml_XMLDocument_ignoreWhite, &flash_xml_XMLDocument_ignoreWhite);
-    dict_put(&flash_xml_XMLDocument.members, &flash_xml_XMLDocument_createTextNode, &flash_xml_XMLDocument_createTextNode);
-    dict_put(&flash_xml_XMLDocument.members, &flash_xml_XMLDocument_parseXML, &flash_xml_XMLDocument_parseXML);
-    dict_put(d, &flash_display_ShaderInput, &flash_display_ShaderInput);
-    dict_init2(&flash_display_ShaderInput.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ShaderInput.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_ShaderInput.members, &flash_display_ShaderInput_width, &flash_display_ShaderInput_width);
-    dict_put(&flash_display_ShaderInput.members, &flash_display_ShaderInput_input, &flash_display_ShaderInput_input);
-    dict_put(&flash_display_ShaderInput.members, &flash_display_ShaderInput_height, &flash_display_ShaderInput_height);
-    dict_put(&flash_display_ShaderInput.members, &flash_display_ShaderInput_index, &flash_display_ShaderInput_index);
-    dict_put(&flash_display_ShaderInput.members, &flash_display_ShaderInput_channels, &flash_display_ShaderInput_channels);
-    dict_put(d, &flash_text_engine_TextBlock, &flash_text_engine_TextBlock);
-    dict_init2(&flash_text_engine_TextBlock.members, &memberinfo_type, 31);
-    dict_init2(&flash_text_engine_TextBlock.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_createTextLine, &flash_text_engine_TextBlock_createTextLine);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_bidiLevel, &flash_text_engine_TextBlock_bidiLevel);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_getTextLineAtCharIndex, &flash_text_engine_TextBlock_getTextLineAtCharIndex);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_lastLine, &flash_text_engine_TextBlock_lastLine);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_findPreviousWordBoundary, &flash_text_engine_TextBlock_findPreviousWordBoundary);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_findPreviousAtomBoundary, &flash_text_engine_TextBlock_findPreviousAtomBoundary);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_baselineZero, &flash_text_engine_TextBlock_baselineZero);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_applyNonLinearFontScaling, &flash_text_engine_TextBlock_applyNonLinearFontScaling);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_firstLine, &flash_text_engine_TextBlock_firstLine);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_textJustifier, &flash_text_engine_TextBlock_textJustifier);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_releaseLines, &flash_text_engine_TextBlock_releaseLines);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_firstInvalidLine, &flash_text_engine_TextBlock_firstInvalidLine);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_baselineFontSize, &flash_text_engine_TextBlock_baselineFontSize);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_lineRotation, &flash_text_engine_TextBlock_lineRotation);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_userData, &flash_text_engine_TextBlock_userData);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_content, &flash_text_engine_TextBlock_content);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_textLineCreationResult, &flash_text_engine_TextBlock_textLineCreationResult);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_baselineFontDescription, &flash_text_engine_TextBlock_baselineFontDescription);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_findNextAtomBoundary, &flash_text_engine_TextBlock_findNextAtomBoundary);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_findNextWordBoundary, &flash_text_engine_TextBlock_findNextWordBoundary);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_tabStops, &flash_text_engine_TextBlock_tabStops);
-    dict_put(&flash_text_engine_TextBlock.members, &flash_text_engine_TextBlock_dump, &flash_text_engine_TextBlock_dump);
-    dict_put(d, &flash_ui_MouseCursor, &flash_ui_MouseCursor);
-    dict_init2(&flash_ui_MouseCursor.members, &memberinfo_type, 8);
-    dict_init2(&flash_ui_MouseCursor.static_members, &memberinfo_type, 8);
-    dict_put(&flash_ui_MouseCursor.static_members, &flash_ui_MouseCursor_BUTTON, &flash_ui_MouseCursor_BUTTON);
-    dict_put(&flash_ui_MouseCursor.static_members, &flash_ui_MouseCursor_AUTO, &flash_ui_MouseCursor_AUTO);
-    dict_put(&flash_ui_MouseCursor.static_members, &flash_ui_MouseCursor_ARROW, &flash_ui_MouseCursor_ARROW);
-    dict_put(&flash_ui_MouseCursor.static_members, &flash_ui_MouseCursor_IBEAM, &flash_ui_MouseCursor_IBEAM);
-    dict_put(&flash_ui_MouseCursor.static_members, &flash_ui_MouseCursor_HAND, &flash_ui_MouseCursor_HAND);
-    dict_put(d, &flash_utils_flash_proxy, &flash_utils_flash_proxy);
-    dict_put(d, &flash_display_MorphShape, &flash_display_MorphShape);
-    dict_init2(&flash_display_MorphShape.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_MorphShape.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_text_TextDisplayMode, &flash_text_TextDisplayMode);
-    dict_init2(&flash_text_TextDisplayMode.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextDisplayMode.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextDisplayMode.static_members, &flash_text_TextDisplayMode_CRT, &flash_text_TextDisplayMode_CRT);
-    dict_put(&flash_text_TextDisplayMode.static_members, &flash_text_TextDisplayMode_LCD, &flash_text_TextDisplayMode_LCD);
-    dict_put(&flash_text_TextDisplayMode.static_members, &flash_text_TextDisplayMode_DEFAULT, &flash_text_TextDisplayMode_DEFAULT);
-    dict_put(d, &flash_net_URLLoaderDataFormat, &flash_net_URLLoaderDataFormat);
-    dict_init2(&flash_net_URLLoaderDataFormat.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_URLLoaderDataFormat.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_URLLoaderDataFormat.static_members, &flash_net_URLLoaderDataFormat_VARIABLES, &flash_net_URLLoaderDataFormat_VARIABLES);
-    dict_put(&flash_net_URLLoaderDataFormat.static_members, &flash_net_URLLoaderDataFormat_BINARY, &flash_net_URLLoaderDataFormat_BINARY);
-    dict_put(&flash_net_URLLoaderDataFormat.static_members, &flash_net_URLLoaderDataFormat_TEXT, &flash_net_URLLoaderDataFormat_TEXT);
-    dict_put(d, &flash_display_StageQuality, &flash_display_StageQuality);
-    dict_init2(&flash_display_StageQuality.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_StageQuality.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_StageQuality.static_members, &flash_display_StageQuality_LOW, &flash_display_StageQuality_LOW);
-    dict_put(&flash_display_StageQuality.static_members, &flash_display_StageQuality_MEDIUM, &flash_display_StageQuality_MEDIUM);
-    dict_put(&flash_display_StageQuality.static_members, &flash_display_StageQuality_HIGH, &flash_display_StageQuality_HIGH);
-    dict_put(&flash_display_StageQuality.static_members, &flash_display_StageQuality_BEST, &flash_display_StageQuality_BEST);
-    dict_put(d, &flash_display_Sprite, &flash_display_Sprite);
-    dict_init2(&flash_display_Sprite.members, &memberinfo_type, 15);
-    dict_init2(&flash_display_Sprite.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_Sprite.members, &flash_display_Sprite_stopDrag, &flash_display_Sprite_stopDrag);
-    dict_put(&flash_display_Sprite.members, &flash_display_Sprite_buttonMode, &flash_display_Sprite_buttonMode);
-    dict_put(&flash_display_Sprite.members, &flash_display_Sprite_soundTransform, &flash_display_Sprite_soundTransform);
-    dict_put(&flash_display_Sprite.members, &flash_display_Sprite_hitArea, &flash_display_Sprite_hitArea);
-    dict_put(&flash_display_Sprite.members, &flash_display_Sprite_useHandCursor, &flash_display_Sprite_useHandCursor);
-    dict_put(&flash_display_Sprite.members, &flash_display_Sprite_graphics, &flash_display_Sprite_graphics);
-    dict_put(&flash_display_Sprite.members, &flash_display_Sprite_startDrag, &flash_display_Sprite_startDrag);
-    dict_put(&flash_display_Sprite.members, &flash_display_Sprite_dropTarget, &flash_display_Sprite_dropTarget);
-    dict_put(d, &flash_ui_Keyboard, &flash_ui_Keyboard);
-    dict_init2(&flash_ui_Keyboard.members, &memberinfo_type, 8);
-    dict_init2(&flash_ui_Keyboard.static_members, &memberinfo_type, 127);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_PAGE_DOWN, &flash_ui_Keyboard_PAGE_DOWN);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F4, &flash_ui_Keyboard_F4);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_ENTER, &flash_ui_Keyboard_ENTER);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_CONTROL, &flash_ui_Keyboard_CONTROL);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F7, &flash_ui_Keyboard_F7);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F14, &flash_ui_Keyboard_F14);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_3, &flash_ui_Keyboard_NUMPAD_3);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_DECIMAL, &flash_ui_Keyboard_NUMPAD_DECIMAL);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_CAPS_LOCK, &flash_ui_Keyboard_CAPS_LOCK);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_SHIFT, &flash_ui_Keyboard_SHIFT);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_TAB, &flash_ui_Keyboard_TAB);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_0, &flash_ui_Keyboard_NUMPAD_0);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_END, &flash_ui_Keyboard_END);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_1, &flash_ui_Keyboard_NUMPAD_1);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_LEFT, &flash_ui_Keyboard_LEFT);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F8, &flash_ui_Keyboard_F8);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F9, &flash_ui_Keyboard_F9);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_numLock, &flash_ui_Keyboard_numLock);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F2, &flash_ui_Keyboard_F2);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_4, &flash_ui_Keyboard_NUMPAD_4);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F3, &flash_ui_Keyboard_F3);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_2, &flash_ui_Keyboard_NUMPAD_2);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_HOME, &flash_ui_Keyboard_HOME);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_7, &flash_ui_Keyboard_NUMPAD_7);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_6, &flash_ui_Keyboard_NUMPAD_6);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F6, &flash_ui_Keyboard_F6);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F5, &flash_ui_Keyboard_F5);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_INSERT, &flash_ui_Keyboard_INSERT);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_ESCAPE, &flash_ui_Keyboard_ESCAPE);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F1, &flash_ui_Keyboard_F1);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_SUBTRACT, &flash_ui_Keyboard_NUMPAD_SUBTRACT);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_8, &flash_ui_Keyboard_NUMPAD_8);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_SPACE, &flash_ui_Keyboard_SPACE);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_BACKSPACE, &flash_ui_Keyboard_BACKSPACE);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_DELETE, &flash_ui_Keyboard_DELETE);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_MULTIPLY, &flash_ui_Keyboard_NUMPAD_MULTIPLY);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F13, &flash_ui_Keyboard_F13);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_ADD, &flash_ui_Keyboard_NUMPAD_ADD);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_9, &flash_ui_Keyboard_NUMPAD_9);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F12, &flash_ui_Keyboard_F12);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_RIGHT, &flash_ui_Keyboard_RIGHT);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F15, &flash_ui_Keyboard_F15);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F11, &flash_ui_Keyboard_F11);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_UP, &flash_ui_Keyboard_UP);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_isAccessible, &flash_ui_Keyboard_isAccessible);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_DOWN, &flash_ui_Keyboard_DOWN);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_capsLock, &flash_ui_Keyboard_capsLock);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_PAGE_UP, &flash_ui_Keyboard_PAGE_UP);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_ENTER, &flash_ui_Keyboard_NUMPAD_ENTER);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_F10, &flash_ui_Keyboard_F10);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_5, &flash_ui_Keyboard_NUMPAD_5);
-    dict_put(&flash_ui_Keyboard.static_members, &flash_ui_Keyboard_NUMPAD_DIVIDE, &flash_ui_Keyboard_NUMPAD_DIVIDE);
-    dict_put(d, &flash_filters_DisplacementMapFilter, &flash_filters_DisplacementMapFilter);
-    dict_init2(&flash_filters_DisplacementMapFilter.members, &memberinfo_type, 31);
-    dict_init2(&flash_filters_DisplacementMapFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_scaleY, &flash_filters_DisplacementMapFilter_scaleY);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_mapPoint, &flash_filters_DisplacementMapFilter_mapPoint);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_scaleX, &flash_filters_DisplacementMapFilter_scaleX);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_mapBitmap, &flash_filters_DisplacementMapFilter_mapBitmap);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_mode, &flash_filters_DisplacementMapFilter_mode);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_color, &flash_filters_DisplacementMapFilter_color);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_componentX, &flash_filters_DisplacementMapFilter_componentX);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_clone, &flash_filters_DisplacementMapFilter_clone);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_alpha, &flash_filters_DisplacementMapFilter_alpha);
-    dict_put(&flash_filters_DisplacementMapFilter.members, &flash_filters_DisplacementMapFilter_componentY, &flash_filters_DisplacementMapFilter_componentY);
-    dict_put(d, &flash_utils_escapeMultiByte, &flash_utils_escapeMultiByte);
-    dict_put(d, &adobe_utils_MMEndCommand, &adobe_utils_MMEndCommand);
-    dict_put(d, &flash_display_GradientType, &flash_display_GradientType);
-    dict_init2(&flash_display_GradientType.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GradientType.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GradientType.static_members, &flash_display_GradientType_LINEAR, &flash_display_GradientType_LINEAR);
-    dict_put(&flash_display_GradientType.static_members, &flash_display_GradientType_RADIAL, &flash_display_GradientType_RADIAL);
-    dict_put(d, &flash_media_ID3Info, &flash_media_ID3Info);
-    dict_init2(&flash_media_ID3Info.members, &memberinfo_type, 8);
-    dict_init2(&flash_media_ID3Info.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_ID3Info.members, &flash_media_ID3Info_comment, &flash_media_ID3Info_comment);
-    dict_put(&flash_media_ID3Info.members, &flash_media_ID3Info_year, &flash_media_ID3Info_year);
-    dict_put(&flash_media_ID3Info.members, &flash_media_ID3Info_track, &flash_media_ID3Info_track);
-    dict_put(&flash_media_ID3Info.members, &flash_media_ID3Info_artist, &flash_media_ID3Info_artist);
-    dict_put(&flash_media_ID3Info.members, &flash_media_ID3Info_songName, &flash_media_ID3Info_songName);
-    dict_put(&flash_media_ID3Info.members, &flash_media_ID3Info_genre, &flash_media_ID3Info_genre);
-    dict_put(&flash_media_ID3Info.members, &flash_media_ID3Info_album, &flash_media_ID3Info_album);
-    dict_put(d, &flash_display_GraphicsSolidFill, &flash_display_GraphicsSolidFill);
-    dict_init2(&flash_display_GraphicsSolidFill.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsSolidFill.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsSolidFill.members, &flash_display_GraphicsSolidFill_color, &flash_display_GraphicsSolidFill_color);
-    dict_put(&flash_display_GraphicsSolidFill.members, &flash_display_GraphicsSolidFill_alpha, &flash_display_GraphicsSolidFill_alpha);
-    dict_put(d, &flash_filters_ColorMatrixFilter, &flash_filters_ColorMatrixFilter);
-    dict_init2(&flash_filters_ColorMatrixFilter.members, &memberinfo_type, 8);
-    dict_init2(&flash_filters_ColorMatrixFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_ColorMatrixFilter.members, &flash_filters_ColorMatrixFilter_matrix, &flash_filters_ColorMatrixFilter_matrix);
-    dict_put(&flash_filters_ColorMatrixFilter.members, &flash_filters_ColorMatrixFilter_clone, &flash_filters_ColorMatrixFilter_clone);
-    dict_put(d, &flash_net_NetStreamPlayTransitions, &flash_net_NetStreamPlayTransitions);
-    dict_init2(&flash_net_NetStreamPlayTransitions.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_NetStreamPlayTransitions.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_NetStreamPlayTransitions.static_members, &flash_net_NetStreamPlayTransitions_RESET, &flash_net_NetStreamPlayTransitions_RESET);
-    dict_put(&flash_net_NetStreamPlayTransitions.static_members, &flash_net_NetStreamPlayTransitions_APPEND, &flash_net_NetStreamPlayTransitions_APPEND);
-    dict_put(&flash_net_NetStreamPlayTransitions.static_members, &flash_net_NetStreamPlayTransitions_SWAP, &flash_net_NetStreamPlayTransitions_SWAP);
-    dict_put(&flash_net_NetStreamPlayTransitions.static_members, &flash_net_NetStreamPlayTransitions_SWITCH, &flash_net_NetStreamPlayTransitions_SWITCH);
-    dict_put(&flash_net_NetStreamPlayTransitions.static_members, &flash_net_NetStreamPlayTransitions_STOP, &flash_net_NetStreamPlayTransitions_STOP);
-    dict_put(d, &flash_media_SoundCodec, &flash_media_SoundCodec);
-    dict_init2(&flash_media_SoundCodec.members, &memberinfo_type, 8);
-    dict_init2(&flash_media_SoundCodec.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_SoundCodec.static_members, &flash_media_SoundCodec_NELLYMOSER, &flash_media_SoundCodec_NELLYMOSER);
-    dict_put(&flash_media_SoundCodec.static_members, &flash_media_SoundCodec_SPEEX, &flash_media_SoundCodec_SPEEX);
-    dict_put(d, &flash_net_ObjectEncoding, &flash_net_ObjectEncoding);
-    dict_init2(&flash_net_ObjectEncoding.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_ObjectEncoding.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_ObjectEncoding.static_members, &flash_net_ObjectEncoding_dynamicPropertyWriter, &flash_net_ObjectEncoding_dynamicPropertyWriter);
-    dict_put(&flash_net_ObjectEncoding.static_members, &flash_net_ObjectEncoding_DEFAULT, &flash_net_ObjectEncoding_DEFAULT);
-    dict_put(&flash_net_ObjectEncoding.static_members, &flash_net_ObjectEncoding_AMF0, &flash_net_ObjectEncoding_AMF0);
-    dict_put(&flash_net_ObjectEncoding.static_members, &flash_net_ObjectEncoding_AMF3, &flash_net_ObjectEncoding_AMF3);
-    dict_put(d, &flash_text_engine_GroupElement, &flash_text_engine_GroupElement);
-    dict_init2(&flash_text_engine_GroupElement.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_GroupElement.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_groupElements, &flash_text_engine_GroupElement_groupElements);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_splitTextElement, &flash_text_engine_GroupElement_splitTextElement);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_mergeTextElements, &flash_text_engine_GroupElement_mergeTextElements);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_getElementAtCharIndex, &flash_text_engine_GroupElement_getElementAtCharIndex);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_elementCount, &flash_text_engine_GroupElement_elementCount);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_setElements, &flash_text_engine_GroupElement_setElements);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_getElementAt, &flash_text_engine_GroupElement_getElementAt);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_ungroupElements, &flash_text_engine_GroupElement_ungroupElements);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_replaceElements, &flash_text_engine_GroupElement_replaceElements);
-    dict_put(&flash_text_engine_GroupElement.members, &flash_text_engine_GroupElement_getElementIndex, &flash_text_engine_GroupElement_getElementIndex);
-    dict_put(d, &_parseInt, &_parseInt);
-    dict_put(d, &_QName, &_QName);
-    dict_init2(&_QName.members, &memberinfo_type, 8);
-    dict_init2(&_QName.static_members, &memberinfo_type, 8);
-    dict_put(&_QName.members, &_QName_localName, &_QName_localName);
-    dict_put(&_QName.members, &_QName_valueOf, &_QName_valueOf);
-    dict_put(&_QName.members, &_QName_toString, &_QName_toString);
-    dict_put(&_QName.members, &_QName_uri, &_QName_uri);
-    dict_put(&_QName.static_members, &_QName_length, &_QName_length);
-    dict_put(d, &_UninitializedError, &_UninitializedError);
-    dict_init2(&_UninitializedError.members, &memberinfo_type, 8);
-    dict_init2(&_UninitializedError.static_members, &memberinfo_type, 8);
-    dict_put(&_UninitializedError.static_members, &_UninitializedError_length, &_UninitializedError_length);
-    dict_put(d, &_Date, &_Date);
-    dict_init2(&_Date.members, &memberinfo_type, 127);
-    dict_init2(&_Date.static_members, &memberinfo_type, 8);
-    dict_put(&_Date.members, &_Date_getTimezoneOffset, &_Date_getTimezoneOffset);
-    dict_put(&_Date.members, &_Date_getTime, &_Date_getTime);
-    dict_put(&_Date.members, &_Date_setUTCMilliseconds, &_Date_setUTCMilliseconds);
-    dict_put(&_Date.members, &_Date_month, &_Date_month);
-    dict_put(&_Date.members, &_Date_toString, &_Date_toString);
-    dict_put(&_Date.members, &_Date_getHours, &_Date_getHours);
-    dict_put(&_Date.members, &_Date_date, &_Date_date);
-    dict_put(&_Date.members, &_Date_milliseconds, &_Date_milliseconds);
-    dict_put(&_Date.members, &_Date_setSeconds, &_Date_setSeconds);
-    dict_put(&_Date.members, &_Date_getDate, &_Date_getDate);
-    dict_put(&_Date.members, &_Date_hoursUTC, &_Date_hoursUTC);
-    dict_put(&_Date.members, &_Date_getUTCDate, &_Date_getUTCDate);
-    dict_put(&_Date.members, &_Date_timezoneOffset, &_Date_timezoneOffset);
-    dict_put(&_Date.members, &_Date_setTime, &_Date_setTime);
-    dict_put(&_Date.members, &_Date_millisecondsUTC, &_Date_millisecondsUTC);
-    dict_put(&_Date.members, &_Date_minutes, &_Date_minutes);
-    dict_put(&_Date.members, &_Date_setUTCHours, &_Date_setUTCHours);
-    dict_put(&_Date.members, &_Date_minutesUTC, &_Date_minutesUTC);
-    dict_put(&_Date.members, &_Date_toLocaleTimeString, &_Date_toLocaleTimeString);
-    dict_put(&_Date.members, &_Date_fullYearUTC, &_Date_fullYearUTC);
-    dict_put(&_Date.members, &_Date_time, &_Date_time);
-    dict_put(&_Date.members, &_Date_monthUTC, &_Date_monthUTC);
-    dict_put(&_Date.members, &_Date_getUTCMilliseconds, &_Date_getUTCMilliseconds);
-    dict_put(&_Date.members, &_Date_toDateString, &_Date_toDateString);
-    dict_put(&_Date.members, &_Date_getMonth, &_Date_getMonth);
-    dict_put(&_Date.members, &_Date_setMinutes, &_Date_setMinutes);
-    dict_put(&_Date.members, &_Date_toLocaleDateString, &_Date_toLocaleDateString);
-    dict_put(&_Date.members, &_Date_fullYear, &_Date_fullYear);
-    dict_put(&_Date.members, &_Date_getUTCFullYear, &_Date_getUTCFullYear);
-    dict_put(&_Date.members, &_Date_getSeconds, &_Date_getSeconds);
-    dict_put(&_Date.members, &_Date_dateUTC, &_Date_dateUTC);
-    dict_put(&_Date.members, &_Date_getMilliseconds, &_Date_getMilliseconds);
-    dict_put(&_Date.members, &_Date_setUTCMinutes, &_Date_setUTCMinutes);
-    dict_put(&_Date.members, &_Date_day, &_Date_day);
-    dict_put(&_Date.members, &_Date_setUTCSeconds, &_Date_setUTCSeconds);
-    dict_put(&_Date.members, &_Date_setUTCDate, &_Date_setUTCDate);
-    dict_put(&_Date.members, &_Date_getUTCMonth, &_Date_getUTCMonth);
-    dict_put(&_Date.members, &_Date_valueOf, &_Date_valueOf);
-    dict_put(&_Date.members, &_Date_seconds, &_Date_seconds);
-    dict_put(&_Date.members, &_Date_getUTCMinutes, &_Date_getUTCMinutes);
-    dict_put(&_Date.members, &_Date_setDate, &_Date_setDate);
-    dict_put(&_Date.members, &_Date_getFullYear, &_Date_getFullYear);
-    dict_put(&_Date.members, &_Date_setFullYear, &_Date_setFullYear);
-    dict_put(&_Date.members, &_Date_setHours, &_Date_setHours);
-    dict_put(&_Date.members, &_Date_setMonth, &_Date_setMonth);
-    dict_put(&_Date.members, &_Date_getUTCSeconds, &_Date_getUTCSeconds);
-    dict_put(&_Date.members, &_Date_getMinutes, &_Date_getMinutes);
-    dict_put(&_Date.members, &_Date_toLocaleString, &_Date_toLocaleString);
-    dict_put(&_Date.members, &_Date_toUTCString, &_Date_toUTCString);
-    dict_put(&_Date.members, &_Date_dayUTC, &_Date_dayUTC);
-    dict_put(&_Date.members, &_Date_getDay, &_Date_getDay);
-    dict_put(&_Date.members, &_Date_setUTCMonth, &_Date_setUTCMonth);
-    dict_put(&_Date.members, &_Date_hours, &_Date_hours);
-    dict_put(&_Date.members, &_Date_getUTCDay, &_Date_getUTCDay);
-    dict_put(&_Date.members, &_Date_setUTCFullYear, &_Date_setUTCFullYear);
-    dict_put(&_Date.members, &_Date_secondsUTC, &_Date_secondsUTC);
-    dict_put(&_Date.members, &_Date_toTimeString, &_Date_toTimeString);
-    dict_put(&_Date.members, &_Date_setMilliseconds, &_Date_setMilliseconds);
-    dict_put(&_Date.members, &_Date_getUTCHours, &_Date_getUTCHours);
-    dict_put(&_Date.static_members, &_Date_length, &_Date_length);
-    dict_put(&_Date.static_members, &_Date_UTC, &_Date_UTC);
-    dict_put(&_Date.static_members, &_Date_parse, &_Date_parse);
-    dict_put(d, &flash_text_StyleSheet, &flash_text_StyleSheet);
-    dict_init2(&flash_text_StyleSheet.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_StyleSheet.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_StyleSheet.members, &flash_text_StyleSheet_styleNames, &flash_text_StyleSheet_styleNames);
-    dict_put(&flash_text_StyleSheet.members, &flash_text_StyleSheet_clear, &flash_text_StyleSheet_clear);
-    dict_put(&flash_text_StyleSheet.members, &flash_text_StyleSheet_transform, &flash_text_StyleSheet_transform);
-    dict_put(&flash_text_StyleSheet.members, &flash_text_StyleSheet_getStyle, &flash_text_StyleSheet_getStyle);
-    dict_put(&flash_text_StyleSheet.members, &flash_text_StyleSheet_parseCSS, &flash_text_StyleSheet_parseCSS);
-    dict_put(&flash_text_StyleSheet.members, &flash_text_StyleSheet_setStyle, &flash_text_StyleSheet_setStyle);
-    dict_put(d, &flash_display_ActionScriptVersion, &flash_display_ActionScriptVersion);
-    dict_init2(&flash_display_ActionScriptVersion.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ActionScriptVersion.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_ActionScriptVersion.static_members, &flash_display_ActionScriptVersion_ACTIONSCRIPT3, &flash_display_ActionScriptVersion_ACTIONSCRIPT3);
-    dict_put(&flash_display_ActionScriptVersion.static_members, &flash_display_ActionScriptVersion_ACTIONSCRIPT2, &flash_display_ActionScriptVersion_ACTIONSCRIPT2);
-    dict_put(d, &flash_text_engine_EastAsianJustifier, &flash_text_engine_EastAsianJustifier);
-    dict_init2(&flash_text_engine_EastAsianJustifier.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_EastAsianJustifier.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_EastAsianJustifier.members, &flash_text_engine_EastAsianJustifier_justificationStyle, &flash_text_engine_EastAsianJustifier_justificationStyle);
-    dict_put(&flash_text_engine_EastAsianJustifier.members, &flash_text_engine_EastAsianJustifier_clone, &flash_text_engine_EastAsianJustifier_clone);
-    dict_put(d, &_String, &_String);
-    dict_init2(&_String.members, &memberinfo_type, 31);
-    dict_init2(&_String.static_members, &memberinfo_type, 8);
-    dict_put(&_String.members, &_String_indexOf, &_String_indexOf);
-    dict_put(&_String.members, &_String_replace, &_String_replace);
-    dict_put(&_String.members, &_String_lastIndexOf, &_String_lastIndexOf);
-    dict_put(&_String.members, &_String_valueOf, &_String_valueOf);
-    dict_put(&_String.members, &_String_concat, &_String_concat);
-    dict_put(&_String.members, &_String_substr, &_String_substr);
-    dict_put(&_String.members, &_String_slice, &_String_slice);
-    dict_put(&_String.members, &_String_search, &_String_search);
-    dict_put(&_String.members, &_String_toLocaleUpperCase, &_String_toLocaleUpperCase);
-    dict_put(&_String.members, &_String_toString, &_String_toString);
-    dict_put(&_String.members, &_String_toUpperCase, &_String_toUpperCase);
-    dict_put(&_String.members, &_String_charAt, &_String_charAt);
-    dict_put(&_String.members, &_String_match, &_String_match);
-    dict_put(&_String.members, &_String_charCodeAt, &_String_charCodeAt);
-    dict_put(&_String.members, &_String_substring, &_String_substring);
-    dict_put(&_String.members, &_String_localeCompare, &_String_localeCompare);
-    dict_put(&_String.members, &_String_split, &_String_split);
-    dict_put(&_String.members, &_String_toLocaleLowerCase, &_String_toLocaleLowerCase);
-    dict_put(&_String.members, &_String_length, &_String_length);
-    dict_put(&_String.members, &_String_toLowerCase, &_String_toLowerCase);
-    dict_put(&_String.static_members, &_String_fromCharCode, &_String_fromCharCode);
-    dict_put(d, &flash_media_SoundChannel, &flash_media_SoundChannel);
-    dict_init2(&flash_media_SoundChannel.members, &memberinfo_type, 8);
-    dict_init2(&flash_media_SoundChannel.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_SoundChannel.members, &flash_media_SoundChannel_leftPeak, &flash_media_SoundChannel_leftPeak);
-    dict_put(&flash_media_SoundChannel.members, &flash_media_SoundChannel_stop, &flash_media_SoundChannel_stop);
-    dict_put(&flash_media_SoundChannel.members, &flash_media_SoundChannel_position, &flash_media_SoundChannel_position);
-    dict_put(&flash_media_SoundChannel.members, &flash_media_SoundChannel_soundTransform, &flash_media_SoundChannel_soundTransform);
-    dict_put(&flash_media_SoundChannel.members, &flash_media_SoundChannel_rightPeak, &flash_media_SoundChannel_rightPeak);
-    dict_put(d, &flash_desktop_Clipboard, &flash_desktop_Clipboard);
-    dict_init2(&flash_desktop_Clipboard.members, &memberinfo_type, 8);
-    dict_init2(&flash_desktop_Clipboard.static_members, &memberinfo_type, 8);
-    dict_put(&flash_desktop_Clipboard.members, &flash_desktop_Clipboard_setDataHandler, &flash_desktop_Clipboard_setDataHandler);
-    dict_put(&flash_desktop_Clipboard.members, &flash_desktop_Clipboard_setData, &flash_desktop_Clipboard_setData);
-    dict_put(&flash_desktop_Clipboard.members, &flash_desktop_Clipboard_formats, &flash_desktop_Clipboard_formats);
-    dict_put(&flash_desktop_Clipboard.members, &flash_desktop_Clipboard_clear, &flash_desktop_Clipboard_clear);
-    dict_put(&flash_desktop_Clipboard.members, &flash_desktop_Clipboard_getData, &flash_desktop_Clipboard_getData);
-    dict_put(&flash_desktop_Clipboard.members, &flash_desktop_Clipboard_hasFormat, &flash_desktop_Clipboard_hasFormat);
-    dict_put(&flash_desktop_Clipboard.members, &flash_desktop_Clipboard_clearData, &flash_desktop_Clipboard_clearData);
-    dict_put(&flash_desktop_Clipboard.static_members, &flash_desktop_Clipboard_generalClipboard, &flash_desktop_Clipboard_generalClipboard);
-    dict_put(d, &flash_display_IBitmapDrawable, &flash_display_IBitmapDrawable);
-    dict_init2(&flash_display_IBitmapDrawable.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_IBitmapDrawable.static_members, &memberinfo_type, 8);
-    dict_put(d, &_TypeError, &_TypeError);
-    dict_init2(&_TypeError.members, &memberinfo_type, 8);
-    dict_init2(&_TypeError.static_members, &memberinfo_type, 8);
-    dict_put(&_TypeError.static_members, &_TypeError_length, &_TypeError_length);
-    dict_put(d, &_int, &_int);
-    dict_init2(&_int.members, &memberinfo_type, 8);
-    dict_init2(&_int.static_members, &memberinfo_type, 8);
-    dict_put(&_int.members, &_int_valueOf, &_int_valueOf);
-    dict_put(&_int.members, &_int_toString, &_int_toString);
-    dict_put(&_int.members, &_int_toExponential, &_int_toExponential);
-    dict_put(&_int.members, &_int_toFixed, &_int_toFixed);
-    dict_put(&_int.members, &_int_toPrecision, &_int_toPrecision);
-    dict_put(&_int.static_members, &_int_MAX_VALUE, &_int_MAX_VALUE);
-    dict_put(&_int.static_members, &_int_length, &_int_length);
-    dict_put(&_int.static_members, &_int_MIN_VALUE, &_int_MIN_VALUE);
-    dict_put(d, &flash_display_Scene, &flash_display_Scene);
-    dict_init2(&flash_display_Scene.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_Scene.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_Scene.members, &flash_display_Scene_numFrames, &flash_display_Scene_numFrames);
-    dict_put(&flash_display_Scene.members, &flash_display_Scene_labels, &flash_display_Scene_labels);
-    dict_put(&flash_display_Scene.members, &flash_display_Scene_name, &flash_display_Scene_name);
-    dict_put(d, &flash_text_engine_FontMetrics, &flash_text_engine_FontMetrics);
-    dict_init2(&flash_text_engine_FontMetrics.members, &memberinfo_type, 15);
-    dict_init2(&flash_text_engine_FontMetrics.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_superscriptOffset, &flash_text_engine_FontMetrics_superscriptOffset);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_underlineThickness, &flash_text_engine_FontMetrics_underlineThickness);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_subscriptScale, &flash_text_engine_FontMetrics_subscriptScale);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_strikethroughOffset, &flash_text_engine_FontMetrics_strikethroughOffset);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_emBox, &flash_text_engine_FontMetrics_emBox);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_strikethroughThickness, &flash_text_engine_FontMetrics_strikethroughThickness);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_superscriptScale, &flash_text_engine_FontMetrics_superscriptScale);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_subscriptOffset, &flash_text_engine_FontMetrics_subscriptOffset);
-    dict_put(&flash_text_engine_FontMetrics.members, &flash_text_engine_FontMetrics_underlineOffset, &flash_text_engine_FontMetrics_underlineOffset);
-    dict_put(d, &flash_utils_IExternalizable, &flash_utils_IExternalizable);
-    dict_init2(&flash_utils_IExternalizable.members, &memberinfo_type, 8);
-    dict_init2(&flash_utils_IExternalizable.static_members, &memberinfo_type, 8);
-    dict_put(&flash_utils_IExternalizable.members, &flash_utils_IExternalizable_readExternal, &flash_utils_IExternalizable_readExternal);
-    dict_put(&flash_utils_IExternalizable.members, &flash_utils_IExternalizable_writeExternal, &flash_utils_IExternalizable_writeExternal);
-    dict_put(d, &__AS3___vec_Vector, &__AS3___vec_Vector);
-    dict_init2(&__AS3___vec_Vector.members, &memberinfo_type, 8);
-    dict_init2(&__AS3___vec_Vector.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_filters_GradientBevelFilter, &flash_filters_GradientBevelFilter);
-    dict_init2(&flash_filters_GradientBevelFilter.members, &memberinfo_type, 15);
-    dict_init2(&flash_filters_GradientBevelFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_strength, &flash_filters_GradientBevelFilter_strength);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_quality, &flash_filters_GradientBevelFilter_quality);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_angle, &flash_filters_GradientBevelFilter_angle);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_knockout, &flash_filters_GradientBevelFilter_knockout);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_alphas, &flash_filters_GradientBevelFilter_alphas);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_type, &flash_filters_GradientBevelFilter_type);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_ratios, &flash_filters_GradientBevelFilter_ratios);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_colors, &flash_filters_GradientBevelFilter_colors);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_blurX, &flash_filters_GradientBevelFilter_blurX);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_blurY, &flash_filters_GradientBevelFilter_blurY);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_distance, &flash_filters_GradientBevelFilter_distance);
-    dict_put(&flash_filters_GradientBevelFilter.members, &flash_filters_GradientBevelFilter_clone, &flash_filters_GradientBevelFilter_clone);
-    dict_put(d, &flash_text_TextRun, &flash_text_TextRun);
-    dict_init2(&flash_text_TextRun.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextRun.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextRun.members, &flash_text_TextRun_beginIndex, &flash_text_TextRun_beginIndex);
-    dict_put(&flash_text_TextRun.members, &flash_text_TextRun_endIndex, &flash_text_TextRun_endIndex);
-    dict_put(&flash_text_TextRun.members, &flash_text_TextRun_textFormat, &flash_text_TextRun_textFormat);
-    dict_put(d, &flash_text_TextColorType, &flash_text_TextColorType);
-    dict_init2(&flash_text_TextColorType.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextColorType.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextColorType.static_members, &flash_text_TextColorType_DARK_COLOR, &flash_text_TextColorType_DARK_COLOR);
-    dict_put(&flash_text_TextColorType.static_members, &flash_text_TextColorType_LIGHT_COLOR, &flash_text_TextColorType_LIGHT_COLOR);
-    dict_put(d, &flash_sampler_getSampleCount, &flash_sampler_getSampleCount);
-    dict_put(d, &flash_net_URLRequestHeader, &flash_net_URLRequestHeader);
-    dict_init2(&flash_net_URLRequestHeader.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_URLRequestHeader.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_URLRequestHeader.members, &flash_net_URLRequestHeader_value, &flash_net_URLRequestHeader_value);
-    dict_put(&flash_net_URLRequestHeader.members, &flash_net_URLRequestHeader_name, &flash_net_URLRequestHeader_name);
-    dict_put(d, &flash_profiler_showRedrawRegions, &flash_profiler_showRedrawRegions);
-    dict_put(d, &flash_display_ShaderData, &flash_display_ShaderData);
-    dict_init2(&flash_display_ShaderData.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ShaderData.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_text_engine_TextLine, &flash_text_engine_TextLine);
-    dict_init2(&flash_text_engine_TextLine.members, &memberinfo_type, 63);
-    dict_init2(&flash_text_engine_TextLine.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_previousLine, &flash_text_engine_TextLine_previousLine);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_validity, &flash_text_engine_TextLine_validity);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomTextBlockBeginIndex, &flash_text_engine_TextLine_getAtomTextBlockBeginIndex);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomWordBoundaryOnLeft, &flash_text_engine_TextLine_getAtomWordBoundaryOnLeft);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomTextRotation, &flash_text_engine_TextLine_getAtomTextRotation);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_textHeight, &flash_text_engine_TextLine_textHeight);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomCenter, &flash_text_engine_TextLine_getAtomCenter);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomBounds, &flash_text_engine_TextLine_getAtomBounds);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_mirrorRegions, &flash_text_engine_TextLine_mirrorRegions);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_rawTextLength, &flash_text_engine_TextLine_rawTextLength);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_userData, &flash_text_engine_TextLine_userData);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_textWidth, &flash_text_engine_TextLine_textWidth);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_textBlock, &flash_text_engine_TextLine_textBlock);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_textBlockBeginIndex, &flash_text_engine_TextLine_textBlockBeginIndex);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_unjustifiedTextWidth, &flash_text_engine_TextLine_unjustifiedTextWidth);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_ascent, &flash_text_engine_TextLine_ascent);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getBaselinePosition, &flash_text_engine_TextLine_getBaselinePosition);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_specifiedWidth, &flash_text_engine_TextLine_specifiedWidth);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getMirrorRegion, &flash_text_engine_TextLine_getMirrorRegion);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomGraphic, &flash_text_engine_TextLine_getAtomGraphic);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_hasGraphicElement, &flash_text_engine_TextLine_hasGraphicElement);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_flushAtomData, &flash_text_engine_TextLine_flushAtomData);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_dump, &flash_text_engine_TextLine_dump);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_nextLine, &flash_text_engine_TextLine_nextLine);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomIndexAtCharIndex, &flash_text_engine_TextLine_getAtomIndexAtCharIndex);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomTextBlockEndIndex, &flash_text_engine_TextLine_getAtomTextBlockEndIndex);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_atomCount, &flash_text_engine_TextLine_atomCount);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_descent, &flash_text_engine_TextLine_descent);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomBidiLevel, &flash_text_engine_TextLine_getAtomBidiLevel);
-    dict_put(&flash_text_engine_TextLine.members, &flash_text_engine_TextLine_getAtomIndexAtPoint, &flash_text_engine_TextLine_getAtomIndexAtPoint);
-    dict_put(&flash_text_engine_TextLine.static_members, &flash_text_engine_TextLine_MAX_LINE_WIDTH, &flash_text_engine_TextLine_MAX_LINE_WIDTH);
-    dict_put(d, &flash_sampler_getSamples, &flash_sampler_getSamples);
-    dict_put(d, &flash_net_URLRequest, &flash_net_URLRequest);
-    dict_init2(&flash_net_URLRequest.members, &memberinfo_type, 15);
-    dict_init2(&flash_net_URLRequest.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_URLRequest.members, &flash_net_URLRequest_contentType, &flash_net_URLRequest_contentType);
-    dict_put(&flash_net_URLRequest.members, &flash_net_URLRequest_url, &flash_net_URLRequest_url);
-    dict_put(&flash_net_URLRequest.members, &flash_net_URLRequest_requestHeaders, &flash_net_URLRequest_requestHeaders);
-    dict_put(&flash_net_URLRequest.members, &flash_net_URLRequest_method, &flash_net_URLRequest_method);
-    dict_put(&flash_net_URLRequest.members, &flash_net_URLRequest_digest, &flash_net_URLRequest_digest);
-    dict_put(&flash_net_URLRequest.members, &flash_net_URLRequest_data, &flash_net_URLRequest_data);
-    dict_put(d, &_URIError, &_URIError);
-    dict_init2(&_URIError.members, &memberinfo_type, 8);
-    dict_init2(&_URIError.static_members, &memberinfo_type, 8);
-    dict_put(&_URIError.static_members, &_URIError_length, &_URIError_length);
-    dict_put(d, &flash_net_getClassByAlias, &flash_net_getClassByAlias);
-    dict_put(d, &flash_display_ShaderParameter, &flash_display_ShaderParameter);
-    dict_init2(&flash_display_ShaderParameter.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ShaderParameter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_ShaderParameter.members, &flash_display_ShaderParameter_value, &flash_display_ShaderParameter_value);
-    dict_put(&flash_display_ShaderParameter.members, &flash_display_ShaderParameter_index, &flash_display_ShaderParameter_index);
-    dict_put(&flash_display_ShaderParameter.members, &flash_display_ShaderParameter_type, &flash_display_ShaderParameter_type);
-    dict_put(d, &flash_filters_BitmapFilterType, &flash_filters_BitmapFilterType);
-    dict_init2(&flash_filters_BitmapFilterType.members, &memberinfo_type, 8);
-    dict_init2(&flash_filters_BitmapFilterType.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_BitmapFilterType.static_members, &flash_filters_BitmapFilterType_FULL, &flash_filters_BitmapFilterType_FULL);
-    dict_put(&flash_filters_BitmapFilterType.static_members, &flash_filters_BitmapFilterType_INNER, &flash_filters_BitmapFilterType_INNER);
-    dict_put(&flash_filters_BitmapFilterType.static_members, &flash_filters_BitmapFilterType_OUTER, &flash_filters_BitmapFilterType_OUTER);
-    dict_put(d, &_SecurityError, &_SecurityError);
-    dict_init2(&_SecurityError.members, &memberinfo_type, 8);
-    dict_init2(&_SecurityError.static_members, &memberinfo_type, 8);
-    dict_put(&_SecurityError.static_members, &_SecurityError_length, &_SecurityError_length);
-    dict_put(d, &flash_utils_IDataInput, &flash_utils_IDataInput);
-    dict_init2(&flash_utils_IDataInput.members, &memberinfo_type, 31);
-    dict_init2(&flash_utils_IDataInput.static_members, &memberinfo_type, 8);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readUTF, &flash_utils_IDataInput_readUTF);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readByte, &flash_utils_IDataInput_readByte);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readUTFBytes, &flash_utils_IDataInput_readUTFBytes);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readShort, &flash_utils_IDataInput_readShort);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_objectEncoding, &flash_utils_IDataInput_objectEncoding);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readUnsignedInt, &flash_utils_IDataInput_readUnsignedInt);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readDouble, &flash_utils_IDataInput_readDouble);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readBytes, &flash_utils_IDataInput_readBytes);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readUnsignedByte, &flash_utils_IDataInput_readUnsignedByte);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readMultiByte, &flash_utils_IDataInput_readMultiByte);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readInt, &flash_utils_IDataInput_readInt);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_bytesAvailable, &flash_utils_IDataInput_bytesAvailable);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readUnsignedShort, &flash_utils_IDataInput_readUnsignedShort);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readObject, &flash_utils_IDataInput_readObject);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readFloat, &flash_utils_IDataInput_readFloat);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_endian, &flash_utils_IDataInput_endian);
-    dict_put(&flash_utils_IDataInput.members, &flash_utils_IDataInput_readBoolean, &flash_utils_IDataInput_readBoolean);
-    dict_put(d, &flash_events_IEventDispatcher, &flash_events_IEventDispatcher);
-    dict_init2(&flash_events_IEventDispatcher.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_IEventDispatcher.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_IEventDispatcher.members, &flash_events_IEventDispatcher_willTrigger, &flash_events_IEventDispatcher_willTrigger);
-    dict_put(&flash_events_IEventDispatcher.members, &flash_events_IEventDispatcher_removeEventListener, &flash_events_IEventDispatcher_removeEventListener);
-    dict_put(&flash_events_IEventDispatcher.members, &flash_events_IEventDispatcher_hasEventListener, &flash_events_IEventDispatcher_hasEventListener);
-    dict_put(&flash_events_IEventDispatcher.members, &flash_events_IEventDispatcher_addEventListener, &flash_events_IEventDispatcher_addEventListener);
-    dict_put(&flash_events_IEventDispatcher.members, &flash_events_IEventDispatcher_dispatchEvent, &flash_events_IEventDispatcher_dispatchEvent);
-    dict_put(d, &_Class, &_Class);
-    dict_init2(&_Class.members, &memberinfo_type, 8);
-    dict_init2(&_Class.static_members, &memberinfo_type, 8);
-    dict_put(&_Class.members, &_Class_prototype, &_Class_prototype);
-    dict_put(&_Class.static_members, &_Class_length, &_Class_length);
-    dict_put(d, &flash_geom_Rectangle, &flash_geom_Rectangle);
-    dict_init2(&flash_geom_Rectangle.members, &memberinfo_type, 31);
-    dict_init2(&flash_geom_Rectangle.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_top, &flash_geom_Rectangle_top);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_intersection, &flash_geom_Rectangle_intersection);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_intersects, &flash_geom_Rectangle_intersects);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_containsPoint, &flash_geom_Rectangle_containsPoint);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_setEmpty, &flash_geom_Rectangle_setEmpty);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_topLeft, &flash_geom_Rectangle_topLeft);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_width, &flash_geom_Rectangle_width);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_containsRect, &flash_geom_Rectangle_containsRect);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_isEmpty, &flash_geom_Rectangle_isEmpty);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_equals, &flash_geom_Rectangle_equals);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_height, &flash_geom_Rectangle_height);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_left, &flash_geom_Rectangle_left);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_inflate, &flash_geom_Rectangle_inflate);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_inflatePoint, &flash_geom_Rectangle_inflatePoint);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_toString, &flash_geom_Rectangle_toString);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_offsetPoint, &flash_geom_Rectangle_offsetPoint);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_x, &flash_geom_Rectangle_x);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_size, &flash_geom_Rectangle_size);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_bottomRight, &flash_geom_Rectangle_bottomRight);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_right, &flash_geom_Rectangle_right);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_contains, &flash_geom_Rectangle_contains);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_union, &flash_geom_Rectangle_union);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_bottom, &flash_geom_Rectangle_bottom);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_clone, &flash_geom_Rectangle_clone);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_y, &flash_geom_Rectangle_y);
-    dict_put(&flash_geom_Rectangle.members, &flash_geom_Rectangle_offset, &flash_geom_Rectangle_offset);
-    dict_put(d, &flash_events_SecurityErrorEvent, &flash_events_SecurityErrorEvent);
-    dict_init2(&flash_events_SecurityErrorEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_SecurityErrorEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_SecurityErrorEvent.members, &flash_events_SecurityErrorEvent_toString, &flash_events_SecurityErrorEvent_toString);
-    dict_put(&flash_events_SecurityErrorEvent.members, &flash_events_SecurityErrorEvent_clone, &flash_events_SecurityErrorEvent_clone);
-    dict_put(&flash_events_SecurityErrorEvent.static_members, &flash_events_SecurityErrorEvent_SECURITY_ERROR, &flash_events_SecurityErrorEvent_SECURITY_ERROR);
-    dict_put(d, &flash_net_IDynamicPropertyWriter, &flash_net_IDynamicPropertyWriter);
-    dict_init2(&flash_net_IDynamicPropertyWriter.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_IDynamicPropertyWriter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_IDynamicPropertyWriter.members, &flash_net_IDynamicPropertyWriter_writeDynamicProperties, &flash_net_IDynamicPropertyWriter_writeDynamicProperties);
-    dict_put(d, &flash_display_InterpolationMethod, &flash_display_InterpolationMethod);
-    dict_init2(&flash_display_InterpolationMethod.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_InterpolationMethod.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_InterpolationMethod.static_members, &flash_display_InterpolationMethod_RGB, &flash_display_InterpolationMethod_RGB);
-    dict_put(&flash_display_InterpolationMethod.static_members, &flash_display_InterpolationMethod_LINEAR_RGB, &flash_display_InterpolationMethod_LINEAR_RGB);
-    dict_put(d, &_Object, &_Object);
-    dict_init2(&_Object.members, &memberinfo_type, 8);
-    dict_init2(&_Object.static_members, &memberinfo_type, 8);
-    dict_put(&_Object.members, &_Object_propertyIsEnumerable, &_Object_propertyIsEnumerable);
-    dict_put(&_Object.members, &_Object_isPrototypeOf, &_Object_isPrototypeOf);
-    dict_put(&_Object.members, &_Object_hasOwnProperty, &_Object_hasOwnProperty);
-    dict_put(&_Object.static_members, &_Object_init, &_Object_init);
-    dict_put(&_Object.static_members, &_Object_length, &_Object_length);
-    dict_put(&_Object.static_members, &_Object__setPropertyIsEnumerable, &_Object__setPropertyIsEnumerable);
-    dict_put(&_Object.static_members, &_Object__dontEnumPrototype, &_Object__dontEnumPrototype);
-    dict_put(d, &flash_errors_EOFError, &flash_errors_EOFError);
-    dict_init2(&flash_errors_EOFError.members, &memberinfo_type, 8);
-    dict_init2(&flash_errors_EOFError.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_net_NetStream, &flash_net_NetStream);
-    dict_init2(&flash_net_NetStream.members, &memberinfo_type, 63);
-    dict_init2(&flash_net_NetStream.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_videoCodec, &flash_net_NetStream_videoCodec);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_info, &flash_net_NetStream_info);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_attachCamera, &flash_net_NetStream_attachCamera);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_farNonce, &flash_net_NetStream_farNonce);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_close, &flash_net_NetStream_close);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_pause, &flash_net_NetStream_pause);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_onPeerConnect, &flash_net_NetStream_onPeerConnect);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_client, &flash_net_NetStream_client);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_resume, &flash_net_NetStream_resume);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_liveDelay, &flash_net_NetStream_liveDelay);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_peerStreams, &flash_net_NetStream_peerStreams);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_objectEncoding, &flash_net_NetStream_objectEncoding);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_bytesLoaded, &flash_net_NetStream_bytesLoaded);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_receiveVideo, &flash_net_NetStream_receiveVideo);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_maxPauseBufferTime, &flash_net_NetStream_maxPauseBufferTime);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_play2, &flash_net_NetStream_play2);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_audioCodec, &flash_net_NetStream_audioCodec);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_receiveVideoFPS, &flash_net_NetStream_receiveVideoFPS);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_bytesTotal, &flash_net_NetStream_bytesTotal);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_farID, &flash_net_NetStream_farID);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_receiveAudio, &flash_net_NetStream_receiveAudio);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_bufferLength, &flash_net_NetStream_bufferLength);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_seek, &flash_net_NetStream_seek);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_attachAudio, &flash_net_NetStream_attachAudio);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_bufferTime, &flash_net_NetStream_bufferTime);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_play, &flash_net_NetStream_play);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_publish, &flash_net_NetStream_publish);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_togglePause, &flash_net_NetStream_togglePause);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_checkPolicyFile, &flash_net_NetStream_checkPolicyFile);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_nearNonce, &flash_net_NetStream_nearNonce);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_decodedFrames, &flash_net_NetStream_decodedFrames);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_send, &flash_net_NetStream_send);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_currentFPS, &flash_net_NetStream_currentFPS);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_time, &flash_net_NetStream_time);
-    dict_put(&flash_net_NetStream.members, &flash_net_NetStream_soundTransform, &flash_net_NetStream_soundTransform);
-    dict_put(&flash_net_NetStream.static_members, &flash_net_NetStream_CONNECT_TO_FMS, &flash_net_NetStream_CONNECT_TO_FMS);
-    dict_put(&flash_net_NetStream.static_members, &flash_net_NetStream_DIRECT_CONNECTIONS, &flash_net_NetStream_DIRECT_CONNECTIONS);
-    dict_put(d, &_ArgumentError, &_ArgumentError);
-    dict_init2(&_ArgumentError.members, &memberinfo_type, 8);
-    dict_init2(&_ArgumentError.static_members, &memberinfo_type, 8);
-    dict_put(&_ArgumentError.static_members, &_ArgumentError_length, &_ArgumentError_length);
-    dict_put(d, &_XMLList, &_XMLList);
-    dict_init2(&_XMLList.members, &memberinfo_type, 63);
-    dict_init2(&_XMLList.static_members, &memberinfo_type, 8);
-    dict_put(&_XMLList.members, &_XMLList_normalize, &_XMLList_normalize);
-    dict_put(&_XMLList.members, &_XMLList_removeNamespace, &_XMLList_removeNamespace);
-    dict_put(&_XMLList.members, &_XMLList_prependChild, &_XMLList_prependChild);
-    dict_put(&_XMLList.members, &_XMLList_toXMLString, &_XMLList_toXMLString);
-    dict_put(&_XMLList.members, &_XMLList_nodeKind, &_XMLList_nodeKind);
-    dict_put(&_XMLList.members, &_XMLList_copy, &_XMLList_copy);
-    dict_put(&_XMLList.members, &_XMLList_text, &_XMLList_text);
-    dict_put(&_XMLList.members, &_XMLList_toString, &_XMLList_toString);
-    dict_put(&_XMLList.members, &_XMLList_childIndex, &_XMLList_childIndex);
-    dict_put(&_XMLList.members, &_XMLList_setName, &_XMLList_setName);
-    dict_put(&_XMLList.members, &_XMLList_setLocalName, &_XMLList_setLocalName);
-    dict_put(&_XMLList.members, &_XMLList_namespace, &_XMLList_namespace);
-    dict_put(&_XMLList.members, &_XMLList_insertChildBefore, &_XMLList_insertChildBefore);
-    dict_put(&_XMLList.members, &_XMLList_addNamespace, &_XMLList_addNamespace);
-    dict_put(&_XMLList.members, &_XMLList_propertyIsEnumerable, &_XMLList_propertyIsEnumerable);
-    dict_put(&_XMLList.members, &_XMLList_comments, &_XMLList_comments);
-    dict_put(&_XMLList.members, &_XMLList_attributes, &_XMLList_attributes);
-    dict_put(&_XMLList.members, &_XMLList_descendants, &_XMLList_descendants);
-    dict_put(&_XMLList.members, &_XMLList_replace, &_XMLList_replace);
-    dict_put(&_XMLList.members, &_XMLList_children, &_XMLList_children);
-    dict_put(&_XMLList.members, &_XMLList_contains, &_XMLList_contains);
-    dict_put(&_XMLList.members, &_XMLList_hasSimpleContent, &_XMLList_hasSimpleContent);
-    dict_put(&_XMLList.members, &_XMLList_elements, &_XMLList_elements);
-    dict_put(&_XMLList.members, &_XMLList_hasComplexContent, &_XMLList_hasComplexContent);
-    dict_put(&_XMLList.members, &_XMLList_insertChildAfter, &_XMLList_insertChildAfter);
-    dict_put(&_XMLList.members, &_XMLList_parent, &_XMLList_parent);
-    dict_put(&_XMLList.members, &_XMLList_length, &_XMLList_length);
-    dict_put(&_XMLList.members, &_XMLList_processingInstructions, &_XMLList_processingInstructions);
-    dict_put(&_XMLList.members, &_XMLList_child, &_XMLList_child);
-    dict_put(&_XMLList.members, &_XMLList_appendChild, &_XMLList_appendChild);
-    dict_put(&_XMLList.members, &_XMLList_valueOf, &_XMLList_valueOf);
-    dict_put(&_XMLList.members, &_XMLList_localName, &_XMLList_localName);
-    dict_put(&_XMLList.members, &_XMLList_inScopeNamespaces, &_XMLList_inScopeNamespaces);
-    dict_put(&_XMLList.members, &_XMLList_hasOwnProperty, &_XMLList_hasOwnProperty);
-    dict_put(&_XMLList.members, &_XMLList_setNamespace, &_XMLList_setNamespace);
-    dict_put(&_XMLList.members, &_XMLList_namespaceDeclarations, &_XMLList_namespaceDeclarations);
-    dict_put(&_XMLList.members, &_XMLList_name, &_XMLList_name);
-    dict_put(&_XMLList.members, &_XMLList_setChildren, &_XMLList_setChildren);
-    dict_put(&_XMLList.members, &_XMLList_attribute, &_XMLList_attribute);
-    dict_put(d, &flash_geom_Point, &flash_geom_Point);
-    dict_init2(&flash_geom_Point.members, &memberinfo_type, 15);
-    dict_init2(&flash_geom_Point.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_equals, &flash_geom_Point_equals);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_normalize, &flash_geom_Point_normalize);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_x, &flash_geom_Point_x);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_offset, &flash_geom_Point_offset);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_subtract, &flash_geom_Point_subtract);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_y, &flash_geom_Point_y);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_length, &flash_geom_Point_length);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_add, &flash_geom_Point_add);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_toString, &flash_geom_Point_toString);
-    dict_put(&flash_geom_Point.members, &flash_geom_Point_clone, &flash_geom_Point_clone);
-    dict_put(&flash_geom_Point.static_members, &flash_geom_Point_polar, &flash_geom_Point_polar);
-    dict_put(&flash_geom_Point.static_members, &flash_geom_Point_distance, &flash_geom_Point_distance);
-    dict_put(&flash_geom_Point.static_members, &flash_geom_Point_interpolate, &flash_geom_Point_interpolate);
-    dict_put(d, &flash_printing_PrintJobOptions, &flash_printing_PrintJobOptions);
-    dict_init2(&flash_printing_PrintJobOptions.members, &memberinfo_type, 8);
-    dict_init2(&flash_printing_PrintJobOptions.static_members, &memberinfo_type, 8);
-    dict_put(&flash_printing_PrintJobOptions.members, &flash_printing_PrintJobOptions_printAsBitmap, &flash_printing_PrintJobOptions_printAsBitmap);
-    dict_put(d, &flash_display_DisplayObject, &flash_display_DisplayObject);
-    dict_init2(&flash_display_DisplayObject.members, &memberinfo_type, 63);
-    dict_init2(&flash_display_DisplayObject.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_rotation, &flash_display_DisplayObject_rotation);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_filters, &flash_display_DisplayObject_filters);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_rotationZ, &flash_display_DisplayObject_rotationZ);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_accessibilityProperties, &flash_display_DisplayObject_accessibilityProperties);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_mouseX, &flash_display_DisplayObject_mouseX);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_root, &flash_display_DisplayObject_root);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_stage, &flash_display_DisplayObject_stage);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_rotationY, &flash_display_DisplayObject_rotationY);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_scaleZ, &flash_display_DisplayObject_scaleZ);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_local3DToGlobal, &flash_display_DisplayObject_local3DToGlobal);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_loaderInfo, &flash_display_DisplayObject_loaderInfo);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_cacheAsBitmap, &flash_display_DisplayObject_cacheAsBitmap);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_transform, &flash_display_DisplayObject_transform);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_scaleY, &flash_display_DisplayObject_scaleY);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_height, &flash_display_DisplayObject_height);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_rotationX, &flash_display_DisplayObject_rotationX);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_scrollRect, &flash_display_DisplayObject_scrollRect);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_width, &flash_display_DisplayObject_width);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_scale9Grid, &flash_display_DisplayObject_scale9Grid);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_parent, &flash_display_DisplayObject_parent);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_hitTestObject, &flash_display_DisplayObject_hitTestObject);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_hitTestPoint, &flash_display_DisplayObject_hitTestPoint);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_alpha, &flash_display_DisplayObject_alpha);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_getRect, &flash_display_DisplayObject_getRect);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_opaqueBackground, &flash_display_DisplayObject_opaqueBackground);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_globalToLocal3D, &flash_display_DisplayObject_globalToLocal3D);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_visible, &flash_display_DisplayObject_visible);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_blendMode, &flash_display_DisplayObject_blendMode);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_scaleX, &flash_display_DisplayObject_scaleX);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_globalToLocal, &flash_display_DisplayObject_globalToLocal);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_localToGlobal, &flash_display_DisplayObject_localToGlobal);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_z, &flash_display_DisplayObject_z);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_name, &flash_display_DisplayObject_name);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_getBounds, &flash_display_DisplayObject_getBounds);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_mask, &flash_display_DisplayObject_mask);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_mouseY, &flash_display_DisplayObject_mouseY);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_x, &flash_display_DisplayObject_x);
-    dict_put(&flash_display_DisplayObject.members, &flash_display_DisplayObject_y, &flash_display_DisplayObject_y);
-    dict_put(d, &flash_sampler_DeleteObjectSample, &flash_sampler_DeleteObjectSample);
-    dict_init2(&flash_sampler_DeleteObjectSample.members, &memberinfo_type, 8);
-    dict_init2(&flash_sampler_DeleteObjectSample.static_members, &memberinfo_type, 8);
-    dict_put(&flash_sampler_DeleteObjectSample.members, &flash_sampler_DeleteObjectSample_size, &flash_sampler_DeleteObjectSample_size);
-    dict_put(&flash_sampler_DeleteObjectSample.members, &flash_sampler_DeleteObjectSample_id, &flash_sampler_DeleteObjectSample_id);
-    dict_put(d, &flash_system_fscommand, &flash_system_fscommand);
-    dict_put(d, &flash_utils_unescapeMultiByte, &flash_utils_unescapeMultiByte);
-    dict_put(d, &flash_sampler_StackFrame, &flash_sampler_StackFrame);
-    dict_init2(&flash_sampler_StackFrame.members, &memberinfo_type, 8);
-    dict_init2(&flash_sampler_StackFrame.static_members, &memberinfo_type, 8);
-    dict_put(&flash_sampler_StackFrame.members, &flash_sampler_StackFrame_name, &flash_sampler_StackFrame_name);
-    dict_put(&flash_sampler_StackFrame.members, &flash_sampler_StackFrame_line, &flash_sampler_StackFrame_line);
-    dict_put(&flash_sampler_StackFrame.members, &flash_sampler_StackFrame_toString, &flash_sampler_StackFrame_toString);
-    dict_put(&flash_sampler_StackFrame.members, &flash_sampler_StackFrame_file, &flash_sampler_StackFrame_file);
-    dict_put(d, &flash_system_JPEGLoaderContext, &flash_system_JPEGLoaderContext);
-    dict_init2(&flash_system_JPEGLoaderContext.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_JPEGLoaderContext.static_members, &memberinfo_type, 8);
-    dict_put(&flash_system_JPEGLoaderContext.members, &flash_system_JPEGLoaderContext_deblockingFilter, &flash_system_JPEGLoaderContext_deblockingFilter);
-    dict_put(d, &flash_system_IME, &flash_system_IME);
-    dict_init2(&flash_system_IME.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_IME.static_members, &memberinfo_type, 8);
-    dict_put(&flash_system_IME.static_members, &flash_system_IME_setCompositionString, &flash_system_IME_setCompositionString);
-    dict_put(&flash_system_IME.static_members, &flash_system_IME_enabled, &flash_system_IME_enabled);
-    dict_put(&flash_system_IME.static_members, &flash_system_IME_doConversion, &flash_system_IME_doConversion);
-    dict_put(&flash_system_IME.static_members, &flash_system_IME_conversionMode, &flash_system_IME_conversionMode);
-    dict_put(d, &_isNaN, &_isNaN);
-    dict_put(d, &flash_system_Security, &flash_system_Security);
-    dict_init2(&flash_system_Security.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_Security.static_members, &memberinfo_type, 15);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_sandboxType, &flash_system_Security_sandboxType);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_LOCAL_WITH_NETWORK, &flash_system_Security_LOCAL_WITH_NETWORK);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_loadPolicyFile, &flash_system_Security_loadPolicyFile);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_allowDomain, &flash_system_Security_allowDomain);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_showSettings, &flash_system_Security_showSettings);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_LOCAL_TRUSTED, &flash_system_Security_LOCAL_TRUSTED);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_disableAVM1Loading, &flash_system_Security_disableAVM1Loading);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_allowInsecureDomain, &flash_system_Security_allowInsecureDomain);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_exactSettings, &flash_system_Security_exactSettings);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_REMOTE, &flash_system_Security_REMOTE);
-    dict_put(&flash_system_Security.static_members, &flash_system_Security_LOCAL_WITH_FILE, &flash_system_Security_LOCAL_WITH_FILE);
-    dict_put(d, &flash_display_Bitmap, &flash_display_Bitmap);
-    dict_init2(&flash_display_Bitmap.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_Bitmap.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_Bitmap.members, &flash_display_Bitmap_pixelSnapping, &flash_display_Bitmap_pixelSnapping);
-    dict_put(&flash_display_Bitmap.members, &flash_display_Bitmap_bitmapData, &flash_display_Bitmap_bitmapData);
-    dict_put(&flash_display_Bitmap.members, &flash_display_Bitmap_smoothing, &flash_display_Bitmap_smoothing);
-    dict_put(d, &flash_printing_PrintJob, &flash_printing_PrintJob);
-    dict_init2(&flash_printing_PrintJob.members, &memberinfo_type, 15);
-    dict_init2(&flash_printing_PrintJob.static_members, &memberinfo_type, 8);
-    dict_put(&flash_printing_PrintJob.members, &flash_printing_PrintJob_paperWidth, &flash_printing_PrintJob_paperWidth);
-    dict_put(&flash_printing_PrintJob.members, &flash_printing_PrintJob_addPage, &flash_printing_PrintJob_addPage);
-    dict_put(&flash_printing_PrintJob.members, &flash_printing_PrintJob_pageHeight, &flash_printing_PrintJob_pageHeight);
-    dict_put(&flash_printing_PrintJob.members, &flash_printing_PrintJob_start, &flash_printing_PrintJob_start);
-    dict_put(&flash_printing_PrintJob.members, &flash_printing_PrintJob_pageWidth, &flash_printing_PrintJob_pageWidth);
-    dict_put(&flash_printing_PrintJob.members, &flash_printing_PrintJob_send, &flash_printing_PrintJob_send);
-    dict_put(&flash_printing_PrintJob.members, &flash_printing_PrintJob_paperHeight, &flash_printing_PrintJob_paperHeight);
-    dict_put(&flash_printing_PrintJob.members, &flash_printing_PrintJob_orientation, &flash_printing_PrintJob_orientation);
-    dict_put(d, &flash_text_StaticText, &flash_text_StaticText);
-    dict_init2(&flash_text_StaticText.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_StaticText.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_StaticText.members, &flash_text_StaticText_text, &flash_text_StaticText_text);
-    dict_put(d, &flash_text_engine_SpaceJustifier, &flash_text_engine_SpaceJustifier);
-    dict_init2(&flash_text_engine_SpaceJustifier.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_SpaceJustifier.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_SpaceJustifier.members, &flash_text_engine_SpaceJustifier_clone, &flash_text_engine_SpaceJustifier_clone);
-    dict_put(&flash_text_engine_SpaceJustifier.members, &flash_text_engine_SpaceJustifier_letterSpacing, &flash_text_engine_SpaceJustifier_letterSpacing);
-    dict_put(d, &flash_events_DataEvent, &flash_events_DataEvent);
-    dict_init2(&flash_events_DataEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_DataEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_DataEvent.members, &flash_events_DataEvent_toString, &flash_events_DataEvent_toString);
-    dict_put(&flash_events_DataEvent.members, &flash_events_DataEvent_clone, &flash_events_DataEvent_clone);
-    dict_put(&flash_events_DataEvent.members, &flash_events_DataEvent_data, &flash_events_DataEvent_data);
-    dict_put(&flash_events_DataEvent.static_members, &flash_events_DataEvent_DATA, &flash_events_DataEvent_DATA);
-    dict_put(&flash_events_DataEvent.static_members, &flash_events_DataEvent_UPLOAD_COMPLETE_DATA, &flash_events_DataEvent_UPLOAD_COMPLETE_DATA);
-    dict_put(d, &flash_events_ActivityEvent, &flash_events_ActivityEvent);
-    dict_init2(&flash_events_ActivityEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_ActivityEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_ActivityEvent.members, &flash_events_ActivityEvent_toString, &flash_events_ActivityEvent_toString);
-    dict_put(&flash_events_ActivityEvent.members, &flash_events_ActivityEvent_activating, &flash_events_ActivityEvent_activating);
-    dict_put(&flash_events_ActivityEvent.members, &flash_events_ActivityEvent_clone, &flash_events_ActivityEvent_clone);
-    dict_put(&flash_events_ActivityEvent.static_members, &flash_events_ActivityEvent_ACTIVITY, &flash_events_ActivityEvent_ACTIVITY);
-    dict_put(d, &flash_display_GraphicsEndFill, &flash_display_GraphicsEndFill);
-    dict_init2(&flash_display_GraphicsEndFill.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsEndFill.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_display_ColorCorrection, &flash_display_ColorCorrection);
-    dict_init2(&flash_display_ColorCorrection.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ColorCorrection.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_ColorCorrection.static_members, &flash_display_ColorCorrection_OFF, &flash_display_ColorCorrection_OFF);
-    dict_put(&flash_display_ColorCorrection.static_members, &flash_display_ColorCorrection_DEFAULT, &flash_display_ColorCorrection_DEFAULT);
-    dict_put(&flash_display_ColorCorrection.static_members, &flash_display_ColorCorrection_ON, &flash_display_ColorCorrection_ON);
-    dict_put(d, &flash_events_IOErrorEvent, &flash_events_IOErrorEvent);
-    dict_init2(&flash_events_IOErrorEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_IOErrorEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_IOErrorEvent.members, &flash_events_IOErrorEvent_toString, &flash_events_IOErrorEvent_toString);
-    dict_put(&flash_events_IOErrorEvent.members, &flash_events_IOErrorEvent_clone, &flash_events_IOErrorEvent_clone);
-    dict_put(&flash_events_IOErrorEvent.static_members, &flash_events_IOErrorEvent_IO_ERROR, &flash_events_IOErrorEvent_IO_ERROR);
-    dict_put(&flash_events_IOErrorEvent.static_members, &flash_events_IOErrorEvent_VERIFY_ERROR, &flash_events_IOErrorEvent_VERIFY_ERROR);
-    dict_put(&flash_events_IOErrorEvent.static_members, &flash_events_IOErrorEvent_NETWORK_ERROR, &flash_events_IOErrorEvent_NETWORK_ERROR);
-    dict_put(&flash_events_IOErrorEvent.static_members, &flash_events_IOErrorEvent_DISK_ERROR, &flash_events_IOErrorEvent_DISK_ERROR);
-    dict_put(d, &flash_display_GraphicsStroke, &flash_display_GraphicsStroke);
-    dict_init2(&flash_display_GraphicsStroke.members, &memberinfo_type, 15);
-    dict_init2(&flash_display_GraphicsStroke.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsStroke.members, &flash_display_GraphicsStroke_scaleMode, &flash_display_GraphicsStroke_scaleMode);
-    dict_put(&flash_display_GraphicsStroke.members, &flash_display_GraphicsStroke_miterLimit, &flash_display_GraphicsStroke_miterLimit);
-    dict_put(&flash_display_GraphicsStroke.members, &flash_display_GraphicsStroke_pixelHinting, &flash_display_GraphicsStroke_pixelHinting);
-    dict_put(&flash_display_GraphicsStroke.members, &flash_display_GraphicsStroke_fill, &flash_display_GraphicsStroke_fill);
-    dict_put(&flash_display_GraphicsStroke.members, &flash_display_GraphicsStroke_thickness, &flash_display_GraphicsStroke_thickness);
-    dict_put(&flash_display_GraphicsStroke.members, &flash_display_GraphicsStroke_joints, &flash_display_GraphicsStroke_joints);
-    dict_put(&flash_display_GraphicsStroke.members, &flash_display_GraphicsStroke_caps, &flash_display_GraphicsStroke_caps);
-    dict_put(d, &_Boolean, &_Boolean);
-    dict_init2(&_Boolean.members, &memberinfo_type, 8);
-    dict_init2(&_Boolean.static_members, &memberinfo_type, 8);
-    dict_put(&_Boolean.members, &_Boolean_valueOf, &_Boolean_valueOf);
-    dict_put(&_Boolean.members, &_Boolean_toString, &_Boolean_toString);
-    dict_put(&_Boolean.static_members, &_Boolean_length, &_Boolean_length);
-    dict_put(d, &flash_sampler_getMemberNames, &flash_sampler_getMemberNames);
-    dict_put(d, &flash_utils_getQualifiedClassName, &flash_utils_getQualifiedClassName);
-    dict_put(d, &flash_text_engine_GraphicElement, &flash_text_engine_GraphicElement);
-    dict_init2(&flash_text_engine_GraphicElement.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_GraphicElement.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_GraphicElement.members, &flash_text_engine_GraphicElement_graphic, &flash_text_engine_GraphicElement_graphic);
-    dict_put(&flash_text_engine_GraphicElement.members, &flash_text_engine_GraphicElement_elementWidth, &flash_text_engine_GraphicElement_elementWidth);
-    dict_put(&flash_text_engine_GraphicElement.members, &flash_text_engine_GraphicElement_elementHeight, &flash_text_engine_GraphicElement_elementHeight);
-    dict_put(d, &flash_media_Microphone, &flash_media_Microphone);
-    dict_init2(&flash_media_Microphone.members, &memberinfo_type, 31);
-    dict_init2(&flash_media_Microphone.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_codec, &flash_media_Microphone_codec);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_gain, &flash_media_Microphone_gain);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_index, &flash_media_Microphone_index);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_setLoopBack, &flash_media_Microphone_setLoopBack);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_setSilenceLevel, &flash_media_Microphone_setSilenceLevel);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_name, &flash_media_Microphone_name);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_setUseEchoSuppression, &flash_media_Microphone_setUseEchoSuppression);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_framesPerPacket, &flash_media_Microphone_framesPerPacket);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_muted, &flash_media_Microphone_muted);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_soundTransform, &flash_media_Microphone_soundTransform);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_encodeQuality, &flash_media_Microphone_encodeQuality);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_useEchoSuppression, &flash_media_Microphone_useEchoSuppression);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_silenceLevel, &flash_media_Microphone_silenceLevel);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_silenceTimeout, &flash_media_Microphone_silenceTimeout);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_rate, &flash_media_Microphone_rate);
-    dict_put(&flash_media_Microphone.members, &flash_media_Microphone_activityLevel, &flash_media_Microphone_activityLevel);
-    dict_put(&flash_media_Microphone.static_members, &flash_media_Microphone_names, &flash_media_Microphone_names);
-    dict_put(&flash_media_Microphone.static_members, &flash_media_Microphone_getMicrophone, &flash_media_Microphone_getMicrophone);
-    dict_put(d, &flash_ui_ContextMenuClipboardItems, &flash_ui_ContextMenuClipboardItems);
-    dict_init2(&flash_ui_ContextMenuClipboardItems.members, &memberinfo_type, 8);
-    dict_init2(&flash_ui_ContextMenuClipboardItems.static_members, &memberinfo_type, 8);
-    dict_put(&flash_ui_ContextMenuClipboardItems.members, &flash_ui_ContextMenuClipboardItems_clear, &flash_ui_ContextMenuClipboardItems_clear);
-    dict_put(&flash_ui_ContextMenuClipboardItems.members, &flash_ui_ContextMenuClipboardItems_clone, &flash_ui_ContextMenuClipboardItems_clone);
-    dict_put(&flash_ui_ContextMenuClipboardItems.members, &flash_ui_ContextMenuClipboardItems_paste, &flash_ui_ContextMenuClipboardItems_paste);
-    dict_put(&flash_ui_ContextMenuClipboardItems.members, &flash_ui_ContextMenuClipboardItems_selectAll, &flash_ui_ContextMenuClipboardItems_selectAll);
-    dict_put(&flash_ui_ContextMenuClipboardItems.members, &flash_ui_ContextMenuClipboardItems_copy, &flash_ui_ContextMenuClipboardItems_copy);
-    dict_put(&flash_ui_ContextMenuClipboardItems.members, &flash_ui_ContextMenuClipboardItems_cut, &flash_ui_ContextMenuClipboardItems_cut);
-    dict_put(d, &flash_display_GraphicsShaderFill, &flash_display_GraphicsShaderFill);
-    dict_init2(&flash_display_GraphicsShaderFill.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsShaderFill.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsShaderFill.members, &flash_display_GraphicsShaderFill_shader, &flash_display_GraphicsShaderFill_shader);
-    dict_put(&flash_display_GraphicsShaderFill.members, &flash_display_GraphicsShaderFill_matrix, &flash_display_GraphicsShaderFill_matrix);
-    dict_put(d, &flash_errors_IllegalOperationError, &flash_errors_IllegalOperationError);
-    dict_init2(&flash_errors_IllegalOperationError.members, &memberinfo_type, 8);
-    dict_init2(&flash_errors_IllegalOperationError.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_filters_GradientGlowFilter, &flash_filters_GradientGlowFilter);
-    dict_init2(&flash_filters_GradientGlowFilter.members, &memberinfo_type, 15);
-    dict_init2(&flash_filters_GradientGlowFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_strength, &flash_filters_GradientGlowFilter_strength);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_quality, &flash_filters_GradientGlowFilter_quality);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_angle, &flash_filters_GradientGlowFilter_angle);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_knockout, &flash_filters_GradientGlowFilter_knockout);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_type, &flash_filters_GradientGlowFilter_type);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_alphas, &flash_filters_GradientGlowFilter_alphas);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_ratios, &flash_filters_GradientGlowFilter_ratios);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_colors, &flash_filters_GradientGlowFilter_colors);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_blurX, &flash_filters_GradientGlowFilter_blurX);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_blurY, &flash_filters_GradientGlowFilter_blurY);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_distance, &flash_filters_GradientGlowFilter_distance);
-    dict_put(&flash_filters_GradientGlowFilter.members, &flash_filters_GradientGlowFilter_clone, &flash_filters_GradientGlowFilter_clone);
-    dict_put(d, &flash_display_CapsStyle, &flash_display_CapsStyle);
-    dict_init2(&flash_display_CapsStyle.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_CapsStyle.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_CapsStyle.static_members, &flash_display_CapsStyle_ROUND, &flash_display_CapsStyle_ROUND);
-    dict_put(&flash_display_CapsStyle.static_members, &flash_display_CapsStyle_SQUARE, &flash_display_CapsStyle_SQUARE);
-    dict_put(&flash_display_CapsStyle.static_members, &flash_display_CapsStyle_NONE, &flash_display_CapsStyle_NONE);
-    dict_put(d, &flash_text_TextSnapshot, &flash_text_TextSnapshot);
-    dict_init2(&flash_text_TextSnapshot.members, &memberinfo_type, 15);
-    dict_init2(&flash_text_TextSnapshot.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_setSelectColor, &flash_text_TextSnapshot_setSelectColor);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_setSelected, &flash_text_TextSnapshot_setSelected);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_getSelectedText, &flash_text_TextSnapshot_getSelectedText);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_getTextRunInfo, &flash_text_TextSnapshot_getTextRunInfo);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_charCount, &flash_text_TextSnapshot_charCount);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_findText, &flash_text_TextSnapshot_findText);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_getSelected, &flash_text_TextSnapshot_getSelected);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_hitTestTextNearPos, &flash_text_TextSnapshot_hitTestTextNearPos);
-    dict_put(&flash_text_TextSnapshot.members, &flash_text_TextSnapshot_getText, &flash_text_TextSnapshot_getText);
-    dict_put(d, &flash_text_engine_FontLookup, &flash_text_engine_FontLookup);
-    dict_init2(&flash_text_engine_FontLookup.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_FontLookup.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_FontLookup.static_members, &flash_text_engine_FontLookup_DEVICE, &flash_text_engine_FontLookup_DEVICE);
-    dict_put(&flash_text_engine_FontLookup.static_members, &flash_text_engine_FontLookup_EMBEDDED_CFF, &flash_text_engine_FontLookup_EMBEDDED_CFF);
-    dict_put(d, &flash_display_InteractiveObject, &flash_display_InteractiveObject);
-    dict_init2(&flash_display_InteractiveObject.members, &memberinfo_type, 15);
-    dict_init2(&flash_display_InteractiveObject.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_InteractiveObject.members, &flash_display_InteractiveObject_tabIndex, &flash_display_InteractiveObject_tabIndex);
-    dict_put(&flash_display_InteractiveObject.members, &flash_display_InteractiveObject_doubleClickEnabled, &flash_display_InteractiveObject_doubleClickEnabled);
-    dict_put(&flash_display_InteractiveObject.members, &flash_display_InteractiveObject_tabEnabled, &flash_display_InteractiveObject_tabEnabled);
-    dict_put(&flash_display_InteractiveObject.members, &flash_display_InteractiveObject_mouseEnabled, &flash_display_InteractiveObject_mouseEnabled);
-    dict_put(&flash_display_InteractiveObject.members, &flash_display_InteractiveObject_contextMenu, &flash_display_InteractiveObject_contextMenu);
-    dict_put(&flash_display_InteractiveObject.members, &flash_display_InteractiveObject_focusRect, &flash_display_InteractiveObject_focusRect);
-    dict_put(&flash_display_InteractiveObject.members, &flash_display_InteractiveObject_accessibilityImplementation, &flash_display_InteractiveObject_accessibilityImplementation);
-    dict_put(d, &flash_text_TextField, &flash_text_TextField);
-    dict_init2(&flash_text_TextField.members, &memberinfo_type, 127);
-    dict_init2(&flash_text_TextField.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getTextFormat, &flash_text_TextField_getTextFormat);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_border, &flash_text_TextField_border);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_selectedText, &flash_text_TextField_selectedText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_pasteRichText, &flash_text_TextField_pasteRichText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_bottomScrollV, &flash_text_TextField_bottomScrollV);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getLineIndexOfChar, &flash_text_TextField_getLineIndexOfChar);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_replaceText, &flash_text_TextField_replaceText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_defaultTextFormat, &flash_text_TextField_defaultTextFormat);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_restrict, &flash_text_TextField_restrict);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_htmlText, &flash_text_TextField_htmlText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_copyRichText, &flash_text_TextField_copyRichText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getLineText, &flash_text_TextField_getLineText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getFirstCharInParagraph, &flash_text_TextField_getFirstCharInParagraph);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_setSelection, &flash_text_TextField_setSelection);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_length, &flash_text_TextField_length);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_wordWrap, &flash_text_TextField_wordWrap);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_appendText, &flash_text_TextField_appendText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_caretIndex, &flash_text_TextField_caretIndex);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_mouseWheelEnabled, &flash_text_TextField_mouseWheelEnabled);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_selectionBeginIndex, &flash_text_TextField_selectionBeginIndex);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_sharpness, &flash_text_TextField_sharpness);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_type, &flash_text_TextField_type);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getLineIndexAtPoint, &flash_text_TextField_getLineIndexAtPoint);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getCharIndexAtPoint, &flash_text_TextField_getCharIndexAtPoint);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getXMLText, &flash_text_TextField_getXMLText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getParagraphLength, &flash_text_TextField_getParagraphLength);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getRawText, &flash_text_TextField_getRawText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_gridFitType, &flash_text_TextField_gridFitType);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getLineOffset, &flash_text_TextField_getLineOffset);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_backgroundColor, &flash_text_TextField_backgroundColor);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_multiline, &flash_text_TextField_multiline);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_numLines, &flash_text_TextField_numLines);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getImageReference, &flash_text_TextField_getImageReference);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_displayAsPassword, &flash_text_TextField_displayAsPassword);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_textWidth, &flash_text_TextField_textWidth);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_autoSize, &flash_text_TextField_autoSize);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_selectable, &flash_text_TextField_selectable);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getCharBoundaries, &flash_text_TextField_getCharBoundaries);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_alwaysShowSelection, &flash_text_TextField_alwaysShowSelection);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_thickness, &flash_text_TextField_thickness);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_useRichTextClipboard, &flash_text_TextField_useRichTextClipboard);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_scrollV, &flash_text_TextField_scrollV);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getTextRuns, &flash_text_TextField_getTextRuns);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_setTextFormat, &flash_text_TextField_setTextFormat);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_textColor, &flash_text_TextField_textColor);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_maxScrollV, &flash_text_TextField_maxScrollV);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_embedFonts, &flash_text_TextField_embedFonts);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_scrollH, &flash_text_TextField_scrollH);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_text, &flash_text_TextField_text);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getLineLength, &flash_text_TextField_getLineLength);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_textHeight, &flash_text_TextField_textHeight);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_antiAliasType, &flash_text_TextField_antiAliasType);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_styleSheet, &flash_text_TextField_styleSheet);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_background, &flash_text_TextField_background);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_replaceSelectedText, &flash_text_TextField_replaceSelectedText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_borderColor, &flash_text_TextField_borderColor);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_maxScrollH, &flash_text_TextField_maxScrollH);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_maxChars, &flash_text_TextField_maxChars);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_getLineMetrics, &flash_text_TextField_getLineMetrics);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_selectionEndIndex, &flash_text_TextField_selectionEndIndex);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_insertXMLText, &flash_text_TextField_insertXMLText);
-    dict_put(&flash_text_TextField.members, &flash_text_TextField_condenseWhite, &flash_text_TextField_condenseWhite);
-    dict_put(&flash_text_TextField.static_members, &flash_text_TextField_isFontCompatible, &flash_text_TextField_isFontCompatible);
-    dict_put(d, &flash_printing_PrintJobOrientation, &flash_printing_PrintJobOrientation);
-    dict_init2(&flash_printing_PrintJobOrientation.members, &memberinfo_type, 8);
-    dict_init2(&flash_printing_PrintJobOrientation.static_members, &memberinfo_type, 8);
-    dict_put(&flash_printing_PrintJobOrientation.static_members, &flash_printing_PrintJobOrientation_LANDSCAPE, &flash_printing_PrintJobOrientation_LANDSCAPE);
-    dict_put(&flash_printing_PrintJobOrientation.static_members, &flash_printing_PrintJobOrientation_PORTRAIT, &flash_printing_PrintJobOrientation_PORTRAIT);
-    dict_put(d, &flash_text_TextRenderer, &flash_text_TextRenderer);
-    dict_init2(&flash_text_TextRenderer.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextRenderer.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextRenderer.static_members, &flash_text_TextRenderer_displayMode, &flash_text_TextRenderer_displayMode);
-    dict_put(&flash_text_TextRenderer.static_members, &flash_text_TextRenderer_antiAliasType, &flash_text_TextRenderer_antiAliasType);
-    dict_put(&flash_text_TextRenderer.static_members, &flash_text_TextRenderer_maxLevel, &flash_text_TextRenderer_maxLevel);
-    dict_put(&flash_text_TextRenderer.static_members, &flash_text_TextRenderer_setAdvancedAntiAliasingTable, &flash_text_TextRenderer_setAdvancedAntiAliasingTable);
-    dict_put(d, &flash_net_NetConnection, &flash_net_NetConnection);
-    dict_init2(&flash_net_NetConnection.members, &memberinfo_type, 31);
-    dict_init2(&flash_net_NetConnection.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_nearID, &flash_net_NetConnection_nearID);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_client, &flash_net_NetConnection_client);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_farNonce, &flash_net_NetConnection_farNonce);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_objectEncoding, &flash_net_NetConnection_objectEncoding);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_farID, &flash_net_NetConnection_farID);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_connected, &flash_net_NetConnection_connected);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_call, &flash_net_NetConnection_call);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_usingTLS, &flash_net_NetConnection_usingTLS);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_proxyType, &flash_net_NetConnection_proxyType);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_addHeader, &flash_net_NetConnection_addHeader);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_protocol, &flash_net_NetConnection_protocol);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_close, &flash_net_NetConnection_close);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_nearNonce, &flash_net_NetConnection_nearNonce);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_connect, &flash_net_NetConnection_connect);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_unconnectedPeerStreams, &flash_net_NetConnection_unconnectedPeerStreams);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_maxPeerConnections, &flash_net_NetConnection_maxPeerConnections);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_connectedProxyType, &flash_net_NetConnection_connectedProxyType);
-    dict_put(&flash_net_NetConnection.members, &flash_net_NetConnection_uri, &flash_net_NetConnection_uri);
-    dict_put(&flash_net_NetConnection.static_members, &flash_net_NetConnection_defaultObjectEncoding, &flash_net_NetConnection_defaultObjectEncoding);
-    dict_put(d, &_decodeURIComponent, &_decodeURIComponent);
-    dict_put(d, &flash_sampler_isGetterSetter, &flash_sampler_isGetterSetter);
-    dict_put(d, &flash_utils_getQualifiedSuperclassName, &flash_utils_getQualifiedSuperclassName);
-    dict_put(d, &flash_display_GraphicsPathWinding, &flash_display_GraphicsPathWinding);
-    dict_init2(&flash_display_GraphicsPathWinding.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsPathWinding.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsPathWinding.static_members, &flash_display_GraphicsPathWinding_EVEN_ODD, &flash_display_GraphicsPathWinding_EVEN_ODD);
-    dict_put(&flash_display_GraphicsPathWinding.static_members, &flash_display_GraphicsPathWinding_NON_ZERO, &flash_display_GraphicsPathWinding_NON_ZERO);
-    dict_put(d, &flash_text_engine_TabStop, &flash_text_engine_TabStop);
-    dict_init2(&flash_text_engine_TabStop.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TabStop.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TabStop.members, &flash_text_engine_TabStop_alignment, &flash_text_engine_TabStop_alignment);
-    dict_put(&flash_text_engine_TabStop.members, &flash_text_engine_TabStop_position, &flash_text_engine_TabStop_position);
-    dict_put(&flash_text_engine_TabStop.members, &flash_text_engine_TabStop_decimalAlignmentToken, &flash_text_engine_TabStop_decimalAlignmentToken);
-    dict_put(d, &flash_text_engine_JustificationStyle, &flash_text_engine_JustificationStyle);
-    dict_init2(&flash_text_engine_JustificationStyle.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_JustificationStyle.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_JustificationStyle.static_members, &flash_text_engine_JustificationStyle_PUSH_OUT_ONLY, &flash_text_engine_JustificationStyle_PUSH_OUT_ONLY);
-    dict_put(&flash_text_engine_JustificationStyle.static_members, &flash_text_engine_JustificationStyle_PRIORITIZE_LEAST_ADJUSTMENT, &flash_text_engine_JustificationStyle_PRIORITIZE_LEAST_ADJUSTMENT);
-    dict_put(&flash_text_engine_JustificationStyle.static_members, &flash_text_engine_JustificationStyle_PUSH_IN_KINSOKU, &flash_text_engine_JustificationStyle_PUSH_IN_KINSOKU);
-    dict_put(d, &flash_sampler_startSampling, &flash_sampler_startSampling);
-    dict_put(d, &flash_text_engine_TextRotation, &flash_text_engine_TextRotation);
-    dict_init2(&flash_text_engine_TextRotation.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TextRotation.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextRotation.static_members, &flash_text_engine_TextRotation_ROTATE_270, &flash_text_engine_TextRotation_ROTATE_270);
-    dict_put(&flash_text_engine_TextRotation.static_members, &flash_text_engine_TextRotation_AUTO, &flash_text_engine_TextRotation_AUTO);
-    dict_put(&flash_text_engine_TextRotation.static_members, &flash_text_engine_TextRotation_ROTATE_0, &flash_text_engine_TextRotation_ROTATE_0);
-    dict_put(&flash_text_engine_TextRotation.static_members, &flash_text_engine_TextRotation_ROTATE_90, &flash_text_engine_TextRotation_ROTATE_90);
-    dict_put(&flash_text_engine_TextRotation.static_members, &flash_text_engine_TextRotation_ROTATE_180, &flash_text_engine_TextRotation_ROTATE_180);
-    dict_put(d, &flash_sampler_clearSamples, &flash_sampler_clearSamples);
-    dict_put(d, &flash_system_IMEConversionMode, &flash_system_IMEConversionMode);
-    dict_init2(&flash_system_IMEConversionMode.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_IMEConversionMode.static_members, &memberinfo_type, 8);
-    dict_put(&flash_system_IMEConversionMode.static_members, &flash_system_IMEConversionMode_JAPANESE_KATAKANA_FULL, &flash_system_IMEConversionMode_JAPANESE_KATAKANA_FULL);
-    dict_put(&flash_system_IMEConversionMode.static_members, &flash_system_IMEConversionMode_CHINESE, &flash_system_IMEConversionMode_CHINESE);
-    dict_put(&flash_system_IMEConversionMode.static_members, &flash_system_IMEConversionMode_JAPANESE_KATAKANA_HALF, &flash_system_IMEConversionMode_JAPANESE_KATAKANA_HALF);
-    dict_put(&flash_system_IMEConversionMode.static_members, &flash_system_IMEConversionMode_UNKNOWN, &flash_system_IMEConversionMode_UNKNOWN);
-    dict_put(&flash_system_IMEConversionMode.static_members, &flash_system_IMEConversionMode_KOREAN, &flash_system_IMEConversionMode_KOREAN);
-    dict_put(&flash_system_IMEConversionMode.static_members, &flash_system_IMEConversionMode_ALPHANUMERIC_HALF, &flash_system_IMEConversionMode_ALPHANUMERIC_HALF);
-    dict_put(&flash_system_IMEConversionMode.static_members, &flash_system_IMEConversionMode_ALPHANUMERIC_FULL, &flash_system_IMEConversionMode_ALPHANUMERIC_FULL);
-    dict_put(&flash_system_IMEConversionMode.static_members, &flash_system_IMEConversionMode_JAPANESE_HIRAGANA, &flash_system_IMEConversionMode_JAPANESE_HIRAGANA);
-    dict_put(d, &flash_display_StageScaleMode, &flash_display_StageScaleMode);
-    dict_init2(&flash_display_StageScaleMode.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_StageScaleMode.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_StageScaleMode.static_members, &flash_display_StageScaleMode_SHOW_ALL, &flash_display_StageScaleMode_SHOW_ALL);
-    dict_put(&flash_display_StageScaleMode.static_members, &flash_display_StageScaleMode_NO_BORDER, &flash_display_StageScaleMode_NO_BORDER);
-    dict_put(&flash_display_StageScaleMode.static_members, &flash_display_StageScaleMode_EXACT_FIT, &flash_display_StageScaleMode_EXACT_FIT);
-    dict_put(&flash_display_StageScaleMode.static_members, &flash_display_StageScaleMode_NO_SCALE, &flash_display_StageScaleMode_NO_SCALE);
-    dict_put(d, &flash_sampler_getSize, &flash_sampler_getSize);
-    dict_put(d, &flash_net_URLStream, &flash_net_URLStream);
-    dict_init2(&flash_net_URLStream.members, &memberinfo_type, 31);
-    dict_init2(&flash_net_URLStream.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readUTF, &flash_net_URLStream_readUTF);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readByte, &flash_net_URLStream_readByte);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readUTFBytes, &flash_net_URLStream_readUTFBytes);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readShort, &flash_net_URLStream_readShort);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_objectEncoding, &flash_net_URLStream_objectEncoding);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_connected, &flash_net_URLStream_connected);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readUnsignedInt, &flash_net_URLStream_readUnsignedInt);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readDouble, &flash_net_URLStream_readDouble);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readBytes, &flash_net_URLStream_readBytes);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readUnsignedByte, &flash_net_URLStream_readUnsignedByte);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readMultiByte, &flash_net_URLStream_readMultiByte);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readInt, &flash_net_URLStream_readInt);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_bytesAvailable, &flash_net_URLStream_bytesAvailable);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_load, &flash_net_URLStream_load);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_close, &flash_net_URLStream_close);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readUnsignedShort, &flash_net_URLStream_readUnsignedShort);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readObject, &flash_net_URLStream_readObject);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readFloat, &flash_net_URLStream_readFloat);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_endian, &flash_net_URLStream_endian);
-    dict_put(&flash_net_URLStream.members, &flash_net_URLStream_readBoolean, &flash_net_URLStream_readBoolean);
-    dict_put(d, &flash_display_BlendMode, &flash_display_BlendMode);
-    dict_init2(&flash_display_BlendMode.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_BlendMode.static_members, &memberinfo_type, 31);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_LAYER, &flash_display_BlendMode_LAYER);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_ERASE, &flash_display_BlendMode_ERASE);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_HARDLIGHT, &flash_display_BlendMode_HARDLIGHT);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_OVERLAY, &flash_display_BlendMode_OVERLAY);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_ALPHA, &flash_display_BlendMode_ALPHA);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_SUBTRACT, &flash_display_BlendMode_SUBTRACT);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_INVERT, &flash_display_BlendMode_INVERT);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_DIFFERENCE, &flash_display_BlendMode_DIFFERENCE);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_DARKEN, &flash_display_BlendMode_DARKEN);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_SHADER, &flash_display_BlendMode_SHADER);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_MULTIPLY, &flash_display_BlendMode_MULTIPLY);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_ADD, &flash_display_BlendMode_ADD);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_SCREEN, &flash_display_BlendMode_SCREEN);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_NORMAL, &flash_display_BlendMode_NORMAL);
-    dict_put(&flash_display_BlendMode.static_members, &flash_display_BlendMode_LIGHTEN, &flash_display_BlendMode_LIGHTEN);
-    dict_put(d, &flash_ui_Mouse, &flash_ui_Mouse);
-    dict_init2(&flash_ui_Mouse.members, &memberinfo_type, 8);
-    dict_init2(&flash_ui_Mouse.static_members, &memberinfo_type, 8);
-    dict_put(&flash_ui_Mouse.static_members, &flash_ui_Mouse_cursor, &flash_ui_Mouse_cursor);
-    dict_put(&flash_ui_Mouse.static_members, &flash_ui_Mouse_show, &flash_ui_Mouse_show);
-    dict_put(&flash_ui_Mouse.static_members, &flash_ui_Mouse_hide, &flash_ui_Mouse_hide);
-    dict_put(d, &flash_errors_InvalidSWFError, &flash_errors_InvalidSWFError);
-    dict_init2(&flash_errors_InvalidSWFError.members, &memberinfo_type, 8);
-    dict_init2(&flash_errors_InvalidSWFError.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_text_engine_RenderingMode, &flash_text_engine_RenderingMode);
-    dict_init2(&flash_text_engine_RenderingMode.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_RenderingMode.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_RenderingMode.static_members, &flash_text_engine_RenderingMode_NORMAL, &flash_text_engine_RenderingMode_NORMAL);
-    dict_put(&flash_text_engine_RenderingMode.static_members, &flash_text_engine_RenderingMode_CFF, &flash_text_engine_RenderingMode_CFF);
-    dict_put(d, &flash_display_GraphicsTrianglePath, &flash_display_GraphicsTrianglePath);
-    dict_init2(&flash_display_GraphicsTrianglePath.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsTrianglePath.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsTrianglePath.members, &flash_display_GraphicsTrianglePath_culling, &flash_display_GraphicsTrianglePath_culling);
-    dict_put(&flash_display_GraphicsTrianglePath.members, &flash_display_GraphicsTrianglePath_vertices, &flash_display_GraphicsTrianglePath_vertices);
-    dict_put(&flash_display_GraphicsTrianglePath.members, &flash_display_GraphicsTrianglePath_indices, &flash_display_GraphicsTrianglePath_indices);
-    dict_put(&flash_display_GraphicsTrianglePath.members, &flash_display_GraphicsTrianglePath_uvtData, &flash_display_GraphicsTrianglePath_uvtData);
-    dict_put(d, &flash_display_IGraphicsFill, &flash_display_IGraphicsFill);
-    dict_init2(&flash_display_IGraphicsFill.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_IGraphicsFill.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_text_engine_TypographicCase, &flash_text_engine_TypographicCase);
-    dict_init2(&flash_text_engine_TypographicCase.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TypographicCase.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TypographicCase.static_members, &flash_text_engine_TypographicCase_UPPERCASE, &flash_text_engine_TypographicCase_UPPERCASE);
-    dict_put(&flash_text_engine_TypographicCase.static_members, &flash_text_engine_TypographicCase_DEFAULT, &flash_text_engine_TypographicCase_DEFAULT);
-    dict_put(&flash_text_engine_TypographicCase.static_members, &flash_text_engine_TypographicCase_LOWERCASE, &flash_text_engine_TypographicCase_LOWERCASE);
-    dict_put(&flash_text_engine_TypographicCase.static_members, &flash_text_engine_TypographicCase_SMALL_CAPS, &flash_text_engine_TypographicCase_SMALL_CAPS);
-    dict_put(&flash_text_engine_TypographicCase.static_members, &flash_text_engine_TypographicCase_TITLE, &flash_text_engine_TypographicCase_TITLE);
-    dict_put(&flash_text_engine_TypographicCase.static_members, &flash_text_engine_TypographicCase_CAPS, &flash_text_engine_TypographicCase_CAPS);
-    dict_put(&flash_text_engine_TypographicCase.static_members, &flash_text_engine_TypographicCase_CAPS_AND_SMALL_CAPS, &flash_text_engine_TypographicCase_CAPS_AND_SMALL_CAPS);
-    dict_put(d, &_XML, &_XML);
-    dict_init2(&_XML.members, &memberinfo_type, 63);
-    dict_init2(&_XML.static_members, &memberinfo_type, 15);
-    dict_put(&_XML.members, &_XML_normalize, &_XML_normalize);
-    dict_put(&_XML.members, &_XML_removeNamespace, &_XML_removeNamespace);
-    dict_put(&_XML.members, &_XML_prependChild, &_XML_prependChild);
-    dict_put(&_XML.members, &_XML_toXMLString, &_XML_toXMLString);
-    dict_put(&_XML.members, &_XML_text, &_XML_text);
-    dict_put(&_XML.members, &_XML_nodeKind, &_XML_nodeKind);
-    dict_put(&_XML.members, &_XML_copy, &_XML_copy);
-    dict_put(&_XML.members, &_XML_toString, &_XML_toString);
-    dict_put(&_XML.members, &_XML_childIndex, &_XML_childIndex);
-    dict_put(&_XML.members, &_XML_setName, &_XML_setName);
-    dict_put(&_XML.members, &_XML_setLocalName, &_XML_setLocalName);
-    dict_put(&_XML.members, &_XML_namespace, &_XML_namespace);
-    dict_put(&_XML.members, &_XML_insertChildBefore, &_XML_insertChildBefore);
-    dict_put(&_XML.members, &_XML_addNamespace, &_XML_addNamespace);
-    dict_put(&_XML.members, &_XML_propertyIsEnumerable, &_XML_propertyIsEnumerable);
-    dict_put(&_XML.members, &_XML_comments, &_XML_comments);
-    dict_put(&_XML.members, &_XML_attributes, &_XML_attributes);
-    dict_put(&_XML.members, &_XML_descendants, &_XML_descendants);
-    dict_put(&_XML.members, &_XML_replace, &_XML_replace);
-    dict_put(&_XML.members, &_XML_setNotification, &_XML_setNotification);
-    dict_put(&_XML.members, &_XML_children, &_XML_children);
-    dict_put(&_XML.members, &_XML_contains, &_XML_contains);
-    dict_put(&_XML.members, &_XML_hasSimpleContent, &_XML_hasSimpleContent);
-    dict_put(&_XML.members, &_XML_elements, &_XML_elements);
-    dict_put(&_XML.members, &_XML_hasComplexContent, &_XML_hasComplexContent);
-    dict_put(&_XML.members, &_XML_insertChildAfter, &_XML_insertChildAfter);
-    dict_put(&_XML.members, &_XML_parent, &_XML_parent);
-    dict_put(&_XML.members, &_XML_length, &_XML_length);
-    dict_put(&_XML.members, &_XML_processingInstructions, &_XML_processingInstructions);
-    dict_put(&_XML.members, &_XML_child, &_XML_child);
-    dict_put(&_XML.members, &_XML_appendChild, &_XML_appendChild);
-    dict_put(&_XML.members, &_XML_valueOf, &_XML_valueOf);
-    dict_put(&_XML.members, &_XML_localName, &_XML_localName);
-    dict_put(&_XML.members, &_XML_notification, &_XML_notification);
-    dict_put(&_XML.members, &_XML_inScopeNamespaces, &_XML_inScopeNamespaces);
-    dict_put(&_XML.members, &_XML_hasOwnProperty, &_XML_hasOwnProperty);
-    dict_put(&_XML.members, &_XML_namespaceDeclarations, &_XML_namespaceDeclarations);
-    dict_put(&_XML.members, &_XML_setNamespace, &_XML_setNamespace);
-    dict_put(&_XML.members, &_XML_name, &_XML_name);
-    dict_put(&_XML.members, &_XML_setChildren, &_XML_setChildren);
-    dict_put(&_XML.members, &_XML_attribute, &_XML_attribute);
-    dict_put(&_XML.static_members, &_XML_prettyPrinting, &_XML_prettyPrinting);
-    dict_put(&_XML.static_members, &_XML_setSettings, &_XML_setSettings);
-    dict_put(&_XML.static_members, &_XML_ignoreComments, &_XML_ignoreComments);
-    dict_put(&_XML.static_members, &_XML_prettyIndent, &_XML_prettyIndent);
-    dict_put(&_XML.static_members, &_XML_settings, &_XML_settings);
-    dict_put(&_XML.static_members, &_XML_ignoreProcessingInstructions, &_XML_ignoreProcessingInstructions);
-    dict_put(&_XML.static_members, &_XML_ignoreWhitespace, &_XML_ignoreWhitespace);
-    dict_put(&_XML.static_members, &_XML_defaultSettings, &_XML_defaultSettings);
-    dict_put(d, &flash_net_NetStreamInfo, &flash_net_NetStreamInfo);
-    dict_init2(&flash_net_NetStreamInfo.members, &memberinfo_type, 31);
-    dict_init2(&flash_net_NetStreamInfo.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_maxBytesPerSecond, &flash_net_NetStreamInfo_maxBytesPerSecond);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_dataBufferByteLength, &flash_net_NetStreamInfo_dataBufferByteLength);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_videoByteCount, &flash_net_NetStreamInfo_videoByteCount);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_videoBufferLength, &flash_net_NetStreamInfo_videoBufferLength);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_audioBufferByteLength, &flash_net_NetStreamInfo_audioBufferByteLength);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_dataBytesPerSecond, &flash_net_NetStreamInfo_dataBytesPerSecond);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_SRTT, &flash_net_NetStreamInfo_SRTT);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_droppedFrames, &flash_net_NetStreamInfo_droppedFrames);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_audioByteCount, &flash_net_NetStreamInfo_audioByteCount);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_audioBufferLength, &flash_net_NetStreamInfo_audioBufferLength);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_byteCount, &flash_net_NetStreamInfo_byteCount);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_toString, &flash_net_NetStreamInfo_toString);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_dataByteCount, &flash_net_NetStreamInfo_dataByteCount);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_videoBufferByteLength, &flash_net_NetStreamInfo_videoBufferByteLength);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_dataBufferLength, &flash_net_NetStreamInfo_dataBufferLength);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_audioLossRate, &flash_net_NetStreamInfo_audioLossRate);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_videoBytesPerSecond, &flash_net_NetStreamInfo_videoBytesPerSecond);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_currentBytesPerSecond, &flash_net_NetStreamInfo_currentBytesPerSecond);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_audioBytesPerSecond, &flash_net_NetStreamInfo_audioBytesPerSecond);
-    dict_put(&flash_net_NetStreamInfo.members, &flash_net_NetStreamInfo_playbackBytesPerSecond, &flash_net_NetStreamInfo_playbackBytesPerSecond);
-    dict_put(d, &flash_display_Stage, &flash_display_Stage);
-    dict_init2(&flash_display_Stage.members, &memberinfo_type, 63);
-    dict_init2(&flash_display_Stage.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_setChildIndex, &flash_display_Stage_setChildIndex);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_stageFocusRect, &flash_display_Stage_stageFocusRect);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_frameRate, &flash_display_Stage_frameRate);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_invalidate, &flash_display_Stage_invalidate);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_textSnapshot, &flash_display_Stage_textSnapshot);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_quality, &flash_display_Stage_quality);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_willTrigger, &flash_display_Stage_willTrigger);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_dispatchEvent, &flash_display_Stage_dispatchEvent);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_isFocusInaccessible, &flash_display_Stage_isFocusInaccessible);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_removeChildAt, &flash_display_Stage_removeChildAt);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_fullScreenWidth, &flash_display_Stage_fullScreenWidth);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_addChildAt, &flash_display_Stage_addChildAt);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_height, &flash_display_Stage_height);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_fullScreenSourceRect, &flash_display_Stage_fullScreenSourceRect);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_width, &flash_display_Stage_width);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_addChild, &flash_display_Stage_addChild);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_numChildren, &flash_display_Stage_numChildren);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_mouseChildren, &flash_display_Stage_mouseChildren);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_swapChildrenAt, &flash_display_Stage_swapChildrenAt);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_showDefaultContextMenu, &flash_display_Stage_showDefaultContextMenu);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_addEventListener, &flash_display_Stage_addEventListener);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_stageHeight, &flash_display_Stage_stageHeight);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_fullScreenHeight, &flash_display_Stage_fullScreenHeight);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_align, &flash_display_Stage_align);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_hasEventListener, &flash_display_Stage_hasEventListener);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_displayState, &flash_display_Stage_displayState);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_scaleMode, &flash_display_Stage_scaleMode);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_tabChildren, &flash_display_Stage_tabChildren);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_focus, &flash_display_Stage_focus);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_colorCorrection, &flash_display_Stage_colorCorrection);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_colorCorrectionSupport, &flash_display_Stage_colorCorrectionSupport);
-    dict_put(&flash_display_Stage.members, &flash_display_Stage_stageWidth, &flash_display_Stage_stageWidth);
-    dict_put(d, &flash_ui_ContextMenuItem, &flash_ui_ContextMenuItem);
-    dict_init2(&flash_ui_ContextMenuItem.members, &memberinfo_type, 8);
-    dict_init2(&flash_ui_ContextMenuItem.static_members, &memberinfo_type, 8);
-    dict_put(&flash_ui_ContextMenuItem.members, &flash_ui_ContextMenuItem_separatorBefore, &flash_ui_ContextMenuItem_separatorBefore);
-    dict_put(&flash_ui_ContextMenuItem.members, &flash_ui_ContextMenuItem_enabled, &flash_ui_ContextMenuItem_enabled);
-    dict_put(&flash_ui_ContextMenuItem.members, &flash_ui_ContextMenuItem_caption, &flash_ui_ContextMenuItem_caption);
-    dict_put(&flash_ui_ContextMenuItem.members, &flash_ui_ContextMenuItem_clone, &flash_ui_ContextMenuItem_clone);
-    dict_put(&flash_ui_ContextMenuItem.members, &flash_ui_ContextMenuItem_visible, &flash_ui_ContextMenuItem_visible);
-    dict_put(d, &flash_trace_Trace, &flash_trace_Trace);
-    dict_init2(&flash_trace_Trace.members, &memberinfo_type, 8);
-    dict_init2(&flash_trace_Trace.static_members, &memberinfo_type, 15);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_METHODS_AND_LINES_WITH_ARGS, &flash_trace_Trace_METHODS_AND_LINES_WITH_ARGS);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_FILE, &flash_trace_Trace_FILE);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_METHODS_WITH_ARGS, &flash_trace_Trace_METHODS_WITH_ARGS);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_OFF, &flash_trace_Trace_OFF);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_METHODS_AND_LINES, &flash_trace_Trace_METHODS_AND_LINES);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_LISTENER, &flash_trace_Trace_LISTENER);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_getLevel, &flash_trace_Trace_getLevel);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_setLevel, &flash_trace_Trace_setLevel);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_setListener, &flash_trace_Trace_setListener);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_getListener, &flash_trace_Trace_getListener);
-    dict_put(&flash_trace_Trace.static_members, &flash_trace_Trace_METHODS, &flash_trace_Trace_METHODS);
-    dict_put(d, &flash_events_TimerEvent, &flash_events_TimerEvent);
-    dict_init2(&flash_events_TimerEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_TimerEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_TimerEvent.members, &flash_events_TimerEvent_toString, &flash_events_TimerEvent_toString);
-    dict_put(&flash_events_TimerEvent.members, &flash_events_TimerEvent_clone, &flash_events_TimerEvent_clone);
-    dict_put(&flash_events_TimerEvent.members, &flash_events_TimerEvent_updateAfterEvent, &flash_events_TimerEvent_updateAfterEvent);
-    dict_put(&flash_events_TimerEvent.static_members, &flash_events_TimerEvent_TIMER_COMPLETE, &flash_events_TimerEvent_TIMER_COMPLETE);
-    dict_put(&flash_events_TimerEvent.static_members, &flash_events_TimerEvent_TIMER, &flash_events_TimerEvent_TIMER);
-    dict_put(d, &flash_events_SampleDataEvent, &flash_events_SampleDataEvent);
-    dict_init2(&flash_events_SampleDataEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_SampleDataEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_SampleDataEvent.members, &flash_events_SampleDataEvent_toString, &flash_events_SampleDataEvent_toString);
-    dict_put(&flash_events_SampleDataEvent.members, &flash_events_SampleDataEvent_position, &flash_events_SampleDataEvent_position);
-    dict_put(&flash_events_SampleDataEvent.members, &flash_events_SampleDataEvent_clone, &flash_events_SampleDataEvent_clone);
-    dict_put(&flash_events_SampleDataEvent.members, &flash_events_SampleDataEvent_data, &flash_events_SampleDataEvent_data);
-    dict_put(&flash_events_SampleDataEvent.static_members, &flash_events_SampleDataEvent_SAMPLE_DATA, &flash_events_SampleDataEvent_SAMPLE_DATA);
-    dict_put(d, &flash_display_ShaderPrecision, &flash_display_ShaderPrecision);
-    dict_init2(&flash_display_ShaderPrecision.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ShaderPrecision.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_ShaderPrecision.static_members, &flash_display_ShaderPrecision_FULL, &flash_display_ShaderPrecision_FULL);
-    dict_put(&flash_display_ShaderPrecision.static_members, &flash_display_ShaderPrecision_FAST, &flash_display_ShaderPrecision_FAST);
-    dict_put(d, &flash_net_FileReference, &flash_net_FileReference);
-    dict_init2(&flash_net_FileReference.members, &memberinfo_type, 31);
-    dict_init2(&flash_net_FileReference.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_type, &flash_net_FileReference_type);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_browse, &flash_net_FileReference_browse);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_creationDate, &flash_net_FileReference_creationDate);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_upload, &flash_net_FileReference_upload);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_download, &flash_net_FileReference_download);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_save, &flash_net_FileReference_save);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_cancel, &flash_net_FileReference_cancel);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_creator, &flash_net_FileReference_creator);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_data, &flash_net_FileReference_data);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_size, &flash_net_FileReference_size);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_name, &flash_net_FileReference_name);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_load, &flash_net_FileReference_load);
-    dict_put(&flash_net_FileReference.members, &flash_net_FileReference_modificationDate, &flash_net_FileReference_modificationDate);
-    dict_put(d, &_DefinitionError, &_DefinitionError);
-    dict_init2(&_DefinitionError.members, &memberinfo_type, 8);
-    dict_init2(&_DefinitionError.static_members, &memberinfo_type, 8);
-    dict_put(&_DefinitionError.static_members, &_DefinitionError_length, &_DefinitionError_length);
-    dict_put(d, &flash_events_EventDispatcher, &flash_events_EventDispatcher);
-    dict_init2(&flash_events_EventDispatcher.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_EventDispatcher.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_EventDispatcher.members, &flash_events_EventDispatcher_willTrigger, &flash_events_EventDispatcher_willTrigger);
-    dict_put(&flash_events_EventDispatcher.members, &flash_events_EventDispatcher_toString, &flash_events_EventDispatcher_toString);
-    dict_put(&flash_events_EventDispatcher.members, &flash_events_EventDispatcher_removeEventListener, &flash_events_EventDispatcher_removeEventListener);
-    dict_put(&flash_events_EventDispatcher.members, &flash_events_EventDispatcher_hasEventListener, &flash_events_EventDispatcher_hasEventListener);
-    dict_put(&flash_events_EventDispatcher.members, &flash_events_EventDispatcher_addEventListener, &flash_events_EventDispatcher_addEventListener);
-    dict_put(&flash_events_EventDispatcher.members, &flash_events_EventDispatcher_dispatchEvent, &flash_events_EventDispatcher_dispatchEvent);
-    dict_put(d, &flash_net_SharedObjectFlushStatus, &flash_net_SharedObjectFlushStatus);
-    dict_init2(&flash_net_SharedObjectFlushStatus.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_SharedObjectFlushStatus.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_SharedObjectFlushStatus.static_members, &flash_net_SharedObjectFlushStatus_FLUSHED, &flash_net_SharedObjectFlushStatus_FLUSHED);
-    dict_put(&flash_net_SharedObjectFlushStatus.static_members, &flash_net_SharedObjectFlushStatus_PENDING, &flash_net_SharedObjectFlushStatus_PENDING);
-    dict_put(d, &flash_text_TextLineMetrics, &flash_text_TextLineMetrics);
-    dict_init2(&flash_text_TextLineMetrics.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextLineMetrics.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextLineMetrics.members, &flash_text_TextLineMetrics_descent, &flash_text_TextLineMetrics_descent);
-    dict_put(&flash_text_TextLineMetrics.members, &flash_text_TextLineMetrics_width, &flash_text_TextLineMetrics_width);
-    dict_put(&flash_text_TextLineMetrics.members, &flash_text_TextLineMetrics_ascent, &flash_text_TextLineMetrics_ascent);
-    dict_put(&flash_text_TextLineMetrics.members, &flash_text_TextLineMetrics_leading, &flash_text_TextLineMetrics_leading);
-    dict_put(&flash_text_TextLineMetrics.members, &flash_text_TextLineMetrics_height, &flash_text_TextLineMetrics_height);
-    dict_put(&flash_text_TextLineMetrics.members, &flash_text_TextLineMetrics_x, &flash_text_TextLineMetrics_x);
-    dict_put(d, &flash_text_AntiAliasType, &flash_text_AntiAliasType);
-    dict_init2(&flash_text_AntiAliasType.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_AntiAliasType.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_AntiAliasType.static_members, &flash_text_AntiAliasType_NORMAL, &flash_text_AntiAliasType_NORMAL);
-    dict_put(&flash_text_AntiAliasType.static_members, &flash_text_AntiAliasType_ADVANCED, &flash_text_AntiAliasType_ADVANCED);
-    dict_put(d, &flash_system_SecurityDomain, &flash_system_SecurityDomain);
-    dict_init2(&flash_system_SecurityDomain.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_SecurityDomain.static_members, &memberinfo_type, 8);
-    dict_put(&flash_system_SecurityDomain.static_members, &flash_system_SecurityDomain_currentDomain, &flash_system_SecurityDomain_currentDomain);
-    dict_put(d, &flash_text_Font, &flash_text_Font);
-    dict_init2(&flash_text_Font.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_Font.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_Font.members, &flash_text_Font_hasGlyphs, &flash_text_Font_hasGlyphs);
-    dict_put(&flash_text_Font.members, &flash_text_Font_fontName, &flash_text_Font_fontName);
-    dict_put(&flash_text_Font.members, &flash_text_Font_fontStyle, &flash_text_Font_fontStyle);
-    dict_put(&flash_text_Font.members, &flash_text_Font_fontType, &flash_text_Font_fontType);
-    dict_put(&flash_text_Font.static_members, &flash_text_Font_enumerateFonts, &flash_text_Font_enumerateFonts);
-    dict_put(&flash_text_Font.static_members, &flash_text_Font_registerFont, &flash_text_Font_registerFont);
-    dict_put(d, &_RegExp, &_RegExp);
-    dict_init2(&_RegExp.members, &memberinfo_type, 8);
-    dict_init2(&_RegExp.static_members, &memberinfo_type, 8);
-    dict_put(&_RegExp.members, &_RegExp_source, &_RegExp_source);
-    dict_put(&_RegExp.members, &_RegExp_test, &_RegExp_test);
-    dict_put(&_RegExp.members, &_RegExp_global, &_RegExp_global);
-    dict_put(&_RegExp.members, &_RegExp_exec, &_RegExp_exec);
-    dict_put(&_RegExp.members, &_RegExp_ignoreCase, &_RegExp_ignoreCase);
-    dict_put(&_RegExp.members, &_RegExp_dotall, &_RegExp_dotall);
-    dict_put(&_RegExp.members, &_RegExp_lastIndex, &_RegExp_lastIndex);
-    dict_put(&_RegExp.members, &_RegExp_extended, &_RegExp_extended);
-    dict_put(&_RegExp.members, &_RegExp_multiline, &_RegExp_multiline);
-    dict_put(&_RegExp.static_members, &_RegExp_length, &_RegExp_length);
-    dict_put(d, &flash_accessibility_AccessibilityProperties, &flash_accessibility_AccessibilityProperties);
-    dict_init2(&flash_accessibility_AccessibilityProperties.members, &memberinfo_type, 8);
-    dict_init2(&flash_accessibility_AccessibilityProperties.static_members, &memberinfo_type, 8);
-    dict_put(&flash_accessibility_AccessibilityProperties.members, &flash_accessibility_AccessibilityProperties_forceSimple, &flash_accessibility_AccessibilityProperties_forceSimple);
-    dict_put(&flash_accessibility_AccessibilityProperties.members, &flash_accessibility_AccessibilityProperties_noAutoLabeling, &flash_accessibility_AccessibilityProperties_noAutoLabeling);
-    dict_put(&flash_accessibility_AccessibilityProperties.members, &flash_accessibility_AccessibilityProperties_description, &flash_accessibility_AccessibilityProperties_description);
-    dict_put(&flash_accessibility_AccessibilityProperties.members, &flash_accessibility_AccessibilityProperties_name, &flash_accessibility_AccessibilityProperties_name);
-    dict_put(&flash_accessibility_AccessibilityProperties.members, &flash_accessibility_AccessibilityProperties_shortcut, &flash_accessibility_AccessibilityProperties_shortcut);
-    dict_put(&flash_accessibility_AccessibilityProperties.members, &flash_accessibility_AccessibilityProperties_silent, &flash_accessibility_AccessibilityProperties_silent);
-    dict_put(d, &flash_ui_ContextMenu, &flash_ui_ContextMenu);
-    dict_init2(&flash_ui_ContextMenu.members, &memberinfo_type, 8);
-    dict_init2(&flash_ui_ContextMenu.static_members, &memberinfo_type, 8);
-    dict_put(&flash_ui_ContextMenu.members, &flash_ui_ContextMenu_hideBuiltInItems, &flash_ui_ContextMenu_hideBuiltInItems);
-    dict_put(&flash_ui_ContextMenu.members, &flash_ui_ContextMenu_clipboardItems, &flash_ui_ContextMenu_clipboardItems);
-    dict_put(&flash_ui_ContextMenu.members, &flash_ui_ContextMenu_builtInItems, &flash_ui_ContextMenu_builtInItems);
-    dict_put(&flash_ui_ContextMenu.members, &flash_ui_ContextMenu_customItems, &flash_ui_ContextMenu_customItems);
-    dict_put(&flash_ui_ContextMenu.members, &flash_ui_ContextMenu_clone, &flash_ui_ContextMenu_clone);
-    dict_put(&flash_ui_ContextMenu.members, &flash_ui_ContextMenu_link, &flash_ui_ContextMenu_link);
-    dict_put(&flash_ui_ContextMenu.members, &flash_ui_ContextMenu_clipboardMenu, &flash_ui_ContextMenu_clipboardMenu);
-    dict_put(d, &flash_text_TextFieldAutoSize, &flash_text_TextFieldAutoSize);
-    dict_init2(&flash_text_TextFieldAutoSize.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextFieldAutoSize.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextFieldAutoSize.static_members, &flash_text_TextFieldAutoSize_LEFT, &flash_text_TextFieldAutoSize_LEFT);
-    dict_put(&flash_text_TextFieldAutoSize.static_members, &flash_text_TextFieldAutoSize_RIGHT, &flash_text_TextFieldAutoSize_RIGHT);
-    dict_put(&flash_text_TextFieldAutoSize.static_members, &flash_text_TextFieldAutoSize_CENTER, &flash_text_TextFieldAutoSize_CENTER);
-    dict_put(&flash_text_TextFieldAutoSize.static_members, &flash_text_TextFieldAutoSize_NONE, &flash_text_TextFieldAutoSize_NONE);
-    dict_put(d, &_Math, &_Math);
-    dict_init2(&_Math.members, &memberinfo_type, 8);
-    dict_init2(&_Math.static_members, &memberinfo_type, 63);
-    dict_put(&_Math.static_members, &_Math_ceil, &_Math_ceil);
-    dict_put(&_Math.static_members, &_Math_SQRT2, &_Math_SQRT2);
-    dict_put(&_Math.static_members, &_Math_cos, &_Math_cos);
-    dict_put(&_Math.static_members, &_Math_abs, &_Math_abs);
-    dict_put(&_Math.static_members, &_Math_PI, &_Math_PI);
-    dict_put(&_Math.static_members, &_Math_E, &_Math_E);
-    dict_put(&_Math.static_members, &_Math_round, &_Math_round);
-    dict_put(&_Math.static_members, &_Math_LN10, &_Math_LN10);
-    dict_put(&_Math.static_members, &_Math_SQRT1_2, &_Math_SQRT1_2);
-    dict_put(&_Math.static_members, &_Math_log, &_Math_log);
-    dict_put(&_Math.static_members, &_Math_LOG10E, &_Math_LOG10E);
-    dict_put(&_Math.static_members, &_Math_random, &_Math_random);
-    dict_put(&_Math.static_members, &_Math_acos, &_Math_acos);
-    dict_put(&_Math.static_members, &_Math_tan, &_Math_tan);
-    dict_put(&_Math.static_members, &_Math_asin, &_Math_asin);
-    dict_put(&_Math.static_members, &_Math_exp, &_Math_exp);
-    dict_put(&_Math.static_members, &_Math_atan2, &_Math_atan2);
-    dict_put(&_Math.static_members, &_Math_pow, &_Math_pow);
-    dict_put(&_Math.static_members, &_Math_min, &_Math_min);
-    dict_put(&_Math.static_members, &_Math_LN2, &_Math_LN2);
-    dict_put(&_Math.static_members, &_Math_sin, &_Math_sin);
-    dict_put(&_Math.static_members, &_Math_sqrt, &_Math_sqrt);
-    dict_put(&_Math.static_members, &_Math_LOG2E, &_Math_LOG2E);
-    dict_put(&_Math.static_members, &_Math_max, &_Math_max);
-    dict_put(&_Math.static_members, &_Math_atan, &_Math_atan);
-    dict_put(&_Math.static_members, &_Math_floor, &_Math_floor);
-    dict_put(d, &flash_display_ColorCorrectionSupport, &flash_display_ColorCorrectionSupport);
-    dict_init2(&flash_display_ColorCorrectionSupport.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ColorCorrectionSupport.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_ColorCorrectionSupport.static_members, &flash_display_ColorCorrectionSupport_UNSUPPORTED, &flash_display_ColorCorrectionSupport_UNSUPPORTED);
-    dict_put(&flash_display_ColorCorrectionSupport.static_members, &flash_display_ColorCorrectionSupport_DEFAULT_ON, &flash_display_ColorCorrectionSupport_DEFAULT_ON);
-    dict_put(&flash_display_ColorCorrectionSupport.static_members, &flash_display_ColorCorrectionSupport_DEFAULT_OFF, &flash_display_ColorCorrectionSupport_DEFAULT_OFF);
-    dict_put(d, &flash_errors_IOError, &flash_errors_IOError);
-    dict_init2(&flash_errors_IOError.members, &memberinfo_type, 8);
-    dict_init2(&flash_errors_IOError.static_members, &memberinfo_type, 8);
-    dict_put(d, &_trace, &_trace);
-    dict_put(d, &flash_ui_ContextMenuBuiltInItems, &flash_ui_ContextMenuBuiltInItems);
-    dict_init2(&flash_ui_ContextMenuBuiltInItems.members, &memberinfo_type, 8);
-    dict_init2(&flash_ui_ContextMenuBuiltInItems.static_members, &memberinfo_type, 8);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_zoom, &flash_ui_ContextMenuBuiltInItems_zoom);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_save, &flash_ui_ContextMenuBuiltInItems_save);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_loop, &flash_ui_ContextMenuBuiltInItems_loop);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_print, &flash_ui_ContextMenuBuiltInItems_print);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_forwardAndBack, &flash_ui_ContextMenuBuiltInItems_forwardAndBack);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_rewind, &flash_ui_ContextMenuBuiltInItems_rewind);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_clone, &flash_ui_ContextMenuBuiltInItems_clone);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_quality, &flash_ui_ContextMenuBuiltInItems_quality);
-    dict_put(&flash_ui_ContextMenuBuiltInItems.members, &flash_ui_ContextMenuBuiltInItems_play, &flash_ui_ContextMenuBuiltInItems_play);
-    dict_put(d, &flash_net_FileReferenceList, &flash_net_FileReferenceList);
-    dict_init2(&flash_net_FileReferenceList.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_FileReferenceList.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_FileReferenceList.members, &flash_net_FileReferenceList_fileList, &flash_net_FileReferenceList_fileList);
-    dict_put(&flash_net_FileReferenceList.members, &flash_net_FileReferenceList_browse, &flash_net_FileReferenceList_browse);
-    dict_put(d, &flash_display_TriangleCulling, &flash_display_TriangleCulling);
-    dict_init2(&flash_display_TriangleCulling.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_TriangleCulling.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_TriangleCulling.static_members, &flash_display_TriangleCulling_POSITIVE, &flash_display_TriangleCulling_POSITIVE);
-    dict_put(&flash_display_TriangleCulling.static_members, &flash_display_TriangleCulling_NEGATIVE, &flash_display_TriangleCulling_NEGATIVE);
-    dict_put(&flash_display_TriangleCulling.static_members, &flash_display_TriangleCulling_NONE, &flash_display_TriangleCulling_NONE);
-    dict_put(d, &flash_media_SoundMixer, &flash_media_SoundMixer);
-    dict_init2(&flash_media_SoundMixer.members, &memberinfo_type, 8);
-    dict_init2(&flash_media_SoundMixer.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_SoundMixer.static_members, &flash_media_SoundMixer_computeSpectrum, &flash_media_SoundMixer_computeSpectrum);
-    dict_put(&flash_media_SoundMixer.static_members, &flash_media_SoundMixer_areSoundsInaccessible, &flash_media_SoundMixer_areSoundsInaccessible);
-    dict_put(&flash_media_SoundMixer.static_members, &flash_media_SoundMixer_soundTransform, &flash_media_SoundMixer_soundTransform);
-    dict_put(&flash_media_SoundMixer.static_members, &flash_media_SoundMixer_bufferTime, &flash_media_SoundMixer_bufferTime);
-    dict_put(&flash_media_SoundMixer.static_members, &flash_media_SoundMixer_stopAll, &flash_media_SoundMixer_stopAll);
-    dict_put(d, &adobe_utils_XMLUI, &adobe_utils_XMLUI);
-    dict_init2(&adobe_utils_XMLUI.members, &memberinfo_type, 8);
-    dict_init2(&adobe_utils_XMLUI.static_members, &memberinfo_type, 8);
-    dict_put(&adobe_utils_XMLUI.static_members, &adobe_utils_XMLUI_cancel, &adobe_utils_XMLUI_cancel);
-    dict_put(&adobe_utils_XMLUI.static_members, &adobe_utils_XMLUI_setProperty, &adobe_utils_XMLUI_setProperty);
-    dict_put(&adobe_utils_XMLUI.static_members, &adobe_utils_XMLUI_getProperty, &adobe_utils_XMLUI_getProperty);
-    dict_put(&adobe_utils_XMLUI.static_members, &adobe_utils_XMLUI_accept, &adobe_utils_XMLUI_accept);
-    dict_put(d, &_escape, &_escape);
-    dict_put(d, &flash_utils_setInterval, &flash_utils_setInterval);
-    dict_put(d, &flash_events_StatusEvent, &flash_events_StatusEvent);
-    dict_init2(&flash_events_StatusEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_StatusEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_StatusEvent.members, &flash_events_StatusEvent_toString, &flash_events_StatusEvent_toString);
-    dict_put(&flash_events_StatusEvent.members, &flash_events_StatusEvent_code, &flash_events_StatusEvent_code);
-    dict_put(&flash_events_StatusEvent.members, &flash_events_StatusEvent_clone, &flash_events_StatusEvent_clone);
-    dict_put(&flash_events_StatusEvent.members, &flash_events_StatusEvent_level, &flash_events_StatusEvent_level);
-    dict_put(&flash_events_StatusEvent.static_members, &flash_events_StatusEvent_STATUS, &flash_events_StatusEvent_STATUS);
-    dict_put(d, &flash_display_IGraphicsPath, &flash_display_IGraphicsPath);
-    dict_init2(&flash_display_IGraphicsPath.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_IGraphicsPath.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_events_ShaderEvent, &flash_events_ShaderEvent);
-    dict_init2(&flash_events_ShaderEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_ShaderEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_ShaderEvent.members, &flash_events_ShaderEvent_vector, &flash_events_ShaderEvent_vector);
-    dict_put(&flash_events_ShaderEvent.members, &flash_events_ShaderEvent_toString, &flash_events_ShaderEvent_toString);
-    dict_put(&flash_events_ShaderEvent.members, &flash_events_ShaderEvent_bitmapData, &flash_events_ShaderEvent_bitmapData);
-    dict_put(&flash_events_ShaderEvent.members, &flash_events_ShaderEvent_clone, &flash_events_ShaderEvent_clone);
-    dict_put(&flash_events_ShaderEvent.members, &flash_events_ShaderEvent_byteArray, &flash_events_ShaderEvent_byteArray);
-    dict_put(&flash_events_ShaderEvent.static_members, &flash_events_ShaderEvent_COMPLETE, &flash_events_ShaderEvent_COMPLETE);
-    dict_put(d, &flash_display_Shader, &flash_display_Shader);
-    dict_init2(&flash_display_Shader.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_Shader.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_Shader.members, &flash_display_Shader_precisionHint, &flash_display_Shader_precisionHint);
-    dict_put(&flash_display_Shader.members, &flash_display_Shader_data, &flash_display_Shader_data);
-    dict_put(d, &flash_errors_StackOverflowError, &flash_errors_StackOverflowError);
-    dict_init2(&flash_errors_StackOverflowError.members, &memberinfo_type, 8);
-    dict_init2(&flash_errors_StackOverflowError.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_sampler_getInvocationCount, &flash_sampler_getInvocationCount);
-    dict_put(d, &flash_text_engine_Kerning, &flash_text_engine_Kerning);
-    dict_init2(&flash_text_engine_Kerning.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_Kerning.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_Kerning.static_members, &flash_text_engine_Kerning_AUTO, &flash_text_engine_Kerning_AUTO);
-    dict_put(&flash_text_engine_Kerning.static_members, &flash_text_engine_Kerning_OFF, &flash_text_engine_Kerning_OFF);
-    dict_put(&flash_text_engine_Kerning.static_members, &flash_text_engine_Kerning_ON, &flash_text_engine_Kerning_ON);
-    dict_put(d, &flash_text_CSMSettings, &flash_text_CSMSettings);
-    dict_init2(&flash_text_CSMSettings.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_CSMSettings.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_CSMSettings.members, &flash_text_CSMSettings_fontSize, &flash_text_CSMSettings_fontSize);
-    dict_put(&flash_text_CSMSettings.members, &flash_text_CSMSettings_outsideCutoff, &flash_text_CSMSettings_outsideCutoff);
-    dict_put(&flash_text_CSMSettings.members, &flash_text_CSMSettings_insideCutoff, &flash_text_CSMSettings_insideCutoff);
-    dict_put(d, &_RangeError, &_RangeError);
-    dict_init2(&_RangeError.members, &memberinfo_type, 8);
-    dict_init2(&_RangeError.static_members, &memberinfo_type, 8);
-    dict_put(&_RangeError.static_members, &_RangeError_length, &_RangeError_length);
-    dict_put(d, &_Number, &_Number);
-    dict_init2(&_Number.members, &memberinfo_type, 8);
-    dict_init2(&_Number.static_members, &memberinfo_type, 8);
-    dict_put(&_Number.members, &_Number_valueOf, &_Number_valueOf);
-    dict_put(&_Number.members, &_Number_toString, &_Number_toString);
-    dict_put(&_Number.members, &_Number_toExponential, &_Number_toExponential);
-    dict_put(&_Number.members, &_Number_toFixed, &_Number_toFixed);
-    dict_put(&_Number.members, &_Number_toPrecision, &_Number_toPrecision);
-    dict_put(&_Number.static_members, &_Number_MAX_VALUE, &_Number_MAX_VALUE);
-    dict_put(&_Number.static_members, &_Number_length, &_Number_length);
-    dict_put(&_Number.static_members, &_Number_MIN_VALUE, &_Number_MIN_VALUE);
-    dict_put(&_Number.static_members, &_Number_NaN, &_Number_NaN);
-    dict_put(&_Number.static_members, &_Number_POSITIVE_INFINITY, &_Number_POSITIVE_INFINITY);
-    dict_put(&_Number.static_members, &_Number_NEGATIVE_INFINITY, &_Number_NEGATIVE_INFINITY);
-    dict_put(d, &flash_display_Graphics, &flash_display_Graphics);
-    dict_init2(&flash_display_Graphics.members, &memberinfo_type, 63);
-    dict_init2(&flash_display_Graphics.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_drawPath, &flash_display_Graphics_drawPath);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_drawEllipse, &flash_display_Graphics_drawEllipse);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_drawRoundRectComplex, &flash_display_Graphics_drawRoundRectComplex);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_moveTo, &flash_display_Graphics_moveTo);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_lineShaderStyle, &flash_display_Graphics_lineShaderStyle);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_beginFill, &flash_display_Graphics_beginFill);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_beginGradientFill, &flash_display_Graphics_beginGradientFill);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_drawGraphicsData, &flash_display_Graphics_drawGraphicsData);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_lineGradientStyle, &flash_display_Graphics_lineGradientStyle);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_drawRoundRect, &flash_display_Graphics_drawRoundRect);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_beginBitmapFill, &flash_display_Graphics_beginBitmapFill);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_lineStyle, &flash_display_Graphics_lineStyle);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_lineTo, &flash_display_Graphics_lineTo);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_endFill, &flash_display_Graphics_endFill);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_copyFrom, &flash_display_Graphics_copyFrom);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_lineBitmapStyle, &flash_display_Graphics_lineBitmapStyle);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_curveTo, &flash_display_Graphics_curveTo);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_clear, &flash_display_Graphics_clear);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_drawCircle, &flash_display_Graphics_drawCircle);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_beginShaderFill, &flash_display_Graphics_beginShaderFill);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_drawTriangles, &flash_display_Graphics_drawTriangles);
-    dict_put(&flash_display_Graphics.members, &flash_display_Graphics_drawRect, &flash_display_Graphics_drawRect);
-    dict_put(d, &_SyntaxError, &_SyntaxError);
-    dict_init2(&_SyntaxError.members, &memberinfo_type, 8);
-    dict_init2(&_SyntaxError.static_members, &memberinfo_type, 8);
-    dict_put(&_SyntaxError.static_members, &_SyntaxError_length, &_SyntaxError_length);
-    dict_put(d, &flash_sampler_NewObjectSample, &flash_sampler_NewObjectSample);
-    dict_init2(&flash_sampler_NewObjectSample.members, &memberinfo_type, 8);
-    dict_init2(&flash_sampler_NewObjectSample.static_members, &memberinfo_type, 8);
-    dict_put(&flash_sampler_NewObjectSample.members, &flash_sampler_NewObjectSample_type, &flash_sampler_NewObjectSample_type);
-    dict_put(&flash_sampler_NewObjectSample.members, &flash_sampler_NewObjectSample_object, &flash_sampler_NewObjectSample_object);
-    dict_put(&flash_sampler_NewObjectSample.members, &flash_sampler_NewObjectSample_id, &flash_sampler_NewObjectSample_id);
-    dict_put(d, &flash_net_FileFilter, &flash_net_FileFilter);
-    dict_init2(&flash_net_FileFilter.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_FileFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_FileFilter.members, &flash_net_FileFilter_extension, &flash_net_FileFilter_extension);
-    dict_put(&flash_net_FileFilter.members, &flash_net_FileFilter_description, &flash_net_FileFilter_description);
-    dict_put(&flash_net_FileFilter.members, &flash_net_FileFilter_macType, &flash_net_FileFilter_macType);
-    dict_put(d, &flash_display_BitmapDataChannel, &flash_display_BitmapDataChannel);
-    dict_init2(&flash_display_BitmapDataChannel.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_BitmapDataChannel.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_BitmapDataChannel.static_members, &flash_display_BitmapDataChannel_BLUE, &flash_display_BitmapDataChannel_BLUE);
-    dict_put(&flash_display_BitmapDataChannel.static_members, &flash_display_BitmapDataChannel_GREEN, &flash_display_BitmapDataChannel_GREEN);
-    dict_put(&flash_display_BitmapDataChannel.static_members, &flash_display_BitmapDataChannel_ALPHA, &flash_display_BitmapDataChannel_ALPHA);
-    dict_put(&flash_display_BitmapDataChannel.static_members, &flash_display_BitmapDataChannel_RED, &flash_display_BitmapDataChannel_RED);
-    dict_put(d, &flash_utils_clearInterval, &flash_utils_clearInterval);
-    dict_put(d, &flash_text_engine_ContentElement, &flash_text_engine_ContentElement);
-    dict_init2(&flash_text_engine_ContentElement.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_ContentElement.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_eventMirror, &flash_text_engine_ContentElement_eventMirror);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_groupElement, &flash_text_engine_ContentElement_groupElement);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_textRotation, &flash_text_engine_ContentElement_textRotation);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_text, &flash_text_engine_ContentElement_text);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_userData, &flash_text_engine_ContentElement_userData);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_elementFormat, &flash_text_engine_ContentElement_elementFormat);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_textBlock, &flash_text_engine_ContentElement_textBlock);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_rawText, &flash_text_engine_ContentElement_rawText);
-    dict_put(&flash_text_engine_ContentElement.members, &flash_text_engine_ContentElement_textBlockBeginIndex, &flash_text_engine_ContentElement_textBlockBeginIndex);
-    dict_put(&flash_text_engine_ContentElement.static_members, &flash_text_engine_ContentElement_GRAPHIC_ELEMENT, &flash_text_engine_ContentElement_GRAPHIC_ELEMENT);
-    dict_put(d, &flash_utils_Endian, &flash_utils_Endian);
-    dict_init2(&flash_utils_Endian.members, &memberinfo_type, 8);
-    dict_init2(&flash_utils_Endian.static_members, &memberinfo_type, 8);
-    dict_put(&flash_utils_Endian.static_members, &flash_utils_Endian_LITTLE_ENDIAN, &flash_utils_Endian_LITTLE_ENDIAN);
-    dict_put(&flash_utils_Endian.static_members, &flash_utils_Endian_BIG_ENDIAN, &flash_utils_Endian_BIG_ENDIAN);
-    dict_put(d, &flash_net_navigateToURL, &flash_net_navigateToURL);
-    dict_put(d, &flash_events_ProgressEvent, &flash_events_ProgressEvent);
-    dict_init2(&flash_events_ProgressEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_ProgressEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_ProgressEvent.members, &flash_events_ProgressEvent_bytesLoaded, &flash_events_ProgressEvent_bytesLoaded);
-    dict_put(&flash_events_ProgressEvent.members, &flash_events_ProgressEvent_toString, &flash_events_ProgressEvent_toString);
-    dict_put(&flash_events_ProgressEvent.members, &flash_events_ProgressEvent_bytesTotal, &flash_events_ProgressEvent_bytesTotal);
-    dict_put(&flash_events_ProgressEvent.members, &flash_events_ProgressEvent_clone, &flash_events_ProgressEvent_clone);
-    dict_put(&flash_events_ProgressEvent.static_members, &flash_events_ProgressEvent_PROGRESS, &flash_events_ProgressEvent_PROGRESS);
-    dict_put(&flash_events_ProgressEvent.static_members, &flash_events_ProgressEvent_SOCKET_DATA, &flash_events_ProgressEvent_SOCKET_DATA);
-    dict_put(d, &flash_media_Sound, &flash_media_Sound);
-    dict_init2(&flash_media_Sound.members, &memberinfo_type, 15);
-    dict_init2(&flash_media_Sound.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_extract, &flash_media_Sound_extract);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_bytesLoaded, &flash_media_Sound_bytesLoaded);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_id3, &flash_media_Sound_id3);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_play, &flash_media_Sound_play);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_url, &flash_media_Sound_url);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_isBuffering, &flash_media_Sound_isBuffering);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_load, &flash_media_Sound_load);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_bytesTotal, &flash_media_Sound_bytesTotal);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_length, &flash_media_Sound_length);
-    dict_put(&flash_media_Sound.members, &flash_media_Sound_close, &flash_media_Sound_close);
-    dict_put(d, &flash_text_TextExtent, &flash_text_TextExtent);
-    dict_init2(&flash_text_TextExtent.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextExtent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextExtent.members, &flash_text_TextExtent_descent, &flash_text_TextExtent_descent);
-    dict_put(&flash_text_TextExtent.members, &flash_text_TextExtent_width, &flash_text_TextExtent_width);
-    dict_put(&flash_text_TextExtent.members, &flash_text_TextExtent_ascent, &flash_text_TextExtent_ascent);
-    dict_put(&flash_text_TextExtent.members, &flash_text_TextExtent_textFieldHeight, &flash_text_TextExtent_textFieldHeight);
-    dict_put(&flash_text_TextExtent.members, &flash_text_TextExtent_textFieldWidth, &flash_text_TextExtent_textFieldWidth);
-    dict_put(&flash_text_TextExtent.members, &flash_text_TextExtent_height, &flash_text_TextExtent_height);
-    dict_put(d, &flash_text_FontStyle, &flash_text_FontStyle);
-    dict_init2(&flash_text_FontStyle.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_FontStyle.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_FontStyle.static_members, &flash_text_FontStyle_REGULAR, &flash_text_FontStyle_REGULAR);
-    dict_put(&flash_text_FontStyle.static_members, &flash_text_FontStyle_BOLD, &flash_text_FontStyle_BOLD);
-    dict_put(&flash_text_FontStyle.static_members, &flash_text_FontStyle_BOLD_ITALIC, &flash_text_FontStyle_BOLD_ITALIC);
-    dict_put(&flash_text_FontStyle.static_members, &flash_text_FontStyle_ITALIC, &flash_text_FontStyle_ITALIC);
-    dict_put(d, &flash_text_engine_TextLineMirrorRegion, &flash_text_engine_TextLineMirrorRegion);
-    dict_init2(&flash_text_engine_TextLineMirrorRegion.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TextLineMirrorRegion.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextLineMirrorRegion.members, &flash_text_engine_TextLineMirrorRegion_mirror, &flash_text_engine_TextLineMirrorRegion_mirror);
-    dict_put(&flash_text_engine_TextLineMirrorRegion.members, &flash_text_engine_TextLineMirrorRegion_previousRegion, &flash_text_engine_TextLineMirrorRegion_previousRegion);
-    dict_put(&flash_text_engine_TextLineMirrorRegion.members, &flash_text_engine_TextLineMirrorRegion_bounds, &flash_text_engine_TextLineMirrorRegion_bounds);
-    dict_put(&flash_text_engine_TextLineMirrorRegion.members, &flash_text_engine_TextLineMirrorRegion_nextRegion, &flash_text_engine_TextLineMirrorRegion_nextRegion);
-    dict_put(&flash_text_engine_TextLineMirrorRegion.members, &flash_text_engine_TextLineMirrorRegion_element, &flash_text_engine_TextLineMirrorRegion_element);
-    dict_put(&flash_text_engine_TextLineMirrorRegion.members, &flash_text_engine_TextLineMirrorRegion_textLine, &flash_text_engine_TextLineMirrorRegion_textLine);
-    dict_put(d, &flash_geom_Vector3D, &flash_geom_Vector3D);
-    dict_init2(&flash_geom_Vector3D.members, &memberinfo_type, 31);
-    dict_init2(&flash_geom_Vector3D.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_subtract, &flash_geom_Vector3D_subtract);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_scaleBy, &flash_geom_Vector3D_scaleBy);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_decrementBy, &flash_geom_Vector3D_decrementBy);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_equals, &flash_geom_Vector3D_equals);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_normalize, &flash_geom_Vector3D_normalize);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_dotProduct, &flash_geom_Vector3D_dotProduct);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_negate, &flash_geom_Vector3D_negate);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_toString, &flash_geom_Vector3D_toString);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_lengthSquared, &flash_geom_Vector3D_lengthSquared);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_x, &flash_geom_Vector3D_x);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_incrementBy, &flash_geom_Vector3D_incrementBy);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_w, &flash_geom_Vector3D_w);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_z, &flash_geom_Vector3D_z);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_add, &flash_geom_Vector3D_add);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_project, &flash_geom_Vector3D_project);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_crossProduct, &flash_geom_Vector3D_crossProduct);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_nearEquals, &flash_geom_Vector3D_nearEquals);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_clone, &flash_geom_Vector3D_clone);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_y, &flash_geom_Vector3D_y);
-    dict_put(&flash_geom_Vector3D.members, &flash_geom_Vector3D_length, &flash_geom_Vector3D_length);
-    dict_put(&flash_geom_Vector3D.static_members, &flash_geom_Vector3D_distance, &flash_geom_Vector3D_distance);
-    dict_put(&flash_geom_Vector3D.static_members, &flash_geom_Vector3D_Z_AXIS, &flash_geom_Vector3D_Z_AXIS);
-    dict_put(&flash_geom_Vector3D.static_members, &flash_geom_Vector3D_X_AXIS, &flash_geom_Vector3D_X_AXIS);
-    dict_put(&flash_geom_Vector3D.static_members, &flash_geom_Vector3D_angleBetween, &flash_geom_Vector3D_angleBetween);
-    dict_put(&flash_geom_Vector3D.static_members, &flash_geom_Vector3D_Y_AXIS, &flash_geom_Vector3D_Y_AXIS);
-    dict_put(d, &flash_desktop_ClipboardTransferMode, &flash_desktop_ClipboardTransferMode);
-    dict_init2(&flash_desktop_ClipboardTransferMode.members, &memberinfo_type, 8);
-    dict_init2(&flash_desktop_ClipboardTransferMode.static_members, &memberinfo_type, 8);
-    dict_put(&flash_desktop_ClipboardTransferMode.static_members, &flash_desktop_ClipboardTransferMode_CLONE_ONLY, &flash_desktop_ClipboardTransferMode_CLONE_ONLY);
-    dict_put(&flash_desktop_ClipboardTransferMode.static_members, &flash_desktop_ClipboardTransferMode_ORIGINAL_PREFERRED, &flash_desktop_ClipboardTransferMode_ORIGINAL_PREFERRED);
-    dict_put(&flash_desktop_ClipboardTransferMode.static_members, &flash_desktop_ClipboardTransferMode_CLONE_PREFERRED, &flash_desktop_ClipboardTransferMode_CLONE_PREFERRED);
-    dict_put(&flash_desktop_ClipboardTransferMode.static_members, &flash_desktop_ClipboardTransferMode_ORIGINAL_ONLY, &flash_desktop_ClipboardTransferMode_ORIGINAL_ONLY);
-    dict_put(d, &flash_display_SpreadMethod, &flash_display_SpreadMethod);
-    dict_init2(&flash_display_SpreadMethod.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_SpreadMethod.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_SpreadMethod.static_members, &flash_display_SpreadMethod_REFLECT, &flash_display_SpreadMethod_REFLECT);
-    dict_put(&flash_display_SpreadMethod.static_members, &flash_display_SpreadMethod_REPEAT, &flash_display_SpreadMethod_REPEAT);
-    dict_put(&flash_display_SpreadMethod.static_members, &flash_display_SpreadMethod_PAD, &flash_display_SpreadMethod_PAD);
-    dict_put(d, &flash_system_SecurityPanel, &flash_system_SecurityPanel);
-    dict_init2(&flash_system_SecurityPanel.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_SecurityPanel.static_members, &memberinfo_type, 8);
-    dict_put(&flash_system_SecurityPanel.static_members, &flash_system_SecurityPanel_LOCAL_STORAGE, &flash_system_SecurityPanel_LOCAL_STORAGE);
-    dict_put(&flash_system_SecurityPanel.static_members, &flash_system_SecurityPanel_CAMERA, &flash_system_SecurityPanel_CAMERA);
-    dict_put(&flash_system_SecurityPanel.static_members, &flash_system_SecurityPanel_DEFAULT, &flash_system_SecurityPanel_DEFAULT);
-    dict_put(&flash_system_SecurityPanel.static_members, &flash_system_SecurityPanel_SETTINGS_MANAGER, &flash_system_SecurityPanel_SETTINGS_MANAGER);
-    dict_put(&flash_system_SecurityPanel.static_members, &flash_system_SecurityPanel_PRIVACY, &flash_system_SecurityPanel_PRIVACY);
-    dict_put(&flash_system_SecurityPanel.static_members, &flash_system_SecurityPanel_MICROPHONE, &flash_system_SecurityPanel_MICROPHONE);
-    dict_put(&flash_system_SecurityPanel.static_members, &flash_system_SecurityPanel_DISPLAY, &flash_system_SecurityPanel_DISPLAY);
-    dict_put(d, &flash_events_HTTPStatusEvent, &flash_events_HTTPStatusEvent);
-    dict_init2(&flash_events_HTTPStatusEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_HTTPStatusEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_HTTPStatusEvent.members, &flash_events_HTTPStatusEvent_toString, &flash_events_HTTPStatusEvent_toString);
-    dict_put(&flash_events_HTTPStatusEvent.members, &flash_events_HTTPStatusEvent_clone, &flash_events_HTTPStatusEvent_clone);
-    dict_put(&flash_events_HTTPStatusEvent.members, &flash_events_HTTPStatusEvent_status, &flash_events_HTTPStatusEvent_status);
-    dict_put(&flash_events_HTTPStatusEvent.static_members, &flash_events_HTTPStatusEvent_HTTP_STATUS, &flash_events_HTTPStatusEvent_HTTP_STATUS);
-    dict_put(d, &flash_net_NetStreamPlayOptions, &flash_net_NetStreamPlayOptions);
-    dict_init2(&flash_net_NetStreamPlayOptions.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_NetStreamPlayOptions.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_NetStreamPlayOptions.members, &flash_net_NetStreamPlayOptions_len, &flash_net_NetStreamPlayOptions_len);
-    dict_put(&flash_net_NetStreamPlayOptions.members, &flash_net_NetStreamPlayOptions_streamName, &flash_net_NetStreamPlayOptions_streamName);
-    dict_put(&flash_net_NetStreamPlayOptions.members, &flash_net_NetStreamPlayOptions_start, &flash_net_NetStreamPlayOptions_start);
-    dict_put(&flash_net_NetStreamPlayOptions.members, &flash_net_NetStreamPlayOptions_oldStreamName, &flash_net_NetStreamPlayOptions_oldStreamName);
-    dict_put(&flash_net_NetStreamPlayOptions.members, &flash_net_NetStreamPlayOptions_transition, &flash_net_NetStreamPlayOptions_transition);
-    dict_put(d, &flash_net_Responder, &flash_net_Responder);
-    dict_init2(&flash_net_Responder.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_Responder.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_net_XMLSocket, &flash_net_XMLSocket);
-    dict_init2(&flash_net_XMLSocket.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_XMLSocket.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_XMLSocket.members, &flash_net_XMLSocket_close, &flash_net_XMLSocket_close);
-    dict_put(&flash_net_XMLSocket.members, &flash_net_XMLSocket_connect, &flash_net_XMLSocket_connect);
-    dict_put(&flash_net_XMLSocket.members, &flash_net_XMLSocket_send, &flash_net_XMLSocket_send);
-    dict_put(&flash_net_XMLSocket.members, &flash_net_XMLSocket_connected, &flash_net_XMLSocket_connected);
-    dict_put(&flash_net_XMLSocket.members, &flash_net_XMLSocket_timeout, &flash_net_XMLSocket_timeout);
-    dict_put(d, &flash_filters_ConvolutionFilter, &flash_filters_ConvolutionFilter);
-    dict_init2(&flash_filters_ConvolutionFilter.members, &memberinfo_type, 15);
-    dict_init2(&flash_filters_ConvolutionFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_alpha, &flash_filters_ConvolutionFilter_alpha);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_matrixX, &flash_filters_ConvolutionFilter_matrixX);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_matrix, &flash_filters_ConvolutionFilter_matrix);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_bias, &flash_filters_ConvolutionFilter_bias);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_color, &flash_filters_ConvolutionFilter_color);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_preserveAlpha, &flash_filters_ConvolutionFilter_preserveAlpha);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_divisor, &flash_filters_ConvolutionFilter_divisor);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_clone, &flash_filters_ConvolutionFilter_clone);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_clamp, &flash_filters_ConvolutionFilter_clamp);
-    dict_put(&flash_filters_ConvolutionFilter.members, &flash_filters_ConvolutionFilter_matrixY, &flash_filters_ConvolutionFilter_matrixY);
-    dict_put(d, &flash_text_engine_ElementFormat, &flash_text_engine_ElementFormat);
-    dict_init2(&flash_text_engine_ElementFormat.members, &memberinfo_type, 31);
-    dict_init2(&flash_text_engine_ElementFormat.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_getFontMetrics, &flash_text_engine_ElementFormat_getFontMetrics);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_digitCase, &flash_text_engine_ElementFormat_digitCase);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_breakOpportunity, &flash_text_engine_ElementFormat_breakOpportunity);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_ligatureLevel, &flash_text_engine_ElementFormat_ligatureLevel);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_dominantBaseline, &flash_text_engine_ElementFormat_dominantBaseline);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_alignmentBaseline, &flash_text_engine_ElementFormat_alignmentBaseline);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_color, &flash_text_engine_ElementFormat_color);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_digitWidth, &flash_text_engine_ElementFormat_digitWidth);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_kerning, &flash_text_engine_ElementFormat_kerning);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_fontSize, &flash_text_engine_ElementFormat_fontSize);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_fontDescription, &flash_text_engine_ElementFormat_fontDescription);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_baselineShift, &flash_text_engine_ElementFormat_baselineShift);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_locale, &flash_text_engine_ElementFormat_locale);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_typographicCase, &flash_text_engine_ElementFormat_typographicCase);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_trackingLeft, &flash_text_engine_ElementFormat_trackingLeft);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_locked, &flash_text_engine_ElementFormat_locked);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_clone, &flash_text_engine_ElementFormat_clone);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_alpha, &flash_text_engine_ElementFormat_alpha);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_textRotation, &flash_text_engine_ElementFormat_textRotation);
-    dict_put(&flash_text_engine_ElementFormat.members, &flash_text_engine_ElementFormat_trackingRight, &flash_text_engine_ElementFormat_trackingRight);
-    dict_put(d, &flash_display_GraphicsGradientFill, &flash_display_GraphicsGradientFill);
-    dict_init2(&flash_display_GraphicsGradientFill.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsGradientFill.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsGradientFill.members, &flash_display_GraphicsGradientFill_interpolationMethod, &flash_display_GraphicsGradientFill_interpolationMethod);
-    dict_put(&flash_display_GraphicsGradientFill.members, &flash_display_GraphicsGradientFill_focalPointRatio, &flash_display_GraphicsGradientFill_focalPointRatio);
-    dict_put(&flash_display_GraphicsGradientFill.members, &flash_display_GraphicsGradientFill_colors, &flash_display_GraphicsGradientFill_colors);
-    dict_put(&flash_display_GraphicsGradientFill.members, &flash_display_GraphicsGradientFill_matrix, &flash_display_GraphicsGradientFill_matrix);
-    dict_put(&flash_display_GraphicsGradientFill.members, &flash_display_GraphicsGradientFill_type, &flash_display_GraphicsGradientFill_type);
-    dict_put(&flash_display_GraphicsGradientFill.members, &flash_display_GraphicsGradientFill_ratios, &flash_display_GraphicsGradientFill_ratios);
-    dict_put(&flash_display_GraphicsGradientFill.members, &flash_display_GraphicsGradientFill_spreadMethod, &flash_display_GraphicsGradientFill_spreadMethod);
-    dict_put(&flash_display_GraphicsGradientFill.members, &flash_display_GraphicsGradientFill_alphas, &flash_display_GraphicsGradientFill_alphas);
-    dict_put(d, &flash_display_FrameLabel, &flash_display_FrameLabel);
-    dict_init2(&flash_display_FrameLabel.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_FrameLabel.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_FrameLabel.members, &flash_display_FrameLabel_frame, &flash_display_FrameLabel_frame);
-    dict_put(&flash_display_FrameLabel.members, &flash_display_FrameLabel_name, &flash_display_FrameLabel_name);
-    dict_put(d, &flash_media_SoundTransform, &flash_media_SoundTransform);
-    dict_init2(&flash_media_SoundTransform.members, &memberinfo_type, 8);
-    dict_init2(&flash_media_SoundTransform.static_members, &memberinfo_type, 8);
-    dict_put(&flash_media_SoundTransform.members, &flash_media_SoundTransform_pan, &flash_media_SoundTransform_pan);
-    dict_put(&flash_media_SoundTransform.members, &flash_media_SoundTransform_leftToRight, &flash_media_SoundTransform_leftToRight);
-    dict_put(&flash_media_SoundTransform.members, &flash_media_SoundTransform_rightToLeft, &flash_media_SoundTransform_rightToLeft);
-    dict_put(&flash_media_SoundTransform.members, &flash_media_SoundTransform_volume, &flash_media_SoundTransform_volume);
-    dict_put(&flash_media_SoundTransform.members, &flash_media_SoundTransform_leftToLeft, &flash_media_SoundTransform_leftToLeft);
-    dict_put(&flash_media_SoundTransform.members, &flash_media_SoundTransform_rightToRight, &flash_media_SoundTransform_rightToRight);
-    dict_put(d, &_AS3, &_AS3);
-    dict_put(d, &flash_net_LocalConnection, &flash_net_LocalConnection);
-    dict_init2(&flash_net_LocalConnection.members, &memberinfo_type, 15);
-    dict_init2(&flash_net_LocalConnection.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_LocalConnection.members, &flash_net_LocalConnection_client, &flash_net_LocalConnection_client);
-    dict_put(&flash_net_LocalConnection.members, &flash_net_LocalConnection_allowDomain, &flash_net_LocalConnection_allowDomain);
-    dict_put(&flash_net_LocalConnection.members, &flash_net_LocalConnection_connect, &flash_net_LocalConnection_connect);
-    dict_put(&flash_net_LocalConnection.members, &flash_net_LocalConnection_domain, &flash_net_LocalConnection_domain);
-    dict_put(&flash_net_LocalConnection.members, &flash_net_LocalConnection_allowInsecureDomain, &flash_net_LocalConnection_allowInsecureDomain);
-    dict_put(&flash_net_LocalConnection.members, &flash_net_LocalConnection_send, &flash_net_LocalConnection_send);
-    dict_put(&flash_net_LocalConnection.members, &flash_net_LocalConnection_close, &flash_net_LocalConnection_close);
-    dict_put(d, &flash_display_ShaderParameterType, &flash_display_ShaderParameterType);
-    dict_init2(&flash_display_ShaderParameterType.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_ShaderParameterType.static_members, &memberinfo_type, 31);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_FLOAT, &flash_display_ShaderParameterType_FLOAT);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_BOOL, &flash_display_ShaderParameterType_BOOL);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_FLOAT2, &flash_display_ShaderParameterType_FLOAT2);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_MATRIX2X2, &flash_display_ShaderParameterType_MATRIX2X2);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_INT, &flash_display_ShaderParameterType_INT);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_INT4, &flash_display_ShaderParameterType_INT4);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_MATRIX4X4, &flash_display_ShaderParameterType_MATRIX4X4);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_FLOAT3, &flash_display_ShaderParameterType_FLOAT3);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_BOOL2, &flash_display_ShaderParameterType_BOOL2);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_INT3, &flash_display_ShaderParameterType_INT3);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_BOOL3, &flash_display_ShaderParameterType_BOOL3);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_BOOL4, &flash_display_ShaderParameterType_BOOL4);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_FLOAT4, &flash_display_ShaderParameterType_FLOAT4);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_INT2, &flash_display_ShaderParameterType_INT2);
-    dict_put(&flash_display_ShaderParameterType.static_members, &flash_display_ShaderParameterType_MATRIX3X3, &flash_display_ShaderParameterType_MATRIX3X3);
-    dict_put(d, &flash_events_IMEEvent, &flash_events_IMEEvent);
-    dict_init2(&flash_events_IMEEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_IMEEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_IMEEvent.members, &flash_events_IMEEvent_toString, &flash_events_IMEEvent_toString);
-    dict_put(&flash_events_IMEEvent.members, &flash_events_IMEEvent_clone, &flash_events_IMEEvent_clone);
-    dict_put(&flash_events_IMEEvent.static_members, &flash_events_IMEEvent_IME_COMPOSITION, &flash_events_IMEEvent_IME_COMPOSITION);
-    dict_put(d, &flash_text_TextFormatDisplay, &flash_text_TextFormatDisplay);
-    dict_init2(&flash_text_TextFormatDisplay.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextFormatDisplay.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextFormatDisplay.static_members, &flash_text_TextFormatDisplay_INLINE, &flash_text_TextFormatDisplay_INLINE);
-    dict_put(&flash_text_TextFormatDisplay.static_members, &flash_text_TextFormatDisplay_BLOCK, &flash_text_TextFormatDisplay_BLOCK);
-    dict_put(d, &flash_profiler_profile, &flash_profiler_profile);
-    dict_put(d, &flash_display_AVM1Movie, &flash_display_AVM1Movie);
-    dict_init2(&flash_display_AVM1Movie.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_AVM1Movie.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_AVM1Movie.members, &flash_display_AVM1Movie_call, &flash_display_AVM1Movie_call);
-    dict_put(&flash_display_AVM1Movie.members, &flash_display_AVM1Movie_addCallback, &flash_display_AVM1Movie_addCallback);
-    dict_put(d, &flash_events_ContextMenuEvent, &flash_events_ContextMenuEvent);
-    dict_init2(&flash_events_ContextMenuEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_ContextMenuEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_ContextMenuEvent.members, &flash_events_ContextMenuEvent_mouseTarget, &flash_events_ContextMenuEvent_mouseTarget);
-    dict_put(&flash_events_ContextMenuEvent.members, &flash_events_ContextMenuEvent_isMouseTargetInaccessible, &flash_events_ContextMenuEvent_isMouseTargetInaccessible);
-    dict_put(&flash_events_ContextMenuEvent.members, &flash_events_ContextMenuEvent_toString, &flash_events_ContextMenuEvent_toString);
-    dict_put(&flash_events_ContextMenuEvent.members, &flash_events_ContextMenuEvent_contextMenuOwner, &flash_events_ContextMenuEvent_contextMenuOwner);
-    dict_put(&flash_events_ContextMenuEvent.members, &flash_events_ContextMenuEvent_clone, &flash_events_ContextMenuEvent_clone);
-    dict_put(&flash_events_ContextMenuEvent.static_members, &flash_events_ContextMenuEvent_MENU_SELECT, &flash_events_ContextMenuEvent_MENU_SELECT);
-    dict_put(&flash_events_ContextMenuEvent.static_members, &flash_events_ContextMenuEvent_MENU_ITEM_SELECT, &flash_events_ContextMenuEvent_MENU_ITEM_SELECT);
-    dict_put(d, &flash_events_EventPhase, &flash_events_EventPhase);
-    dict_init2(&flash_events_EventPhase.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_EventPhase.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_EventPhase.static_members, &flash_events_EventPhase_BUBBLING_PHASE, &flash_events_EventPhase_BUBBLING_PHASE);
-    dict_put(&flash_events_EventPhase.static_members, &flash_events_EventPhase_CAPTURING_PHASE, &flash_events_EventPhase_CAPTURING_PHASE);
-    dict_put(&flash_events_EventPhase.static_members, &flash_events_EventPhase_AT_TARGET, &flash_events_EventPhase_AT_TARGET);
-    dict_put(d, &flash_display_JointStyle, &flash_display_JointStyle);
-    dict_init2(&flash_display_JointStyle.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_JointStyle.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_JointStyle.static_members, &flash_display_JointStyle_ROUND, &flash_display_JointStyle_ROUND);
-    dict_put(&flash_display_JointStyle.static_members, &flash_display_JointStyle_MITER, &flash_display_JointStyle_MITER);
-    dict_put(&flash_display_JointStyle.static_members, &flash_display_JointStyle_BEVEL, &flash_display_JointStyle_BEVEL);
-    dict_put(d, &flash_utils_Dictionary, &flash_utils_Dictionary);
-    dict_init2(&flash_utils_Dictionary.members, &memberinfo_type, 8);
-    dict_init2(&flash_utils_Dictionary.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_display_GraphicsPathCommand, &flash_display_GraphicsPathCommand);
-    dict_init2(&flash_display_GraphicsPathCommand.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsPathCommand.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsPathCommand.static_members, &flash_display_GraphicsPathCommand_NO_OP, &flash_display_GraphicsPathCommand_NO_OP);
-    dict_put(&flash_display_GraphicsPathCommand.static_members, &flash_display_GraphicsPathCommand_MOVE_TO, &flash_display_GraphicsPathCommand_MOVE_TO);
-    dict_put(&flash_display_GraphicsPathCommand.static_members, &flash_display_GraphicsPathCommand_WIDE_MOVE_TO, &flash_display_GraphicsPathCommand_WIDE_MOVE_TO);
-    dict_put(&flash_display_GraphicsPathCommand.static_members, &flash_display_GraphicsPathCommand_CURVE_TO, &flash_display_GraphicsPathCommand_CURVE_TO);
-    dict_put(&flash_display_GraphicsPathCommand.static_members, &flash_display_GraphicsPathCommand_LINE_TO, &flash_display_GraphicsPathCommand_LINE_TO);
-    dict_put(&flash_display_GraphicsPathCommand.static_members, &flash_display_GraphicsPathCommand_WIDE_LINE_TO, &flash_display_GraphicsPathCommand_WIDE_LINE_TO);
-    dict_put(d, &flash_filters_BevelFilter, &flash_filters_BevelFilter);
-    dict_init2(&flash_filters_BevelFilter.members, &memberinfo_type, 31);
-    dict_init2(&flash_filters_BevelFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_type, &flash_filters_BevelFilter_type);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_highlightColor, &flash_filters_BevelFilter_highlightColor);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_knockout, &flash_filters_BevelFilter_knockout);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_distance, &flash_filters_BevelFilter_distance);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_strength, &flash_filters_BevelFilter_strength);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_highlightAlpha, &flash_filters_BevelFilter_highlightAlpha);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_blurY, &flash_filters_BevelFilter_blurY);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_shadowColor, &flash_filters_BevelFilter_shadowColor);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_angle, &flash_filters_BevelFilter_angle);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_blurX, &flash_filters_BevelFilter_blurX);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_shadowAlpha, &flash_filters_BevelFilter_shadowAlpha);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_quality, &flash_filters_BevelFilter_quality);
-    dict_put(&flash_filters_BevelFilter.members, &flash_filters_BevelFilter_clone, &flash_filters_BevelFilter_clone);
-    dict_put(d, &flash_utils_getTimer, &flash_utils_getTimer);
-    dict_put(d, &flash_display_Loader, &flash_display_Loader);
-    dict_init2(&flash_display_Loader.members, &memberinfo_type, 15);
-    dict_init2(&flash_display_Loader.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_content, &flash_display_Loader_content);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_unloadAndStop, &flash_display_Loader_unloadAndStop);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_unload, &flash_display_Loader_unload);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_removeChildAt, &flash_display_Loader_removeChildAt);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_addChildAt, &flash_display_Loader_addChildAt);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_contentLoaderInfo, &flash_display_Loader_contentLoaderInfo);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_loadBytes, &flash_display_Loader_loadBytes);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_removeChild, &flash_display_Loader_removeChild);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_load, &flash_display_Loader_load);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_addChild, &flash_display_Loader_addChild);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_close, &flash_display_Loader_close);
-    dict_put(&flash_display_Loader.members, &flash_display_Loader_setChildIndex, &flash_display_Loader_setChildIndex);
-    dict_put(d, &flash_display_GraphicsBitmapFill, &flash_display_GraphicsBitmapFill);
-    dict_init2(&flash_display_GraphicsBitmapFill.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsBitmapFill.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsBitmapFill.members, &flash_display_GraphicsBitmapFill_smooth, &flash_display_GraphicsBitmapFill_smooth);
-    dict_put(&flash_display_GraphicsBitmapFill.members, &flash_display_GraphicsBitmapFill_repeat, &flash_display_GraphicsBitmapFill_repeat);
-    dict_put(&flash_display_GraphicsBitmapFill.members, &flash_display_GraphicsBitmapFill_bitmapData, &flash_display_GraphicsBitmapFill_bitmapData);
-    dict_put(&flash_display_GraphicsBitmapFill.members, &flash_display_GraphicsBitmapFill_matrix, &flash_display_GraphicsBitmapFill_matrix);
-    dict_put(d, &_undefined, &_undefined);
-    dict_put(d, &flash_display_SimpleButton, &flash_display_SimpleButton);
-    dict_init2(&flash_display_SimpleButton.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_SimpleButton.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_SimpleButton.members, &flash_display_SimpleButton_overState, &flash_display_SimpleButton_overState);
-    dict_put(&flash_display_SimpleButton.members, &flash_display_SimpleButton_downState, &flash_display_SimpleButton_downState);
-    dict_put(&flash_display_SimpleButton.members, &flash_display_SimpleButton_enabled, &flash_display_SimpleButton_enabled);
-    dict_put(&flash_display_SimpleButton.members, &flash_display_SimpleButton_trackAsMenu, &flash_display_SimpleButton_trackAsMenu);
-    dict_put(&flash_display_SimpleButton.members, &flash_display_SimpleButton_soundTransform, &flash_display_SimpleButton_soundTransform);
-    dict_put(&flash_display_SimpleButton.members, &flash_display_SimpleButton_useHandCursor, &flash_display_SimpleButton_useHandCursor);
-    dict_put(&flash_display_SimpleButton.members, &flash_display_SimpleButton_upState, &flash_display_SimpleButton_upState);
-    dict_put(&flash_display_SimpleButton.members, &flash_display_SimpleButton_hitTestState, &flash_display_SimpleButton_hitTestState);
-    dict_put(d, &flash_text_engine_TabAlignment, &flash_text_engine_TabAlignment);
-    dict_init2(&flash_text_engine_TabAlignment.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TabAlignment.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TabAlignment.static_members, &flash_text_engine_TabAlignment_END, &flash_text_engine_TabAlignment_END);
-    dict_put(&flash_text_engine_TabAlignment.static_members, &flash_text_engine_TabAlignment_CENTER, &flash_text_engine_TabAlignment_CENTER);
-    dict_put(&flash_text_engine_TabAlignment.static_members, &flash_text_engine_TabAlignment_START, &flash_text_engine_TabAlignment_START);
-    dict_put(&flash_text_engine_TabAlignment.static_members, &flash_text_engine_TabAlignment_DECIMAL, &flash_text_engine_TabAlignment_DECIMAL);
-    dict_put(d, &flash_text_engine_FontWeight, &flash_text_engine_FontWeight);
-    dict_init2(&flash_text_engine_FontWeight.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_FontWeight.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_FontWeight.static_members, &flash_text_engine_FontWeight_NORMAL, &flash_text_engine_FontWeight_NORMAL);
-    dict_put(&flash_text_engine_FontWeight.static_members, &flash_text_engine_FontWeight_BOLD, &flash_text_engine_FontWeight_BOLD);
-    dict_put(d, &flash_utils_describeType, &flash_utils_describeType);
-    dict_put(d, &flash_display_PixelSnapping, &flash_display_PixelSnapping);
-    dict_init2(&flash_display_PixelSnapping.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_PixelSnapping.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_PixelSnapping.static_members, &flash_display_PixelSnapping_AUTO, &flash_display_PixelSnapping_AUTO);
-    dict_put(&flash_display_PixelSnapping.static_members, &flash_display_PixelSnapping_NEVER, &flash_display_PixelSnapping_NEVER);
-    dict_put(&flash_display_PixelSnapping.static_members, &flash_display_PixelSnapping_ALWAYS, &flash_display_PixelSnapping_ALWAYS);
-    dict_put(d, &flash_events_FocusEvent, &flash_events_FocusEvent);
-    dict_init2(&flash_events_FocusEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_FocusEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_FocusEvent.members, &flash_events_FocusEvent_keyCode, &flash_events_FocusEvent_keyCode);
-    dict_put(&flash_events_FocusEvent.members, &flash_events_FocusEvent_toString, &flash_events_FocusEvent_toString);
-    dict_put(&flash_events_FocusEvent.members, &flash_events_FocusEvent_isRelatedObjectInaccessible, &flash_events_FocusEvent_isRelatedObjectInaccessible);
-    dict_put(&flash_events_FocusEvent.members, &flash_events_FocusEvent_clone, &flash_events_FocusEvent_clone);
-    dict_put(&flash_events_FocusEvent.members, &flash_events_FocusEvent_shiftKey, &flash_events_FocusEvent_shiftKey);
-    dict_put(&flash_events_FocusEvent.members, &flash_events_FocusEvent_relatedObject, &flash_events_FocusEvent_relatedObject);
-    dict_put(&flash_events_FocusEvent.static_members, &flash_events_FocusEvent_FOCUS_IN, &flash_events_FocusEvent_FOCUS_IN);
-    dict_put(&flash_events_FocusEvent.static_members, &flash_events_FocusEvent_FOCUS_OUT, &flash_events_FocusEvent_FOCUS_OUT);
-    dict_put(&flash_events_FocusEvent.static_members, &flash_events_FocusEvent_KEY_FOCUS_CHANGE, &flash_events_FocusEvent_KEY_FOCUS_CHANGE);
-    dict_put(&flash_events_FocusEvent.static_members, &flash_events_FocusEvent_MOUSE_FOCUS_CHANGE, &flash_events_FocusEvent_MOUSE_FOCUS_CHANGE);
-    dict_put(d, &flash_errors_MemoryError, &flash_errors_MemoryError);
-    dict_init2(&flash_errors_MemoryError.members, &memberinfo_type, 8);
-    dict_init2(&flash_errors_MemoryError.static_members, &memberinfo_type, 8);
-    dict_put(d, &flash_events_NetFilterEvent, &flash_events_NetFilterEvent);
-    dict_init2(&flash_events_NetFilterEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_NetFilterEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_NetFilterEvent.members, &flash_events_NetFilterEvent_header, &flash_events_NetFilterEvent_header);
-    dict_put(&flash_events_NetFilterEvent.members, &flash_events_NetFilterEvent_toString, &flash_events_NetFilterEvent_toString);
-    dict_put(&flash_events_NetFilterEvent.members, &flash_events_NetFilterEvent_clone, &flash_events_NetFilterEvent_clone);
-    dict_put(&flash_events_NetFilterEvent.members, &flash_events_NetFilterEvent_data, &flash_events_NetFilterEvent_data);
-    dict_put(d, &_decodeURI, &_decodeURI);
-    dict_put(d, &_encodeURI, &_encodeURI);
-    dict_put(d, &flash_text_engine_TextBaseline, &flash_text_engine_TextBaseline);
-    dict_init2(&flash_text_engine_TextBaseline.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TextBaseline.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextBaseline.static_members, &flash_text_engine_TextBaseline_ROMAN, &flash_text_engine_TextBaseline_ROMAN);
-    dict_put(&flash_text_engine_TextBaseline.static_members, &flash_text_engine_TextBaseline_DESCENT, &flash_text_engine_TextBaseline_DESCENT);
-    dict_put(&flash_text_engine_TextBaseline.static_members, &flash_text_engine_TextBaseline_IDEOGRAPHIC_CENTER, &flash_text_engine_TextBaseline_IDEOGRAPHIC_CENTER);
-    dict_put(&flash_text_engine_TextBaseline.static_members, &flash_text_engine_TextBaseline_USE_DOMINANT_BASELINE, &flash_text_engine_TextBaseline_USE_DOMINANT_BASELINE);
-    dict_put(&flash_text_engine_TextBaseline.static_members, &flash_text_engine_TextBaseline_IDEOGRAPHIC_BOTTOM, &flash_text_engine_TextBaseline_IDEOGRAPHIC_BOTTOM);
-    dict_put(&flash_text_engine_TextBaseline.static_members, &flash_text_engine_TextBaseline_ASCENT, &flash_text_engine_TextBaseline_ASCENT);
-    dict_put(&flash_text_engine_TextBaseline.static_members, &flash_text_engine_TextBaseline_IDEOGRAPHIC_TOP, &flash_text_engine_TextBaseline_IDEOGRAPHIC_TOP);
-    dict_put(d, &flash_external_ExternalInterface, &flash_external_ExternalInterface);
-    dict_init2(&flash_external_ExternalInterface.members, &memberinfo_type, 8);
-    dict_init2(&flash_external_ExternalInterface.static_members, &memberinfo_type, 8);
-    dict_put(&flash_external_ExternalInterface.static_members, &flash_external_ExternalInterface_call, &flash_external_ExternalInterface_call);
-    dict_put(&flash_external_ExternalInterface.static_members, &flash_external_ExternalInterface_available, &flash_external_ExternalInterface_available);
-    dict_put(&flash_external_ExternalInterface.static_members, &flash_external_ExternalInterface_addCallback, &flash_external_ExternalInterface_addCallback);
-    dict_put(&flash_external_ExternalInterface.static_members, &flash_external_ExternalInterface_marshallExceptions, &flash_external_ExternalInterface_marshallExceptions);
-    dict_put(&flash_external_ExternalInterface.static_members, &flash_external_ExternalInterface_objectID, &flash_external_ExternalInterface_objectID);
-    dict_put(d, &_EvalError, &_EvalError);
-    dict_init2(&_EvalError.members, &memberinfo_type, 8);
-    dict_init2(&_EvalError.static_members, &memberinfo_type, 8);
-    dict_put(&_EvalError.static_members, &_EvalError_length, &_EvalError_length);
-    dict_put(d, &flash_text_engine_DigitCase, &flash_text_engine_DigitCase);
-    dict_init2(&flash_text_engine_DigitCase.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_DigitCase.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_DigitCase.static_members, &flash_text_engine_DigitCase_OLD_STYLE, &flash_text_engine_DigitCase_OLD_STYLE);
-    dict_put(&flash_text_engine_DigitCase.static_members, &flash_text_engine_DigitCase_DEFAULT, &flash_text_engine_DigitCase_DEFAULT);
-    dict_put(&flash_text_engine_DigitCase.static_members, &flash_text_engine_DigitCase_LINING, &flash_text_engine_DigitCase_LINING);
-    dict_put(d, &flash_text_TextFormatAlign, &flash_text_TextFormatAlign);
-    dict_init2(&flash_text_TextFormatAlign.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_TextFormatAlign.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_TextFormatAlign.static_members, &flash_text_TextFormatAlign_LEFT, &flash_text_TextFormatAlign_LEFT);
-    dict_put(&flash_text_TextFormatAlign.static_members, &flash_text_TextFormatAlign_RIGHT, &flash_text_TextFormatAlign_RIGHT);
-    dict_put(&flash_text_TextFormatAlign.static_members, &flash_text_TextFormatAlign_CENTER, &flash_text_TextFormatAlign_CENTER);
-    dict_put(&flash_text_TextFormatAlign.static_members, &flash_text_TextFormatAlign_JUSTIFY, &flash_text_TextFormatAlign_JUSTIFY);
-    dict_put(d, &flash_errors_ScriptTimeoutError, &flash_errors_ScriptTimeoutError);
-    dict_init2(&flash_errors_ScriptTimeoutError.members, &memberinfo_type, 8);
-    dict_init2(&flash_errors_ScriptTimeoutError.static_members, &memberinfo_type, 8);
-    dict_put(d, &_uint, &_uint);
-    dict_init2(&_uint.members, &memberinfo_type, 8);
-    dict_init2(&_uint.static_members, &memberinfo_type, 8);
-    dict_put(&_uint.members, &_uint_valueOf, &_uint_valueOf);
-    dict_put(&_uint.members, &_uint_toString, &_uint_toString);
-    dict_put(&_uint.members, &_uint_toExponential, &_uint_toExponential);
-    dict_put(&_uint.members, &_uint_toFixed, &_uint_toFixed);
-    dict_put(&_uint.members, &_uint_toPrecision, &_uint_toPrecision);
-    dict_put(&_uint.static_members, &_uint_MAX_VALUE, &_uint_MAX_VALUE);
-    dict_put(&_uint.static_members, &_uint_length, &_uint_length);
-    dict_put(&_uint.static_members, &_uint_MIN_VALUE, &_uint_MIN_VALUE);
-    dict_put(d, &flash_debugger_enterDebugger, &flash_debugger_enterDebugger);
-    dict_put(d, &flash_geom_Orientation3D, &flash_geom_Orientation3D);
-    dict_init2(&flash_geom_Orientation3D.members, &memberinfo_type, 8);
-    dict_init2(&flash_geom_Orientation3D.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_Orientation3D.static_members, &flash_geom_Orientation3D_QUATERNION, &flash_geom_Orientation3D_QUATERNION);
-    dict_put(&flash_geom_Orientation3D.static_members, &flash_geom_Orientation3D_EULER_ANGLES, &flash_geom_Orientation3D_EULER_ANGLES);
-    dict_put(&flash_geom_Orientation3D.static_members, &flash_geom_Orientation3D_AXIS_ANGLE, &flash_geom_Orientation3D_AXIS_ANGLE);
-    dict_put(d, &flash_text_engine_CFFHinting, &flash_text_engine_CFFHinting);
-    dict_init2(&flash_text_engine_CFFHinting.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_CFFHinting.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_CFFHinting.static_members, &flash_text_engine_CFFHinting_HORIZONTAL_STEM, &flash_text_engine_CFFHinting_HORIZONTAL_STEM);
-    dict_put(&flash_text_engine_CFFHinting.static_members, &flash_text_engine_CFFHinting_NONE, &flash_text_engine_CFFHinting_NONE);
-    dict_put(d, &flash_text_FontType, &flash_text_FontType);
-    dict_init2(&flash_text_FontType.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_FontType.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_FontType.static_members, &flash_text_FontType_EMBEDDED, &flash_text_FontType_EMBEDDED);
-    dict_put(&flash_text_FontType.static_members, &flash_text_FontType_DEVICE, &flash_text_FontType_DEVICE);
-    dict_put(&flash_text_FontType.static_members, &flash_text_FontType_EMBEDDED_CFF, &flash_text_FontType_EMBEDDED_CFF);
-    dict_put(d, &flash_filters_ShaderFilter, &flash_filters_ShaderFilter);
-    dict_init2(&flash_filters_ShaderFilter.members, &memberinfo_type, 8);
-    dict_init2(&flash_filters_ShaderFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_ShaderFilter.members, &flash_filters_ShaderFilter_bottomExtension, &flash_filters_ShaderFilter_bottomExtension);
-    dict_put(&flash_filters_ShaderFilter.members, &flash_filters_ShaderFilter_shader, &flash_filters_ShaderFilter_shader);
-    dict_put(&flash_filters_ShaderFilter.members, &flash_filters_ShaderFilter_rightExtension, &flash_filters_ShaderFilter_rightExtension);
-    dict_put(&flash_filters_ShaderFilter.members, &flash_filters_ShaderFilter_leftExtension, &flash_filters_ShaderFilter_leftExtension);
-    dict_put(&flash_filters_ShaderFilter.members, &flash_filters_ShaderFilter_topExtension, &flash_filters_ShaderFilter_topExtension);
-    dict_put(d, &flash_display_GraphicsPath, &flash_display_GraphicsPath);
-    dict_init2(&flash_display_GraphicsPath.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_GraphicsPath.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_GraphicsPath.members, &flash_display_GraphicsPath_wideMoveTo, &flash_display_GraphicsPath_wideMoveTo);
-    dict_put(&flash_display_GraphicsPath.members, &flash_display_GraphicsPath_winding, &flash_display_GraphicsPath_winding);
-    dict_put(&flash_display_GraphicsPath.members, &flash_display_GraphicsPath_moveTo, &flash_display_GraphicsPath_moveTo);
-    dict_put(&flash_display_GraphicsPath.members, &flash_display_GraphicsPath_wideLineTo, &flash_display_GraphicsPath_wideLineTo);
-    dict_put(&flash_display_GraphicsPath.members, &flash_display_GraphicsPath_commands, &flash_display_GraphicsPath_commands);
-    dict_put(&flash_display_GraphicsPath.members, &flash_display_GraphicsPath_curveTo, &flash_display_GraphicsPath_curveTo);
-    dict_put(&flash_display_GraphicsPath.members, &flash_display_GraphicsPath_lineTo, &flash_display_GraphicsPath_lineTo);
-    dict_put(&flash_display_GraphicsPath.members, &flash_display_GraphicsPath_data, &flash_display_GraphicsPath_data);
-    dict_put(d, &flash_system_ApplicationDomain, &flash_system_ApplicationDomain);
-    dict_init2(&flash_system_ApplicationDomain.members, &memberinfo_type, 8);
-    dict_init2(&flash_system_ApplicationDomain.static_members, &memberinfo_type, 8);
-    dict_put(&flash_system_ApplicationDomain.members, &flash_system_ApplicationDomain_hasDefinition, &flash_system_ApplicationDomain_hasDefinition);
-    dict_put(&flash_system_ApplicationDomain.members, &flash_system_ApplicationDomain_getDefinition, &flash_system_ApplicationDomain_getDefinition);
-    dict_put(&flash_system_ApplicationDomain.members, &flash_system_ApplicationDomain_parentDomain, &flash_system_ApplicationDomain_parentDomain);
-    dict_put(&flash_system_ApplicationDomain.members, &flash_system_ApplicationDomain_domainMemory, &flash_system_ApplicationDomain_domainMemory);
-    dict_put(&flash_system_ApplicationDomain.static_members, &flash_system_ApplicationDomain_MIN_DOMAIN_MEMORY_LENGTH, &flash_system_ApplicationDomain_MIN_DOMAIN_MEMORY_LENGTH);
-    dict_put(&flash_system_ApplicationDomain.static_members, &flash_system_ApplicationDomain_currentDomain, &flash_system_ApplicationDomain_currentDomain);
-    dict_put(d, &flash_events_KeyboardEvent, &flash_events_KeyboardEvent);
-    dict_init2(&flash_events_KeyboardEvent.members, &memberinfo_type, 15);
-    dict_init2(&flash_events_KeyboardEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_shiftKey, &flash_events_KeyboardEvent_shiftKey);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_keyCode, &flash_events_KeyboardEvent_keyCode);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_keyLocation, &flash_events_KeyboardEvent_keyLocation);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_updateAfterEvent, &flash_events_KeyboardEvent_updateAfterEvent);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_toString, &flash_events_KeyboardEvent_toString);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_altKey, &flash_events_KeyboardEvent_altKey);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_ctrlKey, &flash_events_KeyboardEvent_ctrlKey);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_clone, &flash_events_KeyboardEvent_clone);
-    dict_put(&flash_events_KeyboardEvent.members, &flash_events_KeyboardEvent_charCode, &flash_events_KeyboardEvent_charCode);
-    dict_put(&flash_events_KeyboardEvent.static_members, &flash_events_KeyboardEvent_KEY_DOWN, &flash_events_KeyboardEvent_KEY_DOWN);
-    dict_put(&flash_events_KeyboardEvent.static_members, &flash_events_KeyboardEvent_KEY_UP, &flash_events_KeyboardEvent_KEY_UP);
-    dict_put(d, &adobe_utils_ProductManager, &adobe_utils_ProductManager);
-    dict_init2(&adobe_utils_ProductManager.members, &memberinfo_type, 8);
-    dict_init2(&adobe_utils_ProductManager.static_members, &memberinfo_type, 8);
-    dict_put(&adobe_utils_ProductManager.members, &adobe_utils_ProductManager_running, &adobe_utils_ProductManager_running);
-    dict_put(&adobe_utils_ProductManager.members, &adobe_utils_ProductManager_download, &adobe_utils_ProductManager_download);
-    dict_put(&adobe_utils_ProductManager.members, &adobe_utils_ProductManager_installedVersion, &adobe_utils_ProductManager_installedVersion);
-    dict_put(&adobe_utils_ProductManager.members, &adobe_utils_ProductManager_installed, &adobe_utils_ProductManager_installed);
-    dict_put(&adobe_utils_ProductManager.members, &adobe_utils_ProductManager_launch, &adobe_utils_ProductManager_launch);
-    dict_put(d, &flash_events_Event, &flash_events_Event);
-    dict_init2(&flash_events_Event.members, &memberinfo_type, 31);
-    dict_init2(&flash_events_Event.static_members, &memberinfo_type, 63);
-    dict_put(&flash_events_Event.members, &flash_events_Event_type, &flash_events_Event_type);
-    dict_put(&flash_events_Event.members, &flash_events_Event_cancelable, &flash_events_Event_cancelable);
-    dict_put(&flash_events_Event.members, &flash_events_Event_isDefaultPrevented, &flash_events_Event_isDefaultPrevented);
-    dict_put(&flash_events_Event.members, &flash_events_Event_target, &flash_events_Event_target);
-    dict_put(&flash_events_Event.members, &flash_events_Event_eventPhase, &flash_events_Event_eventPhase);
-    dict_put(&flash_events_Event.members, &flash_events_Event_currentTarget, &flash_events_Event_currentTarget);
-    dict_put(&flash_events_Event.members, &flash_events_Event_toString, &flash_events_Event_toString);
-    dict_put(&flash_events_Event.members, &flash_events_Event_stopImmediatePropagation, &flash_events_Event_stopImmediatePropagation);
-    dict_put(&flash_events_Event.members, &flash_events_Event_bubbles, &flash_events_Event_bubbles);
-    dict_put(&flash_events_Event.members, &flash_events_Event_stopPropagation, &flash_events_Event_stopPropagation);
-    dict_put(&flash_events_Event.members, &flash_events_Event_clone, &flash_events_Event_clone);
-    dict_put(&flash_events_Event.members, &flash_events_Event_preventDefault, &flash_events_Event_preventDefault);
-    dict_put(&flash_events_Event.members, &flash_events_Event_formatToString, &flash_events_Event_formatToString);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_REMOVED_FROM_STAGE, &flash_events_Event_REMOVED_FROM_STAGE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_CLEAR, &flash_events_Event_CLEAR);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_OPEN, &flash_events_Event_OPEN);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_TAB_CHILDREN_CHANGE, &flash_events_Event_TAB_CHILDREN_CHANGE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_DEACTIVATE, &flash_events_Event_DEACTIVATE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_ACTIVATE, &flash_events_Event_ACTIVATE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_SOUND_COMPLETE, &flash_events_Event_SOUND_COMPLETE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_CANCEL, &flash_events_Event_CANCEL);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_REMOVED, &flash_events_Event_REMOVED);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_INIT, &flash_events_Event_INIT);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_FRAME_CONSTRUCTED, &flash_events_Event_FRAME_CONSTRUCTED);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_SCROLL, &flash_events_Event_SCROLL);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_TAB_INDEX_CHANGE, &flash_events_Event_TAB_INDEX_CHANGE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_CHANGE, &flash_events_Event_CHANGE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_ADDED_TO_STAGE, &flash_events_Event_ADDED_TO_STAGE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_UNLOAD, &flash_events_Event_UNLOAD);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_SELECT, &flash_events_Event_SELECT);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_CONNECT, &flash_events_Event_CONNECT);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_CUT, &flash_events_Event_CUT);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_PASTE, &flash_events_Event_PASTE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_ADDED, &flash_events_Event_ADDED);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_ID3, &flash_events_Event_ID3);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_ENTER_FRAME, &flash_events_Event_ENTER_FRAME);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_RENDER, &flash_events_Event_RENDER);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_EXIT_FRAME, &flash_events_Event_EXIT_FRAME);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_RESIZE, &flash_events_Event_RESIZE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_FULLSCREEN, &flash_events_Event_FULLSCREEN);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_MOUSE_LEAVE, &flash_events_Event_MOUSE_LEAVE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_CLOSE, &flash_events_Event_CLOSE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_SELECT_ALL, &flash_events_Event_SELECT_ALL);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_TAB_ENABLED_CHANGE, &flash_events_Event_TAB_ENABLED_CHANGE);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_COPY, &flash_events_Event_COPY);
-    dict_put(&flash_events_Event.static_members, &flash_events_Event_COMPLETE, &flash_events_Event_COMPLETE);
-    dict_put(d, &flash_desktop_ClipboardFormats, &flash_desktop_ClipboardFormats);
-    dict_init2(&flash_desktop_ClipboardFormats.members, &memberinfo_type, 8);
-    dict_init2(&flash_desktop_ClipboardFormats.static_members, &memberinfo_type, 15);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_TEXT_FORMAT, &flash_desktop_ClipboardFormats_TEXT_FORMAT);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_BITMAP_FORMAT, &flash_desktop_ClipboardFormats_BITMAP_FORMAT);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_FLASH_PREFIX, &flash_desktop_ClipboardFormats_FLASH_PREFIX);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_HTML_FORMAT, &flash_desktop_ClipboardFormats_HTML_FORMAT);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_REFERENCE_PREFIX, &flash_desktop_ClipboardFormats_REFERENCE_PREFIX);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_AIR_PREFIX, &flash_desktop_ClipboardFormats_AIR_PREFIX);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_SERIALIZATION_PREFIX, &flash_desktop_ClipboardFormats_SERIALIZATION_PREFIX);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_RICH_TEXT_FORMAT, &flash_desktop_ClipboardFormats_RICH_TEXT_FORMAT);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_URL_FORMAT, &flash_desktop_ClipboardFormats_URL_FORMAT);
-    dict_put(&flash_desktop_ClipboardFormats.static_members, &flash_desktop_ClipboardFormats_FILE_LIST_FORMAT, &flash_desktop_ClipboardFormats_FILE_LIST_FORMAT);
-    dict_put(d, &flash_display_MovieClip, &flash_display_MovieClip);
-    dict_init2(&flash_display_MovieClip.members, &memberinfo_type, 31);
-    dict_init2(&flash_display_MovieClip.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_prevScene, &flash_display_MovieClip_prevScene);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_gotoAndPlay, &flash_display_MovieClip_gotoAndPlay);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_currentLabels, &flash_display_MovieClip_currentLabels);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_nextFrame, &flash_display_MovieClip_nextFrame);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_currentScene, &flash_display_MovieClip_currentScene);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_enabled, &flash_display_MovieClip_enabled);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_currentFrameLabel, &flash_display_MovieClip_currentFrameLabel);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_play, &flash_display_MovieClip_play);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_framesLoaded, &flash_display_MovieClip_framesLoaded);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_scenes, &flash_display_MovieClip_scenes);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_addFrameScript, &flash_display_MovieClip_addFrameScript);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_currentLabel, &flash_display_MovieClip_currentLabel);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_prevFrame, &flash_display_MovieClip_prevFrame);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_gotoAndStop, &flash_display_MovieClip_gotoAndStop);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_currentFrame, &flash_display_MovieClip_currentFrame);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_nextScene, &flash_display_MovieClip_nextScene);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_totalFrames, &flash_display_MovieClip_totalFrames);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_trackAsMenu, &flash_display_MovieClip_trackAsMenu);
-    dict_put(&flash_display_MovieClip.members, &flash_display_MovieClip_stop, &flash_display_MovieClip_stop);
-    dict_put(d, &flash_display_BitmapData, &flash_display_BitmapData);
-    dict_init2(&flash_display_BitmapData.members, &memberinfo_type, 63);
-    dict_init2(&flash_display_BitmapData.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_getPixel32, &flash_display_BitmapData_getPixel32);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_draw, &flash_display_BitmapData_draw);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_setPixels, &flash_display_BitmapData_setPixels);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_copyPixels, &flash_display_BitmapData_copyPixels);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_histogram, &flash_display_BitmapData_histogram);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_scroll, &flash_display_BitmapData_scroll);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_transparent, &flash_display_BitmapData_transparent);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_noise, &flash_display_BitmapData_noise);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_threshold, &flash_display_BitmapData_threshold);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_paletteMap, &flash_display_BitmapData_paletteMap);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_perlinNoise, &flash_display_BitmapData_perlinNoise);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_hitTest, &flash_display_BitmapData_hitTest);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_getPixel, &flash_display_BitmapData_getPixel);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_unlock, &flash_display_BitmapData_unlock);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_height, &flash_display_BitmapData_height);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_copyChannel, &flash_display_BitmapData_copyChannel);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_width, &flash_display_BitmapData_width);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_clone, &flash_display_BitmapData_clone);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_colorTransform, &flash_display_BitmapData_colorTransform);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_generateFilterRect, &flash_display_BitmapData_generateFilterRect);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_compare, &flash_display_BitmapData_compare);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_fillRect, &flash_display_BitmapData_fillRect);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_setVector, &flash_display_BitmapData_setVector);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_floodFill, &flash_display_BitmapData_floodFill);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_pixelDissolve, &flash_display_BitmapData_pixelDissolve);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_setPixel, &flash_display_BitmapData_setPixel);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_setPixel32, &flash_display_BitmapData_setPixel32);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_lock, &flash_display_BitmapData_lock);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_getVector, &flash_display_BitmapData_getVector);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_getColorBoundsRect, &flash_display_BitmapData_getColorBoundsRect);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_getPixels, &flash_display_BitmapData_getPixels);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_merge, &flash_display_BitmapData_merge);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_rect, &flash_display_BitmapData_rect);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_applyFilter, &flash_display_BitmapData_applyFilter);
-    dict_put(&flash_display_BitmapData.members, &flash_display_BitmapData_dispose, &flash_display_BitmapData_dispose);
-    dict_put(d, &flash_text_engine_LigatureLevel, &flash_text_engine_LigatureLevel);
-    dict_init2(&flash_text_engine_LigatureLevel.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_LigatureLevel.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_LigatureLevel.static_members, &flash_text_engine_LigatureLevel_UNCOMMON, &flash_text_engine_LigatureLevel_UNCOMMON);
-    dict_put(&flash_text_engine_LigatureLevel.static_members, &flash_text_engine_LigatureLevel_COMMON, &flash_text_engine_LigatureLevel_COMMON);
-    dict_put(&flash_text_engine_LigatureLevel.static_members, &flash_text_engine_LigatureLevel_EXOTIC, &flash_text_engine_LigatureLevel_EXOTIC);
-    dict_put(&flash_text_engine_LigatureLevel.static_members, &flash_text_engine_LigatureLevel_MINIMUM, &flash_text_engine_LigatureLevel_MINIMUM);
-    dict_put(&flash_text_engine_LigatureLevel.static_members, &flash_text_engine_LigatureLevel_NONE, &flash_text_engine_LigatureLevel_NONE);
-    dict_put(d, &_Infinity, &_Infinity);
-    dict_put(d, &flash_text_engine_FontDescription, &flash_text_engine_FontDescription);
-    dict_init2(&flash_text_engine_FontDescription.members, &memberinfo_type, 15);
-    dict_init2(&flash_text_engine_FontDescription.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_FontDescription.members, &flash_text_engine_FontDescription_renderingMode, &flash_text_engine_FontDescription_renderingMode);
-    dict_put(&flash_text_engine_FontDescription.members, &flash_text_engine_FontDescription_cffHinting, &flash_text_engine_FontDescription_cffHinting);
-    dict_put(&flash_text_engine_FontDescription.members, &flash_text_engine_FontDescription_fontPosture, &flash_text_engine_FontDescription_fontPosture);
-    dict_put(&flash_text_engine_FontDescription.members, &flash_text_engine_FontDescription_fontName, &flash_text_engine_FontDescription_fontName);
-    dict_put(&flash_text_engine_FontDescription.members, &flash_text_engine_FontDescription_fontLookup, &flash_text_engine_FontDescription_fontLookup);
-    dict_put(&flash_text_engine_FontDescription.members, &flash_text_engine_FontDescription_locked, &flash_text_engine_FontDescription_locked);
-    dict_put(&flash_text_engine_FontDescription.members, &flash_text_engine_FontDescription_fontWeight, &flash_text_engine_FontDescription_fontWeight);
-    dict_put(&flash_text_engine_FontDescription.members, &flash_text_engine_FontDescription_clone, &flash_text_engine_FontDescription_clone);
-    dict_put(&flash_text_engine_FontDescription.static_members, &flash_text_engine_FontDescription_isFontCompatible, &flash_text_engine_FontDescription_isFontCompatible);
-    dict_put(d, &flash_text_engine_TextElement, &flash_text_engine_TextElement);
-    dict_init2(&flash_text_engine_TextElement.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TextElement.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextElement.members, &flash_text_engine_TextElement_replaceText, &flash_text_engine_TextElement_replaceText);
-    dict_put(d, &flash_display_SWFVersion, &flash_display_SWFVersion);
-    dict_init2(&flash_display_SWFVersion.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_SWFVersion.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH4, &flash_display_SWFVersion_FLASH4);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH7, &flash_display_SWFVersion_FLASH7);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH8, &flash_display_SWFVersion_FLASH8);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH3, &flash_display_SWFVersion_FLASH3);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH6, &flash_display_SWFVersion_FLASH6);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH9, &flash_display_SWFVersion_FLASH9);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH2, &flash_display_SWFVersion_FLASH2);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH5, &flash_display_SWFVersion_FLASH5);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH10, &flash_display_SWFVersion_FLASH10);
-    dict_put(&flash_display_SWFVersion.static_members, &flash_display_SWFVersion_FLASH1, &flash_display_SWFVersion_FLASH1);
-    dict_put(d, &flash_net_URLLoader, &flash_net_URLLoader);
-    dict_init2(&flash_net_URLLoader.members, &memberinfo_type, 8);
-    dict_init2(&flash_net_URLLoader.static_members, &memberinfo_type, 8);
-    dict_put(&flash_net_URLLoader.members, &flash_net_URLLoader_close, &flash_net_URLLoader_close);
-    dict_put(&flash_net_URLLoader.members, &flash_net_URLLoader_bytesLoaded, &flash_net_URLLoader_bytesLoaded);
-    dict_put(&flash_net_URLLoader.members, &flash_net_URLLoader_load, &flash_net_URLLoader_load);
-    dict_put(&flash_net_URLLoader.members, &flash_net_URLLoader_bytesTotal, &flash_net_URLLoader_bytesTotal);
-    dict_put(&flash_net_URLLoader.members, &flash_net_URLLoader_dataFormat, &flash_net_URLLoader_dataFormat);
-    dict_put(&flash_net_URLLoader.members, &flash_net_URLLoader_data, &flash_net_URLLoader_data);
-    dict_put(d, &flash_geom_Matrix, &flash_geom_Matrix);
-    dict_init2(&flash_geom_Matrix.members, &memberinfo_type, 31);
-    dict_init2(&flash_geom_Matrix.static_members, &memberinfo_type, 8);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_b, &flash_geom_Matrix_b);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_deltaTransformPoint, &flash_geom_Matrix_deltaTransformPoint);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_identity, &flash_geom_Matrix_identity);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_ty, &flash_geom_Matrix_ty);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_translate, &flash_geom_Matrix_translate);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_concat, &flash_geom_Matrix_concat);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_c, &flash_geom_Matrix_c);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_a, &flash_geom_Matrix_a);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_scale, &flash_geom_Matrix_scale);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_d, &flash_geom_Matrix_d);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_transformPoint, &flash_geom_Matrix_transformPoint);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_rotate, &flash_geom_Matrix_rotate);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_createGradientBox, &flash_geom_Matrix_createGradientBox);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_toString, &flash_geom_Matrix_toString);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_invert, &flash_geom_Matrix_invert);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_clone, &flash_geom_Matrix_clone);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_tx, &flash_geom_Matrix_tx);
-    dict_put(&flash_geom_Matrix.members, &flash_geom_Matrix_createBox, &flash_geom_Matrix_createBox);
-    dict_put(d, &flash_accessibility_Accessibility, &flash_accessibility_Accessibility);
-    dict_init2(&flash_accessibility_Accessibility.members, &memberinfo_type, 8);
-    dict_init2(&flash_accessibility_Accessibility.static_members, &memberinfo_type, 8);
-    dict_put(&flash_accessibility_Accessibility.static_members, &flash_accessibility_Accessibility_active, &flash_accessibility_Accessibility_active);
-    dict_put(&flash_accessibility_Accessibility.static_members, &flash_accessibility_Accessibility_updateProperties, &flash_accessibility_Accessibility_updateProperties);
-    dict_put(&flash_accessibility_Accessibility.static_members, &flash_accessibility_Accessibility_sendEvent, &flash_accessibility_Accessibility_sendEvent);
-    dict_put(d, &flash_net_sendToURL, &flash_net_sendToURL);
-    dict_put(d, &flash_filters_GlowFilter, &flash_filters_GlowFilter);
-    dict_init2(&flash_filters_GlowFilter.members, &memberinfo_type, 8);
-    dict_init2(&flash_filters_GlowFilter.static_members, &memberinfo_type, 8);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_blurY, &flash_filters_GlowFilter_blurY);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_strength, &flash_filters_GlowFilter_strength);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_inner, &flash_filters_GlowFilter_inner);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_color, &flash_filters_GlowFilter_color);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_clone, &flash_filters_GlowFilter_clone);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_quality, &flash_filters_GlowFilter_quality);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_knockout, &flash_filters_GlowFilter_knockout);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_alpha, &flash_filters_GlowFilter_alpha);
-    dict_put(&flash_filters_GlowFilter.members, &flash_filters_GlowFilter_blurX, &flash_filters_GlowFilter_blurX);
-    dict_put(d, &flash_events_FullScreenEvent, &flash_events_FullScreenEvent);
-    dict_init2(&flash_events_FullScreenEvent.members, &memberinfo_type, 8);
-    dict_init2(&flash_events_FullScreenEvent.static_members, &memberinfo_type, 8);
-    dict_put(&flash_events_FullScreenEvent.members, &flash_events_FullScreenEvent_toString, &flash_events_FullScreenEvent_toString);
-    dict_put(&flash_events_FullScreenEvent.members, &flash_events_FullScreenEvent_clone, &flash_events_FullScreenEvent_clone);
-    dict_put(&flash_events_FullScreenEvent.members, &flash_events_FullScreenEvent_fullScreen, &flash_events_FullScreenEvent_fullScreen);
-    dict_put(&flash_events_FullScreenEvent.static_members, &flash_events_FullScreenEvent_FULL_SCREEN, &flash_events_FullScreenEvent_FULL_SCREEN);
-    dict_put(d, &flash_display_StageDisplayState, &flash_display_StageDisplayState);
-    dict_init2(&flash_display_StageDisplayState.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_StageDisplayState.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_StageDisplayState.static_members, &flash_display_StageDisplayState_NORMAL, &flash_display_StageDisplayState_NORMAL);
-    dict_put(&flash_display_StageDisplayState.static_members, &flash_display_StageDisplayState_FULL_SCREEN, &flash_display_StageDisplayState_FULL_SCREEN);
-    dict_put(d, &flash_text_engine_TextJustifier, &flash_text_engine_TextJustifier);
-    dict_init2(&flash_text_engine_TextJustifier.members, &memberinfo_type, 8);
-    dict_init2(&flash_text_engine_TextJustifier.static_members, &memberinfo_type, 8);
-    dict_put(&flash_text_engine_TextJustifier.members, &flash_text_engine_TextJustifier_lineJustification, &flash_text_engine_TextJustifier_lineJustification);
-    dict_put(&flash_text_engine_TextJustifier.members, &flash_text_engine_TextJustifier_locale, &flash_text_engine_TextJustifier_locale);
-    dict_put(&flash_text_engine_TextJustifier.members, &flash_text_engine_TextJustifier_clone, &flash_text_engine_TextJustifier_clone);
-    dict_put(&flash_text_engine_TextJustifier.static_members, &flash_text_engine_TextJustifier_getJustifierForLocale, &flash_text_engine_TextJustifier_getJustifierForLocale);
-    dict_put(d, &flash_display_StageAlign, &flash_display_StageAlign);
-    dict_init2(&flash_display_StageAlign.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_StageAlign.static_members, &memberinfo_type, 15);
-    dict_put(&flash_display_StageAlign.static_members, &flash_display_StageAlign_RIGHT, &flash_display_StageAlign_RIGHT);
-    dict_put(&flash_display_StageAlign.static_members, &flash_display_StageAlign_BOTTOM, &flash_display_StageAlign_BOTTOM);
-    dict_put(&flash_display_StageAlign.static_members, &flash_display_StageAlign_BOTTOM_LEFT, &flash_display_StageAlign_BOTTOM_LEFT);
-    dict_put(&flash_display_StageAlign.static_members, &flash_display_StageAlign_TOP_RIGHT, &flash_display_StageAlign_TOP_RIGHT);
-    dict_put(&flash_display_StageAlign.static_members, &flash_display_StageAlign_TOP, &flash_display_StageAlign_TOP);
-    dict_put(&flash_display_StageAlign.static_members, &flash_display_StageAlign_LEFT, &flash_display_StageAlign_LEFT);
-    dict_put(&flash_display_StageAlign.static_members, &flash_display_StageAlign_BOTTOM_RIGHT, &flash_display_StageAlign_BOTTOM_RIGHT);
-    dict_put(&flash_display_StageAlign.static_members, &flash_display_StageAlign_TOP_LEFT, &flash_display_StageAlign_TOP_LEFT);
-    dict_put(d, &_NaN, &_NaN);
-    dict_put(d, &_ReferenceError, &_ReferenceError);
-    dict_init2(&_ReferenceError.members, &memberinfo_type, 8);
-    dict_init2(&_ReferenceError.static_members, &memberinfo_type, 8);
-    dict_put(&_ReferenceError.static_members, &_ReferenceError_length, &_ReferenceError_length);
-    dict_put(d, &flash_display_Shape, &flash_display_Shape);
-    dict_init2(&flash_display_Shape.members, &memberinfo_type, 8);
-    dict_init2(&flash_display_Shape.static_members, &memberinfo_type, 8);
-    dict_put(&flash_display_Shape.members, &flash_display_Shape_graphics, &flash_display_Shape_graphics);
     _NaN_constant.f =  __builtin_nan("");
     _Infinity_constant.f = __builtin_inf();
-    return d;
+    *num = sizeof(builtins)/sizeof(builtins[0]);
+    return builtins;
 }
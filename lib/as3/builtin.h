@@ -28,6 +28,16 @@
 #include "../types.h"
 #include "registry.h"
 
-dict_t* builtin_getclasses();
+typedef struct _builtin {
+    const char*package;
+    const char*name;
+    slotinfo_t*slot;
+    /* 0-terminated, or 0 if the class has no (static) members */
+    slotinfo_t*const*members;
+    slotinfo_t*const*static_members;
+} builtin_t;
+
+/* all builtin classes, methods and variables, sorted by package and name */
+const builtin_t* builtin_getclasses(int*num);
 
 #endif
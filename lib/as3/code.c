@@ -764,7 +764,7 @@ static char callcode(currentstats_t*stats, int pos, int stack, int scope)
                     handleregister(stats, (ptroff_t)c->data[pos]);
                     ok = 1;
                 }
-                p++;
+                p++;pos++;
             }
             if(!ok) {
                 handleregister(stats, c->opcode&3);
@@ -1302,3 +1302,461 @@ code_t* cut_last_push(code_t*c)
 }
 
 
+/* ------------------------------ optimizer ------------------------------ */
+
+/* Peephole optimizations on the code of a single method body.
+   (see optimizations.txt)
+   Instructions which are jumped to (branch, lookupswitch and exception
+   handler targets, as well as exception range boundaries) are never
+   removed, and no pattern is matched across them. */
+
+#define IS_TARGET(c) dict_contains(targets, (c))
+
+static void add_target(dict_t*targets, code_t*c)
+{
+    if(c && !dict_contains(targets, c))
+        dict_put(targets, c, c);
+}
+
+/* collects all jump targets, and numbers the instructions (in c->pos) */
+static dict_t* collect_targets(code_t*code, abc_exception_list_t*exceptions)
+{
+    dict_t*targets = dict_new2(&ptr_type);
+    code_t*c;
+    int pos = 0;
+    for(c=code;c;c=c->next) {
+        c->pos = pos++;
+        opcode_t*op = opcode_get(c->opcode);
+        if(op->flags & (OP_BRANCH|OP_JUMP)) {
+            add_target(targets, c->branch);
+        } else if(op->flags & OP_LOOKUPSWITCH) {
+            lookupswitch_t*l = (lookupswitch_t*)c->data[0];
+            add_target(targets, l->def);
+            code_list_t*t;
+            for(t=l->targets;t;t=t->next)
+                add_target(targets, t->code);
+        }
+    }
+    abc_exception_list_t*e;
+    for(e=exceptions;e;e=e->next) {
+        add_target(targets, e->abc_exception->from);
+        add_target(targets, e->abc_exception->to);
+        add_target(targets, e->abc_exception->target);
+    }
+    return targets;
+}
+
+static code_t* remove_code(code_t**start, code_t*c)
+{
+    code_t*next = c->next;
+    if(c->prev)
+        c->prev->next = next;
+    else
+        *start = next;
+    if(next)
+        next->prev = c->prev;
+    c->prev = c->next = 0;
+    code_free(c);
+    return next;
+}
+
+static char is_noop(code_t*c)
+{
+    return c->opcode == OPCODE_LABEL || c->opcode == OPCODE_NOP;
+}
+
+/* pushes a value without any side effects */
+static char is_pure_push(code_t*c)
+{
+    switch(c->opcode) {
+        case OPCODE_PUSHBYTE: case OPCODE_PUSHSHORT: case OPCODE_PUSHINT:
+        case OPCODE_PUSHUINT: case OPCODE_PUSHDOUBLE: case OPCODE_PUSHNAN:
+        case OPCODE_PUSHNULL: case OPCODE_PUSHUNDEFINED: case OPCODE_PUSHTRUE:
+        case OPCODE_PUSHFALSE: case OPCODE_PUSHSTRING: case OPCODE_PUSHNAMESPACE:
+        case OPCODE_GETLOCAL: case OPCODE_DUP:
+        case OPCODE_GETGLOBALSCOPE: case OPCODE_GETSCOPEOBJECT:
+            return 1;
+    }
+    return 0;
+}
+
+static char is_return(code_t*c)
+{
+    return c && (c->opcode == OPCODE_RETURNVOID || c->opcode == OPCODE_RETURNVALUE);
+}
+
+/* the branch which does the same as "compare;iftrue" (or iffalse, if negate is set) */
+static U8 fused_branch(U8 compare, char negate)
+{
+    switch(compare) {
+        case OPCODE_EQUALS: return negate?OPCODE_IFNE:OPCODE_IFEQ;
+        case OPCODE_STRICTEQUALS: return negate?OPCODE_IFSTRICTNE:OPCODE_IFSTRICTEQ;
+        case OPCODE_LESSTHAN: return negate?OPCODE_IFNLT:OPCODE_IFLT;
+        case OPCODE_LESSEQUALS: return negate?OPCODE_IFNLE:OPCODE_IFLE;
+        case OPCODE_GREATERTHAN: return negate?OPCODE_IFNGT:OPCODE_IFGT;
+        case OPCODE_GREATEREQUALS: return negate?OPCODE_IFNGE:OPCODE_IFGE;
+    }
+    return 0;
+}
+
+static U8 inverted_branch(U8 branch)
+{
+    switch(branch) {
+        case OPCODE_IFTRUE: return OPCODE_IFFALSE;
+        case OPCODE_IFFALSE: return OPCODE_IFTRUE;
+        case OPCODE_IFEQ: return OPCODE_IFNE;
+        case OPCODE_IFNE: return OPCODE_IFEQ;
+        case OPCODE_IFSTRICTEQ: return OPCODE_IFSTRICTNE;
+        case OPCODE_IFSTRICTNE: return OPCODE_IFSTRICTEQ;
+        case OPCODE_IFLT: return OPCODE_IFNLT;
+        case OPCODE_IFNLT: return OPCODE_IFLT;
+        case OPCODE_IFLE: return OPCODE_IFNLE;
+        case OPCODE_IFNLE: return OPCODE_IFLE;
+        case OPCODE_IFGT: return OPCODE_IFNGT;
+        case OPCODE_IFNGT: return OPCODE_IFGT;
+        case OPCODE_IFGE: return OPCODE_IFNGE;
+        case OPCODE_IFNGE: return OPCODE_IFGE;
+    }
+    return 0;
+}
+
+/* does control flow from c's successor reach target without executing anything? */
+static char falls_through_to(code_t*c, code_t*target)
+{
+    code_t*n = c->next;
+    while(n && n != target && is_noop(n))
+        n = n->next;
+    return n && n == target;
+}
+
+/* Redirect jumps and branches which go to a jump, and skip labels and nops
+   at forward targets. The verifier wants backward branches to go to a label
+   instruction, so a new backward target needs to be one. */
+static char thread_jumps(code_t*code, dict_t*targets)
+{
+    char changed = 0;
+    code_t*c;
+    for(c=code;c;c=c->next) {
+        opcode_t*op = opcode_get(c->opcode);
+        if(!(op->flags & (OP_BRANCH|OP_JUMP)) || !c->branch)
+            continue;
+        code_t*t = c->branch;
+        int hops = 0;
+        while(1) {
+            code_t*u = t;
+            while(u && is_noop(u))
+                u = u->next;
+            if(!u)
+                break;
+            code_t*newtarget = 0;
+            if(u->pos > c->pos) {
+                newtarget = u;
+            } else {
+                /* backward: the last label before u */
+                code_t*l;
+                for(l=t;l!=u;l=l->next) {
+                    if(l->opcode == OPCODE_LABEL)
+                        newtarget = l;
+                }
+            }
+            if(newtarget && newtarget != c->branch) {
+                c->branch = newtarget;
+                add_target(targets, newtarget);
+                changed = 1;
+            }
+            if(u->opcode != OPCODE_JUMP || u == c || !u->branch || ++hops > 16)
+                break;
+            t = u->branch;
+        }
+    }
+    return changed;
+}
+
+/* removes code behind jumps, returns and throws which can't be reached */
+static char remove_dead_code(code_t**code, dict_t*targets)
+{
+    char changed = 0;
+    code_t*c;
+    for(c=*code;c;c=c->next) {
+        opcode_t*op = opcode_get(c->opcode);
+        if(!(op->flags & (OP_JUMP|OP_RETURN|OP_THROW|OP_LOOKUPSWITCH)))
+            continue;
+        while(c->next && !IS_TARGET(c->next)) {
+            remove_code(code, c->next);
+            changed = 1;
+        }
+    }
+    return changed;
+}
+
+static char peephole(code_t**code, dict_t*targets)
+{
+    char changed = 0;
+    code_t*c = *code;
+    while(c) {
+        code_t*n = c->next;
+        code_t*n2 = n?n->next:0;
+        U8 op2 = n?n->opcode:0;
+        U8 op3 = n2?n2->opcode:0;
+        code_t*next = c->next;
+        char match = 1;
+
+        if(is_noop(c) && !IS_TARGET(c)) {
+            /* label;  (nobody jumps here) */
+            next = remove_code(code, c);
+        } else if(is_pure_push(c) && op2 == OPCODE_POP && !IS_TARGET(c) && !IS_TARGET(n)) {
+            /* push;pop */
+            remove_code(code, c);
+            next = remove_code(code, n);
+        } else if(c->opcode == OPCODE_COERCE_A && (op2 == OPCODE_POP || op2 == OPCODE_RETURNVALUE) && !IS_TARGET(c)) {
+            /* coerce_a;pop  coerce_a;returnvalue */
+            next = remove_code(code, c);
+        } else if(c->opcode == OPCODE_KILL && is_return(n) && !IS_TARGET(c)) {
+            /* kill;return */
+            next = remove_code(code, c);
+        } else if((c->opcode == OPCODE_CALLPROPERTY || c->opcode == OPCODE_CALLSUPER) && op2 == OPCODE_POP && !IS_TARGET(n)) {
+            /* callproperty;pop -> callpropvoid */
+            c->opcode = c->opcode == OPCODE_CALLPROPERTY?OPCODE_CALLPROPVOID:OPCODE_CALLSUPERVOID;
+            remove_code(code, n);
+            next = c;
+        } else if(c->opcode == OPCODE_GETLOCAL && op2 == OPCODE_SETLOCAL && 
+                  c->data[0] == n->data[0] && !IS_TARGET(c) && !IS_TARGET(n)) {
+            /* getlocal_i;setlocal_i */
+            remove_code(code, c);
+            next = remove_code(code, n);
+        } else if(c->opcode == OPCODE_SETLOCAL && op2 == OPCODE_GETLOCAL && 
+                  c->data[0] == n->data[0] && !IS_TARGET(n)) {
+            /* setlocal_i;getlocal_i -> dup;setlocal_i */
+            c->opcode = OPCODE_DUP;
+            n->opcode = OPCODE_SETLOCAL;
+            n->data[0] = c->data[0];
+            c->data[0] = 0;
+            next = n2;
+        } else if(c->opcode == OPCODE_DUP && op3 == OPCODE_POP &&
+                  (op2 == OPCODE_SETLOCAL || op2 == OPCODE_SETGLOBALSLOT || op2 == OPCODE_PUSHSCOPE) &&
+                  !IS_TARGET(c) && !IS_TARGET(n) && !IS_TARGET(n2)) {
+            /* dup;setlocal_i;pop -> setlocal_i */
+            remove_code(code, c);
+            remove_code(code, n2);
+            next = n;
+        } else if(c->opcode == OPCODE_GETLOCAL && n2 && !IS_TARGET(n) && !IS_TARGET(n2) &&
+                  (op2 == OPCODE_INCREMENT || op2 == OPCODE_INCREMENT_I || 
+                   op2 == OPCODE_DECREMENT || op2 == OPCODE_DECREMENT_I) &&
+                  ((op3 == OPCODE_SETLOCAL && c->data[0] == n2->data[0]) ||
+                   (op3 == OPCODE_COERCE_A && n2->next && !IS_TARGET(n2->next) &&
+                    n2->next->opcode == OPCODE_SETLOCAL && c->data[0] == n2->next->data[0]))) {
+            /* getlocal_i;increment;(coerce_a);setlocal_i -> inclocal_i */
+            switch(op2) {
+                case OPCODE_INCREMENT: c->opcode = OPCODE_INCLOCAL;break;
+                case OPCODE_INCREMENT_I: c->opcode = OPCODE_INCLOCAL_I;break;
+                case OPCODE_DECREMENT: c->opcode = OPCODE_DECLOCAL;break;
+                case OPCODE_DECREMENT_I: c->opcode = OPCODE_DECLOCAL_I;break;
+            }
+            remove_code(code, n);
+            if(op3 == OPCODE_COERCE_A)
+                remove_code(code, n2->next);
+            remove_code(code, n2);
+            next = c;
+        } else if(fused_branch(c->opcode, 0) && (op2 == OPCODE_IFTRUE || op2 == OPCODE_IFFALSE) && !IS_TARGET(n)) {
+            /* greaterthan;iftrue -> ifgt */
+            c->opcode = fused_branch(c->opcode, op2 == OPCODE_IFFALSE);
+            c->branch = n->branch;
+            remove_code(code, n);
+            next = c;
+        } else if(inverted_branch(c->opcode) && op2 == OPCODE_JUMP && !IS_TARGET(n) &&
+                  n->branch && n->branch != c && n->branch != n && falls_through_to(n, c->branch)) {
+            /* iffalse xx;jump yy;xx: -> iftrue yy */
+            c->opcode = inverted_branch(c->opcode);
+            c->branch = n->branch;
+            remove_code(code, n);
+            next = c;
+        } else if(c->opcode == OPCODE_JUMP && !IS_TARGET(c) && c->branch && falls_through_to(c, c->branch)) {
+            /* jump next;next: */
+            next = remove_code(code, c);
+        } else if(c->opcode == OPCODE_JUMP && c->branch) {
+            /* jump xx; xx:returnvoid -> returnvoid */
+            code_t*t = c->branch;
+            while(t && is_noop(t))
+                t = t->next;
+            if(is_return(t)) {
+                c->opcode = t->opcode;
+                c->branch = 0;
+            } else {
+                match = 0;
+            }
+        } else {
+            match = 0;
+        }
+
+        if(match) {
+            changed = 1;
+            /* the instruction before might now be part of a new pattern */
+            if(next && next->prev)
+                next = next->prev;
+        }
+        c = next;
+    }
+    return changed;
+}
+
+static int get_register(code_t*c)
+{
+    if(c->opcode >= OPCODE_GETLOCAL_0 && c->opcode <= OPCODE_GETLOCAL_3)
+        return c->opcode - OPCODE_GETLOCAL_0;
+    if(c->opcode >= OPCODE_SETLOCAL_0 && c->opcode <= OPCODE_SETLOCAL_3)
+        return c->opcode - OPCODE_SETLOCAL_0;
+    return (ptroff_t)c->data[0];
+}
+
+/* get rid of writes to registers which are never read */
+static char remove_dead_stores(code_t**code, dict_t*targets)
+{
+    int max = 0;
+    code_t*c;
+    for(c=*code;c;c=c->next) {
+        opcode_t*op = opcode_get(c->opcode);
+        if(op->flags & OP_REGISTER) {
+            int reg = get_register(c);
+            if(reg+1 > max) max = reg+1;
+            if(c->opcode == OPCODE_HASNEXT2 && (ptroff_t)c->data[1]+1 > max)
+                max = (ptroff_t)c->data[1]+1;
+        }
+    }
+    char*read = rfx_calloc(max+1);
+    for(c=*code;c;c=c->next) {
+        opcode_t*op = opcode_get(c->opcode);
+        if(!(op->flags & OP_REGISTER))
+            continue;
+        if(c->opcode == OPCODE_HASNEXT2) {
+            read[(ptroff_t)c->data[0]] = read[(ptroff_t)c->data[1]] = 1;
+        } else if(c->opcode != OPCODE_SETLOCAL && c->opcode != OPCODE_KILL) {
+            read[get_register(c)] = 1;
+        }
+    }
+    char changed = 0;
+    c = *code;
+    while(c) {
+        if(c->opcode == OPCODE_SETLOCAL && !read[get_register(c)]) {
+            c->opcode = OPCODE_POP;
+            c->data[0] = 0;
+            changed = 1;
+        } else if(c->opcode == OPCODE_KILL && !read[get_register(c)] && !IS_TARGET(c)) {
+            c = remove_code(code, c);
+            changed = 1;
+            continue;
+        }
+        c = c->next;
+    }
+    free(read);
+    return changed;
+}
+
+typedef struct _regusage {
+    int reg;
+    int count;
+} regusage_t;
+
+static int compare_regusage(const void*_a, const void*_b)
+{
+    const regusage_t*a = (const regusage_t*)_a;
+    const regusage_t*b = (const regusage_t*)_b;
+    if(a->count != b->count)
+        return b->count - a->count;
+    return a->reg - b->reg;
+}
+
+/* Give the most used local variables the lowest register numbers (so that
+   more of them can use getlocal_i/setlocal_i), and close gaps left by
+   removed variables. Parameter registers stay where they are. */
+static void renumber_registers(code_t*code, int fixed)
+{
+    int max = 0;
+    code_t*c;
+    for(c=code;c;c=c->next) {
+        /* debug instructions refer to registers, too */
+        if(c->opcode == OPCODE_DEBUG)
+            return;
+        opcode_t*op = opcode_get(c->opcode);
+        if(op->flags & OP_REGISTER) {
+            int reg = get_register(c);
+            if(reg+1 > max) max = reg+1;
+            if(c->opcode == OPCODE_HASNEXT2 && (ptroff_t)c->data[1]+1 > max)
+                max = (ptroff_t)c->data[1]+1;
+        }
+    }
+    if(max <= fixed)
+        return;
+
+    regusage_t*usage = rfx_calloc(sizeof(regusage_t)*max);
+    int t;
+    for(t=0;t<max;t++)
+        usage[t].reg = t;
+    for(c=code;c;c=c->next) {
+        opcode_t*op = opcode_get(c->opcode);
+        if(op->flags & OP_REGISTER) {
+            usage[get_register(c)].count++;
+            if(c->opcode == OPCODE_HASNEXT2)
+                usage[(ptroff_t)c->data[1]].count++;
+        }
+    }
+    qsort(usage+fixed, max-fixed, sizeof(regusage_t), compare_regusage);
+    int*map = rfx_calloc(sizeof(int)*max);
+    for(t=0;t<max;t++)
+        map[usage[t].reg] = t;
+    for(c=code;c;c=c->next) {
+        opcode_t*op = opcode_get(c->opcode);
+        if(op->flags & OP_REGISTER) {
+            /* registers are in long form (getlocal <i>) at this point */
+            c->data[0] = (void*)(ptroff_t)map[(ptroff_t)c->data[0]];
+            if(c->opcode == OPCODE_HASNEXT2)
+                c->data[1] = (void*)(ptroff_t)map[(ptroff_t)c->data[1]];
+        }
+    }
+    free(map);
+    free(usage);
+}
+
+code_t* code_optimize(code_t*code, abc_exception_list_t*exceptions, int fixed_registers)
+{
+    code = code_start(code);
+    code_t*c;
+
+    /* getlocal_i -> getlocal <i>, so that patterns only need to check one opcode */
+    for(c=code;c;c=c->next) {
+        if(c->opcode >= OPCODE_GETLOCAL_0 && c->opcode <= OPCODE_GETLOCAL_3) {
+            c->data[0] = (void*)(ptroff_t)(c->opcode - OPCODE_GETLOCAL_0);
+            c->opcode = OPCODE_GETLOCAL;
+        } else if(c->opcode >= OPCODE_SETLOCAL_0 && c->opcode <= OPCODE_SETLOCAL_3) {
+            c->data[0] = (void*)(ptroff_t)(c->opcode - OPCODE_SETLOCAL_0);
+            c->opcode = OPCODE_SETLOCAL;
+        }
+    }
+
+    int pass;
+    for(pass=0;pass<32;pass++) {
+        char changed = 0;
+        dict_t*targets = collect_targets(code, exceptions);
+        changed |= thread_jumps(code, targets);
+        changed |= peephole(&code, targets);
+        changed |= remove_dead_code(&code, targets);
+        changed |= remove_dead_stores(&code, targets);
+        dict_destroy(targets);
+        if(!changed)
+            break;
+    }
+
+    renumber_registers(code, fixed_registers);
+
+    /* getlocal <i> -> getlocal_i for i<4 */
+    for(c=code;c;c=c->next) {
+        int reg = (ptroff_t)c->data[0];
+        if(c->opcode == OPCODE_GETLOCAL && reg < 4) {
+            c->opcode = OPCODE_GETLOCAL_0 + reg;
+            c->data[0] = 0;
+        } else if(c->opcode == OPCODE_SETLOCAL && reg < 4) {
+            c->opcode = OPCODE_SETLOCAL_0 + reg;
+            c->data[0] = 0;
+        }
+    }
+    return code_end(code);
+}
@@ -104,6 +104,8 @@ code_t* cut_last_push(code_t*_c);
 
 char is_getlocal(code_t*c);
 
+code_t* code_optimize(code_t*code, abc_exception_list_t*exceptions, int fixed_registers);
+
 #define code_new() (0)
 
 #endif
@@ -43,6 +43,7 @@ extern int as3_lex();
 extern int as3_lex_destroy();
 
 static char config_recurse = 0;
+static char config_optimize = 0;
 
 void as3_setverbosity(int level)
 {
@@ -57,6 +58,9 @@ void as3_set_option(const char*key, const char*value)
     if(!strcmp(key, "recurse")) {
         config_recurse=atoi(value);
     }
+    if(!strcmp(key, "optimize")) {
+        config_optimize=atoi(value);
+    }
 }
 
 static char registry_initialized = 0;
@@ -238,6 +242,7 @@ char as3_schedule_directory(const char*dirname)
     while(i) {
         char*fulldirname = concat_paths(i->path, dirname);
         DEBUG printf("[pass %d] ... %s\n", as3_pass, fulldirname);
+        add_dependency(fulldirname);
         DIR*dir = opendir(fulldirname);
         if(dir) {
             ok = 1;
@@ -341,6 +346,8 @@ void* as3_getcode()
     if(parser_initialized) {
         parser_initialized = 0;
         as3code = finish_parser();
+        if(config_optimize && as3code)
+            abc_file_optimize((abc_file_t*)as3code);
     }
     return as3code;
 }
@@ -348,6 +355,14 @@ void* as3_getassets(void*t)
 {
     return swf_AssetsToTags((TAG*)t, registry_getassets());
 }
+void as3_getdependencies(void (*f)(void*data, const char*path, uint64_t state), void*data)
+{
+    list_dependencies(f, data);
+}
+uint64_t as3_path_state(const char*path)
+{
+    return path_state(path);
+}
 char* as3_getglobalclass()
 {
     return as3_globalclass;
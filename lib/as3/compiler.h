@@ -24,6 +24,8 @@
 #ifndef __as3_compiler_h__
 #define __as3_compiler_h__
 
+#include <stdint.h>
+
 void registry_init();
 
 void as3_setverbosity(int level);
@@ -44,6 +46,10 @@ void as3_schedule_class_noerror(const char*package, const char*cls);
 void as3_warning(const char*format, ...);
 char* as3_getglobalclass();
 void* as3_getcode();
+/* all files and directories the compiler read or searched for, with
+   the checksum (see as3_path_state()) they had when it did so */
+void as3_getdependencies(void (*f)(void*data, const char*path, uint64_t state), void*data);
+uint64_t as3_path_state(const char*path);
 void* as3_getassets(void*);
 void as3_destroy();
 
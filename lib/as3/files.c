@@ -21,9 +21,18 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <stdarg.h>
 #include <memory.h>
 #include <errno.h>
+#include "../../config.h"
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+#include "../q.h"
 #include "files.h"
 #include "common.h"
 #include "tokenizer.h"
@@ -230,11 +239,103 @@ char* concat_paths(const char*base, const char*add)
     return n;
 }
 
+/* a checksum of a file, of the .as files in a directory, or 0 if the
+   path doesn't exist */
+uint64_t path_state(const char*path)
+{
+#ifdef HAVE_SYS_STAT_H
+    struct stat st;
+    if(stat(path, &st)<0)
+        return 0;
+    if(S_ISDIR(st.st_mode)) {
+        /* for directories, only the .as files they contain are relevant */
+        uint64_t state = 2;
+#ifdef HAVE_DIRENT_H
+        DIR*dir = opendir(path);
+        struct dirent*ent;
+        while(dir && (ent = readdir(dir))) {
+            int l = strlen(ent->d_name);
+            if(l>=4 && !strncasecmp(&ent->d_name[l-3], ".as", 3))
+                state += string_hash64(ent->d_name);
+        }
+        if(dir) closedir(dir);
+#endif
+        return state;
+    }
+#endif
+    FILE*fi = fopen(path, "rb");
+    if(!fi)
+        return 0;
+    uint64_t state = 1;
+    char buf[16384];
+    int len;
+    while((len = fread(buf, 1, sizeof(buf), fi)) > 0)
+        state = crc64_add_bytes(state, buf, len);
+    fclose(fi);
+    return state?state:1;
+}
+
+/* every path the compiler read or looked for, together with its state at
+   the time, so that a build cache can tell whether compiling again would
+   see the same input */
+typedef struct _dependency {
+    uint64_t state;
+    char read; // state is a checksum of what the compiler read
+} dependency_t;
+static dict_t*dependencies = 0;
+
+static dependency_t* new_dependency(const char*path)
+{
+    if(!dependencies)
+        dependencies = dict_new();
+    dependency_t*d = (dependency_t*)rfx_calloc(sizeof(dependency_t));
+    dict_put(dependencies, path, d);
+    return d;
+}
+
+void add_dependency(const char*path)
+{
+    if(dependencies && dict_contains(dependencies, path))
+        return;
+    new_dependency(path)->state = path_state(path);
+}
+
+/* checksums the file the compiler is about to parse, and rewinds it. If a
+   file is parsed more than once (in pass 1 and pass 2), we keep the state
+   of the first read: should the file change in between, the next
+   compile won't match it. */
+static void add_dependency_file(const char*path, FILE*fi)
+{
+    dependency_t*d = dependencies?(dependency_t*)dict_lookup(dependencies, path):0;
+    if(!d)
+        d = new_dependency(path);
+    if(d->read)
+        return;
+    uint64_t state = 1;
+    char buf[16384];
+    int len;
+    while((len = fread(buf, 1, sizeof(buf), fi)) > 0)
+        state = crc64_add_bytes(state, buf, len);
+    rewind(fi);
+    d->state = state?state:1;
+    d->read = 1;
+}
+
+void list_dependencies(void (*f)(void*data, const char*path, uint64_t state), void*data)
+{
+    if(!dependencies)
+        return;
+    DICT_ITERATE_ITEMS(dependencies, char*, path, dependency_t*, d) {
+        f(data, path, d->state);
+    }
+}
+
 char*find_file(const char*filename, char error)
 {
     include_dir_t*i = current_include_dirs;
     FILE*fi = 0;
     if(is_absolute(filename)) {
+        add_dependency(filename);
         FILE*fi = fopen(filename, "rb");
         if(fi) {
             fclose(fi);
@@ -246,6 +347,7 @@ char*find_file(const char*filename, char error)
         }
         while(i) {
             char*p = concat_paths(i->path, filename);
+            add_dependency(p);
             fi = fopen(p, "rb");
             if(fi) {
                 fclose(fi);
@@ -303,7 +405,10 @@ FILE*enter_file2(const char*name, const char*filename, void*state)
     enter_file(name, filename, state);
     FILE*fi = fopen(filename, "rb");
     if(!fi) {
+        add_dependency(filename);
 	as3_error("Couldn't find file %s: %s", filename, strerror(errno));
+    } else {
+        add_dependency_file(filename, fi);
     }
     return fi;
 }
@@ -22,6 +22,8 @@
 #ifndef __avm2_files_h__
 #define __avm2_files_h__
 
+#include <stdint.h>
+
 typedef struct _include_dir {
     char*path;
     struct _include_dir*next;
@@ -41,6 +43,10 @@ void enter_file(const char*name, const char*filename, void*state);
 FILE* enter_file2(const char*name, const char*filename, void*state);
 void* leave_file();
 
+uint64_t path_state(const char*path);
+void add_dependency(const char*path);
+void list_dependencies(void (*f)(void*data, const char*path, uint64_t state), void*data);
+
 char* concat_paths(const char*base, const char*add);
 char* normalize_path(const char*path);
 char* filename_to_lowercase(const char*name);
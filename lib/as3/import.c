@@ -25,6 +25,7 @@
 #include "common.h"
 #include "tokenizer.h"
 #include "assets.h"
+#include "files.h"
 #include "../os.h"
 #include "../xml.h"
 #ifdef HAVE_ZZIP
@@ -237,6 +238,7 @@ void as3_import_zipfile(char*filename)
 
 void as3_import_file(char*filename)
 {
+    add_dependency(filename);
     FILE*fi = fopen(filename, "rb");
     if(!fi) return;
     char head[3];
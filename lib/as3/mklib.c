@@ -31,6 +31,7 @@
 #include "parser.tab.h"
 #include "parser.h"
 #include "import.h"
+#include "builtin.h"
 
 void fixstring(char*s)
 {
@@ -112,9 +113,10 @@ static int compare_traits(const void*v1, const void*v2)
     return strcmp(x1->name->name, x2->name->name);
 }
 
-dict_t* builtin_getclasses()
+const builtin_t* builtin_getclasses(int*num)
 {
-    return dict_new2(&slotinfo_type);
+    *num = 0;
+    return 0;
 }
 
 extern dict_t*registry_classes;
@@ -150,30 +152,48 @@ void write_slotinfo_decl(FILE*fi, slotinfo_t*s, char*prefix)
 	}
     }
 }
-void write_initinfo(FILE*fi, slotinfo_t*s, char*prefix)
+static void write_memberlist(FILE*fi, char*id, dict_t*d, const char*suffix)
+{
+    if(!d->num)
+        return;
+    fprintf(fi, "static slotinfo_t* const %s_%s[] = {\n", id, suffix);
+    DICT_ITERATE_DATA(d,slotinfo_t*,s) {
+        fprintf(fi, "    (slotinfo_t*)&%s,\n", mkid2(id, s->name));
+    }
+    fprintf(fi, "    0};\n");
+}
+void write_memberlists(FILE*fi, slotinfo_t*s)
 {
     if(s->kind == INFOTYPE_CLASS) {
         classinfo_t*c = (classinfo_t*)s;
         char*id = mkid(c);
-        dict_t*d1 = &c->members;
-        dict_t*d2 = &c->static_members;
-        fprintf(fi, "%s", prefix);
-        fprintf(fi, "dict_init2(&%s.members, &memberinfo_type, %d);\n", id, d1->hashsize);
-	fprintf(fi, "%s", prefix);
-        fprintf(fi, "dict_init2(&%s.static_members, &memberinfo_type, %d);\n", id, d2->hashsize);
-        int t;
-	DICT_ITERATE_DATA(d1,slotinfo_t*,s1) {
-	   fprintf(fi, "%s", prefix);
-	   char*id2 = mkid2(id, s1->name);
-	   fprintf(fi, "dict_put(&%s.members, &%s, &%s);\n", id, id2, id2);
-	}
-	DICT_ITERATE_DATA(d2,slotinfo_t*,s2) {
-	   fprintf(fi, "%s", prefix);
-	   char*id2 = mkid2(id, s2->name);
-	   fprintf(fi, "dict_put(&%s.static_members, &%s, &%s);\n", id, id2, id2);
-	}
+        write_memberlist(fi, id, &c->members, "members");
+        write_memberlist(fi, id, &c->static_members, "static_members");
     }
 }
+void write_builtin(FILE*fi, slotinfo_t*s)
+{
+    char*id = mkid(s);
+    fprintf(fi, "    {\"%s\", \"%s\", (slotinfo_t*)&%s, ", s->package, s->name, id);
+    if(s->kind == INFOTYPE_CLASS && ((classinfo_t*)s)->members.num)
+        fprintf(fi, "%s_members, ", id);
+    else
+        fprintf(fi, "0, ");
+    if(s->kind == INFOTYPE_CLASS && ((classinfo_t*)s)->static_members.num)
+        fprintf(fi, "%s_static_members},\n", id);
+    else
+        fprintf(fi, "0},\n");
+}
+
+static int compare_slots(const void*v1, const void*v2)
+{
+    slotinfo_t*s1 = *(slotinfo_t**)v1;
+    slotinfo_t*s2 = *(slotinfo_t**)v2;
+    int i = strcmp(s1->package, s2->package);
+    if(i)
+        return i;
+    return strcmp(s1->name, s2->name);
+}
 
 void write_constant(FILE*fi, constant_t*value, char*id, char*prefix)
 {
@@ -267,50 +287,48 @@ void write_slotinfo(FILE*fi, slotinfo_t*s, char*id, char*prefix)
 
 int main()
 {
-    registry_classes = builtin_getclasses();
+    registry_init();
 
     as3_import_abc("builtin.abc");
     as3_import_abc("playerglobal.abc");
 
     FILE*fi = fopen("builtin.c", "wb");
 
-    int t;
-    int pass;
-
+    /* the compiler looks up builtins by binary search */
+    int num = 0;
+    slotinfo_t**slots = (slotinfo_t**)malloc(sizeof(slotinfo_t*)*registry_classes->num);
+    DICT_ITERATE_KEY(registry_classes, slotinfo_t*, s) {
+        slots[num++] = s;
+    }
+    qsort(slots, num, sizeof(slotinfo_t*), compare_slots);
 
-    for(pass=1;pass<=3;pass++) {
-        if(pass==1) {
-            fprintf(fi, "#include \"builtin.h\"\n");
-            fprintf(fi, "\n");
-        }
-        if(pass==3) {
-            fprintf(fi, "dict_t* builtin_getclasses()\n");
-            fprintf(fi, "{\n");
-            fprintf(fi, "    dict_t*d = dict_new2(&slotinfo_type);\n");
-        }
-        for(t=0;t<registry_classes->hashsize;t++) {
-            dictentry_t*l = registry_classes->slots[t];
-            while(l) {
-                slotinfo_t*s = (slotinfo_t*)l->key;
-                //printf("%08x %s %s\n", s, s->package, s->name);
-                char*id = mkid(s);
-                if(pass==1) {
-                    write_slotinfo_decl(fi, s, "");
-                }
-                if(pass==2) {
-                    write_slotinfo(fi, s, mkid(s), "");
-                }
-                if(pass==3) {
-                    fprintf(fi, "    dict_put(d, &%s, &%s);\n", id, id);
-                    write_initinfo(fi, s, "    ");
-                }
-                l = l->next;
-            }
-        }
+    int t;
+    fprintf(fi, "#include \"builtin.h\"\n");
+    fprintf(fi, "\n");
+    for(t=0;t<num;t++) {
+        write_slotinfo_decl(fi, slots[t], "");
+    }
+    for(t=0;t<num;t++) {
+        write_slotinfo(fi, slots[t], mkid(slots[t]), "");
     }
+    fprintf(fi, "\n");
+    for(t=0;t<num;t++) {
+        write_memberlists(fi, slots[t]);
+    }
+    fprintf(fi, "\n");
+    fprintf(fi, "static const builtin_t builtins[] = {\n");
+    for(t=0;t<num;t++) {
+        write_builtin(fi, slots[t]);
+    }
+    fprintf(fi, "};\n");
+    fprintf(fi, "\n");
+    fprintf(fi, "const builtin_t* builtin_getclasses(int*num)\n");
+    fprintf(fi, "{\n");
     fprintf(fi, "    _NaN_constant.f =  __builtin_nan(\"\");\n");
     fprintf(fi, "    _Infinity_constant.f = __builtin_inf();\n");
-    fprintf(fi, "    return d;\n");
+    fprintf(fi, "    *num = sizeof(builtins)/sizeof(builtins[0]);\n");
+    fprintf(fi, "    return builtins;\n");
     fprintf(fi, "}\n");
+    fclose(fi);
     return 0;
 }
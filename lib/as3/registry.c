@@ -125,6 +125,8 @@ asset_bundle_list_t*registry_getassets()
     return assets;
 }
 // ----------------------- resolving ----------------------------------
+static void classinfo_load(classinfo_t*c);
+
 slotinfo_t* registry_resolve(slotinfo_t*_s)
 {
     if(!_s || _s->kind != INFOTYPE_UNRESOLVED)
@@ -168,6 +170,7 @@ static void resolve_on_class(slotinfo_t*_cls)
     classinfo_t*cls = (classinfo_t*)_cls;
     cls->superclass = (classinfo_t*)registry_resolve((slotinfo_t*)cls->superclass);
 	
+    classinfo_load(cls);
     DICT_ITERATE_DATA(&cls->members,slotinfo_t*,m) {
 	resolve_on_slot(m);
     }
@@ -223,6 +226,7 @@ methodinfo_t* methodinfo_register_onclass(classinfo_t*cls, U8 access, const char
     m->name = name;
     m->package = ns;
     m->parent = cls;
+    classinfo_load(cls);
     if(!is_static) 
 	dict_put(&cls->members, m, m);
     else
@@ -237,6 +241,7 @@ varinfo_t* varinfo_register_onclass(classinfo_t*cls, U8 access, const char*ns, c
     m->name = name;
     m->package = ns;
     m->parent = cls;
+    classinfo_load(cls);
     if(!is_static) 
 	dict_put(&cls->members, m, m);
     else
@@ -274,11 +279,57 @@ varinfo_t* varinfo_register_global(U8 access, const char*package, const char*nam
 
 // --------------- builtin classes (from builtin.c) ----------------------
 
+/* Builtin classes are only added to the registry when they're looked up
+   for the first time, and their members only when they're first needed,
+   so that compiling a small script doesn't cost us the whole player API */
+static const builtin_t*builtins = 0;
+static int num_builtins = 0;
+
 void registry_init()
 {
-    if(!registry_classes)
-        registry_classes = builtin_getclasses();
+    if(!registry_classes) {
+        registry_classes = dict_new2(&slotinfo_type);
+        builtins = builtin_getclasses(&num_builtins);
+    }
+}
+static const builtin_t* builtin_find(const char*package, const char*name)
+{
+    int min = 0, max = num_builtins-1;
+    while(min<=max) {
+        int pos = (min+max)/2;
+        const builtin_t*b = &builtins[pos];
+        int cmp = strcmp(package, b->package);
+        if(!cmp)
+            cmp = strcmp(name, b->name);
+        if(!cmp)
+            return b;
+        if(cmp<0)
+            max = pos-1;
+        else
+            min = pos+1;
+    }
+    return 0;
+}
+static void load_members(dict_t*d, slotinfo_t*const*members)
+{
+    int num = 0;
+    while(members && members[num])
+        num++;
+    dict_init2(d, &memberinfo_type, num?num:1);
+    int t;
+    for(t=0;t<num;t++)
+        dict_put(d, members[t], members[t]);
+}
+static void classinfo_load(classinfo_t*c)
+{
+    /* the member dicts of builtin classes are all zeroes until we load them */
+    if(c->members.hashsize)
+        return;
+    const builtin_t*b = builtin_find(c->package, c->name);
+    load_members(&c->members, b && b->slot==(slotinfo_t*)c ? b->members : 0);
+    load_members(&c->static_members, b && b->slot==(slotinfo_t*)c ? b->static_members : 0);
 }
+
 slotinfo_t* registry_find(const char*package, const char*name)
 {
     assert(registry_classes);
@@ -286,6 +337,13 @@ slotinfo_t* registry_find(const char*package, const char*name)
     tmp.package = package;
     tmp.name = name;
     slotinfo_t* c = (slotinfo_t*)dict_lookup(registry_classes, &tmp);
+    if(!c) {
+        const builtin_t*b = builtin_find(package, name);
+        if(b) {
+            c = b->slot;
+            dict_put(registry_classes, c, c);
+        }
+    }
     /*if(c)
         printf("%s.%s->%08x (%s.%s)\n", package, name, c, c->package, c->name);*/
     return c;
@@ -319,6 +377,7 @@ memberinfo_t* registry_findmember(classinfo_t*cls, const char*ns, const char*nam
     tmp.package = ns?ns:"";
 
     if(!recursive) {
+        classinfo_load(cls);
 	if(!is_static) 
 	    return (memberinfo_t*)dict_lookup(&cls->members, &tmp);
 	else
@@ -335,6 +394,7 @@ memberinfo_t* registry_findmember(classinfo_t*cls, const char*ns, const char*nam
         if(s->kind == INFOTYPE_UNRESOLVED)
             break;
 
+        classinfo_load(s);
 	if(!is_static) {
 	    m = (slotinfo_t*)dict_lookup(&s->members, &tmp);
 	    if(m) return (memberinfo_t*)m;
@@ -350,6 +410,7 @@ memberinfo_t* registry_findmember(classinfo_t*cls, const char*ns, const char*nam
         classinfo_t*s = cls->interfaces[t];
         if(s->kind != INFOTYPE_UNRESOLVED) {
             while(s) {
+                classinfo_load(s);
 		if(!is_static) {
 		    m = (slotinfo_t*)dict_lookup(&s->members, &tmp);
 		    if(m) return (memberinfo_t*)m;
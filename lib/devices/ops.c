@@ -112,6 +112,7 @@ void ops_fillbitmap(struct _gfxdevice*dev, gfxline_t*line, gfximage_t*img, gfxma
 {
     internal_t*i = (internal_t*)dev->internal;
     gfximage_t img2;
+    memset(&img2, 0, sizeof(img2));
     img2.width = img->width;
     img2.height = img->height;
     img2.data = (gfxcolor_t*)malloc(img->width*img->height*4);
@@ -223,6 +223,9 @@ static void dumpImage(writer_t*w, state_t*state, gfximage_t*img)
 #else
     w->write(w, img->data, img->width*img->height*sizeof(gfxcolor_t));
 #endif
+    writer_writeU32(w, img->jpeg_data?img->jpeg_size:0);
+    if(img->jpeg_data)
+	w->write(w, img->jpeg_data, img->jpeg_size);
 #ifdef STATS
     state->size_images += w->pos - oldpos;
 #endif
@@ -230,6 +233,7 @@ static void dumpImage(writer_t*w, state_t*state, gfximage_t*img)
 static gfximage_t readImage(reader_t*r, state_t*state)
 {
     gfximage_t img;
+    memset(&img, 0, sizeof(img));
     img.width = reader_readU16(r);
     img.height = reader_readU16(r);
     uLongf size = img.width*img.height*sizeof(gfxcolor_t);
@@ -266,6 +270,11 @@ static gfximage_t readImage(reader_t*r, state_t*state)
 #else
     r->read(r, img.data, size);
 #endif
+    img.jpeg_size = reader_readU32(r);
+    if(img.jpeg_size) {
+	img.jpeg_data = malloc(img.jpeg_size);
+	r->read(r, img.jpeg_data, img.jpeg_size);
+    }
     return img;
 }
 
@@ -756,6 +765,9 @@ static void replay(struct _gfxdevice*dev, gfxdevice_t*out, reader_t*r, gfxfontli
 		if(cxform)
 		    free(cxform);
 		free(img.data);img.data=0;
+		if(img.jpeg_data) {
+		    free(img.jpeg_data);img.jpeg_data=0;
+		}
 		break;
 	    }
 	    case OP_FILLGRADIENT: {
@@ -22,12 +22,21 @@
 #include <stdio.h>
 #include <math.h>
 #include <memory.h>
+#include "../../config.h"
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
 #include "../gfxdevice.h"
 #include "../gfxtools.h"
 #include "../mem.h"
 #include "../types.h"
 #include "../png.h"
+#include "../jpeg.h"
+#include "../bitio.h"
+#include "../os.h"
 #include "../log.h"
+#include "../q.h"
+#include "record.h"
 #include "render.h"
 
 typedef gfxcolor_t RGBA;
@@ -48,6 +57,11 @@ typedef struct _internal_result {
     gfximage_t img;
     struct _internal_result*next;
     char palette;
+
+    /* for pages rendered in strips, the image is only available
+       in encoded form, in a temporary file */
+    char*filename;
+    const char*format;
 } internal_result_t;
 
 typedef struct _clipbuffer {
@@ -55,6 +69,44 @@ typedef struct _clipbuffer {
     struct _clipbuffer*next;
 } clipbuffer_t;
 
+/* A glyph, rasterized into horizontal spans. Text usually repeats the same
+   glyphs at the same size, so we keep those spans around and copy them
+   into the page instead of scan-converting the outline every time.
+   (Characters are always placed at whole pixels, see render_drawchar(),
+   so there's no subpixel position in the key) */
+typedef struct _glyphkey {
+    gfxfont_t*font;
+    gfxline_t*line; // the outline, in case a font gets reused
+    int glyphnr;
+    double m00,m10,m01,m11;
+} glyphkey_t;
+
+typedef struct _glyphmask {
+    glyphkey_t key;
+    /* position of the top left corner, relative to the glyph origin */
+    int x, y;
+    int width, height;
+    /* how close the scan conversion came to rounding differently, and the
+       float error it had at the position the mask was computed at. See
+       glyphmask_usable(). ymargin is negative for glyphs which can't be
+       drawn from spans at all. */
+    double xmargin, ymargin;
+    double xerror;
+    /* the (x1,x2) pairs of row r are spans[rowpos[r]] ... spans[rowpos[r+1]-1] */
+    int*rowpos;
+    int*spans;
+} glyphmask_t;
+
+typedef struct _glyphcache {
+    dict_t*masks;
+    int size;
+} glyphcache_t;
+
+/* glyphs bigger than this (in zoomed pixels) are always drawn as outlines */
+#define GLYPHCACHE_MAXGLYPH 512
+/* flush the cache if it gets bigger than this many bytes */
+#define GLYPHCACHE_MAXSIZE (16*1024*1024)
+
 typedef struct _internal {
     int width;
     int height;
@@ -67,6 +119,24 @@ typedef struct _internal {
     int ymin, ymax;
     int fillwhite;
 
+    /* strip mode: the page is recorded, and then rasterized
+       (and encoded) stripheight lines at a time */
+    int stripheight;
+    const char*stripformat;
+    int jpegquality;
+    int threads;
+    gfxdevice_t*recorder;
+
+    char use_glyphcache;
+    glyphcache_t*glyphcache;
+    /* the strips of a page share the glyph cache of the page */
+    char shared_glyphcache;
+
+    /* first line (in the zoomed coordinate system) of the buffers-
+       non-zero if this device only renders a strip of the page */
+    int ystart;
+    int yend;
+
     char palette;
 
     RGBA* img;
@@ -74,6 +144,9 @@ typedef struct _internal {
     clipbuffer_t*clipbuf;
 
     renderline_t*lines;
+    /* if set, draw_line() stores the smallest distance of a y coordinate
+       to a row center (or of a spline's curvature to the next integer) in here */
+    double*margin;
 
     internal_result_t*results;
     internal_result_t*result_next;
@@ -96,6 +169,7 @@ static inline void add_pixel(internal_t*i, float x, int y)
 {
     renderpoint_t p;
 
+    y -= i->ystart;
     if(x >= i->width2 || y >= i->height2 || y<0) return;
     p.x = x;
     if(y<i->ymin) i->ymin = y;
@@ -133,6 +207,12 @@ static void add_line(gfxdevice_t*dev , double x1, double y1, double x2, double y
 	x = x1;x1 = x2;x2=x;
 	y = y1;y1 = y2;y2=y;
     }
+    if(i->margin) {
+	double m1 = fabs(y1 - floor(y1) - CUT);
+	double m2 = fabs(y2 - floor(y2) - CUT);
+	if(m1 < *i->margin) *i->margin = m1;
+	if(m2 < *i->margin) *i->margin = m2;
+    }
     
     diffx = x2 - x1;
     diffy = y2 - y1;
@@ -160,6 +240,14 @@ static void add_line(gfxdevice_t*dev , double x1, double y1, double x2, double y
 	double posx=0;
 	double startx = x1;
 
+	/* skip the parts of the line which are outside of our strip */
+	if(posy < i->ystart) {
+	    posx = (i->ystart - posy)*stepx;
+	    posy = i->ystart;
+	}
+	if(endy >= i->ystart + i->height2)
+	    endy = i->ystart + i->height2 - 1;
+
 	while(posy<=endy) {
 	    float xx = (float)(startx + posx);
 	    add_pixel(i, xx ,posy);
@@ -477,7 +565,7 @@ void fill(gfxdevice_t*dev, fillinfo_t*fill)
                 endx = 0;
 
 	    if(!(n&1))
-		fill_line(dev, line, zline, y, startx, endx, fill);
+		fill_line(dev, line, zline, y+i->ystart, startx, endx, fill);
 
 	    lastx = endx;
             if(endx == i->width2)
@@ -523,6 +611,28 @@ int render_setparameter(struct _gfxdevice*dev, const char*key, const char*value)
     } else if(!strcmp(key, "palette")) {
 	i->palette = atoi(value);
 	return 1;
+    } else if(!strcmp(key, "stripheight")) {
+	i->stripheight = atoi(value);
+	return 1;
+    } else if(!strcmp(key, "stripformat")) {
+	if(!strcasecmp(value, "jpg") || !strcasecmp(value, "jpeg")) {
+	    i->stripformat = "jpg";
+	} else if(!strcasecmp(value, "png")) {
+	    i->stripformat = "png";
+	} else {
+	    msg("<error> render: unsupported strip format %s", value);
+	    return 0;
+	}
+	return 1;
+    } else if(!strcmp(key, "jpegquality")) {
+	i->jpegquality = atoi(value);
+	return 1;
+    } else if(!strcmp(key, "threads")) {
+	i->threads = atoi(value);
+	return 1;
+    } else if(!strcmp(key, "glyphcache")) {
+	i->use_glyphcache = atoi(value);
+	return 1;
     }
     return 0;
 }
@@ -559,6 +669,11 @@ void render_stroke(struct _gfxdevice*dev, gfxline_t*line, gfxcoord_t width, gfxc
 {
     internal_t*i = (internal_t*)dev->internal;
     double x,y;
+
+    if(i->recorder) {
+	i->recorder->stroke(i->recorder, line, width, color, cap_style, joint_style, miterLimit);
+	return;
+    }
     
     /*if(cap_style != gfx_capRound || joint_style != gfx_joinRound) {
 	fprintf(stderr, "Warning: cap/joint style != round not yet supported\n");
@@ -602,6 +717,15 @@ void render_stroke(struct _gfxdevice*dev, gfxline_t*line, gfxcoord_t width, gfxc
     }
 }
 
+/* distance of v to the next value at which abs((int)v) changes */
+static double trunc_margin(double v)
+{
+    v = fabs(v);
+    if(v < 1)
+	return 1 - v;
+    return fabs(v - floor(v + 0.5));
+}
+
 static void draw_line(gfxdevice_t*dev, gfxline_t*line)
 {
     internal_t*i = (internal_t*)dev->internal;
@@ -626,6 +750,12 @@ static void draw_line(gfxdevice_t*dev, gfxline_t*line)
 	    double x3=line->x*i->zoom,y3=line->y*i->zoom;
             
             c = abs(x3-2*x2+x1) + abs(y3-2*y2+y1);
+	    if(i->margin) {
+		double m1 = trunc_margin(x3-2*x2+x1);
+		double m2 = trunc_margin(y3-2*y2+y1);
+		if(m1 < *i->margin) *i->margin = m1;
+		if(m2 < *i->margin) *i->margin = m2;
+	    }
             xx=x1;
 	    yy=y1;
 
@@ -650,6 +780,10 @@ static void draw_line(gfxdevice_t*dev, gfxline_t*line)
 void render_startclip(struct _gfxdevice*dev, gfxline_t*line)
 {
     internal_t*i = (internal_t*)dev->internal;
+    if(i->recorder) {
+	i->recorder->startclip(i->recorder, line);
+	return;
+    }
     fillinfo_t info;
     memset(&info, 0, sizeof(info));
     newclip(dev);
@@ -661,12 +795,20 @@ void render_startclip(struct _gfxdevice*dev, gfxline_t*line)
 void render_endclip(struct _gfxdevice*dev)
 {
     internal_t*i = (internal_t*)dev->internal;
+    if(i->recorder) {
+	i->recorder->endclip(i->recorder);
+	return;
+    }
     endclip(dev, 0);
 }
 
 void render_fill(struct _gfxdevice*dev, gfxline_t*line, gfxcolor_t*color)
 {
     internal_t*i = (internal_t*)dev->internal;
+    if(i->recorder) {
+	i->recorder->fill(i->recorder, line, color);
+	return;
+    }
 
     draw_line(dev, line);
     fill_solid(dev, color);
@@ -675,6 +817,10 @@ void render_fill(struct _gfxdevice*dev, gfxline_t*line, gfxcolor_t*color)
 void render_fillbitmap(struct _gfxdevice*dev, gfxline_t*line, gfximage_t*img, gfxmatrix_t*matrix, gfxcxform_t*cxform)
 {
     internal_t*i = (internal_t*)dev->internal;
+    if(i->recorder) {
+	i->recorder->fillbitmap(i->recorder, line, img, matrix, cxform);
+	return;
+    }
 
     gfxmatrix_t m2 = *matrix;
 
@@ -696,6 +842,10 @@ void render_fillbitmap(struct _gfxdevice*dev, gfxline_t*line, gfximage_t*img, gf
 void render_fillgradient(struct _gfxdevice*dev, gfxline_t*line, gfxgradient_t*gradient, gfxgradienttype_t type, gfxmatrix_t*matrix)
 {
     internal_t*i = (internal_t*)dev->internal;
+    if(i->recorder) {
+	i->recorder->fillgradient(i->recorder, line, gradient, type, matrix);
+	return;
+    }
     
     gfxmatrix_t m2 = *matrix;
 
@@ -753,6 +903,271 @@ void render_fillgradient(struct _gfxdevice*dev, gfxline_t*line, gfxgradient_t*gr
 
 void render_addfont(struct _gfxdevice*dev, gfxfont_t*font)
 {
+    internal_t*i = (internal_t*)dev->internal;
+    if(i->recorder) {
+	i->recorder->addfont(i->recorder, font);
+    }
+}
+
+static unsigned int glyphkey_hash(const glyphkey_t*key)
+{
+    return crc32_add_bytes(0, key, sizeof(glyphkey_t));
+}
+static char glyphkey_equals(const glyphkey_t*k1, const glyphkey_t*k2)
+{
+    return !memcmp(k1, k2, sizeof(glyphkey_t));
+}
+static void* glyphkey_dup(const glyphkey_t*key) {return (void*)key;}
+static void glyphkey_free(glyphkey_t*key) {}
+
+/* the keys are stored in the glyphmask_t entries themselves */
+static type_t glyphkey_type = {
+    hash: (hash_func)glyphkey_hash,
+    equals: (equals_func)glyphkey_equals,
+    dup: (dup_func)glyphkey_dup,
+    free: (free_func)glyphkey_free,
+};
+
+static glyphcache_t* glyphcache_new()
+{
+    glyphcache_t*cache = (glyphcache_t*)rfx_calloc(sizeof(glyphcache_t));
+    cache->masks = dict_new2(&glyphkey_type);
+    return cache;
+}
+
+static void glyphmask_free(void*data)
+{
+    glyphmask_t*mask = (glyphmask_t*)data;
+    rfx_free(mask->rowpos);
+    rfx_free(mask->spans);
+    rfx_free(mask);
+}
+
+static void glyphcache_clear(glyphcache_t*cache)
+{
+    dict_foreach_value(cache->masks, glyphmask_free);
+    /* dict_clear() would also reset the key type */
+    dict_destroy(cache->masks);
+    cache->masks = dict_new2(&glyphkey_type);
+    cache->size = 0;
+}
+
+static void glyphcache_destroy(glyphcache_t*cache)
+{
+    dict_foreach_value(cache->masks, glyphmask_free);
+    dict_destroy(cache->masks);
+    rfx_free(cache);
+}
+
+/* the largest error of storing x (or anything up to x) as a float */
+static double float_error(double x)
+{
+    int e;
+    frexp(fabs(x), &e);
+    return ldexp(1.0, e-24);
+}
+
+/* Scan-convert a glyph at (ox,oy) (in zoomed pixels) with the same
+   draw_line() call render_drawchar() uses for outlines, and store the
+   resulting spans relative to (ox,oy). Returns 0 if the glyph is too
+   close to the top of the page for this. */
+static glyphmask_t* glyphmask_new(gfxdevice_t*dev, glyphkey_t*key, gfxline_t*glyphline, gfxmatrix_t*matrix, int ox, int oy)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    glyphmask_t*mask = (glyphmask_t*)rfx_calloc(sizeof(glyphmask_t));
+    mask->key = *key;
+    mask->ymargin = -1;
+
+    gfxline_t*line = gfxline_clone(glyphline);
+    gfxline_transform(line, matrix);
+    gfxbbox_t bbox = gfxline_getbbox(line);
+    if((bbox.xmax - bbox.xmin) * i->zoom > GLYPHCACHE_MAXGLYPH ||
+       (bbox.ymax - bbox.ymin) * i->zoom > GLYPHCACHE_MAXGLYPH) {
+	gfxline_free(line);
+	return mask;
+    }
+    if(bbox.ymin * i->zoom < -15) {
+	/* INT() rounds differently for y < -16 */
+	gfxline_free(line);
+	glyphmask_free(mask);
+	return 0;
+    }
+
+    internal_t s;
+    memset(&s, 0, sizeof(internal_t));
+    s.zoom = i->zoom;
+    s.width2 = 0x7fffffff;
+    s.ystart = (int)floor(bbox.ymin * i->zoom) - 1;
+    s.height2 = (int)ceil(bbox.ymax * i->zoom) - s.ystart + 2;
+    s.ymin = 0x7fffffff;
+    s.ymax = -0x80000000;
+    s.lines = (renderline_t*)rfx_calloc(s.height2*sizeof(renderline_t));
+    double ymargin = 1.0;
+    s.margin = &ymargin;
+    gfxdevice_t scratch;
+    memset(&scratch, 0, sizeof(gfxdevice_t));
+    scratch.internal = &s;
+    draw_line(&scratch, line);
+    gfxline_free(line);
+
+    int num_spans = 0, y;
+    int xmin = 0x7fffffff, xmax = -0x80000000;
+    double xmargin = 1.0, xerror = 0;
+    for(y=s.ymin;y<=s.ymax;y++) {
+	renderpoint_t*points = s.lines[y].points;
+	int num = s.lines[y].num;
+	if(num&1) {
+	    /* not a closed outline */
+	    ymargin = -1;
+	    break;
+	}
+	int n;
+	for(n=0;n<num;n++) {
+	    /* fill() truncates the float x coordinates */
+	    double d = fabs(points[n].x - floor(points[n].x + 0.5));
+	    if(d < xmargin)
+		xmargin = d;
+	    double e = float_error(points[n].x);
+	    if(e > xerror)
+		xerror = e;
+	    int x = (int)floor(points[n].x);
+	    if(x < xmin) xmin = x;
+	    if(x > xmax) xmax = x;
+	}
+	num_spans += num;
+    }
+    if(ymargin >= 0) {
+	mask->xmargin = xmargin;
+	mask->ymargin = ymargin;
+	mask->xerror = xerror;
+	if(s.ymin<=s.ymax) {
+	    mask->x = xmin - ox;
+	    mask->y = s.ystart + s.ymin - oy;
+	    mask->width = xmax - xmin;
+	    mask->height = s.ymax - s.ymin + 1;
+	}
+	mask->rowpos = (int*)rfx_alloc(sizeof(int)*(mask->height+1));
+	mask->spans = (int*)rfx_alloc(sizeof(int)*(num_spans+1));
+	int pos = 0;
+	for(y=s.ymin;y<=s.ymax;y++) {
+	    renderpoint_t*points = s.lines[y].points;
+	    int num = s.lines[y].num;
+	    qsort(points, num, sizeof(renderpoint_t), compare_renderpoints);
+	    mask->rowpos[y-s.ymin] = pos;
+	    int n;
+	    for(n=0;n<num;n++) {
+		mask->spans[pos++] = (int)floor(points[n].x) - xmin;
+	    }
+	}
+	mask->rowpos[mask->height] = pos;
+    }
+    for(y=0;y<s.height2;y++) {
+	rfx_free(s.lines[y].points);
+    }
+    rfx_free(s.lines);
+    return mask;
+}
+
+/* The spans of a mask only come out the same as draw_line() would compute
+   them at (ox,oy) if none of the roundings could have gone the other way
+   there: The x coordinates pass through a float, whose error depends on
+   the position, and the remaining (double precision) errors are tiny
+   compared to the margins we ask for. */
+static char glyphmask_usable(glyphmask_t*mask, int ox, int oy)
+{
+    if(mask->ymargin < 1.0/1024)
+	return 0;
+    if(oy + mask->y < -15)
+	return 0;
+    double x1 = fabs(ox + mask->x);
+    double x2 = fabs(ox + mask->x + mask->width + 1.0);
+    double xmax = x1>x2?x1:x2;
+    if(xmax > 0x100000)
+	return 0;
+    return mask->xmargin > mask->xerror + float_error(xmax) + 1.0/0x100000;
+}
+
+/* draw a cached glyph at (ox,oy), the same way fill() would have drawn it */
+static void glyphmask_fill(gfxdevice_t*dev, glyphmask_t*mask, int ox, int oy, gfxcolor_t*color)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    int r;
+    for(r=0;r<mask->height;r++) {
+	int y = oy + mask->y + r - i->ystart;
+	if(y<0)
+	    continue;
+	if(y>=i->height2)
+	    break;
+	RGBA*line = &i->img[i->width2*y];
+	U32*zline = &i->clipbuf->data[i->bitwidth*y];
+	int n;
+	for(n=mask->rowpos[r];n<mask->rowpos[r+1];n+=2) {
+	    int startx = ox + mask->x + mask->spans[n];
+	    int endx = ox + mask->x + mask->spans[n+1];
+	    if(startx >= i->width2)
+		break;
+	    if(endx > i->width2)
+		endx = i->width2;
+	    if(startx < 0)
+		startx = 0;
+	    if(endx < 0)
+		endx = 0;
+	    fill_line_solid(line, zline, y+i->ystart, startx, endx, *color);
+	    if(endx == i->width2)
+		break;
+	}
+    }
+}
+
+/* Draws a glyph from the glyph cache. The masks are computed at the first
+   position a glyph is drawn at, and reused at other positions as long as
+   that gives exactly the pixels the outline would have given.
+   Returns 0 if the glyph has to be drawn as outline. */
+static char drawchar_cached(gfxdevice_t*dev, gfxfont_t*font, int glyphnr, gfxcolor_t*color, gfxmatrix_t*matrix)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    gfxglyph_t*glyph = &font->glyphs[glyphnr];
+
+    /* skewed or rotated text rarely repeats */
+    if((matrix->m01 || matrix->m10) && (matrix->m00 || matrix->m11))
+	return 0;
+
+    double fx = matrix->tx * i->zoom;
+    double fy = matrix->ty * i->zoom;
+    int ox = (int)fx;
+    int oy = (int)fy;
+    if(ox != fx || oy != fy)
+	return 0;
+
+    glyphkey_t key;
+    memset(&key, 0, sizeof(key));
+    key.font = font;
+    key.line = glyph->line;
+    key.glyphnr = glyphnr;
+    key.m00 = matrix->m00;
+    key.m10 = matrix->m10;
+    key.m01 = matrix->m01;
+    key.m11 = matrix->m11;
+
+    if(!i->glyphcache)
+	i->glyphcache = glyphcache_new();
+    glyphcache_t*cache = i->glyphcache;
+    glyphmask_t*mask = (glyphmask_t*)dict_lookup(cache->masks, &key);
+    if(!mask) {
+	mask = glyphmask_new(dev, &key, glyph->line, matrix, ox, oy);
+	if(!mask)
+	    return 0;
+	if(cache->size > GLYPHCACHE_MAXSIZE)
+	    glyphcache_clear(cache);
+	dict_put(cache->masks, &mask->key, mask);
+	cache->size += sizeof(glyphmask_t);
+	if(mask->rowpos)
+	    cache->size += sizeof(int)*(mask->height+1+mask->rowpos[mask->height]);
+    }
+    if(!glyphmask_usable(mask, ox, oy))
+	return 0;
+    glyphmask_fill(dev, mask, ox, oy, color);
+    return 1;
 }
 
 void render_drawchar(struct _gfxdevice*dev, gfxfont_t*font, int glyphnr, gfxcolor_t*color, gfxmatrix_t*matrix)
@@ -760,11 +1175,18 @@ void render_drawchar(struct _gfxdevice*dev, gfxfont_t*font, int glyphnr, gfxcolo
     internal_t*i = (internal_t*)dev->internal;
     if(!font)
 	return;
+    if(i->recorder) {
+	i->recorder->drawchar(i->recorder, font, glyphnr, color, matrix);
+	return;
+    }
 
     /* align characters to whole pixels */
     matrix->tx = (int)(matrix->tx * i->antialize) / i->antialize;
     matrix->ty = (int)(matrix->ty * i->antialize) / i->antialize;
 
+    if(i->use_glyphcache && drawchar_cached(dev, font, glyphnr, color, matrix))
+	return;
+
     gfxglyph_t*glyph = &font->glyphs[glyphnr];
     gfxline_t*line2 = gfxline_clone(glyph->line);
     gfxline_transform(line2, matrix);
@@ -779,6 +1201,18 @@ void render_result_write(gfxresult_t*r, int filedesc)
 {
     internal_result_t*i= (internal_result_t*)r->internal;
 }
+static void save_page(internal_result_t*i, const char*filename)
+{
+    if(i->filename) {
+	/* copy, so that the result can be saved more than once. The
+	   temporary file is removed in render_result_destroy() */
+	copy_file(i->filename, filename);
+    } else if(!i->palette) {
+	png_write(filename, (unsigned char*)i->img.data, i->img.width, i->img.height);
+    } else {
+	png_write_palette_based_2(filename, (unsigned char*)i->img.data, i->img.width, i->img.height);
+    }
+}
 int render_result_save(gfxresult_t*r, const char*filename)
 {
     internal_result_t*i= (internal_result_t*)r->internal;
@@ -790,26 +1224,19 @@ int render_result_save(gfxresult_t*r, const char*filename)
 	char filenamebuf[256];
 	char*origname = strdup(filename);
 	int l = strlen(origname);
-	if(l>3 && strchr("gG",origname[l-1]) && strchr("nN",filename[l-2]) &&
-		strchr("pP",origname[l-3]) && filename[l-4]=='.') {
+	if(l>3 && origname[l-4]=='.' && 
+	   (!strcasecmp(&origname[l-3], "png") || !strcasecmp(&origname[l-3], "jpg"))) {
 	    origname[l-4] = 0;
 	}
-	while(i->next) {
-	    sprintf(filenamebuf, "%s.%d.png", origname, nr);
-            if(!i->palette) {
-	        png_write(filename, (unsigned char*)i->img.data, i->img.width, i->img.height);
-            } else {
-	        png_write_palette_based_2(filename, (unsigned char*)i->img.data, i->img.width, i->img.height);
-            }
+	while(i) {
+	    sprintf(filenamebuf, "%s.%d.%s", origname, nr, i->format?i->format:"png");
+	    save_page(i, filenamebuf);
+	    i = i->next;
 	    nr++;
 	}
 	free(origname);
     } else {
-        if(!i->palette) {
-	    png_write(filename, (unsigned char*)i->img.data, i->img.width, i->img.height);
-	} else {
-	    png_write_palette_based_2(filename, (unsigned char*)i->img.data, i->img.width, i->img.height);
-	}
+	save_page(i, filename);
     }
     return 1;
 }
@@ -862,6 +1289,10 @@ void*render_result_get(gfxresult_t*r, const char*name)
 		return 0;
             pagenr--;
 	}
+	if(!i->img.data) {
+	    msg("<error> render: page %d was rendered in strips, and is only available via save()", atoi(&name[4]));
+	    return 0;
+	}
 	return &i->img;
     }
     return 0;
@@ -872,7 +1303,13 @@ void render_result_destroy(gfxresult_t*r)
     r->internal = 0;
     while(i) {
 	internal_result_t*next = i->next;
-	free(i->img.data);i->img.data = 0;
+	if(i->img.data) {
+	    free(i->img.data);i->img.data = 0;
+	}
+	if(i->filename) {
+	    unlink(i->filename);
+	    free(i->filename);i->filename = 0;
+	}
 
         /* FIXME memleak
            the following rfx_free causes a segfault on WIN32 machines,
@@ -917,6 +1354,22 @@ void render_startpage(struct _gfxdevice*dev, int width, int height)
     i->height2 = height*i->zoom;
     i->bitwidth = (i->width2+31)/32;
 
+    if(i->stripheight>0 && !i->yend) {
+	/* strip mode: don't rasterize anything yet, just store the page
+	   contents. We replay them once per strip in render_endpage(). */
+	i->recorder = (gfxdevice_t*)rfx_calloc(sizeof(gfxdevice_t));
+	gfxdevice_record_init(i->recorder, 0);
+	i->recorder->startpage(i->recorder, width, height);
+	return;
+    }
+    if(i->yend) {
+	/* we're rendering only a strip (ystart-yend) of the page */
+	if(i->yend > i->height2)
+	    i->yend = i->height2;
+	i->height2 = i->yend - i->ystart;
+	i->height = i->height2 / i->antialize;
+    }
+
     i->lines = (renderline_t*)rfx_alloc(i->height2*sizeof(renderline_t));
     for(y=0;y<i->height2;y++) {
 	memset(&i->lines[y], 0, sizeof(renderline_t));
@@ -991,6 +1444,91 @@ static void store_image(internal_t*i, internal_result_t*ir)
     }
 }
 
+static void add_result(internal_t*i, internal_result_t*ir)
+{
+    ir->next = 0;
+    if(i->result_next) {
+	i->result_next->next = ir;
+    }
+    if(!i->results) {
+	i->results = ir;
+    }
+    i->result_next = ir;
+}
+
+static void render_strips(gfxdevice_t*dev)
+{
+    internal_t*i = (internal_t*)dev->internal;
+
+    i->recorder->endpage(i->recorder);
+    gfxresult_t*recording = i->recorder->finish(i->recorder);
+    free(i->recorder);i->recorder = 0;
+
+    internal_result_t*ir= (internal_result_t*)rfx_calloc(sizeof(internal_result_t));
+    ir->format = i->stripformat?i->stripformat:"png";
+    char buffer[128];
+    ir->filename = strdup(mktempname(buffer, ir->format));
+
+    writer_t w;
+    writer_init_filewriter2(&w, ir->filename);
+    png_writer_t png;
+    jpeg_writer_t jpeg;
+    char is_jpeg = !strcmp(ir->format, "jpg");
+    if(is_jpeg) {
+	jpeg_writer_start(&jpeg, &w, i->width, i->height, i->jpegquality?i->jpegquality:85, 4);
+    } else {
+	if(i->palette) {
+	    msg("<warning> render: palette mode is not supported for pages rendered in strips");
+	}
+	png_writer_start2(&png, &w, i->width, i->height, 9, i->threads);
+    }
+
+    gfxfontlist_t*fontlist = gfxfontlist_create();
+    if(i->use_glyphcache)
+	i->glyphcache = glyphcache_new();
+    int y;
+    for(y=0;y<i->height;y+=i->stripheight) {
+	gfxdevice_t strip;
+	gfxdevice_render_init(&strip);
+	internal_t*s = (internal_t*)strip.internal;
+	s->antialize = i->antialize;
+	s->multiply = i->multiply;
+	s->zoom = i->zoom;
+	s->fillwhite = i->fillwhite;
+	s->use_glyphcache = i->use_glyphcache;
+	s->glyphcache = i->glyphcache;
+	s->shared_glyphcache = 1;
+	s->ystart = y*i->antialize;
+	s->yend = (y+i->stripheight)*i->antialize;
+
+	gfxresult_record_replay(recording, &strip, &fontlist);
+
+	gfxresult_t*r = strip.finish(&strip);
+	gfximage_t*img = (gfximage_t*)r->get(r, "page0");
+	if(img) {
+	    if(is_jpeg)
+		jpeg_writer_addlines(&jpeg, (unsigned char*)img->data, img->height);
+	    else
+		png_writer_addlines(&png, (unsigned char*)img->data, img->height);
+	}
+	r->destroy(r);
+    }
+    if(i->glyphcache) {
+	glyphcache_destroy(i->glyphcache);
+	i->glyphcache = 0;
+    }
+    gfxfontlist_free(fontlist, 1);
+    recording->destroy(recording);
+
+    if(is_jpeg)
+	jpeg_writer_finish(&jpeg);
+    else
+	png_writer_finish(&png);
+    w.finish(&w);
+
+    add_result(i, ir);
+}
+
 void render_endpage(struct _gfxdevice*dev)
 {
     internal_t*i = (internal_t*)dev->internal;
@@ -1000,6 +1538,13 @@ void render_endpage(struct _gfxdevice*dev)
 	exit(1);
     }
 
+    if(i->recorder) {
+	render_strips(dev);
+	i->width2 = 0;
+	i->height2 = 0;
+	return;
+    }
+
     endclip(dev, 1);
     int unclosed = 0;
     while(i->clipbuf) {
@@ -1017,15 +1562,7 @@ void render_endpage(struct _gfxdevice*dev)
     int y,x;
 
     store_image(i, ir);
-
-    ir->next = 0;
-    if(i->result_next) {
-	i->result_next->next = ir;
-    }
-    if(!i->results) {
-	i->results = ir;
-    }
-    i->result_next = ir;
+    add_result(i, ir);
 
     for(y=0;y<i->height2;y++) {
 	rfx_free(i->lines[y].points); i->lines[y].points = 0;
@@ -1034,6 +1571,12 @@ void render_endpage(struct _gfxdevice*dev)
 
     if(i->img) {rfx_free(i->img);i->img = 0;}
 
+    /* fonts aren't guaranteed to outlive the page */
+    if(i->glyphcache && !i->shared_glyphcache) {
+	glyphcache_destroy(i->glyphcache);
+    }
+    i->glyphcache = 0;
+
     i->width2 = 0;
     i->height2 = 0;
 }
@@ -1059,6 +1602,7 @@ void gfxdevice_render_init(gfxdevice_t*dev)
     i->antialize = 1;
     i->multiply = 1;
     i->zoom = 1;
+    i->use_glyphcache = 1;
 
     dev->setparameter = render_setparameter;
     dev->startpage = render_startpage;
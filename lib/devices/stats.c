@@ -0,0 +1,202 @@
+/* stats.c
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+ 
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <memory.h>
+#include <string.h>
+#include "../types.h"
+#include "../mem.h"
+#include "../gfxdevice.h"
+#include "../gfxtools.h"
+#include "../stats.h"
+#include "stats.h"
+
+typedef struct _internal {
+    gfxdevice_t*out;
+    stat_t*startpage;
+    stat_t*startclip;
+    stat_t*endclip;
+    stat_t*stroke;
+    stat_t*fill;
+    stat_t*fillbitmap;
+    stat_t*fillgradient;
+    stat_t*addfont;
+    stat_t*drawchar;
+    stat_t*drawlink;
+    stat_t*endpage;
+    stat_t*finish;
+} internal_t;
+
+static int line_size(gfxline_t*line)
+{
+    int size = 0;
+    while(line) {
+	size++;
+	line = line->next;
+    }
+    return size;
+}
+
+static int stats_setparameter(struct _gfxdevice*dev, const char*key, const char*value)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    return i->out->setparameter(i->out,key,value);
+}
+
+static void stats_startpage(struct _gfxdevice*dev, int width, int height)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->startpage(i->out,width,height);
+    stats_add(i->startpage, 1, 0, stats_time()-start);
+}
+
+static void stats_startclip(struct _gfxdevice*dev, gfxline_t*line)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->startclip(i->out,line);
+    stats_add(i->startclip, 1, line_size(line), stats_time()-start);
+}
+
+static void stats_endclip(struct _gfxdevice*dev)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->endclip(i->out);
+    stats_add(i->endclip, 1, 0, stats_time()-start);
+}
+
+static void stats_stroke(struct _gfxdevice*dev, gfxline_t*line, gfxcoord_t width, gfxcolor_t*color, gfx_capType cap_style, gfx_joinType joint_style, gfxcoord_t miterLimit)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->stroke(i->out, line, width, color, cap_style, joint_style, miterLimit);
+    stats_add(i->stroke, 1, line_size(line), stats_time()-start);
+}
+
+static void stats_fill(struct _gfxdevice*dev, gfxline_t*line, gfxcolor_t*color)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->fill(i->out, line, color);
+    stats_add(i->fill, 1, line_size(line), stats_time()-start);
+}
+
+static void stats_fillbitmap(struct _gfxdevice*dev, gfxline_t*line, gfximage_t*img, gfxmatrix_t*matrix, gfxcxform_t*cxform)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->fillbitmap(i->out, line, img, matrix, cxform);
+    stats_add(i->fillbitmap, 1, (double)img->width*img->height, stats_time()-start);
+}
+
+static void stats_fillgradient(struct _gfxdevice*dev, gfxline_t*line, gfxgradient_t*gradient, gfxgradienttype_t type, gfxmatrix_t*matrix)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->fillgradient(i->out, line, gradient, type, matrix);
+    stats_add(i->fillgradient, 1, line_size(line), stats_time()-start);
+}
+
+static void stats_addfont(struct _gfxdevice*dev, gfxfont_t*font)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->addfont(i->out, font);
+    stats_add(i->addfont, 1, font?font->num_glyphs:0, stats_time()-start);
+}
+
+static void stats_drawchar(struct _gfxdevice*dev, gfxfont_t*font, int glyphnr, gfxcolor_t*color, gfxmatrix_t*matrix)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->drawchar(i->out, font, glyphnr, color, matrix);
+    stats_add(i->drawchar, 1, 0, stats_time()-start);
+}
+
+static void stats_drawlink(struct _gfxdevice*dev, gfxline_t*line, const char*action, const char*text)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->drawlink(i->out, line, action, text);
+    stats_add(i->drawlink, 1, 0, stats_time()-start);
+}
+
+static void stats_endpage(struct _gfxdevice*dev)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    i->out->endpage(i->out);
+    stats_add(i->endpage, 1, 0, stats_time()-start);
+}
+
+static gfxresult_t* stats_finish(struct _gfxdevice*dev)
+{
+    internal_t*i = (internal_t*)dev->internal;
+    double start = stats_time();
+    gfxresult_t*result = i->out->finish(i->out);
+    stats_add(i->finish, 1, 0, stats_time()-start);
+    free(dev->internal);
+    dev->internal = 0;
+    return result;
+}
+
+void gfxdevice_stats_init(gfxdevice_t*dev, gfxdevice_t*out)
+{
+    internal_t*i = (internal_t*)rfx_calloc(sizeof(internal_t));
+    memset(dev, 0, sizeof(gfxdevice_t));
+
+    dev->name = "stats";
+
+    dev->internal = i;
+
+    dev->setparameter = stats_setparameter;
+    dev->startpage = stats_startpage;
+    dev->startclip = stats_startclip;
+    dev->endclip = stats_endclip;
+    dev->stroke = stats_stroke;
+    dev->fill = stats_fill;
+    dev->fillbitmap = stats_fillbitmap;
+    dev->fillgradient = stats_fillgradient;
+    dev->addfont = stats_addfont;
+    dev->drawchar = stats_drawchar;
+    dev->drawlink = stats_drawlink;
+    dev->endpage = stats_endpage;
+    dev->finish = stats_finish;
+
+    i->out = out;
+
+    char group[80];
+    snprintf(group, sizeof(group), "device.%s", out->name?out->name:"unknown");
+    i->startpage = stats_get(group, "startpage");
+    i->startclip = stats_get(group, "startclip");
+    i->endclip = stats_get(group, "endclip");
+    i->stroke = stats_get(group, "stroke");
+    i->fill = stats_get(group, "fill");
+    i->fillbitmap = stats_get(group, "fillbitmap");
+    i->fillgradient = stats_get(group, "fillgradient");
+    i->addfont = stats_get(group, "addfont");
+    i->drawchar = stats_get(group, "drawchar");
+    i->drawlink = stats_get(group, "drawlink");
+    i->endpage = stats_get(group, "endpage");
+    i->finish = stats_get(group, "finish");
+}
@@ -35,6 +35,9 @@
 #define assert(a)
 #endif
 #include <math.h>
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
 #include "../mem.h"
 #include "../log.h"
 #include "../rfxswf.h"
@@ -43,6 +46,7 @@
 #include "swf.h"
 #include "../gfxpoly.h"
 #include "../gfximage.h"
+#include "../stats.h"
 
 #define CHARDATAMAX 1024
 #define CHARMIDX 0
@@ -78,6 +82,19 @@ typedef struct _fontlist
 
 typedef long int twip;
 
+typedef struct _imagejob {
+    TAG*tag; // placeholder tag, which will receive the encoded image
+    int bitid;
+    RGBA*mem;
+    int width, height;
+    int quality;
+    TAG*result;
+    char done;
+    struct _imagejob*next;
+} imagejob_t;
+
+typedef struct _imagepool imagepool_t;
+
 typedef struct _swfmatrix {
     double m11,m12,m21,m22,m31,m32;
 } swfmatrix_t;
@@ -129,6 +146,8 @@ typedef struct _swfoutput_internal
     char*config_externallinkfunction;
     char config_animate;
     double config_framerate;
+    int config_imagethreads;
+    int config_jpegpassthrough;
 
     SWF* swf;
 
@@ -210,6 +229,8 @@ typedef struct _swfoutput_internal
 
     char* mark;
 
+    imagepool_t*imagepool;
+
 } swfoutput_internal;
 
 static const int NO_FONT3=0;
@@ -232,6 +253,7 @@ static void swfoutput_linktopage(gfxdevice_t*dev, int page, gfxline_t*points);
 static void swfoutput_linktourl(gfxdevice_t*dev, const char*url, gfxline_t*points);
 
 static gfxresult_t* swf_finish(gfxdevice_t*driver);
+static void finish_images(swfoutput_internal*i);
 
 static swfoutput_internal* init_internal_struct()
 {
@@ -275,6 +297,8 @@ static swfoutput_internal* init_internal_struct()
     i->config_ignoredraworder=0;
     i->config_drawonlyshapes=0;
     i->config_jpegquality=85;
+    i->config_imagethreads=0;
+    i->config_jpegpassthrough=1;
     i->config_storeallcharacters=0;
     i->config_dots=1;
     i->config_enablezlib=0;
@@ -304,17 +328,14 @@ static swfoutput_internal* init_internal_struct()
     return i;
 };
 
-static int id_error = 0;
-
 static U16 getNewID(gfxdevice_t* dev)
 {
     swfoutput_internal*i = (swfoutput_internal*)dev->internal;
     if(i->currentswfid == 65535) {
-	if(!id_error) {
+	if(!i->overflow) {
 	    msg("<error> ID Table overflow");
 	    msg("<error> This file is too complex to render- SWF only supports 65536 shapes at once");
 	}
-	id_error=1;
 	i->overflow = 1;
 	exit(1);
     }
@@ -324,11 +345,10 @@ static U16 getNewDepth(gfxdevice_t* dev)
 {
     swfoutput_internal*i = (swfoutput_internal*)dev->internal;
     if(i->depth == 65520) {
-	if(!id_error) {
+	if(!i->overflow) {
 	    msg("<error> Depth Table overflow");
 	    msg("<error> This file is too complex to render- SWF only supports 65536 shapes at once");
 	}
-	id_error=1;
 	i->overflow = 1;
 	exit(1);
     }
@@ -1451,6 +1471,8 @@ void swfoutput_finalize(gfxdevice_t*dev)
     if(i->tag && i->tag->id == ST_END)
         return; //already done
 
+    finish_images(i);
+
     i->swf->fileVersion = i->config_flashversion;
     i->swf->frameRate = i->config_framerate*0x100;
 
@@ -1628,6 +1650,8 @@ static void swfoutput_destroy(gfxdevice_t* dev)
         return;
     }
 
+    finish_images(i);
+
     fontlist_t *tmp,*iterator = i->fontlist;
     while(iterator) {
 	if(iterator->swffont) {
@@ -2164,6 +2188,14 @@ int swf_setparameter(gfxdevice_t*dev, const char*name, const char*value)
 	if(val<0) val=0;
 	if(val>101) val=101;
 	i->config_jpegquality = val;
+    } else if(!strcmp(name, "imagethreads")) {
+	i->config_imagethreads = atoi(value);
+#ifndef HAVE_PTHREADS
+	if(i->config_imagethreads)
+	    msg("<warning> No thread support- images will be encoded synchronously");
+#endif
+    } else if(!strcmp(name, "jpegpassthrough")) {
+	i->config_jpegpassthrough = atoi(value);
     } else if(!strcmp(name, "splinequality")) {
 	int v = atoi(value);
 	v = 500-(v*5); // 100% = 0.25 pixel, 0% = 25 pixel
@@ -2212,6 +2244,8 @@ int swf_setparameter(gfxdevice_t*dev, const char*name, const char*value)
         printf("simpleviewer                Add next/previous buttons to the SWF\n");
         printf("animate                     insert a showframe tag after each placeobject (animate draw order of PDF files)\n");
         printf("jpegquality=<quality>       set compression quality of jpeg images\n");
+        printf("imagethreads=<num>          encode images on <num> background threads\n");
+        printf("jpegpassthrough=0/1         store jpegs from the input as-is, without recompressing (default: 1)\n");
 	printf("splinequality=<value>       Set the quality of spline convertion to value (0-100, default: 100).\n");
 	printf("disablelinks                Disable links.\n");
     } else {
@@ -2253,7 +2287,156 @@ static int imageInCache(gfxdevice_t*dev, void*data, int width, int height)
 static void addImageToCache(gfxdevice_t*dev, void*data, int width, int height)
 {
 }
-    
+
+/* images are encoded (as jpeg and lossless, keeping the smaller one) on
+   background threads. add_image() inserts an empty placeholder tag into
+   the tag list, which gets filled in once the image is done. */
+
+#ifdef HAVE_PTHREADS
+struct _imagepool {
+    pthread_t*threads;
+    int num_threads;
+    pthread_mutex_t mutex;
+    pthread_cond_t job_available;
+    pthread_cond_t job_done;
+    imagejob_t*first; // oldest job which hasn't been spliced in yet
+    imagejob_t*last;
+    imagejob_t*next_job; // next job to be encoded
+    int num_pending;
+    char shutdown;
+};
+
+static void* imagepool_thread(void*_pool)
+{
+    imagepool_t*pool = (imagepool_t*)_pool;
+    pthread_mutex_lock(&pool->mutex);
+    while(1) {
+	while(!pool->next_job && !pool->shutdown)
+	    pthread_cond_wait(&pool->job_available, &pool->mutex);
+	if(!pool->next_job)
+	    break;
+	imagejob_t*job = pool->next_job;
+	pool->next_job = job->next;
+	pthread_mutex_unlock(&pool->mutex);
+
+	job->result = swf_AddImage(0, job->bitid, job->mem, job->width, job->height, job->quality);
+	rfx_free(job->mem);job->mem = 0;
+
+	pthread_mutex_lock(&pool->mutex);
+	job->done = 1;
+	pthread_cond_broadcast(&pool->job_done);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+    return 0;
+}
+
+static imagepool_t* imagepool_new(int num_threads)
+{
+    imagepool_t*pool = (imagepool_t*)rfx_calloc(sizeof(imagepool_t));
+    pthread_mutex_init(&pool->mutex, 0);
+    pthread_cond_init(&pool->job_available, 0);
+    pthread_cond_init(&pool->job_done, 0);
+    pool->threads = (pthread_t*)rfx_calloc(sizeof(pthread_t)*num_threads);
+    int t;
+    for(t=0;t<num_threads;t++) {
+	if(pthread_create(&pool->threads[t], 0, imagepool_thread, pool))
+	    break;
+    }
+    pool->num_threads = t;
+    return pool;
+}
+
+/* move the encoded image into the placeholder tag */
+static void imagejob_splice(imagejob_t*job)
+{
+    TAG*tag = job->tag;
+    TAG*result = job->result;
+    tag->id = result->id;
+    tag->data = result->data;
+    tag->len = result->len;
+    tag->memsize = result->memsize;
+    tag->pos = 0;
+    tag->readBit = tag->writeBit = 0;
+    result->data = 0;
+    swf_DeleteTag(0, result);
+}
+
+/* wait until at most max_pending images are still being worked on */
+static void imagepool_flush(imagepool_t*pool, int max_pending)
+{
+    pthread_mutex_lock(&pool->mutex);
+    while(pool->first && (pool->num_pending > max_pending || pool->first->done)) {
+	imagejob_t*job = pool->first;
+	while(!job->done)
+	    pthread_cond_wait(&pool->job_done, &pool->mutex);
+	pool->first = job->next;
+	if(!pool->first)
+	    pool->last = 0;
+	pool->num_pending--;
+	imagejob_splice(job);
+	rfx_free(job);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+static void imagepool_add(imagepool_t*pool, TAG*tag, int bitid, RGBA*mem, int width, int height, int quality)
+{
+    /* don't let the queue (and hence memory usage) grow indefinitely */
+    imagepool_flush(pool, pool->num_threads*2);
+
+    imagejob_t*job = (imagejob_t*)rfx_calloc(sizeof(imagejob_t));
+    job->tag = tag;
+    job->bitid = bitid;
+    job->mem = mem;
+    job->width = width;
+    job->height = height;
+    job->quality = quality;
+
+    pthread_mutex_lock(&pool->mutex);
+    if(pool->last)
+	pool->last->next = job;
+    else
+	pool->first = job;
+    pool->last = job;
+    if(!pool->next_job)
+	pool->next_job = job;
+    pool->num_pending++;
+    pthread_cond_signal(&pool->job_available);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/* finish all images and stop the threads */
+static void imagepool_destroy(imagepool_t*pool)
+{
+    imagepool_flush(pool, 0);
+    pthread_mutex_lock(&pool->mutex);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->job_available);
+    pthread_mutex_unlock(&pool->mutex);
+    int t;
+    for(t=0;t<pool->num_threads;t++) {
+	pthread_join(pool->threads[t], 0);
+    }
+    pthread_cond_destroy(&pool->job_available);
+    pthread_cond_destroy(&pool->job_done);
+    pthread_mutex_destroy(&pool->mutex);
+    rfx_free(pool->threads);
+    rfx_free(pool);
+}
+#endif
+
+static void finish_images(swfoutput_internal*i)
+{
+#ifdef HAVE_PTHREADS
+    if(i->imagepool) {
+	imagepool_destroy(i->imagepool);
+	i->imagepool = 0;
+    }
+#endif
+}
+
+STAT(stat_jpeg_passthrough, "image", "jpeg_passthrough");
+
 static int add_image(swfoutput_internal*i, gfximage_t*img, int targetwidth, int targetheight, int* newwidth, int* newheight)
 {
     gfxdevice_t*dev = i->dev;
@@ -2328,7 +2511,32 @@ static int add_image(swfoutput_internal*i, gfximage_t*img, int targetwidth, int
     if(cacheid<=0) {
 	bitid = getNewID(dev);
 
-	i->tag = swf_AddImage(i->tag, bitid, mem, sizex, sizey, i->config_jpegquality);
+	if(img->jpeg_data && !newpic && i->config_jpegpassthrough) {
+	    /* the image is a jpeg we don't need to scale: store it unchanged */
+	    msg("<verbose> Storing %d bytes of jpeg data for image %d", img->jpeg_size, bitid);
+	    i->tag = swf_InsertTag(i->tag, ST_DEFINEBITSJPEG2);
+	    swf_SetU16(i->tag, bitid);
+	    swf_SetBlock(i->tag, img->jpeg_data, img->jpeg_size);
+	    if(stats_enabled)
+		stats_add(&stat_jpeg_passthrough, 1, img->jpeg_size, 0);
+	} else {
+#ifdef HAVE_PTHREADS
+	    if(i->config_imagethreads>0 && !i->imagepool) {
+		i->imagepool = imagepool_new(i->config_imagethreads);
+	    }
+	    if(i->imagepool && i->imagepool->num_threads) {
+		RGBA*copy = newpic;
+		if(!copy) {
+		    copy = (RGBA*)rfx_alloc(sizex*sizey*sizeof(RGBA));
+		    memcpy(copy, mem, sizex*sizey*sizeof(RGBA));
+		}
+		newpic = 0;
+		i->tag = swf_InsertTag(i->tag, ST_DEFINEBITSLOSSLESS);
+		imagepool_add(i->imagepool, i->tag, bitid, copy, sizex, sizey, i->config_jpegquality);
+	    } else
+#endif
+	    i->tag = swf_AddImage(i->tag, bitid, mem, sizex, sizey, i->config_jpegquality);
+	}
 	addImageToCache(dev, mem, sizex, sizey);
     } else {
 	bitid = cacheid;
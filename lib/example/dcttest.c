@@ -0,0 +1,209 @@
+/* dcttest.c
+
+   Accuracy test for the H.263 encoder's DCT/IDCT (lib/h.263/dct.c), following
+   IEEE 1180-1990: random blocks are transformed with a double precision DCT,
+   and the integer idct() has to reproduce the double precision IDCT of the
+   rounded coefficients within the limits of the standard. dct() may not
+   be off by more than one from the rounded double precision DCT.
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../h.263/dct.h"
+
+#define BLOCKS 10000
+
+/* the random number generator from the standard */
+static long randx = 1;
+static long ieee_rand(long L, long H)
+{
+    static double z = (double)0x7fffffff;
+    randx = (randx * 1103515245) + 12345;
+    long i = randx & 0x7ffffffe;
+    double x = ((double)i) / z;
+    x *= (L+H+1);
+    long j = x;
+    return j-L;
+}
+
+static double c[8][8];
+
+static void init_cos()
+{
+    int u,x;
+    for(u=0;u<8;u++) {
+	double s = u?0.5:sqrt(0.125);
+	for(x=0;x<8;x++)
+	    c[u][x] = s*cos((2*x+1)*u*M_PI/16);
+    }
+}
+
+static void ref_dct(const double*src, double*dest)
+{
+    int u,v,x,y;
+    for(v=0;v<8;v++)
+    for(u=0;u<8;u++) {
+	double sum = 0;
+	for(y=0;y<8;y++)
+	for(x=0;x<8;x++)
+	    sum += c[v][y]*c[u][x]*src[y*8+x];
+	dest[v*8+u] = sum;
+    }
+}
+
+static void ref_idct(const double*src, double*dest)
+{
+    int u,v,x,y;
+    for(y=0;y<8;y++)
+    for(x=0;x<8;x++) {
+	double sum = 0;
+	for(v=0;v<8;v++)
+	for(u=0;u<8;u++)
+	    sum += c[v][y]*c[u][x]*src[v*8+u];
+	dest[y*8+x] = sum;
+    }
+}
+
+static int clamp(double v, int min, int max)
+{
+    int i = (int)floor(v+0.5);
+    return i<min?min:(i>max?max:i);
+}
+
+typedef struct {
+    double err[64];
+    double sqerr[64];
+    int peak;
+} stats_t;
+
+static void stats_add(stats_t*s, const int*test, const int*ref)
+{
+    int t;
+    for(t=0;t<64;t++) {
+	int e = test[t]-ref[t];
+	s->err[t] += e;
+	s->sqerr[t] += e*e;
+	if(abs(e) > s->peak)
+	    s->peak = abs(e);
+    }
+}
+
+/* returns nonzero if one of the IEEE 1180 limits is exceeded. The standard
+   only covers the IDCT, so for the DCT only the peak error is checked. */
+static int stats_check(const char*name, stats_t*s, char peak_only)
+{
+    double pmse=0, pme=0, omse=0, ome=0;
+    int t;
+    for(t=0;t<64;t++) {
+	double mse = s->sqerr[t]/BLOCKS;
+	double me = fabs(s->err[t]/BLOCKS);
+	if(mse>pmse) pmse = mse;
+	if(me>pme) pme = me;
+	omse += s->sqerr[t];
+	ome += s->err[t];
+    }
+    omse /= 64.0*BLOCKS;
+    ome = fabs(ome/(64.0*BLOCKS));
+    int fail = s->peak>1;
+    if(!peak_only)
+	fail |= pmse>0.06 || omse>0.02 || pme>0.015 || ome>0.0015;
+    printf("%-22s peak %d  pmse %.4f  omse %.4f  pme %.4f  ome %.5f  %s\n",
+	    name, s->peak, pmse, omse, pme, ome, fail?"FAILED":"ok");
+    return fail;
+}
+
+static int test_range(int L, int H, int sign)
+{
+    stats_t si, sf;
+    memset(&si, 0, sizeof(si));
+    memset(&sf, 0, sizeof(sf));
+    randx = 1;
+    int b,t;
+    for(b=0;b<BLOCKS;b++) {
+	double block[64], coeff[64], pixels[64];
+	int icoeff[64], ref[64], test[64];
+	for(t=0;t<64;t++)
+	    block[t] = ieee_rand(L,H)*sign;
+
+	ref_dct(block, coeff);
+	for(t=0;t<64;t++)
+	    icoeff[t] = clamp(coeff[t], -2048, 2047);
+
+	/* idct: the double IDCT of the rounded coefficients is the reference */
+	for(t=0;t<64;t++)
+	    coeff[t] = icoeff[t];
+	ref_idct(coeff, pixels);
+	for(t=0;t<64;t++) {
+	    ref[t] = clamp(pixels[t], -256, 255);
+	    test[t] = icoeff[t];
+	}
+	idct(test);
+	for(t=0;t<64;t++)
+	    test[t] = test[t]<-256?-256:(test[t]>255?255:test[t]);
+	stats_add(&si, test, ref);
+
+	/* dct: compare with the rounded double DCT. The encoder only passes
+	   9 bit values to it. */
+	if(L<=256 && H<=255) {
+	    for(t=0;t<64;t++)
+		test[t] = (int)block[t];
+	    dct(test);
+	    stats_add(&sf, test, icoeff);
+	}
+    }
+    char name[80];
+    int fail = 0;
+    sprintf(name, "idct [-%d,%d]%s", L, H, sign<0?" neg":"");
+    fail |= stats_check(name, &si, 0);
+    if(L<=256 && H<=255) {
+	sprintf(name, "dct  [-%d,%d]%s", L, H, sign<0?" neg":"");
+	fail |= stats_check(name, &sf, 1);
+    }
+    return fail;
+}
+
+int main()
+{
+    int fail = 0;
+    init_cos();
+    fail |= test_range(256, 255, 1);
+    fail |= test_range(5, 5, 1);
+    fail |= test_range(300, 300, 1);
+    fail |= test_range(256, 255, -1);
+    fail |= test_range(5, 5, -1);
+    fail |= test_range(300, 300, -1);
+
+    /* all-zero input has to give all-zero output */
+    int zero[64];
+    int t;
+    memset(zero, 0, sizeof(zero));
+    idct(zero);
+    for(t=0;t<64;t++) {
+	if(zero[t]) {
+	    printf("idct of zero block isn't zero\n");
+	    fail = 1;
+	    break;
+	}
+    }
+    printf("%s\n", fail?"FAILED":"all tests passed");
+    return fail;
+}
@@ -0,0 +1,479 @@
+/* dictbench.c
+
+   Compares the dict_t implementation in q.c against the chained hashtable
+   it replaced, on the kind of keys the rest of swftools uses dictionaries for:
+
+     registry   classes, keyed by package+name (as3/registry.c)
+     members    class members, keyed by name (as3/registry.c)
+     pool       constant pool strings, looked up before being added (as3/pool.c)
+     points     endpoint multiplicity check of gfxpoly (gfxpoly/poly.c)
+     segments   pointer set with insert/remove churn (gfxpoly/poly.c)
+     fontcache  a few dozen font ids, one lookup per character (pdf/InfoOutputDev.cc)
+
+   The class and member names are those of the builtin AS3 class library.
+
+   Usage: ./dictbench [-n <repetitions>]
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../q.h"
+#include "../stats.h"
+#include "../as3/registry.h"
+#include "../as3/builtin.h"
+
+/* opcodes.h (from registry.h) defines these as macros */
+#undef dup
+#undef equals
+
+// ------------------------- the previous dict_t -----------------------------
+
+typedef struct _chained {
+    dictentry_t**slots;
+    type_t*key_type;
+    int hashsize;
+    int num;
+} chained_t;
+
+static void* chained_new(type_t*t)
+{
+    chained_t*h = (chained_t*)rfx_calloc(sizeof(chained_t));
+    h->hashsize = 1;
+    h->slots = (dictentry_t**)rfx_calloc(sizeof(dictentry_t*)*h->hashsize);
+    h->key_type = t;
+    return h;
+}
+static void chained_expand(chained_t*h, int newlen)
+{
+    dictentry_t**newslots = (dictentry_t**)rfx_calloc(sizeof(dictentry_t*)*newlen);
+    int t;
+    for(t=0;t<h->hashsize;t++) {
+        dictentry_t*e = h->slots[t];
+        while(e) {
+            dictentry_t*next = e->next;
+            unsigned int newhash = e->hash%newlen;
+            e->next = newslots[newhash];
+            newslots[newhash] = e;
+            e = next;
+        }
+    }
+    rfx_free(h->slots);
+    h->slots = newslots;
+    h->hashsize = newlen;
+}
+static void chained_put(void*_h, const void*key, void*data)
+{
+    chained_t*h = (chained_t*)_h;
+    unsigned int hash = h->key_type->hash(key);
+    dictentry_t*e = (dictentry_t*)rfx_alloc(sizeof(dictentry_t));
+    unsigned int hash2 = hash % h->hashsize;
+    e->key = h->key_type->dup(key);
+    e->hash = hash;
+    e->next = h->slots[hash2];
+    e->data = data;
+    h->slots[hash2] = e;
+    h->num++;
+}
+static void* chained_lookup(void*_h, const void*key)
+{
+    chained_t*h = (chained_t*)_h;
+    if(!h->num)
+        return 0;
+    unsigned int ohash = h->key_type->hash(key);
+    unsigned int hash = ohash % h->hashsize;
+    dictentry_t*e = h->slots[hash];
+    if(e && h->key_type->equals(e->key, key))
+        return e->data;
+    else if(e)
+        e = e->next;
+    if(e && h->num*3 >= h->hashsize*2) {
+        int newsize = h->hashsize;
+        while(h->num*3 >= newsize*2)
+            newsize = newsize<15?15:(newsize+1)*2-1;
+        chained_expand(h, newsize);
+        hash = ohash % h->hashsize;
+        e = h->slots[hash];
+        if(e && h->key_type->equals(e->key, key))
+            return e->data;
+        else if(e)
+            e = e->next;
+    }
+    dictentry_t*last = h->slots[hash];
+    while(e) {
+        if(h->key_type->equals(e->key, key)) {
+            last->next = e->next;
+            e->next = h->slots[hash];
+            h->slots[hash] = e;
+            return e->data;
+        }
+        last=e;
+        e = e->next;
+    }
+    return 0;
+}
+static char chained_del(void*_h, const void*key)
+{
+    chained_t*h = (chained_t*)_h;
+    if(!h->num)
+        return 0;
+    unsigned int hash = h->key_type->hash(key) % h->hashsize;
+    dictentry_t*e = h->slots[hash], *prev=0;
+    while(e) {
+        if(h->key_type->equals(e->key, key)) {
+            if(prev)
+                prev->next = e->next;
+            else
+                h->slots[hash] = e->next;
+            h->key_type->free(e->key);
+            rfx_free(e);
+            h->num--;
+            return 1;
+        }
+        prev = e;
+        e = e->next;
+    }
+    return 0;
+}
+static void chained_destroy(void*_h)
+{
+    chained_t*h = (chained_t*)_h;
+    int t;
+    for(t=0;t<h->hashsize;t++) {
+        dictentry_t*e = h->slots[t];
+        while(e) {
+            dictentry_t*next = e->next;
+            h->key_type->free(e->key);
+            rfx_free(e);
+            e = next;
+        }
+    }
+    rfx_free(h->slots);
+    rfx_free(h);
+}
+
+// ------------------------- the current dict_t ------------------------------
+
+static void* dict_new_wrapper(type_t*t) {return dict_new2(t);}
+static void dict_put_wrapper(void*h, const void*key, void*data) {dict_put((dict_t*)h, key, data);}
+static void* dict_lookup_wrapper(void*h, const void*key) {return dict_lookup((dict_t*)h, key);}
+static char dict_del_wrapper(void*h, const void*key) {return dict_del((dict_t*)h, key);}
+static void dict_destroy_wrapper(void*h) {dict_destroy((dict_t*)h);}
+
+typedef struct _impl {
+    const char*name;
+    void* (*create)(type_t*t);
+    void (*put)(void*h, const void*key, void*data);
+    void* (*lookup)(void*h, const void*key);
+    char (*del)(void*h, const void*key);
+    void (*destroy)(void*h);
+} impl_t;
+
+static impl_t impls[] = {
+    {"chained", chained_new, chained_put, chained_lookup, chained_del, chained_destroy},
+    {"dict_t", dict_new_wrapper, dict_put_wrapper, dict_lookup_wrapper, dict_del_wrapper, dict_destroy_wrapper},
+};
+
+// ------------------------------ test data ----------------------------------
+
+static slotinfo_t**classes = 0;
+static int num_classes = 0;
+static slotinfo_t*const**class_members = 0;
+static const char**names = 0;
+static int num_names = 0;
+
+static unsigned int rnd = 0x12345678;
+static unsigned int random32()
+{
+    rnd = rnd*1103515245 + 12345;
+    return rnd >> 8;
+}
+
+static void collect_builtins()
+{
+    int num = 0, t;
+    const builtin_t*b = builtin_getclasses(&num);
+    classes = (slotinfo_t**)rfx_alloc(sizeof(slotinfo_t*)*num);
+    class_members = (slotinfo_t*const**)rfx_alloc(sizeof(slotinfo_t*const*)*num);
+    int size = 0;
+    for(t=0;t<num;t++) {
+        class_members[num_classes] = b[t].members;
+        classes[num_classes++] = b[t].slot;
+        slotinfo_t*const*m = b[t].members;
+        while(m && *m) {
+            if(num_names == size) {
+                size = size?size*2:1024;
+                names = (const char**)rfx_realloc(names, sizeof(char*)*size);
+            }
+            names[num_names++] = (*m++)->name;
+        }
+    }
+}
+
+typedef struct _point {
+    int x,y;
+} point_t;
+static char point_equals(const void*o1, const void*o2)
+{
+    const point_t*p1 = o1;
+    const point_t*p2 = o2;
+    return p1->x == p2->x && p1->y == p2->y;
+}
+static unsigned int point_hash(const void*o)
+{
+    const point_t*p = o;
+    /* x^y alone is the same for lots of points on a grid */
+    return p->x*2654435761u^p->y;
+}
+static void* point_dup(const void*o)
+{
+    point_t*n = malloc(sizeof(point_t));
+    *n = *(const point_t*)o;
+    return n;
+}
+static void point_free(void*o)
+{
+    free(o);
+}
+static type_t point_type = {
+    equals: point_equals,
+    hash: point_hash,
+    dup: point_dup,
+    free: point_free,
+    key_size: sizeof(point_t),
+};
+
+// ------------------------------ workloads ----------------------------------
+
+/* every workload returns a checksum, which has to be the same for all implementations */
+
+static unsigned int bench_registry(impl_t*impl)
+{
+    void*d = impl->create(&slotinfo_type);
+    unsigned int sum = 0;
+    int t, r;
+    for(t=0;t<num_classes;t++)
+        impl->put(d, classes[t], classes[t]);
+    /* like find_class(): try the current package first, then the global one */
+    slotinfo_t tmp;
+    memset(&tmp, 0, sizeof(tmp));
+    for(r=0;r<20;r++) {
+        for(t=0;t<num_classes;t++) {
+            tmp.package = "com.example";
+            tmp.name = classes[t]->name;
+            sum += impl->lookup(d, &tmp)!=0;
+            tmp.package = classes[t]->package;
+            sum += impl->lookup(d, &tmp)!=0;
+        }
+    }
+    impl->destroy(d);
+    return sum;
+}
+
+static unsigned int bench_members(impl_t*impl)
+{
+    unsigned int sum = 0;
+    int t;
+    slotinfo_t tmp;
+    memset(&tmp, 0, sizeof(tmp));
+    for(t=0;t<num_classes;t++) {
+        slotinfo_t*const*members = class_members[t];
+        if(!members)
+            continue;
+        void*d = impl->create(&memberinfo_type);
+        slotinfo_t*const*m;
+        for(m=members;*m;m++) {
+            impl->put(d, *m, *m);
+        }
+        /* look up the members of this class, and (mostly missing)
+           names of members of other classes */
+        int r;
+        for(r=0;r<10;r++) {
+            for(m=members;*m;m++) {
+                sum += impl->lookup(d, *m)!=0;
+            }
+            tmp.package = "";
+            tmp.name = names[random32()%num_names];
+            sum += impl->lookup(d, &tmp)!=0;
+        }
+        impl->destroy(d);
+    }
+    return sum;
+}
+
+static unsigned int bench_pool(impl_t*impl)
+{
+    unsigned int sum = 0;
+    int r, t;
+    for(r=0;r<10;r++) {
+        void*d = impl->create(&charptr_type);
+        int num = 0;
+        for(t=0;t<20000;t++) {
+            /* a few names are used a lot */
+            int nr = random32()%num_names;
+            if(random32()&1)
+                nr %= 64;
+            const char*s = names[nr];
+            if(!impl->lookup(d, s))
+                impl->put(d, s, (void*)(ptroff_t)++num);
+        }
+        sum += num;
+        impl->destroy(d);
+    }
+    return sum;
+}
+
+static unsigned int bench_points(impl_t*impl)
+{
+    unsigned int sum = 0;
+    int r, t, s;
+    for(r=0;r<10;r++) {
+        void*d = impl->create(&point_type);
+        /* polygons with shared vertices, on a 1/20 pixel grid */
+        for(t=0;t<2000;t++) {
+            int x = (random32()%1000)*20;
+            int y = (random32()%1000)*20;
+            for(s=0;s<16;s++) {
+                point_t p = {x+(s&3)*20, y+(s>>2)*20};
+                ptroff_t count = (ptroff_t)impl->lookup(d, &p);
+                if(!count) {
+                    impl->put(d, &p, (void*)1);
+                } else {
+                    impl->del(d, &p);
+                    impl->put(d, &p, (void*)(count+1));
+                }
+            }
+        }
+        for(t=0;t<20000;t++) {
+            point_t p = {(random32()%1000)*20, (random32()%1000)*20};
+            sum += (ptroff_t)impl->lookup(d, &p);
+        }
+        impl->destroy(d);
+    }
+    return sum;
+}
+
+static unsigned int bench_segments(impl_t*impl)
+{
+    unsigned int sum = 0;
+    int num_segments = 5000;
+    void**segments = (void**)rfx_alloc(sizeof(void*)*num_segments);
+    int t, y, s;
+    for(t=0;t<num_segments;t++)
+        segments[t] = rfx_alloc(64);
+    void*d = impl->create(&ptr_type);
+    int active[64];
+    for(y=0;y<20000;y++) {
+        /* segments intersecting in this scanline */
+        int num = random32()%64;
+        for(s=0;s<num;s++) {
+            active[s] = random32()%num_segments;
+            if(!impl->lookup(d, segments[active[s]]))
+                impl->put(d, segments[active[s]], segments[active[s]]);
+        }
+        for(s=0;s<num;s++) {
+            sum += impl->del(d, segments[active[s]]);
+        }
+    }
+    impl->destroy(d);
+    for(t=0;t<num_segments;t++)
+        rfx_free(segments[t]);
+    rfx_free(segments);
+    return sum;
+}
+
+static unsigned int bench_fontcache(impl_t*impl)
+{
+    unsigned int sum = 0;
+    char ids[50][64];
+    int t;
+    void*d = impl->create(&charptr_type);
+    for(t=0;t<50;t++) {
+        sprintf(ids[t], "%s-%d-%08x", names[t*7%num_names], t, random32());
+        impl->put(d, ids[t], (void*)(ptroff_t)(t+1));
+    }
+    for(t=0;t<1000000;t++) {
+        /* text mostly stays in the same font */
+        int nr = (t/200 + (random32()%10==0)) % 50;
+        sum += (ptroff_t)impl->lookup(d, ids[nr]);
+    }
+    impl->destroy(d);
+    return sum;
+}
+
+typedef struct _workload {
+    const char*name;
+    unsigned int (*run)(impl_t*impl);
+} workload_t;
+
+static workload_t workloads[] = {
+    {"registry", bench_registry},
+    {"members", bench_members},
+    {"pool", bench_pool},
+    {"points", bench_points},
+    {"segments", bench_segments},
+    {"fontcache", bench_fontcache},
+};
+
+int main(int argn, char*argv[])
+{
+    int repetitions = 3;
+    if(argn>2 && !strcmp(argv[1], "-n")) {
+        repetitions = atoi(argv[2]);
+    } else if(argn>1) {
+        printf("Usage: %s [-n <repetitions>]\n", argv[0]);
+        return 1;
+    }
+    collect_builtins();
+    printf("%d classes, %d member names\n\n", num_classes, num_names);
+
+    int num_impls = sizeof(impls)/sizeof(impls[0]);
+    int num_workloads = sizeof(workloads)/sizeof(workloads[0]);
+    int w, i, r;
+    int errors = 0;
+    printf("%-10s", "");
+    for(i=0;i<num_impls;i++)
+        printf(" %10s", impls[i].name);
+    printf("\n");
+    for(w=0;w<num_workloads;w++) {
+        printf("%-10s", workloads[w].name);
+        unsigned int sum0 = 0;
+        for(i=0;i<num_impls;i++) {
+            double best = 0;
+            for(r=0;r<repetitions;r++) {
+                rnd = 0x12345678;
+                double start = stats_time();
+                unsigned int sum = workloads[w].run(&impls[i]);
+                double time = stats_time() - start;
+                if(!r || time < best)
+                    best = time;
+                if(!i && !r)
+                    sum0 = sum;
+                else if(sum != sum0)
+                    errors++;
+            }
+            printf(" %8.2fms", best*1000);
+        }
+        printf("\n");
+    }
+    if(errors)
+        printf("%d checksum mismatches\n", errors);
+    return errors?1:0;
+}
@@ -0,0 +1,256 @@
+/* gfxstress.c
+
+   Converts several documents at the same time, on different threads, through
+   the gfx pipeline (pdf/swf/image reader -> swf device and render device),
+   writes the rendered pages as png and jpeg files, and checks that every
+   thread produces the same output as a single-threaded run.
+
+   To find data races, build the library and this program with
+   CFLAGS="-g -O1 -fsanitize=thread" (./configure CFLAGS=...; make), then run
+   e.g. ./gfxstress -t 8 -n 4 ../../doc/*.swf ../../spec/*.pdf image.png
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "../rfxswf.h"
+#include "../q.h"
+#include "../png.h"
+#include "../jpeg.h"
+#include "../gfxdevice.h"
+#include "../gfxsource.h"
+#include "../devices/swf.h"
+#include "../devices/render.h"
+#include "../readers/swf.h"
+#include "../readers/image.h"
+#include "../pdf/pdf.h"
+
+static int num_files = 0;
+static char**files = 0;
+static int iterations = 2;
+
+/* the pdf reader keeps global parameters, so all threads share one */
+static gfxsource_t*pdf_driver = 0;
+
+/* reference checksums, from the single-threaded run */
+static unsigned int*swf_crc = 0;
+static unsigned int*render_crc = 0;
+static unsigned int*image_crc = 0;
+
+typedef struct _job {
+    int nr;
+    int errors;
+} job_t;
+
+static unsigned int swf_checksum(gfxresult_t*result)
+{
+    SWF*swf = (SWF*)result->get(result, "swf");
+    unsigned int crc = 0;
+    TAG*tag;
+    for(tag=swf->firstTag;tag;tag=tag->next) {
+	U16 id = swf_GetTagID(tag);
+	crc = crc32_add_bytes(crc, &id, sizeof(id));
+	crc = crc32_add_bytes(crc, tag->data, tag->len);
+    }
+    swf_FreeTags(swf);
+    free(swf);
+    return crc;
+}
+
+static unsigned int file_checksum(unsigned int crc, const char*filename)
+{
+    FILE*fi = fopen(filename, "rb");
+    if(!fi)
+	return crc;
+    char buf[4096];
+    int len;
+    while((len = fread(buf, 1, sizeof(buf), fi)) > 0)
+	crc = crc32_add_bytes(crc, buf, len);
+    fclose(fi);
+    unlink(filename);
+    return crc;
+}
+
+/* checksums the rendered pages, and what the png and jpeg writers make of them */
+static unsigned int render_checksum(gfxresult_t*result, unsigned int*image_crc)
+{
+    unsigned int crc = 0;
+    int nr = 0;
+    char name[32];
+    char filename[64];
+    gfximage_t*img;
+    *image_crc = 0;
+    while(1) {
+	sprintf(name, "page%d", nr++);
+	if(!(img = (gfximage_t*)result->get(result, name)))
+	    break;
+	crc = crc32_add_bytes(crc, img->data, img->width*img->height*sizeof(gfxcolor_t));
+
+	sprintf(filename, "/tmp/gfxstress%08lx.png", (unsigned long)pthread_self());
+	png_write(filename, (unsigned char*)img->data, img->width, img->height);
+	*image_crc = file_checksum(*image_crc, filename);
+	png_write_palette_based_2(filename, (unsigned char*)img->data, img->width, img->height);
+	*image_crc = file_checksum(*image_crc, filename);
+
+	int size = img->width*img->height*3+4096;
+	unsigned char*jpeg = (unsigned char*)malloc(size);
+	unsigned char*rgb = (unsigned char*)malloc(img->width*img->height*3);
+	int t;
+	for(t=0;t<img->width*img->height;t++) {
+	    rgb[t*3+0] = img->data[t].r;
+	    rgb[t*3+1] = img->data[t].g;
+	    rgb[t*3+2] = img->data[t].b;
+	}
+	int len = jpeg_save_to_mem(rgb, img->width, img->height, 85, jpeg, size, 3);
+	*image_crc = crc32_add_bytes(*image_crc, jpeg, len);
+	free(rgb);
+	free(jpeg);
+    }
+    return crc;
+}
+
+static gfxsource_t*open_driver(const char*filename)
+{
+    const char*ext = strrchr(filename, '.');
+    if(ext && (!strcasecmp(ext, ".swf")))
+	return gfxsource_swf_create();
+    if(ext && (!strcasecmp(ext, ".pdf")))
+	return pdf_driver;
+    return gfxsource_image_create();
+}
+
+static void close_driver(gfxsource_t*driver)
+{
+    if(driver != pdf_driver)
+	driver->destroy(driver);
+}
+
+static void convert(const char*filename, unsigned int*crc1, unsigned int*crc2, unsigned int*crc3)
+{
+    gfxsource_t*driver = open_driver(filename);
+    gfxdocument_t*doc = driver->open(driver, filename);
+    *crc1 = *crc2 = *crc3 = 0;
+    if(!doc) {
+	fprintf(stderr, "Couldn't open %s\n", filename);
+	close_driver(driver);
+	return;
+    }
+
+    gfxdevice_t swf, render;
+    gfxdevice_swf_init(&swf);
+    gfxdevice_render_init(&render);
+    render.setparameter(&render, "antialize", "2");
+
+    int pagenr;
+    for(pagenr=1;pagenr<=doc->num_pages;pagenr++) {
+	gfxpage_t*page = doc->getpage(doc, pagenr);
+	swf.startpage(&swf, page->width, page->height);
+	page->render(page, &swf);
+	swf.endpage(&swf);
+	render.startpage(&render, page->width, page->height);
+	page->render(page, &render);
+	render.endpage(&render);
+	page->destroy(page);
+    }
+
+    gfxresult_t*r1 = swf.finish(&swf);
+    *crc1 = swf_checksum(r1);
+    r1->destroy(r1);
+    gfxresult_t*r2 = render.finish(&render);
+    *crc2 = render_checksum(r2, crc3);
+    r2->destroy(r2);
+
+    doc->destroy(doc);
+    close_driver(driver);
+}
+
+static void* worker(void*_job)
+{
+    job_t*job = (job_t*)_job;
+    int t, f;
+    for(t=0;t<iterations;t++) {
+	/* every thread starts with a different file */
+	for(f=0;f<num_files;f++) {
+	    int nr = (f+job->nr)%num_files;
+	    unsigned int crc1, crc2, crc3;
+	    convert(files[nr], &crc1, &crc2, &crc3);
+	    if(crc1 != swf_crc[nr] || crc2 != render_crc[nr] || crc3 != image_crc[nr]) {
+		fprintf(stderr, "thread %d: %s converted differently (%08x/%08x/%08x instead of %08x/%08x/%08x)\n",
+			job->nr, files[nr], crc1, crc2, crc3, swf_crc[nr], render_crc[nr], image_crc[nr]);
+		job->errors++;
+	    }
+	}
+    }
+    return 0;
+}
+
+int main(int argn, char*argv[])
+{
+    int num_threads = 4;
+    int t;
+    while(argn>1 && argv[1][0]=='-') {
+	if(!strcmp(argv[1], "-t") && argn>2) {
+	    num_threads = atoi(argv[2]);
+	} else if(!strcmp(argv[1], "-n") && argn>2) {
+	    iterations = atoi(argv[2]);
+	} else {
+	    break;
+	}
+	argv+=2;argn-=2;
+    }
+    if(argn<2 || num_threads<1) {
+	printf("Usage: %s [-t <threads>] [-n <iterations>] file1.pdf|.swf|.png|.jpg [file2 ...]\n", argv[0]);
+	return 1;
+    }
+    files = &argv[1];
+    num_files = argn-1;
+
+    swf_crc = (unsigned int*)malloc(sizeof(unsigned int)*num_files);
+    render_crc = (unsigned int*)malloc(sizeof(unsigned int)*num_files);
+    image_crc = (unsigned int*)malloc(sizeof(unsigned int)*num_files);
+    pdf_driver = gfxsource_pdf_create();
+    for(t=0;t<num_files;t++) {
+	convert(files[t], &swf_crc[t], &render_crc[t], &image_crc[t]);
+	printf("%s: %08x %08x %08x\n", files[t], swf_crc[t], render_crc[t], image_crc[t]);
+    }
+
+    pthread_t*threads = (pthread_t*)malloc(sizeof(pthread_t)*num_threads);
+    job_t*jobs = (job_t*)calloc(num_threads, sizeof(job_t));
+    for(t=0;t<num_threads;t++) {
+	jobs[t].nr = t;
+	pthread_create(&threads[t], 0, worker, &jobs[t]);
+    }
+    int errors = 0;
+    for(t=0;t<num_threads;t++) {
+	pthread_join(threads[t], 0);
+	errors += jobs[t].errors;
+    }
+    printf("%d threads, %d conversions, %d errors\n", num_threads, num_threads*iterations*num_files, errors);
+
+    free(jobs);
+    free(threads);
+    free(swf_crc);
+    free(render_crc);
+    free(image_crc);
+    pdf_driver->destroy(pdf_driver);
+    return errors?1:0;
+}
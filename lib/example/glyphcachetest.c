@@ -0,0 +1,175 @@
+/* glyphcachetest.c
+
+   Renders documents through the render device with and without the glyph
+   cache, at several antialiasing levels, and checks that both produce
+   exactly the same pixels. Also draws one glyph at enough different sizes
+   to make the cache flush itself.
+
+   Usage: ./glyphcachetest [../../spec/*.pdf]
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../gfxdevice.h"
+#include "../gfxsource.h"
+#include "../gfxtools.h"
+#include "../devices/render.h"
+#include "../readers/swf.h"
+#include "../pdf/pdf.h"
+
+static gfxresult_t* render(gfxdocument_t*doc, int pagenr, const char*antialize, const char*glyphcache)
+{
+    gfxdevice_t dev;
+    gfxdevice_render_init(&dev);
+    dev.setparameter(&dev, "antialize", antialize);
+    dev.setparameter(&dev, "glyphcache", glyphcache);
+    gfxpage_t*page = doc->getpage(doc, pagenr);
+    dev.startpage(&dev, page->width, page->height);
+    page->render(page, &dev);
+    dev.endpage(&dev);
+    page->destroy(page);
+    return dev.finish(&dev);
+}
+
+/* returns the number of bytes which differ */
+static int compare(gfximage_t*img1, gfximage_t*img2, int*maxdiff)
+{
+    *maxdiff = 0;
+    if(img1->width != img2->width || img1->height != img2->height) {
+	*maxdiff = 256;
+	return 1;
+    }
+    unsigned char*p1 = (unsigned char*)img1->data;
+    unsigned char*p2 = (unsigned char*)img2->data;
+    int size = img1->width*img1->height*sizeof(gfxcolor_t);
+    int t, diff = 0;
+    for(t=0;t<size;t++) {
+	if(p1[t] != p2[t]) {
+	    int d = abs(p1[t]-p2[t]);
+	    if(d > *maxdiff)
+		*maxdiff = d;
+	    diff++;
+	}
+    }
+    return diff;
+}
+
+static int compare_results(gfxresult_t*r1, gfxresult_t*r2, const char*name, int pagenr, const char*antialize)
+{
+    gfximage_t*img1 = (gfximage_t*)r1->get(r1, "page0");
+    gfximage_t*img2 = (gfximage_t*)r2->get(r2, "page0");
+    int maxdiff = 0;
+    int diff = compare(img1, img2, &maxdiff);
+    if(diff) {
+	printf("%s: page %d, antialize %s: %d bytes differ, by up to %d\n",
+		name, pagenr, antialize, diff, maxdiff);
+    }
+    r1->destroy(r1);
+    r2->destroy(r2);
+    return diff?1:0;
+}
+
+/* draws a frame-shaped glyph at so many different sizes that the cached
+   masks exceed the size limit of the glyph cache */
+static gfxresult_t* render_sizes(const char*antialize, const char*glyphcache)
+{
+    gfxglyph_t glyph;
+    memset(&glyph, 0, sizeof(glyph));
+    glyph.line = gfxline_append(gfxline_makerectangle(0.05,0.05,0.95,0.95),
+				gfxline_makerectangle(0.3,0.3,0.7,0.7));
+    gfxfont_t font;
+    memset(&font, 0, sizeof(font));
+    font.id = "frame";
+    font.num_glyphs = 1;
+    font.glyphs = &glyph;
+
+    gfxdevice_t dev;
+    gfxdevice_render_init(&dev);
+    dev.setparameter(&dev, "antialize", antialize);
+    dev.setparameter(&dev, "glyphcache", glyphcache);
+    dev.startpage(&dev, 600, 600);
+    gfxcolor_t color = {32,0,0,0};
+    int t;
+    for(t=0;t<4400;t++) {
+	double size = (60 + t*0.1) / atoi(antialize);
+	gfxmatrix_t m1 = {size,0,10, 0,size,10};
+	dev.drawchar(&dev, &font, 0, &color, &m1);
+	/* and again somewhere else, from the cache */
+	gfxmatrix_t m2 = {size,0,20+t%7, 0,size,30+t%5};
+	dev.drawchar(&dev, &font, 0, &color, &m2);
+    }
+    dev.endpage(&dev);
+    gfxline_free(glyph.line);
+    return dev.finish(&dev);
+}
+
+static int test_sizes()
+{
+    static const char*levels[] = {"1", "2"};
+    int errors = 0;
+    int l;
+    for(l=0;l<sizeof(levels)/sizeof(levels[0]);l++) {
+	gfxresult_t*r1 = render_sizes(levels[l], "1");
+	gfxresult_t*r2 = render_sizes(levels[l], "0");
+	errors += compare_results(r1, r2, "glyph sizes", 1, levels[l]);
+    }
+    return errors;
+}
+
+static int test_file(gfxsource_t*driver, const char*filename)
+{
+    static const char*levels[] = {"1", "2", "4"};
+    gfxdocument_t*doc = driver->open(driver, filename);
+    if(!doc) {
+	printf("%s: couldn't open\n", filename);
+	return 1;
+    }
+    int errors = 0;
+    int pagenr, l;
+    for(pagenr=1;pagenr<=doc->num_pages;pagenr++) {
+	for(l=0;l<sizeof(levels)/sizeof(levels[0]);l++) {
+	    gfxresult_t*r1 = render(doc, pagenr, levels[l], "1");
+	    gfxresult_t*r2 = render(doc, pagenr, levels[l], "0");
+	    errors += compare_results(r1, r2, filename, pagenr, levels[l]);
+	}
+    }
+    doc->destroy(doc);
+    return errors;
+}
+
+int main(int argn, char*argv[])
+{
+    gfxsource_t*pdf = gfxsource_pdf_create();
+    gfxsource_t*swf = gfxsource_swf_create();
+    int errors = test_sizes();
+    int t;
+    for(t=1;t<argn;t++) {
+	const char*ext = strrchr(argv[t], '.');
+	if(ext && !strcasecmp(ext, ".swf"))
+	    errors += test_file(swf, argv[t]);
+	else
+	    errors += test_file(pdf, argv[t]);
+    }
+    printf("%s\n", errors?"FAILED":"all pages rendered identically");
+    pdf->destroy(pdf);
+    swf->destroy(swf);
+    return errors?1:0;
+}
@@ -55,6 +55,7 @@ static void maketransparent_fillbitmap(gfxfilter_t*f, gfxline_t*line, gfximage_t
 {
     internal_t*i = (internal_t*)f->internal;
     gfximage_t img2;
+    memset(&img2, 0, sizeof(img2));
     img2.width = img->width;
     img2.height = img->height;
     img2.data = (gfxcolor_t*)rfx_alloc(img->width*img->height*4);
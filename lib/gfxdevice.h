@@ -63,6 +63,13 @@ typedef struct _gfximage
     gfxcolor_t*data;
     unsigned width;
     unsigned height;
+
+    /* optional: if data was decoded from a (baseline, non-transformed)
+       jpeg, the original jpeg file. Devices may store this instead
+       of re-encoding the pixels. Must be cleared by anything that
+       modifies the image data. */
+    unsigned char*jpeg_data;
+    int jpeg_size;
 } gfximage_t;
 
 /* gradients: A radial gradient will start at 0,0 and have a radius of 1,0 
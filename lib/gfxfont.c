@@ -31,9 +31,10 @@
 #include "ttf.h"
 #include "mem.h"
 #include "log.h"
+#include "stats.h"
 
-static int loadfont_scale = 64;
-static int full_unicode = 1;
+static const int loadfont_scale = 64;
+static const int full_unicode = 1;
 
 static void glyph_clear(gfxglyph_t*g)
 {
@@ -127,8 +128,6 @@ static FT_Outline_Funcs outline_functions =
   0,0
 };
 
-static FT_Library ftlibrary = 0;
-
 static gfxglyph_t cloneGlyph(gfxglyph_t*src)
 {
     gfxglyph_t dest;
@@ -145,8 +144,12 @@ static int errorno = 0;
 
 //#define DEBUG 1
 
+STAT(stat_load, "font", "load");
+
 gfxfont_t* gfxfont_load(const char*id, const char*filename, unsigned int flags, double quality)
 {
+    double start = stats_enabled?stats_time():0;
+    FT_Library ftlibrary;
     FT_Face face;
     FT_Error error;
     const char* fontname = 0;
@@ -162,11 +165,10 @@ gfxfont_t* gfxfont_load(const char*id, const char*filename, unsigned int flags,
     int has_had_errors = 0;
     int num_names = 0;
 
-    if(ftlibrary == 0) {
-	if(FT_Init_FreeType(&ftlibrary)) {
-	    fprintf(stderr, "Couldn't init freetype library!\n");
-	    exit(1);
-	}
+    /* FT_Library objects must not be shared between threads */
+    if(FT_Init_FreeType(&ftlibrary)) {
+	fprintf(stderr, "Couldn't init freetype library!\n");
+	exit(1);
     }
     error = FT_New_Face(ftlibrary, filename, 0, &face);
     FT_Set_Pixel_Sizes (face, 16*loadfont_scale, 16*loadfont_scale);
@@ -176,10 +178,13 @@ gfxfont_t* gfxfont_load(const char*id, const char*filename, unsigned int flags,
 
     if(error) {
 	fprintf(stderr, "Couldn't load file %s- not a TTF file? (error=%02x)\n", filename, error);
+	FT_Done_FreeType(ftlibrary);
 	return 0;
     }
     if(face->num_glyphs <= 0) {
 	fprintf(stderr, "File %s contains %d glyphs\n", filename, (int)face->num_glyphs);
+	FT_Done_Face(face);
+	FT_Done_FreeType(ftlibrary);
 	return 0;
     }
 
@@ -438,7 +443,7 @@ gfxfont_t* gfxfont_load(const char*id, const char*filename, unsigned int flags,
     rfx_free(glyph2unicode);
 
     FT_Done_Face(face);
-    FT_Done_FreeType(ftlibrary);ftlibrary=0;
+    FT_Done_FreeType(ftlibrary);
  
     if(!isunicode && font->num_glyphs>0 && font->max_unicode) {
 	/* if the encoding isn't unicode, remap the font
@@ -490,6 +495,8 @@ gfxfont_t* gfxfont_load(const char*id, const char*filename, unsigned int flags,
         }
     }
 
+    if(stats_enabled)
+	stats_add(&stat_load, 1, font->num_glyphs, stats_time()-start);
     return font;
 }
 #else
@@ -12,6 +12,15 @@
 #ifdef HAVE_FFTW3
 #include <fftw3.h>
 #endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #define MOD(x,d) (((x)+(d))%(d))
 
@@ -49,70 +58,6 @@ void gfximage_save_png_quick(gfximage_t*image, const char*filename)
     png_write_quick(filename, (void*)image->data, image->width, image->height);
 }
 
-typedef struct scale_lookup {
-    int pos;
-    unsigned int weight;
-} scale_lookup_t;
-
-typedef struct rgba_int {
-    unsigned int r,g,b,a;
-} rgba_int_t;
-
-static int bicubic = 0;
-
-static scale_lookup_t**make_scale_lookup(int width, int newwidth)
-{
-    scale_lookup_t*lookupx = (scale_lookup_t*)rfx_alloc((width>newwidth?width:newwidth)*2*sizeof(scale_lookup_t));
-    scale_lookup_t**lblockx = (scale_lookup_t**)rfx_alloc((newwidth+1)*sizeof(scale_lookup_t**));
-    double fx = ((double)width)/((double)newwidth);
-    double px = 0;
-    int x;
-    scale_lookup_t*p_x = lookupx;
-
-    if(newwidth<=width) {
-	for(x=0;x<newwidth;x++) {
-	    double ex = px + fx;
-	    int fromx = (int)px;
-	    int tox = (int)ex;
-	    double rem = fromx+1-px;
-	    int i = (int)(256/fx);
-	    int xweight = (int)(rem*256/fx);
-	    int xx;
-	    int w = 0;
-	    lblockx[x] = p_x;
-	    if(tox>=width) tox = width-1;
-	    for(xx=fromx;xx<=tox;xx++) {
-		if(xx==fromx && xx==tox) p_x->weight = 256;
-		else if(xx==fromx) p_x->weight = xweight;
-		else if(xx==tox) p_x->weight = 256-w;
-		else p_x->weight = i;
-		w+=p_x->weight;
-		p_x->pos = xx;
-		p_x++;
-	    }
-	    px = ex;
-	}
-    } else {
-	for(x=0;x<newwidth;x++) {
-	    int ix1 = (int)px;
-	    int ix2 = ((int)px)+1;
-	    double r = px-ix1;
-	    if(ix2>=width) ix2=width-1;
-	    lblockx[x] = p_x;
-	    if(bicubic)
-		r = -2*r*r*r+3*r*r;
-	    p_x[0].weight = (int)(256*(1-r));
-	    p_x[0].pos = ix1;
-	    p_x[1].weight = 256-p_x[0].weight;
-	    p_x[1].pos = ix2;
-	    p_x+=2;
-	    px += fx;
-	}
-    }
-    lblockx[newwidth] = p_x;
-    return lblockx;
-}
-
 static void encodeMonochromeImage(gfxcolor_t*data, int width, int height, gfxcolor_t*colors)
 {
     int t;
@@ -271,12 +216,338 @@ int gfximage_getNumberOfPaletteEntries(gfximage_t*img)
     return 2;
 }
 
-gfximage_t* gfximage_rescale_old(gfximage_t*image, int newwidth, int newheight)
+/* separable two-pass resampler: the image is scaled horizontally and
+   vertically in two passes, through an intermediate image. The pass that
+   reduces the number of lines runs first, so that the (more expensive)
+   horizontal pass has fewer lines to process.
+   Filter weights are 2.14 fixed point, precomputed per output pixel. */
+
+#define WEIGHT_BITS 14
+#define WEIGHT_ONE (1<<WEIGHT_BITS)
+
+typedef struct _resample_weights {
+    int taps; // number of weights per output pixel
+    int*start; // first source pixel of each output pixel
+    short*weights; // taps weights for each output pixel
+} resample_weights_t;
+
+static double filter_bilinear(double x)
+{
+    if(x<0) x=-x;
+    return x<1.0?1.0-x:0.0;
+}
+static double sinc(double x)
+{
+    if(x==0.0)
+	return 1.0;
+    x *= M_PI;
+    return sin(x)/x;
+}
+static double filter_lanczos(double x)
+{
+    if(x<=-3.0 || x>=3.0)
+	return 0.0;
+    return sinc(x)*sinc(x/3.0);
+}
+
+static resample_weights_t*make_weights(int size, int newsize, gfximage_filter_t filter)
+{
+    resample_weights_t*w = (resample_weights_t*)rfx_calloc(sizeof(resample_weights_t));
+    double scale = (double)size/(double)newsize;
+    double fscale = scale<1.0?1.0:scale;
+    double (*f)(double) = 0;
+    double support;
+    if(filter == GFXIMAGE_FILTER_BOX) {
+	support = scale/2.0;
+    } else if(filter == GFXIMAGE_FILTER_LANCZOS) {
+	f = filter_lanczos;
+	support = 3.0*fscale;
+    } else {
+	f = filter_bilinear;
+	support = fscale;
+    }
+    /* determine the window of source pixels for each output pixel */
+    int*from = (int*)rfx_alloc(sizeof(int)*newsize);
+    int*to = (int*)rfx_alloc(sizeof(int)*newsize);
+    int maxtaps = 1;
+    int x;
+    for(x=0;x<newsize;x++) {
+	double center = (x+0.5)*scale;
+	int x1,x2;
+	if(f) {
+	    x1 = (int)floor(center-support+0.5);
+	    x2 = (int)floor(center+support+0.5);
+	} else {
+	    /* box: average over the area of the source pixels covered */
+	    x1 = (int)floor(x*scale);
+	    x2 = (int)ceil((x+1)*scale);
+	}
+	if(x1<0) x1=0;
+	if(x2>size) x2=size;
+	if(x2<=x1) {
+	    /* can only happen for rounding errors at the border */
+	    x1 = x2-1;
+	    if(x1<0) {x1=0;x2=1;}
+	}
+	from[x] = x1;
+	to[x] = x2;
+	if(x2-x1>maxtaps)
+	    maxtaps = x2-x1;
+    }
+    /* an even number of taps lets the SIMD code process them in pairs */
+    if((maxtaps&1) && maxtaps<size)
+	maxtaps++;
+
+    double*tmp = (double*)rfx_alloc(sizeof(double)*maxtaps);
+    w->start = (int*)rfx_alloc(sizeof(int)*newsize);
+    w->weights = (short*)rfx_calloc(sizeof(short)*newsize*maxtaps);
+    w->taps = maxtaps;
+
+    for(x=0;x<newsize;x++) {
+	double center = (x+0.5)*scale;
+	double sum = 0;
+	int xx;
+	for(xx=from[x];xx<to[x];xx++) {
+	    double v;
+	    if(f) {
+		v = f((xx+0.5-center)/fscale);
+	    } else {
+		double x1 = x*scale, x2 = (x+1)*scale;
+		v = (xx+1<x2?xx+1:x2) - (xx>x1?xx:x1);
+		if(v<0) v=0;
+	    }
+	    tmp[xx-from[x]] = v;
+	    sum += v;
+	}
+	if(sum==0) {
+	    tmp[0] = sum = 1.0;
+	}
+
+	/* shift the window left at the right border, so that all taps
+	   are inside the source image */
+	int start = from[x];
+	if(start+maxtaps>size)
+	    start = size-maxtaps;
+	w->start[x] = start;
+
+	short*k = &w->weights[x*maxtaps + (from[x]-start)];
+	/* round the running sum of the weights, not every weight on its
+	   own. That spreads the rounding error over all taps, and the
+	   weights sum up to exactly 1.0, so that areas of one color stay
+	   the same */
+	double acc = 0;
+	int last = 0;
+	for(xx=0;xx<to[x]-from[x];xx++) {
+	    acc += tmp[xx];
+	    int next = (int)floor(acc*WEIGHT_ONE/sum+0.5);
+	    k[xx] = (short)(next-last);
+	    last = next;
+	}
+    }
+    rfx_free(tmp);
+    rfx_free(from);
+    rfx_free(to);
+    return w;
+}
+
+static void free_weights(resample_weights_t*w)
 {
+    rfx_free(w->start);
+    rfx_free(w->weights);
+    rfx_free(w);
+}
+
+static inline unsigned char clamp8(int v)
+{
+    v >>= WEIGHT_BITS;
+    return v<0?0:(v>255?255:v);
+}
+
+/* scale the lines y1..y2 of src horizontally */
+static void resample_horizontal(const unsigned char*src, int width, unsigned char*dest, int newwidth,
+				resample_weights_t*w, int y1, int y2)
+{
+    int taps = w->taps;
     int x,y;
-    gfxcolor_t* newdata; 
-    scale_lookup_t *p, **lblockx,**lblocky;
-    rgba_int_t*tmpline;
+    for(y=y1;y<y2;y++) {
+	const unsigned char*line = &src[y*width*4];
+	unsigned char*d = &dest[y*newwidth*4];
+	const short*k = w->weights;
+	for(x=0;x<newwidth;x++) {
+	    const unsigned char*s = &line[w->start[x]*4];
+	    int t;
+#ifdef __SSE2__
+	    __m128i zero = _mm_setzero_si128();
+	    __m128i acc = _mm_set1_epi32(WEIGHT_ONE/2);
+	    for(t=0;t+1<taps;t+=2) {
+		/* two pixels, channels interleaved: p0c0 p1c0 p0c1 p1c1 ... */
+		__m128i p = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)&s[t*4]), zero);
+		p = _mm_unpacklo_epi16(p, _mm_srli_si128(p, 8));
+		__m128i kk = _mm_set1_epi32(*(const int*)&k[t]);
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(p, kk));
+	    }
+	    if(t<taps) {
+		__m128i p = _mm_unpacklo_epi8(_mm_cvtsi32_si128(*(const int*)&s[t*4]), zero);
+		p = _mm_unpacklo_epi16(p, zero);
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(p, _mm_set1_epi32((unsigned short)k[t])));
+	    }
+	    acc = _mm_srai_epi32(acc, WEIGHT_BITS);
+	    acc = _mm_packs_epi32(acc, acc);
+	    acc = _mm_packus_epi16(acc, acc);
+	    *(int*)&d[x*4] = _mm_cvtsi128_si32(acc);
+#else
+	    int c0=WEIGHT_ONE/2,c1=WEIGHT_ONE/2,c2=WEIGHT_ONE/2,c3=WEIGHT_ONE/2;
+	    for(t=0;t<taps;t++) {
+		c0 += s[t*4+0]*k[t];
+		c1 += s[t*4+1]*k[t];
+		c2 += s[t*4+2]*k[t];
+		c3 += s[t*4+3]*k[t];
+	    }
+	    d[x*4+0] = clamp8(c0);
+	    d[x*4+1] = clamp8(c1);
+	    d[x*4+2] = clamp8(c2);
+	    d[x*4+3] = clamp8(c3);
+#endif
+	    k += taps;
+	}
+    }
+}
+
+/* compute the output lines y1..y2 from the horizontally scaled image */
+static void resample_vertical(const unsigned char*src, int width, unsigned char*dest,
+			      resample_weights_t*w, int y1, int y2)
+{
+    int taps = w->taps;
+    int linelen = width*4;
+    int x,y;
+    for(y=y1;y<y2;y++) {
+	const unsigned char*s = &src[w->start[y]*linelen];
+	const short*k = &w->weights[y*taps];
+	unsigned char*d = &dest[y*linelen];
+	int t;
+	x = 0;
+#ifdef __SSE2__
+	__m128i zero = _mm_setzero_si128();
+	for(;x+16<=linelen;x+=16) {
+	    __m128i acc0 = _mm_set1_epi32(WEIGHT_ONE/2);
+	    __m128i acc1 = acc0, acc2 = acc0, acc3 = acc0;
+	    for(t=0;t<taps;t+=2) {
+		__m128i a = _mm_loadu_si128((const __m128i*)&s[t*linelen+x]);
+		__m128i b, kk;
+		if(t+1<taps) {
+		    b = _mm_loadu_si128((const __m128i*)&s[(t+1)*linelen+x]);
+		    kk = _mm_set1_epi32(*(const int*)&k[t]);
+		} else {
+		    b = zero;
+		    kk = _mm_set1_epi32((unsigned short)k[t]);
+		}
+		/* interleave the two lines, so that madd does a*ka + b*kb */
+		__m128i lo = _mm_unpacklo_epi8(a, b);
+		__m128i hi = _mm_unpackhi_epi8(a, b);
+		acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi8(lo, zero), kk));
+		acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi8(lo, zero), kk));
+		acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_unpacklo_epi8(hi, zero), kk));
+		acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_unpackhi_epi8(hi, zero), kk));
+	    }
+	    acc0 = _mm_packs_epi32(_mm_srai_epi32(acc0, WEIGHT_BITS), _mm_srai_epi32(acc1, WEIGHT_BITS));
+	    acc2 = _mm_packs_epi32(_mm_srai_epi32(acc2, WEIGHT_BITS), _mm_srai_epi32(acc3, WEIGHT_BITS));
+	    _mm_storeu_si128((__m128i*)&d[x], _mm_packus_epi16(acc0, acc2));
+	}
+#endif
+	for(;x<linelen;x++) {
+	    int c = WEIGHT_ONE/2;
+	    for(t=0;t<taps;t++) {
+		c += s[t*linelen+x]*k[t];
+	    }
+	    d[x] = clamp8(c);
+	}
+    }
+}
+
+typedef struct _resample_job {
+    const unsigned char*src;
+    unsigned char*dest;
+    int width, newwidth;
+    resample_weights_t*w;
+    int y1, y2; // lines to process
+} resample_job_t;
+
+static void* resample_horizontal_job(void*data)
+{
+    resample_job_t*j = (resample_job_t*)data;
+    resample_horizontal(j->src, j->width, j->dest, j->newwidth, j->w, j->y1, j->y2);
+    return 0;
+}
+static void* resample_vertical_job(void*data)
+{
+    resample_job_t*j = (resample_job_t*)data;
+    resample_vertical(j->src, j->width, j->dest, j->w, j->y1, j->y2);
+    return 0;
+}
+
+static void run_jobs(void*(*f)(void*), resample_job_t*jobs, int num)
+{
+#ifdef HAVE_PTHREADS
+    pthread_t*threads = (pthread_t*)rfx_alloc(sizeof(pthread_t)*num);
+    int t;
+    for(t=1;t<num;t++) {
+	if(pthread_create(&threads[t], 0, f, &jobs[t])) {
+	    /* couldn't spawn thread- do it ourselves */
+	    f(&jobs[t]);
+	    threads[t] = 0;
+	}
+    }
+    f(&jobs[0]);
+    for(t=1;t<num;t++) {
+	if(threads[t])
+	    pthread_join(threads[t], 0);
+    }
+    rfx_free(threads);
+#else
+    int t;
+    for(t=0;t<num;t++)
+	f(&jobs[t]);
+#endif
+}
+
+/* split a pass over num_lines lines into num_threads jobs, and run them */
+static void run_pass(void*(*f)(void*), const unsigned char*src, unsigned char*dest, int width, int newwidth,
+		     resample_weights_t*w, int num_lines, int num_threads)
+{
+    if(num_threads>num_lines)
+	num_threads = num_lines;
+    resample_job_t*jobs = (resample_job_t*)rfx_calloc(sizeof(resample_job_t)*num_threads);
+    int t;
+    for(t=0;t<num_threads;t++) {
+	jobs[t].src = src;
+	jobs[t].dest = dest;
+	jobs[t].width = width;
+	jobs[t].newwidth = newwidth;
+	jobs[t].w = w;
+	jobs[t].y1 = num_lines*t/num_threads;
+	jobs[t].y2 = num_lines*(t+1)/num_threads;
+    }
+    run_jobs(f, jobs, num_threads);
+    rfx_free(jobs);
+}
+
+static int default_num_threads(int pixels)
+{
+#if defined(HAVE_PTHREADS) && defined(_SC_NPROCESSORS_ONLN)
+    /* only worth it for big images */
+    if(pixels < 1024*1024)
+	return 1;
+    int num = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(num<1) num=1;
+    if(num>8) num=8;
+    return num;
+#else
+    return 1;
+#endif
+}
+
+gfximage_t* gfximage_rescale2(gfximage_t*image, int newwidth, int newheight, gfximage_filter_t filter, int num_threads)
+{
     int monochrome = 0;
     gfxcolor_t monochrome_colors[2];
    
@@ -302,68 +573,50 @@ gfximage_t* gfximage_rescale_old(gfximage_t*image, int newwidth, int newheight)
         }
     }
 
-    tmpline = (rgba_int_t*)rfx_alloc(width*sizeof(rgba_int_t));
-    newdata = (gfxcolor_t*)rfx_alloc(newwidth*newheight*sizeof(gfxcolor_t));
-  
-    lblockx = make_scale_lookup(width, newwidth);
-    lblocky = make_scale_lookup(height, newheight);
-
-    for(p=lblocky[0];p<lblocky[newheight];p++)
-	p->pos*=width;
-
-    for(y=0;y<newheight;y++) {
-	gfxcolor_t*destline = &newdata[y*newwidth];
-	
-	/* create lookup table for y */
-	rgba_int_t*l = tmpline;
-	scale_lookup_t*p_y,*p_x;
-	memset(tmpline, 0, width*sizeof(rgba_int_t));
-	for(p_y=lblocky[y];p_y<lblocky[y+1];p_y++) {
-	    gfxcolor_t*line = &data[p_y->pos];
-	    scale_lookup_t*p_x;
-	    int weight = p_y->weight;
-	    for(x=0;x<width;x++) {
-		tmpline[x].r += line[x].r*weight;
-		tmpline[x].g += line[x].g*weight;
-		tmpline[x].b += line[x].b*weight;
-		tmpline[x].a += line[x].a*weight;
-	    }
-	}
+    gfximage_filter_t fx = filter, fy = filter;
+    if(filter == GFXIMAGE_FILTER_DEFAULT) {
+	fx = newwidth<=width?GFXIMAGE_FILTER_BOX:GFXIMAGE_FILTER_BILINEAR;
+	fy = newheight<=height?GFXIMAGE_FILTER_BOX:GFXIMAGE_FILTER_BILINEAR;
+    }
 
-	/* process x direction */
-	p_x = lblockx[0];
-	for(x=0;x<newwidth;x++) {
-	    unsigned int r=0,g=0,b=0,a=0;
-	    scale_lookup_t*p_x_to = lblockx[x+1];
-	    do { 
-		rgba_int_t* col = &tmpline[p_x->pos];
-		unsigned int weight = p_x->weight;
-		r += col->r*weight;
-		g += col->g*weight;
-		b += col->b*weight;
-		a += col->a*weight;
-		p_x++;
-	    } while (p_x<p_x_to);
-
-	    destline->r = r >> 16;
-	    destline->g = g >> 16;
-	    destline->b = b >> 16;
-	    destline->a = a >> 16;
-	   
-	    destline++;
+    gfxcolor_t*newdata = (gfxcolor_t*)rfx_alloc(newwidth*newheight*sizeof(gfxcolor_t));
+    resample_weights_t*wx = make_weights(width, newwidth, fx);
+    resample_weights_t*wy = make_weights(height, newheight, fy);
+
+    if(num_threads<=0)
+	num_threads = default_num_threads(width*height);
+
+    unsigned char*tmp;
+    if(newheight < height) {
+	tmp = (unsigned char*)rfx_alloc(width*newheight*sizeof(gfxcolor_t));
+	run_pass(resample_vertical_job, (unsigned char*)data, tmp, width, width, wy, newheight, num_threads);
+	run_pass(resample_horizontal_job, tmp, (unsigned char*)newdata, width, newwidth, wx, newheight, num_threads);
+    } else {
+	tmp = (unsigned char*)rfx_alloc(newwidth*height*sizeof(gfxcolor_t));
+	run_pass(resample_horizontal_job, (unsigned char*)data, tmp, width, newwidth, wx, height, num_threads);
+	run_pass(resample_vertical_job, tmp, (unsigned char*)newdata, newwidth, newwidth, wy, newheight, num_threads);
+    }
+    int t;
+
+    if(fx == GFXIMAGE_FILTER_LANCZOS || fy == GFXIMAGE_FILTER_LANCZOS) {
+	/* negative filter lobes may push colors above the (premultiplied) alpha */
+	int size = newwidth*newheight;
+	for(t=0;t<size;t++) {
+	    gfxcolor_t*c = &newdata[t];
+	    if(c->r>c->a) c->r=c->a;
+	    if(c->g>c->a) c->g=c->a;
+	    if(c->b>c->a) c->b=c->a;
 	}
     }
 
     if(monochrome)
 	decodeMonochromeImage(newdata, newwidth, newheight, monochrome_colors);
 
-    rfx_free(tmpline);
-    rfx_free(*lblockx);
-    rfx_free(lblockx);
-    rfx_free(*lblocky);
-    rfx_free(lblocky);
+    free_weights(wx);
+    free_weights(wy);
+    rfx_free(tmp);
 
-    gfximage_t*image2 = (gfximage_t*)malloc(sizeof(gfximage_t));
+    gfximage_t*image2 = (gfximage_t*)rfx_calloc(sizeof(gfximage_t));
     image2->data = newdata;
     image2->width = newwidth;
     image2->height = newheight;
@@ -460,7 +713,7 @@ gfximage_t* gfximage_rescale_fft(gfximage_t*image, int newwidth, int newheight)
     if(monochrome)
 	decodeMonochromeImage(rgba_new, newwidth, newheight, monochrome_colors);
 
-    gfximage_t*image2 = (gfximage_t*)malloc(sizeof(gfximage_t));
+    gfximage_t*image2 = (gfximage_t*)rfx_calloc(sizeof(gfximage_t));
     image2->data = rgba_new;
     image2->width = newwidth;
     image2->height = newheight;
@@ -468,18 +721,10 @@ gfximage_t* gfximage_rescale_fft(gfximage_t*image, int newwidth, int newheight)
 }
 #endif
 
-#ifdef HAVE_FFTW3
 gfximage_t* gfximage_rescale(gfximage_t*image, int newwidth, int newheight)
 {
-    //return gfximage_rescale_fft(image, newwidth, newheight);
-    return gfximage_rescale_old(image, newwidth, newheight);
+    return gfximage_rescale2(image, newwidth, newheight, GFXIMAGE_FILTER_DEFAULT, 0);
 }
-#else
-gfximage_t* gfximage_rescale(gfximage_t*image, int newwidth, int newheight)
-{
-    return gfximage_rescale_old(image, newwidth, newheight);
-}
-#endif
 
 bool gfximage_has_alpha(gfximage_t*img)
 {
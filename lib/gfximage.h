@@ -9,6 +9,17 @@ void gfximage_save_jpeg(gfximage_t*image, const char*filename, int quality);
 void gfximage_save_png(gfximage_t*image, const char*filename);
 void gfximage_save_png_quick(gfximage_t*image, const char*filename);
 gfximage_t* gfximage_rescale(gfximage_t*image, int newwidth, int newheight);
+
+typedef enum {
+    GFXIMAGE_FILTER_DEFAULT, /* box when downscaling, bilinear when upscaling */
+    GFXIMAGE_FILTER_BOX,
+    GFXIMAGE_FILTER_BILINEAR,
+    GFXIMAGE_FILTER_LANCZOS
+} gfximage_filter_t;
+
+/* num_threads=0 picks the number of threads based on image size and
+   available cpus */
+gfximage_t* gfximage_rescale2(gfximage_t*image, int newwidth, int newheight, gfximage_filter_t filter, int num_threads);
 bool gfximage_has_alpha(gfximage_t*image);
 void gfximage_free(gfximage_t*b);
 
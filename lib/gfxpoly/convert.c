@@ -3,6 +3,7 @@
 #include <string.h>
 #include "../gfxdevice.h"
 #include "../mem.h"
+#include "../stats.h"
 #include "poly.h"
 #include "convert.h"
 #include "wind.h"
@@ -242,13 +243,18 @@ void gfxpolywriter_init(polywriter_t*w)
     data->poly->strokes = 0;
 }
 
+STAT(stat_from_fill, "gfxpoly", "from_fill");
 gfxpoly_t* gfxpoly_from_fill(gfxline_t*line, double gridsize)
 {
+    double start = stats_enabled?stats_time():0;
     polywriter_t writer;
     gfxpolywriter_init(&writer);
     writer.setgridsize(&writer, gridsize);
     convert_gfxline(line, &writer, gridsize);
-    return (gfxpoly_t*)writer.finish(&writer);
+    gfxpoly_t*poly = (gfxpoly_t*)writer.finish(&writer);
+    if(stats_enabled)
+	stats_add(&stat_from_fill, 1, gfxpoly_size(poly), stats_time()-start);
+    return poly;
 }
 gfxpoly_t* gfxpoly_from_file(const char*filename, double gridsize)
 {
@@ -5,6 +5,7 @@
 #include <time.h>
 #include "../mem.h"
 #include "../types.h"
+#include "../stats.h"
 #include "poly.h"
 #include "active.h"
 #include "xrow.h"
@@ -61,7 +62,8 @@ static char point_equals(const void*o1, const void*o2)
 static unsigned int point_hash(const void*o)
 {
     const point_t*p = o;
-    return p->x^p->y;
+    /* x^y alone is the same for lots of points on a grid */
+    return p->x*2654435761u^p->y;
 }
 static void* point_dup(const void*o)
 {
@@ -83,6 +85,7 @@ type_t point_type = {
     hash: point_hash,
     dup: point_dup,
     free: point_free,
+    key_size: sizeof(point_t),
 };
 
 typedef struct _event {
@@ -166,6 +169,7 @@ typedef struct _status {
     horizdata_t horiz;
 
     gfxpolystroke_t*strokes;
+    int segment_count;
 #ifdef CHECKS
     dict_t*seen_crossings; //list of crossing we saw so far
     dict_t*intersecting_segs; //list of segments intersecting in this scanline
@@ -408,10 +412,9 @@ static void segment_dump(segment_t*s)
             (double)s->delta.x / s->delta.y, s->fs);
 }
 
-static void segment_init(segment_t*s, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int polygon_nr, segment_dir_t dir)
+static void segment_init(segment_t*s, int nr, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int polygon_nr, segment_dir_t dir)
 {
-    static int segment_count=0;
-    s->nr = segment_count++;
+    s->nr = nr;
     s->dir = dir;
     if(y1!=y2) {
 	assert(y1<y2);
@@ -429,7 +432,7 @@ static void segment_init(segment_t*s, int32_t x1, int32_t y1, int32_t x2, int32_
         }
 #ifdef DEBUG
 	fprintf(stderr, "Scheduling horizontal segment [%d] (%.2f,%.2f) -> (%.2f,%.2f) %s\n",
-		segment_count,
+		nr,
 		x1 * 0.05, y1 * 0.05, x2 * 0.05, y2 * 0.05, s->dir==DIR_UP?"up":"down");
 #endif
     }
@@ -475,10 +478,10 @@ static void segment_init(segment_t*s, int32_t x1, int32_t y1, int32_t x2, int32_
 #endif
 }
 
-static segment_t* segment_new(point_t a, point_t b, int polygon_nr, segment_dir_t dir)
+static segment_t* segment_new(int nr, point_t a, point_t b, int polygon_nr, segment_dir_t dir)
 {
     segment_t*s = (segment_t*)rfx_calloc(sizeof(segment_t));
-    segment_init(s, a.x, a.y, b.x, b.y, polygon_nr, dir);
+    segment_init(s, nr, a.x, a.y, b.x, b.y, polygon_nr, dir);
     return s;
 }
 
@@ -494,7 +497,7 @@ static void segment_destroy(segment_t*s)
     free(s);
 }
 
-static void advance_stroke(queue_t*queue, hqueue_t*hqueue, gfxpolystroke_t*stroke, int polygon_nr, int pos, double gridsize)
+static void advance_stroke(queue_t*queue, hqueue_t*hqueue, int*segment_count, gfxpolystroke_t*stroke, int polygon_nr, int pos, double gridsize)
 {
     if(!stroke) 
 	return;
@@ -503,7 +506,7 @@ static void advance_stroke(queue_t*queue, hqueue_t*hqueue, gfxpolystroke_t*strok
        before horizontal events */
     while(pos < stroke->num_points-1) {
 	assert(stroke->points[pos].y <= stroke->points[pos+1].y);
-	s = segment_new(stroke->points[pos], stroke->points[pos+1], polygon_nr, stroke->dir);
+	s = segment_new((*segment_count)++, stroke->points[pos], stroke->points[pos+1], polygon_nr, stroke->dir);
 	s->fs = stroke->fs;
 	pos++;
 	s->stroke = 0;
@@ -535,7 +538,7 @@ static void advance_stroke(queue_t*queue, hqueue_t*hqueue, gfxpolystroke_t*strok
     }
 }
 
-static void gfxpoly_enqueue(gfxpoly_t*p, queue_t*queue, hqueue_t*hqueue, int polygon_nr)
+static void gfxpoly_enqueue(gfxpoly_t*p, queue_t*queue, hqueue_t*hqueue, int*segment_count, int polygon_nr)
 {
     int t;
     gfxpolystroke_t*stroke = p->strokes;
@@ -548,7 +551,7 @@ static void gfxpoly_enqueue(gfxpoly_t*p, queue_t*queue, hqueue_t*hqueue, int pol
 	    assert(stroke->points[s].y <= stroke->points[s+1].y);
 	}
 #endif
-	advance_stroke(queue, hqueue, stroke, polygon_nr, 0, p->gridsize);
+	advance_stroke(queue, hqueue, segment_count, stroke, polygon_nr, 0, p->gridsize);
     }
 }
 
@@ -1414,7 +1417,7 @@ static void event_apply(status_t*status, event_t*e)
             segment_t*s = e->s1;
             intersect_with_horizontal(status, s);
 	    store_horizontal(status, s->a, s->b, s->fs, s->dir, s->polygon_nr);
-	    advance_stroke(&status->queue, 0, s->stroke, s->polygon_nr, s->stroke_pos, status->gridsize);
+	    advance_stroke(&status->queue, 0, &status->segment_count, s->stroke, s->polygon_nr, s->stroke_pos, status->gridsize);
             segment_destroy(s);e->s1=0;
             break;
         }
@@ -1436,7 +1439,7 @@ static void event_apply(status_t*status, event_t*e)
 	    /* schedule segment for xrow handling */
             s->left = 0; s->right = status->ending_segments;
             status->ending_segments = s;
-	    advance_stroke(&status->queue, 0, s->stroke, s->polygon_nr, s->stroke_pos, status->gridsize);
+	    advance_stroke(&status->queue, 0, &status->segment_count, s->stroke, s->polygon_nr, s->stroke_pos, status->gridsize);
             break;
         }
         case EVENT_START: {
@@ -1501,9 +1504,15 @@ static void check_status(status_t*status)
 }
 #endif
 
+STAT(stat_process, "gfxpoly", "process");
+
 gfxpoly_t* gfxpoly_process(gfxpoly_t*poly1, gfxpoly_t*poly2, windrule_t*windrule, windcontext_t*context, moments_t*moments)
 {
+    double start = stats_enabled?stats_time():0;
+#ifdef CHECKS
+    /* only needed for the debug dump in gfxpoly_fail() */
     current_polygon = poly1;
+#endif
 
     status_t status;
     memset(&status, 0, sizeof(status_t));
@@ -1513,10 +1522,10 @@ gfxpoly_t* gfxpoly_process(gfxpoly_t*poly1, gfxpoly_t*poly2, windrule_t*windrule
     status.actlist = actlist_new();
 
     queue_init(&status.queue);
-    gfxpoly_enqueue(poly1, &status.queue, 0, /*polygon nr*/0);
+    gfxpoly_enqueue(poly1, &status.queue, 0, &status.segment_count, /*polygon nr*/0);
     if(poly2) {
 	assert(poly1->gridsize == poly2->gridsize);
-	gfxpoly_enqueue(poly2, &status.queue, 0, /*polygon nr*/1);
+	gfxpoly_enqueue(poly2, &status.queue, 0, &status.segment_count, /*polygon nr*/1);
     }
 
 #ifdef CHECKS
@@ -1603,6 +1612,11 @@ gfxpoly_t* gfxpoly_process(gfxpoly_t*poly1, gfxpoly_t*poly2, windrule_t*windrule
 	stroke = stroke->next;
     }
 #endif
+    if(stats_enabled) {
+	/* size is the number of input edges */
+	int size = gfxpoly_size(poly1) + (poly2?gfxpoly_size(poly2):0);
+	stats_add(&stat_process, 1, size, stats_time()-start);
+    }
     return p;
 }
 
@@ -3,6 +3,7 @@
 #include <math.h>
 #include "../gfxdevice.h"
 #include "../gfxtools.h"
+#include "../stats.h"
 #include "poly.h"
 #include "wind.h"
 #include "convert.h"
@@ -219,8 +220,10 @@ void draw_stroke(gfxline_t*start, gfxdrawer_t*draw, double width, gfx_capType ca
 }
 
 static windcontext_t onepolygon = {1};
+STAT(stat_from_stroke, "gfxpoly", "from_stroke");
 gfxpoly_t* gfxpoly_from_stroke(gfxline_t*line, gfxcoord_t width, gfx_capType cap_style, gfx_joinType joint_style, gfxcoord_t miterLimit, double gridsize)
 {
+    double start = stats_enabled?stats_time():0;
     gfxdrawer_t d;
     gfxdrawer_target_poly(&d, gridsize);
     draw_stroke(line, &d, width, cap_style, joint_style, miterLimit);
@@ -228,6 +231,8 @@ gfxpoly_t* gfxpoly_from_stroke(gfxline_t*line, gfxcoord_t width, gfx_capType cap
     assert(gfxpoly_check(poly, 1));
     gfxpoly_t*poly2 = gfxpoly_process(poly, 0, &windrule_circular, &onepolygon, 0);
     gfxpoly_destroy(poly);
+    if(stats_enabled)
+	stats_add(&stat_from_stroke, 1, gfxpoly_size(poly2), stats_time()-start);
     return poly2;
 }
 
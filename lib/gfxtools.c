@@ -1112,6 +1112,7 @@ static type_t gfxpoint_type = {
     equals: (equals_func)gfxpoint_equals,
     dup: (dup_func)gfxpoint_clone,
     free: (free_func)gfxpoint_destroy,
+    key_size: sizeof(gfxpoint_t),
 };
 
 /* makes sure that a gfxline is drawn in a single stroke.
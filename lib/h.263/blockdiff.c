@@ -0,0 +1,414 @@
+/* blockdiff.c
+
+   Block comparison kernels (with SIMD versions) for video encoding.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include <stdlib.h>
+#include "blockdiff.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* AVX2 versions are compiled for the target, and only used if the cpu
+   we run on supports them */
+#if defined(__SSE2__) && defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_AVX2_KERNELS
+#include <immintrin.h>
+#define AVX2 __attribute__((target("avx2")))
+#endif
+
+/* ------------------------------ plain C ---------------------------------- */
+
+static inline int pixeldist(const unsigned char*p1, const unsigned char*p2)
+{
+    return abs(p1[1]-p2[1]) + abs(p1[2]-p2[2]) + abs(p1[3]-p2[3]);
+}
+
+static int rgb_sad_c(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    int sum = 0;
+    int x,y;
+    for(y=0;y<h;y++) {
+	for(x=0;x<w;x++)
+	    sum += pixeldist(&d1[x*4], &d2[x*4]);
+	d1 += stride; d2 += stride;
+    }
+    return sum;
+}
+
+static unsigned int rgb_ssd_c(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    unsigned int sum = 0;
+    int x,y;
+    for(y=0;y<h;y++) {
+	for(x=0;x<w;x++) {
+	    int q = pixeldist(&d1[x*4], &d2[x*4]);
+	    sum += q*q;
+	}
+	d1 += stride; d2 += stride;
+    }
+    return sum;
+}
+
+static int rgb_max_c(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    int max = 0;
+    int x,y;
+    for(y=0;y<h;y++) {
+	for(x=0;x<w;x++) {
+	    int q = pixeldist(&d1[x*4], &d2[x*4]);
+	    if(q>max)
+		max = q;
+	}
+	d1 += stride; d2 += stride;
+    }
+    return max;
+}
+
+static int rgb_differ_c(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    int x,y;
+    for(y=0;y<h;y++) {
+	for(x=0;x<w*4;x+=4) {
+	    if(d1[x+1]!=d2[x+1] || d1[x+2]!=d2[x+2] || d1[x+3]!=d2[x+3])
+		return 1;
+	}
+	d1 += stride; d2 += stride;
+    }
+    return 0;
+}
+
+static void yuv_sad16_c(const unsigned char*p1, const unsigned char*p2, int stride, int*diffy, int*diffuv)
+{
+    int dy=0, duv=0;
+    int x,y;
+    for(y=0;y<16;y++) {
+	for(x=0;x<16*3;x+=3) {
+	    dy += abs(p1[x]-p2[x]);
+	    duv += abs(p1[x+1]-p2[x+1]) + abs(p1[x+2]-p2[x+2]);
+	}
+	p1 += stride; p2 += stride;
+    }
+    *diffy = dy;
+    *diffuv = duv;
+}
+
+static const blockdiff_t blockdiff_c = {
+    "c",
+    rgb_sad_c, rgb_ssd_c, rgb_max_c, rgb_differ_c,
+    yuv_sad16_c
+};
+
+/* -------------------------------- SSE2 ----------------------------------- */
+
+#ifdef __SSE2__
+
+/* per-byte |a-b| of the r,g,b bytes (alpha zeroed) */
+static inline __m128i absdiff_rgb(__m128i a, __m128i b)
+{
+    __m128i d = _mm_or_si128(_mm_subs_epu8(a,b), _mm_subs_epu8(b,a));
+    return _mm_and_si128(d, _mm_set1_epi32(0xffffff00));
+}
+/* per-pixel distance, as 32 bit integers */
+static inline __m128i pixeldist_sse2(__m128i a, __m128i b)
+{
+    __m128i m = _mm_set1_epi32(0x00ff00ff);
+    __m128i d = absdiff_rgb(a,b);
+    __m128i t = _mm_add_epi32(_mm_and_si128(d, m), _mm_and_si128(_mm_srli_epi32(d, 8), m));
+    return _mm_add_epi32(_mm_and_si128(t, _mm_set1_epi32(0xffff)), _mm_srli_epi32(t, 16));
+}
+static inline int hsum_sse2(__m128i v)
+{
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1,0,3,2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2,3,0,1)));
+    return _mm_cvtsi128_si32(v);
+}
+static inline int hmax_sse2(__m128i v)
+{
+    v = _mm_max_epi16(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1,0,3,2)));
+    v = _mm_max_epi16(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2,3,0,1)));
+    return _mm_cvtsi128_si32(v);
+}
+#define LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+
+static int rgb_sad_sse2(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    __m128i sum = _mm_setzero_si128();
+    int rest = 0;
+    int w4 = w&~3;
+    int x,y;
+    for(y=0;y<h;y++) {
+	for(x=0;x<w4;x+=4) {
+	    __m128i d = absdiff_rgb(LOAD(&d1[x*4]), LOAD(&d2[x*4]));
+	    sum = _mm_add_epi32(sum, _mm_sad_epu8(d, _mm_setzero_si128()));
+	}
+	for(;x<w;x++)
+	    rest += pixeldist(&d1[x*4], &d2[x*4]);
+	d1 += stride; d2 += stride;
+    }
+    return hsum_sse2(sum) + rest;
+}
+
+static unsigned int rgb_ssd_sse2(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    __m128i sum = _mm_setzero_si128();
+    unsigned int rest = 0;
+    int w4 = w&~3;
+    int x,y;
+    for(y=0;y<h;y++) {
+	for(x=0;x<w4;x+=4) {
+	    __m128i q = pixeldist_sse2(LOAD(&d1[x*4]), LOAD(&d2[x*4]));
+	    sum = _mm_add_epi32(sum, _mm_madd_epi16(q, q));
+	}
+	for(;x<w;x++) {
+	    int q = pixeldist(&d1[x*4], &d2[x*4]);
+	    rest += q*q;
+	}
+	d1 += stride; d2 += stride;
+    }
+    return (unsigned int)hsum_sse2(sum) + rest;
+}
+
+static int rgb_max_sse2(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    __m128i max = _mm_setzero_si128();
+    int rest = 0;
+    int w4 = w&~3;
+    int x,y;
+    for(y=0;y<h;y++) {
+	for(x=0;x<w4;x+=4) {
+	    max = _mm_max_epi16(max, pixeldist_sse2(LOAD(&d1[x*4]), LOAD(&d2[x*4])));
+	}
+	for(;x<w;x++) {
+	    int q = pixeldist(&d1[x*4], &d2[x*4]);
+	    if(q>rest)
+		rest = q;
+	}
+	d1 += stride; d2 += stride;
+    }
+    int m = hmax_sse2(max);
+    return m>rest?m:rest;
+}
+
+static int rgb_differ_sse2(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    int w4 = w&~3;
+    int x,y;
+    for(y=0;y<h;y++) {
+	for(x=0;x<w4;x+=4) {
+	    int eq = _mm_movemask_epi8(_mm_cmpeq_epi8(LOAD(&d1[x*4]), LOAD(&d2[x*4])));
+	    if((~eq)&0xeeee) // ignore alpha
+		return 1;
+	}
+	for(;x<w;x++) {
+	    if(pixeldist(&d1[x*4], &d2[x*4]))
+		return 1;
+	}
+	d1 += stride; d2 += stride;
+    }
+    return 0;
+}
+
+static void yuv_sad16_sse2(const unsigned char*p1, const unsigned char*p2, int stride, int*diffy, int*diffuv)
+{
+    /* 16 yuv pixels are 48 bytes. Sum up the differences of all bytes,
+       and of only the luminance bytes. */
+    const __m128i ymask0 = _mm_setr_epi8(-1,0,0,-1,0,0,-1,0,0,-1,0,0,-1,0,0,-1);
+    const __m128i ymask1 = _mm_setr_epi8(0,0,-1,0,0,-1,0,0,-1,0,0,-1,0,0,-1,0);
+    const __m128i ymask2 = _mm_setr_epi8(0,-1,0,0,-1,0,0,-1,0,0,-1,0,0,-1,0,0);
+    __m128i all = _mm_setzero_si128();
+    __m128i ys = _mm_setzero_si128();
+    int y;
+    for(y=0;y<16;y++) {
+	__m128i a0 = LOAD(&p1[0]), b0 = LOAD(&p2[0]);
+	__m128i a1 = LOAD(&p1[16]), b1 = LOAD(&p2[16]);
+	__m128i a2 = LOAD(&p1[32]), b2 = LOAD(&p2[32]);
+	all = _mm_add_epi32(all, _mm_sad_epu8(a0, b0));
+	all = _mm_add_epi32(all, _mm_sad_epu8(a1, b1));
+	all = _mm_add_epi32(all, _mm_sad_epu8(a2, b2));
+	ys = _mm_add_epi32(ys, _mm_sad_epu8(_mm_and_si128(a0, ymask0), _mm_and_si128(b0, ymask0)));
+	ys = _mm_add_epi32(ys, _mm_sad_epu8(_mm_and_si128(a1, ymask1), _mm_and_si128(b1, ymask1)));
+	ys = _mm_add_epi32(ys, _mm_sad_epu8(_mm_and_si128(a2, ymask2), _mm_and_si128(b2, ymask2)));
+	p1 += stride; p2 += stride;
+    }
+    int dy = hsum_sse2(ys);
+    *diffy = dy;
+    *diffuv = hsum_sse2(all) - dy;
+}
+
+static const blockdiff_t blockdiff_sse2 = {
+    "sse2",
+    rgb_sad_sse2, rgb_ssd_sse2, rgb_max_sse2, rgb_differ_sse2,
+    yuv_sad16_sse2
+};
+
+#endif
+
+/* -------------------------------- AVX2 ----------------------------------- */
+
+#ifdef HAVE_AVX2_KERNELS
+
+#define LOAD256(p) _mm256_loadu_si256((const __m256i*)(p))
+
+static inline AVX2 __m256i absdiff_rgb_avx2(__m256i a, __m256i b)
+{
+    __m256i d = _mm256_or_si256(_mm256_subs_epu8(a,b), _mm256_subs_epu8(b,a));
+    return _mm256_and_si256(d, _mm256_set1_epi32(0xffffff00));
+}
+static inline AVX2 __m256i pixeldist_avx2(__m256i a, __m256i b)
+{
+    __m256i m = _mm256_set1_epi32(0x00ff00ff);
+    __m256i d = absdiff_rgb_avx2(a,b);
+    __m256i t = _mm256_add_epi32(_mm256_and_si256(d, m), _mm256_and_si256(_mm256_srli_epi32(d, 8), m));
+    return _mm256_add_epi32(_mm256_and_si256(t, _mm256_set1_epi32(0xffff)), _mm256_srli_epi32(t, 16));
+}
+static inline AVX2 __m128i fold_avx2(__m256i v)
+{
+    return _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+}
+
+/* 8 pixels at a time, with the SSE2 functions doing the rest */
+static AVX2 int rgb_sad_avx2(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    if(w<8)
+	return rgb_sad_sse2(d1, d2, stride, w, h);
+    __m256i sum = _mm256_setzero_si256();
+    int w8 = w&~7;
+    int y;
+    for(y=0;y<h;y++) {
+	int x;
+	for(x=0;x<w8;x+=8) {
+	    __m256i d = absdiff_rgb_avx2(LOAD256(&d1[x*4]), LOAD256(&d2[x*4]));
+	    sum = _mm256_add_epi32(sum, _mm256_sad_epu8(d, _mm256_setzero_si256()));
+	}
+	d1 += stride; d2 += stride;
+    }
+    int rest = 0;
+    if(w8<w)
+	rest = rgb_sad_sse2(d1-stride*h+w8*4, d2-stride*h+w8*4, stride, w-w8, h);
+    return hsum_sse2(fold_avx2(sum)) + rest;
+}
+
+static AVX2 unsigned int rgb_ssd_avx2(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    if(w<8)
+	return rgb_ssd_sse2(d1, d2, stride, w, h);
+    __m256i sum = _mm256_setzero_si256();
+    int w8 = w&~7;
+    int y;
+    for(y=0;y<h;y++) {
+	int x;
+	for(x=0;x<w8;x+=8) {
+	    __m256i q = pixeldist_avx2(LOAD256(&d1[x*4]), LOAD256(&d2[x*4]));
+	    sum = _mm256_add_epi32(sum, _mm256_madd_epi16(q, q));
+	}
+	d1 += stride; d2 += stride;
+    }
+    unsigned int rest = 0;
+    if(w8<w)
+	rest = rgb_ssd_sse2(d1-stride*h+w8*4, d2-stride*h+w8*4, stride, w-w8, h);
+    return (unsigned int)hsum_sse2(fold_avx2(sum)) + rest;
+}
+
+static AVX2 int rgb_max_avx2(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    if(w<8)
+	return rgb_max_sse2(d1, d2, stride, w, h);
+    __m256i max = _mm256_setzero_si256();
+    int w8 = w&~7;
+    int y;
+    for(y=0;y<h;y++) {
+	int x;
+	for(x=0;x<w8;x+=8) {
+	    max = _mm256_max_epi16(max, pixeldist_avx2(LOAD256(&d1[x*4]), LOAD256(&d2[x*4])));
+	}
+	d1 += stride; d2 += stride;
+    }
+    int m = hmax_sse2(_mm_max_epi16(_mm256_castsi256_si128(max), _mm256_extracti128_si256(max, 1)));
+    if(w8<w) {
+	int rest = rgb_max_sse2(d1-stride*h+w8*4, d2-stride*h+w8*4, stride, w-w8, h);
+	if(rest>m)
+	    m = rest;
+    }
+    return m;
+}
+
+static AVX2 int rgb_differ_avx2(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h)
+{
+    if(w<8)
+	return rgb_differ_sse2(d1, d2, stride, w, h);
+    int w8 = w&~7;
+    int y;
+    for(y=0;y<h;y++) {
+	int x;
+	for(x=0;x<w8;x+=8) {
+	    unsigned int eq = _mm256_movemask_epi8(_mm256_cmpeq_epi8(LOAD256(&d1[x*4]), LOAD256(&d2[x*4])));
+	    if((~eq)&0xeeeeeeeeu) // ignore alpha
+		return 1;
+	}
+	d1 += stride; d2 += stride;
+    }
+    if(w8<w)
+	return rgb_differ_sse2(d1-stride*h+w8*4, d2-stride*h+w8*4, stride, w-w8, h);
+    return 0;
+}
+
+/* 48 byte lines don't split nicely into 32 byte registers, so the
+   yuv comparison stays SSE2 */
+static const blockdiff_t blockdiff_avx2 = {
+    "avx2",
+    rgb_sad_avx2, rgb_ssd_avx2, rgb_max_avx2, rgb_differ_avx2,
+    yuv_sad16_sse2
+};
+
+#endif
+
+const blockdiff_t* blockdiff_get(int level)
+{
+    switch(level) {
+	case BLOCKDIFF_C:
+	    return &blockdiff_c;
+#ifdef __SSE2__
+	case BLOCKDIFF_SSE2:
+	    return &blockdiff_sse2;
+#endif
+#ifdef HAVE_AVX2_KERNELS
+	case BLOCKDIFF_AVX2:
+	    __builtin_cpu_init();
+	    if(__builtin_cpu_supports("avx2"))
+		return &blockdiff_avx2;
+	    return 0;
+#endif
+    }
+    return 0;
+}
+
+const blockdiff_t* blockdiff(void)
+{
+    /* several threads may race to initialize this, but they'll
+       all store the same value */
+    static const blockdiff_t*best = 0;
+    if(!best) {
+	const blockdiff_t*b = blockdiff_get(BLOCKDIFF_AVX2);
+	if(!b) b = blockdiff_get(BLOCKDIFF_SSE2);
+	if(!b) b = blockdiff_get(BLOCKDIFF_C);
+	best = b;
+    }
+    return best;
+}
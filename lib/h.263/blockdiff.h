@@ -0,0 +1,63 @@
+/* blockdiff.h
+
+   Block comparison kernels (with SIMD versions) for video encoding.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#ifndef __blockdiff_h__
+#define __blockdiff_h__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BLOCKDIFF_C 0
+#define BLOCKDIFF_SSE2 1
+#define BLOCKDIFF_AVX2 2
+
+/* The rgb functions compare w x h pixels in (a,r,g,b) byte order, ignoring
+   alpha. stride is the distance between two lines, in bytes.
+   The "distance" of two pixels is |r1-r2|+|g1-g2|+|b1-b2|. */
+typedef struct _blockdiff
+{
+    const char*name;
+
+    /* sum of all pixel distances */
+    int (*rgb_sad)(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h);
+    /* sum of all squared pixel distances (w*h must not exceed 4096) */
+    unsigned int (*rgb_ssd)(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h);
+    /* the largest pixel distance */
+    int (*rgb_max)(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h);
+    /* nonzero if any of the pixels differ */
+    int (*rgb_differ)(const unsigned char*d1, const unsigned char*d2, int stride, int w, int h);
+
+    /* sum of absolute differences of a 16x16 block of interleaved (y,u,v) pixels,
+       separately for luminance and chrominance */
+    void (*yuv_sad16)(const unsigned char*p1, const unsigned char*p2, int stride, int*diffy, int*diffuv);
+} blockdiff_t;
+
+/* the fastest implementation this cpu supports */
+const blockdiff_t* blockdiff(void);
+
+/* a specific implementation (BLOCKDIFF_*), or NULL if not available */
+const blockdiff_t* blockdiff_get(int level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__blockdiff_h__
@@ -19,6 +19,9 @@
    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 
 #include <memory.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 int zigzagtable[64] = {
     0, 1, 5, 6, 14, 15, 27, 28,
@@ -30,161 +33,442 @@ int zigzagtable[64] = {
     21, 34, 37, 47, 50, 56, 59, 61,
     35, 36, 48, 49, 57, 58, 62, 63};
 
-static double table[8][8] =
+/* Integer DCT/IDCT, using the Loeffler-Ligtenberg-Moschytz factorization
+   (12 multiplications per 8 point transform) with 13 bit fixed point
+   constants. The intermediate results of the first pass are kept with
+   PASS1_BITS of extra precision. */
+
+#define CONST_BITS 13
+#define PASS1_BITS 2
+
+#define FIX_0_298631336  2446	/* FIX(0.298631336) */
+#define FIX_0_390180644  3196	/* FIX(0.390180644) */
+#define FIX_0_541196100  4433	/* FIX(0.541196100) */
+#define FIX_0_765366865  6270	/* FIX(0.765366865) */
+#define FIX_0_899976223  7373	/* FIX(0.899976223) */
+#define FIX_1_175875602  9633	/* FIX(1.175875602) */
+#define FIX_1_501321110  12299	/* FIX(1.501321110) */
+#define FIX_1_847759065  15137	/* FIX(1.847759065) */
+#define FIX_1_961570560  16069	/* FIX(1.961570560) */
+#define FIX_2_053119869  16819	/* FIX(2.053119869) */
+#define FIX_2_562915447  20995	/* FIX(2.562915447) */
+#define FIX_3_072711026  25172	/* FIX(3.072711026) */
+
+#define DESCALE(x,n) (((x) + (1 << ((n)-1))) >> (n))
+
+/* one dimensional forward transform. The even coefficients are shifted 
+   up by dcshift, the odd ones down by shift. */
+static inline void fdct_1d(const int*a, int*b, int step, int dcshift, int shift)
 {
-{0.707106781186548,0.707106781186548,0.707106781186548,0.707106781186548,0.707106781186548,0.707106781186548,0.707106781186548,0.707106781186548},
-{0.980785280403230,0.831469612302545,0.555570233019602,0.195090322016128,-0.195090322016128,-0.555570233019602,-0.831469612302545,-0.980785280403230},
-{0.923879532511287,0.382683432365090,-0.382683432365090,-0.923879532511287,-0.923879532511287,-0.382683432365090,0.382683432365090,0.923879532511287},
-{0.831469612302545,-0.195090322016128,-0.980785280403230,-0.555570233019602,0.555570233019602,0.980785280403230,0.195090322016129,-0.831469612302545},
-{0.707106781186548,-0.707106781186547,-0.707106781186548,0.707106781186547,0.707106781186548,-0.707106781186547,-0.707106781186547,0.707106781186547},
-{0.555570233019602,-0.980785280403230,0.195090322016128,0.831469612302545,-0.831469612302545,-0.195090322016128,0.980785280403231,-0.555570233019602},
-{0.382683432365090,-0.923879532511287,0.923879532511287,-0.382683432365090,-0.382683432365091,0.923879532511287,-0.923879532511286,0.382683432365090},
-{0.195090322016128,-0.555570233019602,0.831469612302545,-0.980785280403231,0.980785280403230,-0.831469612302545,0.555570233019602,-0.195090322016129}
-};
+    int tmp0 = a[0*step] + a[7*step];
+    int tmp7 = a[0*step] - a[7*step];
+    int tmp1 = a[1*step] + a[6*step];
+    int tmp6 = a[1*step] - a[6*step];
+    int tmp2 = a[2*step] + a[5*step];
+    int tmp5 = a[2*step] - a[5*step];
+    int tmp3 = a[3*step] + a[4*step];
+    int tmp4 = a[3*step] - a[4*step];
 
-void dct(int*src)
+    /* even part */
+    int tmp10 = tmp0 + tmp3;
+    int tmp13 = tmp0 - tmp3;
+    int tmp11 = tmp1 + tmp2;
+    int tmp12 = tmp1 - tmp2;
+
+    b[0*step] = (tmp10 + tmp11) << dcshift;
+    b[4*step] = (tmp10 - tmp11) << dcshift;
+    int z1 = (tmp12 + tmp13) * FIX_0_541196100;
+    b[2*step] = DESCALE(z1 + tmp13 * FIX_0_765366865, shift);
+    b[6*step] = DESCALE(z1 - tmp12 * FIX_1_847759065, shift);
+
+    /* odd part */
+    z1 = tmp4 + tmp7;
+    int z2 = tmp5 + tmp6;
+    int z3 = tmp4 + tmp6;
+    int z4 = tmp5 + tmp7;
+    int z5 = (z3 + z4) * FIX_1_175875602;
+
+    tmp4 *= FIX_0_298631336;
+    tmp5 *= FIX_2_053119869;
+    tmp6 *= FIX_3_072711026;
+    tmp7 *= FIX_1_501321110;
+    z1 *= -FIX_0_899976223;
+    z2 *= -FIX_2_562915447;
+    z3 = z3 * -FIX_1_961570560 + z5;
+    z4 = z4 * -FIX_0_390180644 + z5;
+
+    b[7*step] = DESCALE(tmp4 + z1 + z3, shift);
+    b[5*step] = DESCALE(tmp5 + z2 + z4, shift);
+    b[3*step] = DESCALE(tmp6 + z2 + z3, shift);
+    b[1*step] = DESCALE(tmp7 + z1 + z4, shift);
+}
+
+/* forward transform, plain C version */
+static void fdct_int_c(const int*src, int*dest)
 {
-    double tmp[64];
-    int x,y,u,v,t;
-
-    for(v=0;v<8;v++)
-    for(u=0;u<8;u++)
-    {
-	double c = 0;
-	for(x=0;x<8;x++)
-	{
-	    c+=table[u][x]*src[v*8+x];
-	}
-	tmp[v*8+u] = c;
-    }
-    for(u=0;u<8;u++)
-    for(v=0;v<8;v++)
-    {
-	double c = 0;
-	for(y=0;y<8;y++)
-	{
-	    c+=table[v][y]*tmp[y*8+u];
-	}
-	src[v*8+u] = (int)(c*0.25+0.5);
+    int tmp[64];
+    int t;
+    for(t=0;t<8;t++)
+	fdct_1d(&src[t*8], &tmp[t*8], 1, PASS1_BITS, CONST_BITS-PASS1_BITS);
+    for(t=0;t<8;t++)
+	fdct_1d(&tmp[t], &dest[t], 8, 0, CONST_BITS);
+}
+
+static inline void idct_1d(const int*a, int*b, int step, int shift)
+{
+    /* even part */
+    int z2 = a[2*step];
+    int z3 = a[6*step];
+    int z1 = (z2 + z3) * FIX_0_541196100;
+    int tmp2 = z1 - z3 * FIX_1_847759065;
+    int tmp3 = z1 + z2 * FIX_0_765366865;
+
+    int tmp0 = (a[0*step] + a[4*step]) << CONST_BITS;
+    int tmp1 = (a[0*step] - a[4*step]) << CONST_BITS;
+
+    int tmp10 = tmp0 + tmp3;
+    int tmp13 = tmp0 - tmp3;
+    int tmp11 = tmp1 + tmp2;
+    int tmp12 = tmp1 - tmp2;
+
+    /* odd part */
+    tmp0 = a[7*step];
+    tmp1 = a[5*step];
+    tmp2 = a[3*step];
+    tmp3 = a[1*step];
+
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    int z4 = tmp1 + tmp3;
+    int z5 = (z3 + z4) * FIX_1_175875602;
+
+    tmp0 *= FIX_0_298631336;
+    tmp1 *= FIX_2_053119869;
+    tmp2 *= FIX_3_072711026;
+    tmp3 *= FIX_1_501321110;
+    z1 *= -FIX_0_899976223;
+    z2 *= -FIX_2_562915447;
+    z3 = z3 * -FIX_1_961570560 + z5;
+    z4 = z4 * -FIX_0_390180644 + z5;
+
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+
+    b[0*step] = DESCALE(tmp10 + tmp3, shift);
+    b[7*step] = DESCALE(tmp10 - tmp3, shift);
+    b[1*step] = DESCALE(tmp11 + tmp2, shift);
+    b[6*step] = DESCALE(tmp11 - tmp2, shift);
+    b[2*step] = DESCALE(tmp12 + tmp1, shift);
+    b[5*step] = DESCALE(tmp12 - tmp1, shift);
+    b[3*step] = DESCALE(tmp13 + tmp0, shift);
+    b[4*step] = DESCALE(tmp13 - tmp0, shift);
+}
+
+static void idct_c(int*src)
+{
+    int tmp[64];
+    int t;
+    for(t=0;t<8;t++)
+	idct_1d(&src[t], &tmp[t], 8, CONST_BITS-PASS1_BITS);
+    for(t=0;t<8;t++)
+	idct_1d(&tmp[t*8], &src[t*8], 1, CONST_BITS+PASS1_BITS+3);
+}
+
+/* -------------------------------- SSE2 ----------------------------------- */
+
+/* The SSE2 versions work on eight 16 bit values at a time, one block row per
+   register, and transform all columns of a block in parallel. The rows are
+   transposed between the two passes. Every multiplication is done with pmaddwd
+   on pairs of inputs, with the products of the scalar code regrouped by input,
+   so the results are bit-identical to fdct_int_c() and idct_c(). This needs
+   the inputs and the first pass results to fit into 16 bit, which the
+   callers check. */
+
+#ifdef __SSE2__
+
+typedef struct {
+    __m128i lo, hi;
+} v32_t;
+
+#define PAIR(a,b) _mm_set1_epi32((int)(((unsigned)(b)<<16) | ((a)&0xffff)))
+
+/* a*ca + b*cb, in 32 bit */
+static inline v32_t madd(__m128i a, __m128i b, int ca, int cb)
+{
+    v32_t r;
+    __m128i c = PAIR(ca, cb);
+    r.lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c);
+    r.hi = _mm_madd_epi16(_mm_unpackhi_epi16(a, b), c);
+    return r;
+}
+static inline v32_t madd4(__m128i a, __m128i b, int ca, int cb, __m128i c, __m128i d, int cc, int cd)
+{
+    v32_t r1 = madd(a, b, ca, cb);
+    v32_t r2 = madd(c, d, cc, cd);
+    r1.lo = _mm_add_epi32(r1.lo, r2.lo);
+    r1.hi = _mm_add_epi32(r1.hi, r2.hi);
+    return r1;
+}
+static inline v32_t add32(v32_t a, v32_t b)
+{
+    a.lo = _mm_add_epi32(a.lo, b.lo);
+    a.hi = _mm_add_epi32(a.hi, b.hi);
+    return a;
+}
+static inline v32_t sub32(v32_t a, v32_t b)
+{
+    a.lo = _mm_sub_epi32(a.lo, b.lo);
+    a.hi = _mm_sub_epi32(a.hi, b.hi);
+    return a;
+}
+static inline v32_t descale32(v32_t a, int n)
+{
+    __m128i round = _mm_set1_epi32(1<<(n-1));
+    a.lo = _mm_srai_epi32(_mm_add_epi32(a.lo, round), n);
+    a.hi = _mm_srai_epi32(_mm_add_epi32(a.hi, round), n);
+    return a;
+}
+static inline __m128i pack32(v32_t a)
+{
+    return _mm_packs_epi32(a.lo, a.hi);
+}
+static inline void store32(int*dest, v32_t a)
+{
+    _mm_storeu_si128((__m128i*)dest, a.lo);
+    _mm_storeu_si128((__m128i*)(dest+4), a.hi);
+}
+
+static inline void transpose8x8(__m128i*r)
+{
+    __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+    __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+    __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+    __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+    __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+    __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+    __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+    __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+    __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+    __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+    __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+    __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+    __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+    __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+    __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+    __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+    r[0] = _mm_unpacklo_epi64(b0, b4);
+    r[1] = _mm_unpackhi_epi64(b0, b4);
+    r[2] = _mm_unpacklo_epi64(b1, b5);
+    r[3] = _mm_unpackhi_epi64(b1, b5);
+    r[4] = _mm_unpacklo_epi64(b2, b6);
+    r[5] = _mm_unpackhi_epi64(b2, b6);
+    r[6] = _mm_unpacklo_epi64(b3, b7);
+    r[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+/* The odd part shared by both directions. Computes
+   x4*FIX_0_298631336 + z1 + z3, x5*FIX_2_053119869 + z2 + z4,
+   x6*FIX_3_072711026 + z2 + z3 and x7*FIX_1_501321110 + z1 + z4
+   (with z1..z4 as in fdct_1d) */
+static inline void odd_part(__m128i x4, __m128i x5, __m128i x6, __m128i x7, v32_t*o)
+{
+    o[0] = madd4(x4, x5, FIX_0_298631336 - FIX_0_899976223 - FIX_1_961570560 + FIX_1_175875602, FIX_1_175875602,
+		 x6, x7, FIX_1_175875602 - FIX_1_961570560, FIX_1_175875602 - FIX_0_899976223);
+    o[1] = madd4(x4, x5, FIX_1_175875602, FIX_2_053119869 - FIX_2_562915447 - FIX_0_390180644 + FIX_1_175875602,
+		 x6, x7, FIX_1_175875602 - FIX_2_562915447, FIX_1_175875602 - FIX_0_390180644);
+    o[2] = madd4(x4, x5, FIX_1_175875602 - FIX_1_961570560, FIX_1_175875602 - FIX_2_562915447,
+		 x6, x7, FIX_3_072711026 - FIX_2_562915447 - FIX_1_961570560 + FIX_1_175875602, FIX_1_175875602);
+    o[3] = madd4(x4, x5, FIX_1_175875602 - FIX_0_899976223, FIX_1_175875602 - FIX_0_390180644,
+		 x6, x7, FIX_1_175875602, FIX_1_501321110 - FIX_0_899976223 - FIX_0_390180644 + FIX_1_175875602);
+}
+
+/* fdct_1d() on all eight columns of r. Results are left in 32 bit. */
+static inline void fdct_1d_sse2(const __m128i*r, v32_t*b, int dcshift, int shift)
+{
+    __m128i tmp0 = _mm_add_epi16(r[0], r[7]);
+    __m128i tmp7 = _mm_sub_epi16(r[0], r[7]);
+    __m128i tmp1 = _mm_add_epi16(r[1], r[6]);
+    __m128i tmp6 = _mm_sub_epi16(r[1], r[6]);
+    __m128i tmp2 = _mm_add_epi16(r[2], r[5]);
+    __m128i tmp5 = _mm_sub_epi16(r[2], r[5]);
+    __m128i tmp3 = _mm_add_epi16(r[3], r[4]);
+    __m128i tmp4 = _mm_sub_epi16(r[3], r[4]);
+
+    /* even part */
+    __m128i tmp10 = _mm_add_epi16(tmp0, tmp3);
+    __m128i tmp13 = _mm_sub_epi16(tmp0, tmp3);
+    __m128i tmp11 = _mm_add_epi16(tmp1, tmp2);
+    __m128i tmp12 = _mm_sub_epi16(tmp1, tmp2);
+
+    b[0] = madd(tmp10, tmp11, 1<<dcshift, 1<<dcshift);
+    b[4] = madd(tmp10, tmp11, 1<<dcshift, -(1<<dcshift));
+    b[2] = descale32(madd(tmp12, tmp13, FIX_0_541196100, FIX_0_541196100 + FIX_0_765366865), shift);
+    b[6] = descale32(madd(tmp12, tmp13, FIX_0_541196100 - FIX_1_847759065, FIX_0_541196100), shift);
+
+    /* odd part */
+    v32_t o[4];
+    odd_part(tmp4, tmp5, tmp6, tmp7, o);
+    b[7] = descale32(o[0], shift);
+    b[5] = descale32(o[1], shift);
+    b[3] = descale32(o[2], shift);
+    b[1] = descale32(o[3], shift);
+}
+
+/* idct_1d() on all eight columns of a */
+static inline void idct_1d_sse2(const __m128i*a, v32_t*b, int shift)
+{
+    /* even part */
+    v32_t tmp2 = madd(a[2], a[6], FIX_0_541196100, FIX_0_541196100 - FIX_1_847759065);
+    v32_t tmp3 = madd(a[2], a[6], FIX_0_541196100 + FIX_0_765366865, FIX_0_541196100);
+    v32_t tmp0 = madd(a[0], a[4], 1<<CONST_BITS, 1<<CONST_BITS);
+    v32_t tmp1 = madd(a[0], a[4], 1<<CONST_BITS, -(1<<CONST_BITS));
+
+    v32_t tmp10 = add32(tmp0, tmp3);
+    v32_t tmp13 = sub32(tmp0, tmp3);
+    v32_t tmp11 = add32(tmp1, tmp2);
+    v32_t tmp12 = sub32(tmp1, tmp2);
+
+    /* odd part */
+    v32_t o[4];
+    odd_part(a[7], a[5], a[3], a[1], o);
+
+    b[0] = descale32(add32(tmp10, o[3]), shift);
+    b[7] = descale32(sub32(tmp10, o[3]), shift);
+    b[1] = descale32(add32(tmp11, o[2]), shift);
+    b[6] = descale32(sub32(tmp11, o[2]), shift);
+    b[2] = descale32(add32(tmp12, o[1]), shift);
+    b[5] = descale32(sub32(tmp12, o[1]), shift);
+    b[3] = descale32(add32(tmp13, o[0]), shift);
+    b[4] = descale32(sub32(tmp13, o[0]), shift);
+}
+
+static inline __m128i load_row(const int*src)
+{
+    return _mm_packs_epi32(_mm_loadu_si128((const __m128i*)src), 
+			   _mm_loadu_si128((const __m128i*)(src+4)));
+}
+
+/* returns 0 (and does nothing) if the input isn't 9 bit */
+static int fdct_int_sse2(const int*src, int*dest)
+{
+    __m128i r[8];
+    v32_t b[8];
+    __m128i max = _mm_set1_epi16(255);
+    __m128i min = _mm_set1_epi16(-255);
+    __m128i out = _mm_setzero_si128();
+    int t;
+    for(t=0;t<8;t++) {
+	r[t] = load_row(&src[t*8]);
+	out = _mm_or_si128(out, _mm_or_si128(_mm_cmpgt_epi16(r[t], max), _mm_cmplt_epi16(r[t], min)));
     }
+    if(_mm_movemask_epi8(out))
+	return 0;
+
+    transpose8x8(r);
+    fdct_1d_sse2(r, b, PASS1_BITS, CONST_BITS-PASS1_BITS);
+    for(t=0;t<8;t++)
+	r[t] = pack32(b[t]);
+    transpose8x8(r);
+    fdct_1d_sse2(r, b, 0, CONST_BITS);
+    for(t=0;t<8;t++)
+	store32(&dest[t*8], b[t]);
+    return 1;
 }
 
-void idct(int*src)
+/* The first pass multiplies a column with at most ~5.6*(sum of its absolute
+   values), so that sum has to stay below 5800 for the result to fit into 16
+   bit. Returns 0 (and does nothing) otherwise. */
+static int idct_sse2(int*src)
 {
-    double tmp[64];
-    int x,y,u,v;
-    for(y=0;y<8;y++)
-    for(x=0;x<8;x++)
-    {
-	double c = 0;
-	for(u=0;u<8;u++)
-	{
-	    c+=table[u][x]*src[y*8+u];
-	}
-	tmp[y*8+x] = c;
+    __m128i r[8];
+    v32_t b[8];
+    __m128i sum = _mm_setzero_si128();
+    int t;
+    for(t=0;t<8;t++) {
+	r[t] = load_row(&src[t*8]);
+	sum = _mm_add_epi16(sum, _mm_max_epi16(r[t], _mm_sub_epi16(_mm_setzero_si128(), r[t])));
     }
-    for(y=0;y<8;y++)
-    for(x=0;x<8;x++)
-    {
-	double c = 0;
-	for(v=0;v<8;v++)
-	{
-	    c+=table[v][y]*tmp[v*8+x];
-	}
-	src[y*8+x] = (int)(c*0.25+0.5);
+    if(_mm_movemask_epi8(_mm_cmpgt_epi16(sum, _mm_set1_epi16(5800))))
+	return 0;
+
+    idct_1d_sse2(r, b, CONST_BITS-PASS1_BITS);
+    for(t=0;t<8;t++)
+	r[t] = pack32(b[t]);
+    transpose8x8(r);
+    idct_1d_sse2(r, b, CONST_BITS+PASS1_BITS+3);
+    for(t=0;t<8;t++)
+	r[t] = pack32(b[t]);
+    transpose8x8(r);
+    for(t=0;t<8;t++) {
+	_mm_storeu_si128((__m128i*)&src[t*8], _mm_srai_epi32(_mm_unpacklo_epi16(r[t], r[t]), 16));
+	_mm_storeu_si128((__m128i*)&src[t*8+4], _mm_srai_epi32(_mm_unpackhi_epi16(r[t], r[t]), 16));
     }
+    return 1;
 }
 
-static double c[8] = {1.0,
-0.980785280403230, // cos(Pi*1/16), sin(Pi*7/16)
-0.923879532511287, // cos(Pi*2/16), sin(Pi*6/16)
-0.831469612302545, // cos(Pi*3/16), sin(Pi*5/16)
-0.707106781186548, // cos(Pi*4/16), sin(Pi*4/16), 1/sqrt(2)
-0.555570233019602, // cos(Pi*5/16), sin(Pi*3/16)
-0.382683432365090, // cos(Pi*6/16), sin(Pi*2/16)
-0.195090322016128 // cos(Pi*7/16), sin(Pi*1/16)
-};
-
-static double cc[8];
-static int ccquant = -1;
+#endif
 
-void preparequant(int quant)
+/* forward transform. The result is scaled up by 8<<PASS1_BITS
+   compared to the orthonormal DCT. */
+static void fdct_int(const int*src, int*dest)
 {
-    if(ccquant == quant)
+#ifdef __SSE2__
+    if(fdct_int_sse2(src, dest))
 	return;
-    cc[0] = c[0]/(quant*2*4);
-    cc[1] = c[1]/(quant*2*4);
-    cc[2] = c[2]/(quant*2*4);
-    cc[3] = c[3]/(quant*2*4);
-    cc[4] = c[4]/(quant*2*4);
-    cc[5] = c[5]/(quant*2*4);
-    cc[6] = c[6]/(quant*2*4);
-    cc[7] = c[7]/(quant*2*4);
-    ccquant = quant;
-}
-
-inline static void innerdct(const double*a,double*b, const double*c)
-{
-    // c1*c7*2 = c6
-    // c2*c6*2 = c4
-    // c3*c5*2 = c2
-    // c4*c4*2 = 1
-
-     //{  1,  3,  5,  7, -7, -5, -3, -1},
-     //{  3, -7, -1, -5,  5,  1,  7, -3},
-     //{  5, -1,  7,  3, -3, -7,  1, -5},
-     //{  7, -5,  3, -1,  1, -3,  5, -7}
-    double b0,b1,b2,b3,b4,b5;
-    b2 = (a[0]+a[7]);
-    b3 = (a[1]+a[6]);
-    b4 = (a[2]+a[5]);
-    b5 = (a[3]+a[4]);
-
-    b0 = (b2+b5)*c[4];
-    b1 = (b3+b4)*c[4];
-    b[0*8] = b0 + b1;
-    b[4*8] = b0 - b1;
-    b[2*8] = (b2-b5)*c[2] + (b3-b4)*c[6];
-    b[6*8] = (b2-b5)*c[6] + (b4-b3)*c[2];
-
-    b0 = (a[0]-a[7]);
-    b1 = (a[1]-a[6]);
-    b2 = (a[2]-a[5]);
-    b3 = (a[3]-a[4]);
-
-    b[1*8] = b0*c[1] + b1*c[3] + b2*c[5] + b3*c[7];
-    b[3*8] = b0*c[3] - b1*c[7] - b2*c[1] - b3*c[5];
-    b[5*8] = b0*c[5] - b1*c[1] + b2*c[7] + b3*c[3];
-    b[7*8] = b0*c[7] - b1*c[5] + b2*c[3] - b3*c[1];
-}
-
-void dct2(int*src, int*dest)
-{
-    double tmp[64], tmp2[64];
-    double*p;
-    int u,x,v,t;
-
-    for(t=0;t<64;t++)
-	tmp2[t] = src[t];
-
-    for(v=0;v<8;v++)
-    {
-	double* a=&tmp2[v*8];
-	double* b=&tmp[v];
-	innerdct(a,b,c);
-    }
-    for(v=0;v<8;v++)
-    {
-	double* a=&tmp[v*8];
-	double* b=&tmp2[v];
-	innerdct(a,b,cc);
+#endif
+    fdct_int_c(src, dest);
+}
+
+#define FDCT_SHIFT (PASS1_BITS+3)
+
+void dct(int*src)
+{
+    int t;
+    fdct_int(src, src);
+    for(t=0;t<64;t++) {
+	src[t] = DESCALE(src[t], FDCT_SHIFT);
     }
+}
+
+void idct(int*src)
+{
+    int t;
+    /* keep broken input from overflowing the 32 bit intermediate values.
+       Blocks of 9 bit values never have coefficients outside of this range. */
     for(t=0;t<64;t++) {
-	int v = (int)(tmp2[t]);
-	dest[zigzagtable[t]] = v;
+	if(src[t]<-2048) src[t]=-2048;
+	if(src[t]>2047) src[t]=2047;
     }
+#ifdef __SSE2__
+    if(idct_sse2(src))
+	return;
+#endif
+    idct_c(src);
+}
+
+/* dct2() divides by 2*quant (in fixed point), by multiplying with the
+   reciprocal. This is exact for all values fdct_int can produce. */
+unsigned int quantrecip(int quant)
+{
+    return (unsigned int)((((unsigned long long)1<<32) + ((quant*2)<<FDCT_SHIFT) - 1) / ((quant*2)<<FDCT_SHIFT));
 }
 
+/* dct, quantization (rounding towards zero) and zigzag in one step */
+void dct2(int*src, int*dest, unsigned int recip)
+{
+    int tmp[64];
+    int t;
+    fdct_int(src, tmp);
+    for(t=0;t<64;t++) {
+	int sign = tmp[t] >> 31;
+	unsigned int v = (tmp[t] ^ sign) - sign;
+	int q = (int)(((unsigned long long)v * recip) >> 32);
+	dest[zigzagtable[t]] = (q ^ sign) - sign;
+    }
+}
 
 void zigzag(int*src)
 {
@@ -22,8 +22,8 @@
 void dct(int*src);
 void idct(int*src);
 
-void preparequant(int quant);
-void dct2(int*src, int*dest);
+unsigned int quantrecip(int quant);
+void dct2(int*src, int*dest, unsigned int recip);
 
 extern int zigzagtable[64];
 void zigzag(int*src);
@@ -26,6 +26,7 @@
 #include "../rfxswf.h"
 #include "h263tables.h"
 #include "dct.h"
+#include "blockdiff.h"
 
 /* TODO:
    - use prepare* / write* in encode_IFrame_block
@@ -318,21 +319,8 @@ static int compare_pic_pic(VIDEOSTREAM*s, YUV*pp1, YUV*pp2, int bx, int by)
     int linex = s->width;
     YUV*p1 = &pp1[by*linex*16+bx*16];
     YUV*p2 = &pp2[by*linex*16+bx*16];
-    int diffy=0, diffuv = 0;
-    int x,y;
-    for(y=0;y<16;y++) {
-	for(x=0;x<16;x++) {
-	    YUV*m = &p1[x];
-	    YUV*n = &p2[x];
-	    int y = m->y - n->y;
-	    int u = m->u - n->u;
-	    int v = m->v - n->v;
-	    diffy += abs(y);
-	    diffuv += abs(u)+abs(v);
-	}
-	p1+=linex;
-	p2+=linex;
-    }
+    int diffy, diffuv;
+    blockdiff()->yuv_sad16((U8*)p1, (U8*)p2, linex*sizeof(YUV), &diffy, &diffuv);
     return diffy + diffuv/4;
 }
 
@@ -650,9 +638,9 @@ static void dodctandquant(block_t*fb, block_t*b, int has_dc, int quant)
 	quantize(fb,b,has_dc,quant);
 	return;
     }
-    preparequant(quant);
-    dct2(fb->y1,b->y1); dct2(fb->y2,b->y2); dct2(fb->y3,b->y3); dct2(fb->y4,b->y4);
-    dct2(fb->u,b->u);  dct2(fb->v,b->v);
+    unsigned int recip = quantrecip(quant);
+    dct2(fb->y1,b->y1,recip); dct2(fb->y2,b->y2,recip); dct2(fb->y3,b->y3,recip); dct2(fb->y4,b->y4,recip);
+    dct2(fb->u,b->u,recip);  dct2(fb->v,b->v,recip);
 
     for(t=0;t<64;t++) {
 	/* prepare for encoding (only values in (-127..-1,1..127) are
@@ -958,6 +946,187 @@ int getmvdbits(VIDEOSTREAM*s,block_t*fb, int bx,int by,int hx,int hy)
     return bits;
 }
 
+/* tries every fourth vector, then refines around the best one */
+static void fullmotionsearch(VIDEOSTREAM*s, block_t*fb, int bx, int by, int startx, int endx, int starty, int endy, 
+	                     int*movex, int*movey)
+{
+    int hx,hy;
+    int bestx=0,besty=0,bestbits=65536;
+
+    for(hx=startx;hx<=endx;hx+=4)
+    for(hy=starty;hy<=endy;hy+=4)
+    {
+	int bits = 0;
+	bits = getmvdbits(s,fb,bx,by,hx,hy);
+	if(bits<bestbits) {
+	    bestbits = bits;
+	    bestx = hx;
+	    besty = hy;
+	}
+    }
+    
+    if(bestx-3 > startx) startx = bestx-3;
+    if(besty-3 > starty) starty = besty-3;
+    if(bestx+3 < endx) endx = bestx+3;
+    if(besty+3 < endy) endy = besty+3;
+
+    for(hx=startx;hx<=endx;hx++)
+    for(hy=starty;hy<=endy;hy++)
+    {
+	int bits = 0;
+	bits = getmvdbits(s,fb,bx,by,hx,hy);
+	if(bits<bestbits) {
+	    bestbits = bits;
+	    bestx = hx;
+	    besty = hy;
+	}
+    }
+    *movex = bestx;
+    *movey = besty;
+}
+
+/* sum of absolute luminance differences between the current block and the
+   (half-pixel interpolated) block at motion vector hx,hy in the last frame.
+   Stops as soon as the sum exceeds limit. */
+static int getmvdsad(VIDEOSTREAM*s, int bx, int by, int hx, int hy, int limit)
+{
+    int linex = s->linex;
+    int posx = bx*16 + ((hx&~1)/2);
+    int posy = by*16 + ((hy&~1)/2);
+    YUV*c = &s->current[by*16*linex+bx*16];
+    YUV*p = &s->oldpic[posy*linex+posx];
+    int yhp = ((hy&1)<<1|(hx&1));
+    int sad = 0;
+    int x,y;
+    if(!yhp) {
+	/* full pixel vectors are most of the candidates, and don't need
+	   interpolation, so they can use the SIMD kernel */
+	int diffuv;
+	blockdiff()->yuv_sad16((U8*)c, (U8*)p, linex*sizeof(YUV), &sad, &diffuv);
+	return sad;
+    }
+    for(y=0;y<16;y++) {
+	switch(yhp) {
+	    case 0:
+		for(x=0;x<16;x++) sad += abs(c[x].y - p[x].y);
+	    break;
+	    case 1:
+		for(x=0;x<16;x++) sad += abs(c[x].y - (p[x].y + p[x+1].y)/2);
+	    break;
+	    case 2:
+		for(x=0;x<16;x++) sad += abs(c[x].y - (p[x].y + p[x+linex].y)/2);
+	    break;
+	    case 3:
+		for(x=0;x<16;x++) sad += abs(c[x].y - (p[x].y + p[x+1].y + p[x+linex].y + p[x+linex+1].y)/4);
+	    break;
+	}
+	if(sad > limit)
+	    return sad;
+	c+=linex;
+	p+=linex;
+    }
+    return sad;
+}
+
+#define MOTION_CANDIDATES 3
+
+typedef struct _motionsearch {
+    VIDEOSTREAM*s;
+    int bx,by;
+    int predictx,predicty;
+    int startx,endx,starty,endy;
+    int lambda;
+    unsigned char visited[64*64];
+    /* best candidates so far, sorted by cost */
+    int num;
+    int x[MOTION_CANDIDATES];
+    int y[MOTION_CANDIDATES];
+    int cost[MOTION_CANDIDATES];
+} motionsearch_t;
+
+/* evaluates a motion vector, returns 1 if it's the new best one */
+static int motionsearch_try(motionsearch_t*m, int hx, int hy)
+{
+    if(hx<m->startx || hx>m->endx || hy<m->starty || hy>m->endy)
+	return 0;
+    if(m->visited[(hy+32)*64+(hx+32)])
+	return 0;
+    m->visited[(hy+32)*64+(hx+32)] = 1;
+
+    int cost = m->lambda*(mvd[mvd2index(m->predictx, m->predicty, hx, hy, 0)].len + 
+	                  mvd[mvd2index(m->predictx, m->predicty, hx, hy, 1)].len);
+    int limit = m->num<MOTION_CANDIDATES?0x7fffffff:m->cost[m->num-1];
+    if(cost >= limit)
+	return 0;
+    cost += getmvdsad(m->s, m->bx, m->by, hx, hy, limit-cost);
+    if(cost >= limit)
+	return 0;
+
+    int pos = m->num<MOTION_CANDIDATES?m->num++:m->num-1;
+    while(pos>0 && m->cost[pos-1] > cost) {
+	m->x[pos] = m->x[pos-1];
+	m->y[pos] = m->y[pos-1];
+	m->cost[pos] = m->cost[pos-1];
+	pos--;
+    }
+    m->x[pos] = hx;
+    m->y[pos] = hy;
+    m->cost[pos] = cost;
+    return pos==0;
+}
+
+/* diamond search (on the full pixel grid, with vectors in half pixel units), 
+   followed by a half pixel refinement. Only the best few candidates
+   are then evaluated with the actual bit costs. */
+static void fastmotionsearch(VIDEOSTREAM*s, block_t*fb, int bx, int by, int startx, int endx, int starty, int endy, 
+	                     int predictx, int predicty, int*movex, int*movey)
+{
+    static const int large_diamond[8][2] = {{4,0},{-4,0},{0,4},{0,-4},{2,2},{2,-2},{-2,2},{-2,-2}};
+    static const int small_diamond[4][2] = {{2,0},{-2,0},{0,2},{0,-2}};
+    static const int halfpel[8][2] = {{1,0},{-1,0},{0,1},{0,-1},{1,1},{1,-1},{-1,1},{-1,-1}};
+    motionsearch_t m;
+    int t;
+
+    memset(m.visited, 0, sizeof(m.visited));
+    m.s = s;
+    m.bx = bx; m.by = by;
+    m.predictx = predictx; m.predicty = predicty;
+    m.startx = startx; m.endx = endx;
+    m.starty = starty; m.endy = endy;
+    m.lambda = s->quant;
+    m.num = 0;
+
+    motionsearch_try(&m, 0, 0);
+    motionsearch_try(&m, predictx&~1, predicty&~1);
+
+    int cx, cy;
+    do {
+	cx = m.x[0]; cy = m.y[0];
+	for(t=0;t<8;t++)
+	    motionsearch_try(&m, cx+large_diamond[t][0], cy+large_diamond[t][1]);
+    } while(m.x[0]!=cx || m.y[0]!=cy);
+
+    cx = m.x[0]; cy = m.y[0];
+    for(t=0;t<4;t++)
+	motionsearch_try(&m, cx+small_diamond[t][0], cy+small_diamond[t][1]);
+
+    cx = m.x[0]; cy = m.y[0];
+    for(t=0;t<8;t++)
+	motionsearch_try(&m, cx+halfpel[t][0], cy+halfpel[t][1]);
+
+    int bestbits = 0x7fffffff;
+    for(t=0;t<m.num;t++) {
+	int bits = getmvdbits(s,fb,bx,by,m.x[t],m.y[t]);
+	bits += mvd[mvd2index(predictx, predicty, m.x[t], m.y[t], 0)].len;
+	bits += mvd[mvd2index(predictx, predicty, m.x[t], m.y[t], 1)].len;
+	if(bits<bestbits) {
+	    bestbits = bits;
+	    *movex = m.x[t];
+	    *movey = m.y[t];
+	}
+    }
+}
+
 void prepareMVDBlock(VIDEOSTREAM*s, mvdblockdata_t*data, int bx, int by, block_t* fb, int*bits)
 { /* consider mvd(x,y)-block */
 
@@ -976,8 +1145,6 @@ void prepareMVDBlock(VIDEOSTREAM*s, mvdblockdata_t*data, int bx, int by, block_t
     data->movey=0;
 
     if(s->do_motion) {
-	int hx,hy;
-	int bestx=0,besty=0,bestbits=65536;
 	int startx=-32,endx=31;
 	int starty=-32,endy=31;
 
@@ -986,36 +1153,13 @@ void prepareMVDBlock(VIDEOSTREAM*s, mvdblockdata_t*data, int bx, int by, block_t
 	if(bx==s->bbx-1) endx=0;
 	if(by==s->bby-1) endy=0;
 
-	for(hx=startx;hx<=endx;hx+=4)
-	for(hy=starty;hy<=endy;hy+=4)
-	{
-	    int bits = 0;
-	    bits = getmvdbits(s,fb,bx,by,hx,hy);
-	    if(bits<bestbits) {
-		bestbits = bits;
-		bestx = hx;
-		besty = hy;
-	    }
-	}
-	
-	if(bestx-3 > startx) startx = bestx-3;
-	if(besty-3 > starty) starty = besty-3;
-	if(bestx+3 < endx) endx = bestx+3;
-	if(besty+3 < endy) endy = besty+3;
-
-	for(hx=startx;hx<=endx;hx++)
-	for(hy=starty;hy<=endy;hy++)
-	{
-	    int bits = 0;
-	    bits = getmvdbits(s,fb,bx,by,hx,hy);
-	    if(bits<bestbits) {
-		bestbits = bits;
-		bestx = hx;
-		besty = hy;
-	    }
+	if(s->fast_motion) {
+	    fastmotionsearch(s, fb, bx, by, startx, endx, starty, endy, 
+		             predictmvdx, predictmvdy, &data->movex, &data->movey);
+	} else {
+	    fullmotionsearch(s, fb, bx, by, startx, endx, starty, endy, 
+		             &data->movex, &data->movey);
 	}
-	data->movex = bestx;
-	data->movey = besty;
     }
 
     memcpy(&fbdiff, fb, sizeof(block_t));
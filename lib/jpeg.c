@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <memory.h>
 #include "jpeg.h"
+#include "bitio.h"
 #include "../config.h"
 
 #ifdef HAVE_JPEGLIB
@@ -10,56 +11,68 @@
 
 #define OUTBUFFER_SIZE 0x8000
 
-static FILE*fi;
-static JOCTET * buffer;
-static unsigned char*dest;
-static int len;
-static int destlen;
-static unsigned char*data;
-static int pos;
-static int size;
+/* destination managers keep their state next to the libjpeg struct, so that
+   several images can be compressed at the same time */
+typedef struct _jpeg_file_dest {
+    struct jpeg_destination_mgr mgr;
+    FILE*fi;
+    JOCTET*buffer;
+} jpeg_file_dest_t;
+
+typedef struct _jpeg_mem_dest {
+    struct jpeg_destination_mgr mgr;
+    unsigned char*dest;
+    int destlen;
+    int len;
+} jpeg_mem_dest_t;
 
 static void file_init_destination(j_compress_ptr cinfo) 
 { 
-  struct jpeg_destination_mgr*dmgr = 
-      (struct jpeg_destination_mgr*)(cinfo->dest);
-  buffer = (JOCTET*)malloc(OUTBUFFER_SIZE);
-  if(!buffer) {
+  jpeg_file_dest_t*d = (jpeg_file_dest_t*)(cinfo->dest);
+  d->buffer = (JOCTET*)malloc(OUTBUFFER_SIZE);
+  if(!d->buffer) {
       perror("malloc");
       printf("Out of memory!\n");
       exit(1);
   }
-  dmgr->next_output_byte = buffer;
-  dmgr->free_in_buffer = OUTBUFFER_SIZE;
+  d->mgr.next_output_byte = d->buffer;
+  d->mgr.free_in_buffer = OUTBUFFER_SIZE;
 }
 
 static boolean file_empty_output_buffer(j_compress_ptr cinfo)
 { 
-  struct jpeg_destination_mgr*dmgr = 
-      (struct jpeg_destination_mgr*)(cinfo->dest);
-  if(fi)
-    fwrite(buffer, OUTBUFFER_SIZE, 1, fi);
-  dmgr->next_output_byte = buffer;
-  dmgr->free_in_buffer = OUTBUFFER_SIZE;
+  jpeg_file_dest_t*d = (jpeg_file_dest_t*)(cinfo->dest);
+  if(d->fi)
+    fwrite(d->buffer, OUTBUFFER_SIZE, 1, d->fi);
+  d->mgr.next_output_byte = d->buffer;
+  d->mgr.free_in_buffer = OUTBUFFER_SIZE;
   return 1;
 }
 
 static void file_term_destination(j_compress_ptr cinfo) 
-{ struct jpeg_destination_mgr*dmgr = 
-      (struct jpeg_destination_mgr*)(cinfo->dest);
-  if(fi)
-    fwrite(buffer, OUTBUFFER_SIZE-dmgr->free_in_buffer, 1, fi);
-  free(buffer);
-  buffer = 0;
-  dmgr->free_in_buffer = 0;
+{ 
+  jpeg_file_dest_t*d = (jpeg_file_dest_t*)(cinfo->dest);
+  if(d->fi)
+    fwrite(d->buffer, OUTBUFFER_SIZE-d->mgr.free_in_buffer, 1, d->fi);
+  free(d->buffer);
+  d->buffer = 0;
+  d->mgr.free_in_buffer = 0;
+}
+
+static void file_dest_init(jpeg_file_dest_t*d, FILE*fi)
+{
+  memset(d, 0, sizeof(jpeg_file_dest_t));
+  d->fi = fi;
+  d->mgr.init_destination = file_init_destination;
+  d->mgr.empty_output_buffer = file_empty_output_buffer;
+  d->mgr.term_destination = file_term_destination;
 }
 
 static void mem_init_destination(j_compress_ptr cinfo) 
 { 
-  struct jpeg_destination_mgr*dmgr = 
-      (struct jpeg_destination_mgr*)(cinfo->dest);
-  dmgr->next_output_byte = dest;
-  dmgr->free_in_buffer = destlen;
+  jpeg_mem_dest_t*d = (jpeg_mem_dest_t*)(cinfo->dest);
+  d->mgr.next_output_byte = d->dest;
+  d->mgr.free_in_buffer = d->destlen;
 }
 
 static boolean mem_empty_output_buffer(j_compress_ptr cinfo)
@@ -70,17 +83,17 @@ static boolean mem_empty_output_buffer(j_compress_ptr cinfo)
 
 static void mem_term_destination(j_compress_ptr cinfo) 
 { 
-  struct jpeg_destination_mgr*dmgr = 
-      (struct jpeg_destination_mgr*)(cinfo->dest);
-  len = destlen - dmgr->free_in_buffer;
-  dmgr->free_in_buffer = 0;
+  jpeg_mem_dest_t*d = (jpeg_mem_dest_t*)(cinfo->dest);
+  d->len = d->destlen - d->mgr.free_in_buffer;
+  d->mgr.free_in_buffer = 0;
 }
 
 int jpeg_save(unsigned char*data, unsigned width, unsigned height, int quality, const char*filename)
 {
-  struct jpeg_destination_mgr mgr;
+  jpeg_file_dest_t mgr;
   struct jpeg_compress_struct cinfo;
   struct jpeg_error_mgr jerr;
+  FILE*fi;
   int t;
 
   if(filename)
@@ -90,14 +103,11 @@ int jpeg_save(unsigned char*data, unsigned width, unsigned height, int quality,
 
   memset(&cinfo, 0, sizeof(cinfo));
   memset(&jerr, 0, sizeof(jerr));
-  memset(&mgr, 0, sizeof(mgr));
   cinfo.err = jpeg_std_error(&jerr);
   jpeg_create_compress(&cinfo);
 
-  mgr.init_destination = file_init_destination;
-  mgr.empty_output_buffer = file_empty_output_buffer;
-  mgr.term_destination = file_term_destination;
-  cinfo.dest = &mgr;
+  file_dest_init(&mgr, fi);
+  cinfo.dest = &mgr.mgr;
 
   // init compression
   
@@ -126,23 +136,21 @@ int jpeg_save(unsigned char*data, unsigned width, unsigned height, int quality,
 
 int jpeg_save_gray(unsigned char*data, unsigned width, unsigned height, int quality, const char*filename)
 {
-  struct jpeg_destination_mgr mgr;
+  jpeg_file_dest_t mgr;
   struct jpeg_compress_struct cinfo;
   struct jpeg_error_mgr jerr;
+  FILE*fi;
 
   if(filename) fi = fopen(filename, "wb");
   else         fi = 0;
 
   memset(&cinfo, 0, sizeof(cinfo));
   memset(&jerr, 0, sizeof(jerr));
-  memset(&mgr, 0, sizeof(mgr));
   cinfo.err = jpeg_std_error(&jerr);
   jpeg_create_compress(&cinfo);
 
-  mgr.init_destination = file_init_destination;
-  mgr.empty_output_buffer = file_empty_output_buffer;
-  mgr.term_destination = file_term_destination;
-  cinfo.dest = &mgr;
+  file_dest_init(&mgr, fi);
+  cinfo.dest = &mgr.mgr;
   cinfo.image_width  = width;
   cinfo.image_height = height;
   cinfo.input_components = 1;
@@ -165,23 +173,18 @@ int jpeg_save_gray(unsigned char*data, unsigned width, unsigned height, int qual
 
 int jpeg_save_to_file(unsigned char*data, unsigned width, unsigned height, int quality, FILE*_fi)
 {
-  struct jpeg_destination_mgr mgr;
+  jpeg_file_dest_t mgr;
   struct jpeg_compress_struct cinfo;
   struct jpeg_error_mgr jerr;
   int t;
 
-  fi = _fi;
-
   memset(&cinfo, 0, sizeof(cinfo));
   memset(&jerr, 0, sizeof(jerr));
-  memset(&mgr, 0, sizeof(mgr));
   cinfo.err = jpeg_std_error(&jerr);
   jpeg_create_compress(&cinfo);
 
-  mgr.init_destination = file_init_destination;
-  mgr.empty_output_buffer = file_empty_output_buffer;
-  mgr.term_destination = file_term_destination;
-  cinfo.dest = &mgr;
+  file_dest_init(&mgr, _fi);
+  cinfo.dest = &mgr.mgr;
 
   // init compression
   
@@ -208,7 +211,7 @@ int jpeg_save_to_file(unsigned char*data, unsigned width, unsigned height, int q
 
 int jpeg_save_to_mem(unsigned char*data, unsigned width, unsigned height, int quality, unsigned char*_dest, int _destlen, int components)
 {
-    struct jpeg_destination_mgr mgr;
+    jpeg_mem_dest_t mgr;
     struct jpeg_compress_struct cinfo;
     struct jpeg_error_mgr jerr;
     int t;
@@ -219,14 +222,14 @@ int jpeg_save_to_mem(unsigned char*data, unsigned width, unsigned height, int qu
     cinfo.err = jpeg_std_error(&jerr);
     jpeg_create_compress(&cinfo);
 
-    dest = _dest;
-    len = 0;
-    destlen = _destlen;
+    mgr.dest = _dest;
+    mgr.len = 0;
+    mgr.destlen = _destlen;
 
-    mgr.init_destination = mem_init_destination;
-    mgr.empty_output_buffer = mem_empty_output_buffer;
-    mgr.term_destination = mem_term_destination;
-    cinfo.dest = &mgr;
+    mgr.mgr.init_destination = mem_init_destination;
+    mgr.mgr.empty_output_buffer = mem_empty_output_buffer;
+    mgr.mgr.term_destination = mem_term_destination;
+    cinfo.dest = &mgr.mgr;
 
     // init compression
 
@@ -263,70 +266,186 @@ int jpeg_save_to_mem(unsigned char*data, unsigned width, unsigned height, int qu
 
     jpeg_finish_compress(&cinfo);
     jpeg_destroy_compress(&cinfo);
-    return len;
+    return mgr.len;
 }
 
+typedef struct _jpeg_writer_internal {
+    struct jpeg_destination_mgr mgr;
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    struct _writer*w;
+    JOCTET*buffer;
+    unsigned char*line;
+    int components;
+} jpeg_writer_internal_t;
+
+static void writer_init_destination(j_compress_ptr cinfo)
+{
+    jpeg_writer_internal_t*i = (jpeg_writer_internal_t*)cinfo->dest;
+    i->mgr.next_output_byte = i->buffer;
+    i->mgr.free_in_buffer = OUTBUFFER_SIZE;
+}
+
+static boolean writer_empty_output_buffer(j_compress_ptr cinfo)
+{
+    jpeg_writer_internal_t*i = (jpeg_writer_internal_t*)cinfo->dest;
+    i->w->write(i->w, i->buffer, OUTBUFFER_SIZE);
+    i->mgr.next_output_byte = i->buffer;
+    i->mgr.free_in_buffer = OUTBUFFER_SIZE;
+    return 1;
+}
+
+static void writer_term_destination(j_compress_ptr cinfo)
+{
+    jpeg_writer_internal_t*i = (jpeg_writer_internal_t*)cinfo->dest;
+    i->w->write(i->w, i->buffer, OUTBUFFER_SIZE-i->mgr.free_in_buffer);
+    i->mgr.free_in_buffer = 0;
+}
+
+int jpeg_writer_start(jpeg_writer_t*jpeg, struct _writer*w, unsigned width, unsigned height, int quality, int components)
+{
+    if(components != 3 && components != 4) {
+        fprintf(stderr, "unsupported number of components in jpeg_writer_start()\n");
+        return 0;
+    }
+    jpeg_writer_internal_t*i = (jpeg_writer_internal_t*)calloc(1, sizeof(jpeg_writer_internal_t));
+    memset(jpeg, 0, sizeof(jpeg_writer_t));
+    jpeg->width = width;
+    jpeg->height = height;
+    jpeg->internal = i;
+
+    i->w = w;
+    i->components = components;
+    i->buffer = (JOCTET*)malloc(OUTBUFFER_SIZE);
+    if(components == 4)
+        i->line = (unsigned char*)malloc(width*3);
+
+    i->cinfo.err = jpeg_std_error(&i->jerr);
+    jpeg_create_compress(&i->cinfo);
+
+    i->mgr.init_destination = writer_init_destination;
+    i->mgr.empty_output_buffer = writer_empty_output_buffer;
+    i->mgr.term_destination = writer_term_destination;
+    i->cinfo.dest = &i->mgr;
+
+    i->cinfo.image_width  = width;
+    i->cinfo.image_height = height;
+    i->cinfo.input_components = 3;
+    i->cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&i->cinfo);
+    i->cinfo.dct_method = JDCT_IFAST;
+    jpeg_set_quality(&i->cinfo,quality,TRUE);
+
+    jpeg_start_compress(&i->cinfo, FALSE);
+    return 1;
+}
+
+void jpeg_writer_addlines(jpeg_writer_t*jpeg, unsigned char*data, unsigned num_lines)
+{
+    jpeg_writer_internal_t*i = (jpeg_writer_internal_t*)jpeg->internal;
+    unsigned t;
+    for(t=0;t<num_lines && jpeg->y<jpeg->height;t++) {
+        unsigned char*line = &data[jpeg->width*i->components*t];
+        if(i->components == 4) {
+            int x;
+            for(x=0;x<jpeg->width;x++) {
+                i->line[x*3+0] = line[x*4+1];
+                i->line[x*3+1] = line[x*4+2];
+                i->line[x*3+2] = line[x*4+3];
+            }
+            line = i->line;
+        }
+        jpeg_write_scanlines(&i->cinfo, &line, 1);
+        jpeg->y++;
+    }
+}
+
+void jpeg_writer_finish(jpeg_writer_t*jpeg)
+{
+    jpeg_writer_internal_t*i = (jpeg_writer_internal_t*)jpeg->internal;
+    if(jpeg->y < jpeg->height) {
+        fprintf(stderr, "jpeg_writer_finish: only %d of %d lines written\n", jpeg->y, jpeg->height);
+        unsigned char*empty = (unsigned char*)calloc(jpeg->width, 3);
+        while(jpeg->y++ < jpeg->height)
+            jpeg_write_scanlines(&i->cinfo, &empty, 1);
+        free(empty);
+    }
+    jpeg_finish_compress(&i->cinfo);
+    jpeg_destroy_compress(&i->cinfo);
+    free(i->buffer);
+    if(i->line)
+        free(i->line);
+    free(i);
+    jpeg->internal = 0;
+}
+
+typedef struct _jpeg_mem_source {
+    struct jpeg_source_mgr mgr;
+    unsigned char*data;
+    int size;
+} jpeg_mem_source_t;
+
 void mem_init_source (j_decompress_ptr cinfo)
 {
-    struct jpeg_source_mgr* mgr = cinfo->src;
-    mgr->next_input_byte = data;
-    mgr->bytes_in_buffer = size;
-    //printf("init %d\n", size - mgr->bytes_in_buffer);
+    jpeg_mem_source_t* src = (jpeg_mem_source_t*)cinfo->src;
+    src->mgr.next_input_byte = src->data;
+    src->mgr.bytes_in_buffer = src->size;
+    //printf("init %d\n", src->size - src->mgr.bytes_in_buffer);
 }
 
 boolean mem_fill_input_buffer (j_decompress_ptr cinfo)
 {
-    struct jpeg_source_mgr* mgr = cinfo->src;
-    printf("fill %d\n", size - mgr->bytes_in_buffer);
+    jpeg_mem_source_t* src = (jpeg_mem_source_t*)cinfo->src;
+    printf("fill %d\n", (int)(src->size - src->mgr.bytes_in_buffer));
     return 0;
 }
 
 void mem_skip_input_data (j_decompress_ptr cinfo, long num_bytes)
 {
-    struct jpeg_source_mgr* mgr = cinfo->src;
-    printf("skip %d +%ld\n", size - mgr->bytes_in_buffer, num_bytes);
+    jpeg_mem_source_t* src = (jpeg_mem_source_t*)cinfo->src;
+    printf("skip %d +%ld\n", (int)(src->size - src->mgr.bytes_in_buffer), num_bytes);
     if(num_bytes<=0)
 	return;
-    mgr->next_input_byte += num_bytes;
-    mgr->bytes_in_buffer -= num_bytes;
+    src->mgr.next_input_byte += num_bytes;
+    src->mgr.bytes_in_buffer -= num_bytes;
 }
 
 boolean mem_resync_to_restart (j_decompress_ptr cinfo, int desired)
 {
-    struct jpeg_source_mgr* mgr = cinfo->src;
-    printf("resync %d\n", size - mgr->bytes_in_buffer);
-    mgr->next_input_byte = data;
-    mgr->bytes_in_buffer = size;
+    jpeg_mem_source_t* src = (jpeg_mem_source_t*)cinfo->src;
+    printf("resync %d\n", (int)(src->size - src->mgr.bytes_in_buffer));
+    src->mgr.next_input_byte = src->data;
+    src->mgr.bytes_in_buffer = src->size;
     return 1;
 }
 
 void mem_term_source (j_decompress_ptr cinfo)
 {
-    struct jpeg_source_mgr* mgr = cinfo->src;
-    //printf("term %d\n", size - mgr->bytes_in_buffer);
+    //jpeg_mem_source_t* src = (jpeg_mem_source_t*)cinfo->src;
+    //printf("term %d\n", src->size - src->mgr.bytes_in_buffer);
 }
 
 int jpeg_load_from_mem(unsigned char*_data, int _size, unsigned char**dest, unsigned*width, unsigned*height)
 {
     struct jpeg_decompress_struct cinfo;
     struct jpeg_error_mgr jerr;
-    struct jpeg_source_mgr mgr;
+    jpeg_mem_source_t mgr;
 
-    data = _data;
-    size = _size;
+    mgr.data = _data;
+    mgr.size = _size;
 
     jpeg_create_decompress(&cinfo); 
 
-    mgr.next_input_byte = data;
-    mgr.bytes_in_buffer = size;
-    mgr.init_source        =mem_init_source ;
-    mgr.fill_input_buffer  =mem_fill_input_buffer ;
-    mgr.skip_input_data    =mem_skip_input_data ;
-    mgr.resync_to_restart  =mem_resync_to_restart ;
-    mgr.term_source        =mem_term_source ;
+    mgr.mgr.next_input_byte = _data;
+    mgr.mgr.bytes_in_buffer = _size;
+    mgr.mgr.init_source        =mem_init_source ;
+    mgr.mgr.fill_input_buffer  =mem_fill_input_buffer ;
+    mgr.mgr.skip_input_data    =mem_skip_input_data ;
+    mgr.mgr.resync_to_restart  =mem_resync_to_restart ;
+    mgr.mgr.term_source        =mem_term_source ;
 
     cinfo.err = jpeg_std_error(&jerr);
-    cinfo.src = &mgr;
+    cinfo.src = &mgr.mgr;
 
     jpeg_read_header(&cinfo, TRUE);
     cinfo.out_color_space == JCS_RGB;
@@ -342,6 +461,13 @@ int jpeg_load_from_mem(unsigned char*_data, int _size, unsigned char**dest, unsi
 	unsigned char*to = &(*dest)[cinfo.output_width*y*4];
 	jpeg_read_scanlines(&cinfo,&scanline,1);
 	int x;
+	if(cinfo.output_components == 1) {
+	    for(x=0;x<cinfo.output_width;x++) {
+		to[x*4 + 0] = 255;
+		to[x*4 + 1] = to[x*4 + 2] = to[x*4 + 3] = scanline[x];
+	    }
+	    continue;
+	}
 	for(x=0;x<cinfo.output_width;x++) {
 	    to[x*4 + 0] = 255;
 	    to[x*4 + 1] = scanline[x*3 + 0];
@@ -500,4 +626,15 @@ void jpeg_get_size(const char *fname, unsigned *width, unsigned *height)
     fprintf(stderr, "jpeg_get_size: No JPEG support compiled in\n");
 }
 
+int jpeg_writer_start(jpeg_writer_t*jpeg, struct _writer*w, unsigned width, unsigned height, int quality, int components)
+{
+    fprintf(stderr, "jpeg_writer_start: No JPEG support compiled in\n");
+    return 0;
+}
+void jpeg_writer_addlines(jpeg_writer_t*jpeg, unsigned char*data, unsigned num_lines)
+{
+}
+void jpeg_writer_finish(jpeg_writer_t*jpeg)
+{
+}
 #endif
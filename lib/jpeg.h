@@ -15,6 +15,20 @@ int jpeg_load(const char*filename, unsigned char**dest, unsigned int*width, unsi
 int jpeg_load_from_mem(unsigned char*_data, int _size, unsigned char**dest, unsigned int*width, unsigned int*height);
 void jpeg_get_size(const char *fname, unsigned int *width, unsigned int *height);
 
+/* streaming interface: compress an image a couple of scanlines at a time.
+   components is 3 (r,g,b) or 4 (a,r,g,b- alpha is ignored) */
+struct _writer;
+typedef struct _jpeg_writer {
+    unsigned width;
+    unsigned height;
+    unsigned y;
+    void*internal;
+} jpeg_writer_t;
+
+int jpeg_writer_start(jpeg_writer_t*jpeg, struct _writer*w, unsigned width, unsigned height, int quality, int components);
+void jpeg_writer_addlines(jpeg_writer_t*jpeg, unsigned char*data, unsigned num_lines);
+void jpeg_writer_finish(jpeg_writer_t*jpeg);
+
 #ifdef __cplusplus
 }
 #endif
@@ -155,7 +155,6 @@ putbits_noheaders(lame_global_flags *gfp, int val, int j)
 inline static void
 drain_into_ancillary(lame_global_flags *gfp,int remainingBits)
 {
-    lame_internal_flags *gfc=gfp->internal_flags;
     int i;
     assert(remainingBits >= 0);
 
@@ -185,9 +184,11 @@ drain_into_ancillary(lame_global_flags *gfp,int remainingBits)
 	}
     }
 
+    /* pad with zeros, not with alternating bits. The alternating pattern
+       depends on all frames written so far, so mp3 streams encoded in
+       several segments (swf_SoundEncodeBlocks) wouldn't come out the same */
     for (; remainingBits >= 1; remainingBits -= 1 ) {
-        putbits2 ( gfp, gfc->ancillary_flag, 1 );
-        gfc->ancillary_flag ^= 1;
+        putbits2 ( gfp, 0, 1 );
     }
 
     assert (remainingBits == 0);
@@ -34,6 +34,11 @@
 #include <unistd.h>
 #endif
 
+#include "../config.h"
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
 #include "log.h"
 
 int maxloglevel = 1;
@@ -41,6 +46,17 @@ static int screenloglevel = 1;
 static int fileloglevel = -1;
 static FILE *logFile = 0;
 
+/* the log levels are set up once at startup, but messages can come from
+   any thread, so opening/closing the log file and writing to it is locked */
+#ifdef HAVE_PTHREADS
+static pthread_mutex_t log_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define LOG_LOCK() pthread_mutex_lock(&log_mutex)
+#define LOG_UNLOCK() pthread_mutex_unlock(&log_mutex)
+#else
+#define LOG_LOCK()
+#define LOG_UNLOCK()
+#endif
+
 int getScreenLogLevel()
 {
     return screenloglevel;
@@ -60,6 +76,7 @@ void setFileLogging(char*filename, int level, char append)
 {
     if(level>maxloglevel)
         maxloglevel=level;
+    LOG_LOCK();
     if(logFile) {
         fclose(logFile);logFile=0;
     }
@@ -70,6 +87,7 @@ void setFileLogging(char*filename, int level, char append)
         logFile = 0;
         fileloglevel = 0;
     }
+    LOG_UNLOCK();
 }
 /* deprecated */
 void initLog(char* filename, int filelevel, char* s00, char* s01, int s02, int screenlevel)
@@ -81,6 +99,7 @@ void initLog(char* filename, int filelevel, char* s00, char* s01, int s02, int s
 void exitLog()
 {
    // close file
+   LOG_LOCK();
    if(logFile != NULL) {
      fclose(logFile);
      logFile = 0;
@@ -88,6 +107,7 @@ void exitLog()
      screenloglevel = 1;
      maxloglevel = 1;
    }
+   LOG_UNLOCK();
 }
 
 static char * logimportance[]= {"Fatal","Error","Warning","Notice","Verbose","Debug","Trace"};
@@ -96,37 +116,13 @@ static char * logimportance2[]= {"       ","FATAL  ","ERROR  ","WARNING","NOTICE
 
 static inline void log_str(const char* logString)
 {
-   char timebuffer[32];
    char* logBuffer;
-   char dbuffer[9];
-   char tbuffer[9];
    int level;
    char*lt;
    char*gt;
    int l;
 
    logBuffer = (char*)malloc (strlen(logString) + 24 + 15);
-#ifndef __NT__
-   {
-     /*time_t t = time(0);
-     tm*t2 = localtime(t);
-     strftime(dbuffer, 8, "%m %d", t2);
-     strftime(tbuffer, 8, "%m %d", t2);
-     dbuffer[0]=0; //FIXME
-     tbuffer[0]=0;*/
-     time_t t = time(0);
-     char* a = ctime(&t);
-     int l = strlen(a);
-     while(a[l-1] == 13 || a[l-1] == 10)
-       l--;
-     a[l]=0;
-     sprintf(timebuffer, "%s", a);
-   }
-#else
-   _strdate( dbuffer );
-   _strtime( tbuffer );
-   sprintf(timebuffer, "%s - %s",dbuffer,tbuffer);
-#endif
 
    // search for <level> field
    level = -1;
@@ -151,7 +147,6 @@ static inline void log_str(const char* logString)
        }
    }
    
-//   sprintf(logBuffer, "%s: %s %s", timebuffer, logimportance2[level + 1],logString);
    sprintf(logBuffer, "%s %s", logimportance2[level + 1],logString);
 
    // we always do exactly one newline.
@@ -171,11 +166,13 @@ static inline void log_str(const char* logString)
 
    if (level <= fileloglevel)
    {
+       LOG_LOCK();
        if (logFile != NULL)
        {
 	  fprintf(logFile, "%s\r\n", logBuffer); 
 	  fflush(logFile);
        }
+       LOG_UNLOCK();
    }
 
    free (logBuffer);
@@ -1,6 +1,9 @@
 #include "../rfxswf.h"
 #include "../graphcut.c"
 #include "../log.h"
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
 static inline double sqr(double x) {return x*x;}
 
@@ -64,7 +67,8 @@ static void find_best(float*_row, int width, int*_x1, int*_x2, int min_size, int
     
     //filter[0]=1;filter_size=0;
 
-    for(t=0;t<=width;t++) {
+    /* only the values between from and to are ever looked at */
+    for(t=from;t<=to;t++) {
 	int s;
 	double sum = 0;
 	for(s=-filter_size;s<=filter_size;s++) {
@@ -186,10 +190,11 @@ static ALIGNZONE detect_for_char(SWFFONT * f, float*row, float*column, SRECT fon
     int x1=-1,y1=-1,x2=-1,y2=-1;
 
     int nr_x = 0;
-    find_best(row, width, &x1, &x2, f->use->smallest_size, 
-		char_bbox.xmin - font_bbox.xmin,
-		char_bbox.xmax - font_bbox.xmin, nr_x,
-		0);
+    if(nr_x>0)
+	find_best(row, width, &x1, &x2, f->use->smallest_size, 
+		  char_bbox.xmin - font_bbox.xmin,
+		  char_bbox.xmax - font_bbox.xmin, nr_x,
+		  0);
     if(nr_x>0 && x1>=0) a.x  = floatToF16((x1+font_bbox.xmin) / 20480.0);
     if(nr_x>1 && x2>=0) a.dx = floatToF16((x2-x1) / 20480.0);
 
@@ -206,36 +211,113 @@ static graph_t*make_graph(SWFFONT*f)
 {
     FONTUSAGE*use = f->use;
     graph_t*g = graph_new(f->numchars);
-    int s,t;
-    for(s=1;s<f->numchars;s++) {
-	for(t=0;t<s;t++) {
-	    if(f->glyph2ascii) {
-		int c1 = f->glyph2ascii[s];
-		int c2 = f->glyph2ascii[t];
-		if((c1<'a' && c2>='a' && c2<='z') ||
-		   (c2<'a' && c1>='a' && c1<='z')) {
-		    /* never connect lowercase with any uppercase
-		       or punctuation */
-		    continue;
-		}
-	    }
-
-	    int pos1 = swf_FontUseGetPair(f, s, t);
-	    int pos2 = swf_FontUseGetPair(f, t, s);
-	    if(pos1 || pos2) {
-		int weight1 = pos1?use->neighbors[pos1-1].num:0;
-		int weight2 = pos2?use->neighbors[pos2-1].num:0;
-		int weight = weight1+weight2;
-		
-		/*printf("font %d: pair %c and %c\n",
-			f->id, f->glyph2ascii[t], f->glyph2ascii[s]);*/
-		graph_add_edge(&g->nodes[s], &g->nodes[t], weight, weight);
+    int t;
+    /* Only glyphs which appeared next to each other are connected, so walk
+       the pairs we've seen instead of all numchars^2 combinations. */
+    for(t=0;t<use->num_neighbors;t++) {
+	int s = use->neighbors[t].char1;
+	int r = use->neighbors[t].char2;
+	if(s==r || s<0 || r<0 || s>=f->numchars || r>=f->numchars)
+	    continue;
+
+	/* (s,r) and (r,s) share one edge, added when we see the first of them */
+	int pos2 = swf_FontUseGetPair(f, r, s);
+	if(pos2 && pos2-1 < t)
+	    continue;
+
+	if(f->glyph2ascii) {
+	    int c1 = f->glyph2ascii[s];
+	    int c2 = f->glyph2ascii[r];
+	    if((c1<'a' && c2>='a' && c2<='z') ||
+	       (c2<'a' && c1>='a' && c1<='z')) {
+		/* never connect lowercase with any uppercase
+		   or punctuation */
+		continue;
 	    }
 	}
+
+	int weight = use->neighbors[t].num + (pos2?use->neighbors[pos2-1].num:0);
+	/*printf("font %d: pair %c and %c\n",
+		f->id, f->glyph2ascii[s], f->glyph2ascii[r]);*/
+	if(s>r)
+	    graph_add_edge(&g->nodes[s], &g->nodes[r], weight, weight);
+	else
+	    graph_add_edge(&g->nodes[r], &g->nodes[s], weight, weight);
     }
     return g;
 }
 
+typedef struct _alignzone_job {
+    SWFFONT*f;
+    SRECT bounds;
+    /* glyphs of component c are first[c], next[first[c]], ... */
+    int*first;
+    int*next;
+    int num_components;
+    int nr;
+    int num_jobs;
+} alignzone_job_t;
+
+/* process every num_jobs'th component, starting with component nr */
+static void* alignzone_job(void*data)
+{
+    alignzone_job_t*j = (alignzone_job_t*)data;
+    SWFFONT*f = j->f;
+    SRECT bounds = j->bounds;
+    int width = bounds.xmax - bounds.xmin;
+    int height = bounds.ymax - bounds.ymin;
+    float*row = rfx_calloc(sizeof(float)*(width+1));
+    float*global_column = rfx_calloc(sizeof(float)*(height+1));
+    float*column = rfx_calloc(sizeof(float)*(height+1));
+
+    const double SELF_WEIGHT = 0.00; // ignore own char
+
+    int c,t;
+    for(c=j->nr;c<j->num_components;c+=j->num_jobs) {
+	int drawn = 0;
+	memset(global_column, 0, sizeof(float)*(height+1));
+	SRECT local_bounds = {0,0,0,0};
+	for(t=j->first[c];t>=0;t=j->next[t]) {
+	    draw_char(f, t, row, global_column, bounds, 1.0-SELF_WEIGHT);
+	    SRECT b = f->layout->bounds[t];
+	    negate_y(&b);
+	    swf_ExpandRect2(&local_bounds, &b);
+	    drawn++;
+	}
+
+	for(t=0;t<=height;t++) {
+	    global_column[t] /= drawn;
+	}
+
+	memcpy(column, global_column, sizeof(float)*(height+1));
+	memset(row, 0, sizeof(float)*(width+1));
+	ALIGNZONE a = detect_for_char(f, row, column, bounds, local_bounds);
+
+	for(t=j->first[c];t>=0;t=j->next[t]) {
+	    f->alignzones[t] = a;
+	}
+    }
+    free(row);
+    free(column);
+    free(global_column);
+    return 0;
+}
+
+static int alignzone_num_threads(int num_components)
+{
+#if defined(HAVE_PTHREADS) && defined(_SC_NPROCESSORS_ONLN)
+    /* latin fonts have only a handful of components */
+    if(num_components < 64)
+	return 1;
+    int num = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(num<1) num=1;
+    if(num>8) num=8;
+    return num;
+#else
+    return 1;
+#endif
+}
+
 void swf_FontCreateAlignZones(SWFFONT * f)
 {
     if(f->alignzones)
@@ -273,69 +355,82 @@ void swf_FontCreateAlignZones(SWFFONT * f)
 	    swf_ExpandRect2(&bounds, &b);
 	}
 
-	int width = bounds.xmax - bounds.xmin;
-	int height = bounds.ymax - bounds.ymin;
-	float*row = rfx_calloc(sizeof(float)*(width+1));
-	float*global_column = rfx_calloc(sizeof(float)*(height+1));
-	float*column = rfx_calloc(sizeof(float)*(height+1));
-
-	const double SELF_WEIGHT = 0.00; // ignore own char
-
-	int c;
-	for(c=0;c<num_components;c++) {
-	    int drawn = 0;
-	    memset(global_column, 0, sizeof(float)*(height+1));
-	    SRECT local_bounds = {0,0,0,0};
-	    for(t=0;t<f->numchars;t++) {
-		if(g->nodes[t].tmp == c) {
-		    draw_char(f, t, row, global_column, bounds, 1.0-SELF_WEIGHT);
-		    SRECT b = f->layout->bounds[t];
-		    negate_y(&b);
-		    swf_ExpandRect2(&local_bounds, &b);
-		    drawn++;
-		}
-	    }
-
-	    for(t=0;t<=height;t++) {
-		global_column[t] /= drawn;
-	    }
-
-	    memcpy(column, global_column, sizeof(float)*(height+1));
-	    memset(row, 0, sizeof(float)*(width+1));
-	    ALIGNZONE a = detect_for_char(f, row, column, bounds, local_bounds);
-
-	    for(t=0;t<f->numchars;t++) {
-		if(g->nodes[t].tmp == c) {
-		    f->alignzones[t] = a;
-		}
-	    }
+	/* sort the glyphs into per-component lists (in glyph order) */
+	int*first = (int*)rfx_alloc(sizeof(int)*num_components);
+	int*last = (int*)rfx_alloc(sizeof(int)*num_components);
+	int*next = (int*)rfx_alloc(sizeof(int)*f->numchars);
+	for(t=0;t<num_components;t++) {
+	    first[t] = last[t] = -1;
+	}
+	for(t=0;t<f->numchars;t++) {
+	    int c = g->nodes[t].tmp;
+	    next[t] = -1;
+	    if(last[c]>=0)
+		next[last[c]] = t;
+	    else
+		first[c] = t;
+	    last[c] = t;
 	}
-	free(row);
-	free(column);
-	free(global_column);
-
 	graph_delete(g);
+
+	/* the components are independent of each other, so they
+	   can be processed in parallel */
+	int num_jobs = alignzone_num_threads(num_components);
+	alignzone_job_t*jobs = (alignzone_job_t*)rfx_calloc(sizeof(alignzone_job_t)*num_jobs);
+	for(t=0;t<num_jobs;t++) {
+	    jobs[t].f = f;
+	    jobs[t].bounds = bounds;
+	    jobs[t].first = first;
+	    jobs[t].next = next;
+	    jobs[t].num_components = num_components;
+	    jobs[t].nr = t;
+	    jobs[t].num_jobs = num_jobs;
+	}
+#ifdef HAVE_PTHREADS
+	pthread_t*threads = (pthread_t*)rfx_calloc(sizeof(pthread_t)*num_jobs);
+	char*started = (char*)rfx_calloc(num_jobs);
+	for(t=1;t<num_jobs;t++) {
+	    started[t] = !pthread_create(&threads[t], 0, alignzone_job, &jobs[t]);
+	    if(!started[t])
+		alignzone_job(&jobs[t]);
+	}
+	alignzone_job(&jobs[0]);
+	for(t=1;t<num_jobs;t++) {
+	    if(started[t])
+		pthread_join(threads[t], 0);
+	}
+	rfx_free(threads);
+	rfx_free(started);
+#else
+	for(t=0;t<num_jobs;t++)
+	    alignzone_job(&jobs[t]);
+#endif
+	rfx_free(jobs);
+	rfx_free(first);
+	rfx_free(last);
+	rfx_free(next);
     }
 }
 
 void swf_FontPostprocess(SWF*swf)
 {
+    SWFFONT**fonts = 0;
+    int num_fonts = swf_FontExtractAll(swf, &fonts);
     TAG*tag = swf->firstTag;
     while(tag) {
 	TAG*next = tag->next;
 	if(tag->id == ST_DEFINEFONT3) {
 	    U16 id = swf_GetDefineID(tag);
-	    SWFFONT*font = 0;
-	    swf_FontExtract(swf, id, &font);
+	    SWFFONT*font = swf_FontFindID(fonts, num_fonts, id);
 	    if(!font->alignzones) {
 		swf_FontCreateAlignZones(font);
 		tag = swf_InsertTag(tag, ST_DEFINEFONTALIGNZONES);
 		swf_FontSetAlignZones(tag, font);
 	    }
-	    swf_FontFree(font);
 	}
 	tag = next;
     }
+    swf_FontFreeAll(fonts, num_fonts);
 }
 
 void swf_FontSetAlignZones(TAG*t, SWFFONT *f)
@@ -44,6 +44,7 @@ extern "C" {
 #endif // HAVE_JPEGLIB
 
 #include "../rfxswf.h"
+#include "../stats.h"
 
 #define OUTBUFFER_SIZE 0x8000
 
@@ -897,7 +898,8 @@ void swf_SetLosslessImage(TAG*tag, RGBA*data, int width, int height)
     if(num>1 && num<=256) {
 	RGBA*palette = (RGBA*)malloc(sizeof(RGBA)*num);
 	int width2 = BYTES_PER_SCANLINE(width);
-	U8*data2 = (U8*)malloc(width2*height);
+	/* zeroed, so that the padding at the end of the lines is deterministic */
+	U8*data2 = (U8*)calloc(width2, height);
 	int len = width*height;
 	int x,y;
 	int r;
@@ -1155,49 +1157,150 @@ int swf_SetJPEGBits3(TAG * tag, U16 width, U16 height, RGBA * bitmap, int qualit
 #endif
 
 
-/* expects mem to be non-premultiplied */
-TAG* swf_AddImage(TAG*tag, int bitid, RGBA*mem, int width, int height, int quality)
-{
-    TAG *tag1 = 0, *tag2 = 0;
-    int has_alpha = swf_ImageHasAlpha(mem,width,height);
+#define ESTIMATE_STRIPS 8
+#define ESTIMATE_STRIP_HEIGHT 8
+#define ESTIMATE_MARGIN 0.75
 
-    /* try lossless image */
+#define ENCODING_UNKNOWN 0
+#define ENCODING_LOSSLESS 1
+#define ENCODING_JPEG 2
 
+static TAG* encode_lossless(int bitid, RGBA*mem, int width, int height)
+{
+    TAG*tag = swf_InsertTag(0, /*ST_DEFINEBITSLOSSLESS1/2*/0);
 #ifdef NO_LOSSLESS
-    tag1 = swf_InsertTag(0, /*ST_DEFINEBITSLOSSLESS1/2*/0);
-    tag1->len = 0x7fffffff;
+    tag->len = 0x7fffffff;
 #else
-    tag1 = swf_InsertTag(0, /*ST_DEFINEBITSLOSSLESS1/2*/0);
-    swf_SetU16(tag1, bitid);
-    swf_SetLosslessImage(tag1, mem, width, height);
+    swf_SetU16(tag, bitid);
+    swf_SetLosslessImage(tag, mem, width, height);
 #endif
+    return tag;
+}
 
+static TAG* encode_jpeg(int bitid, RGBA*mem, int width, int height, int has_alpha, int quality)
+{
+    TAG*tag = 0;
 #if defined(HAVE_JPEGLIB)
-    /* try jpeg image. Notice that if (and only if) we tried the lossless compression
-       above, the data will now be premultiplied with alpha. */
     if(has_alpha) {
-	tag2 = swf_InsertTag(0, ST_DEFINEBITSJPEG3);
-	swf_SetU16(tag2, bitid);
-	swf_SetJPEGBits3(tag2, width, height, mem, quality);
+	tag = swf_InsertTag(0, ST_DEFINEBITSJPEG3);
+	swf_SetU16(tag, bitid);
+	swf_SetJPEGBits3(tag, width, height, mem, quality);
     } else {
-	tag2 = swf_InsertTag(0, ST_DEFINEBITSJPEG2);
-	swf_SetU16(tag2, bitid);
-	swf_SetJPEGBits2(tag2, width, height, mem, quality);
+	tag = swf_InsertTag(0, ST_DEFINEBITSJPEG2);
+	swf_SetU16(tag, bitid);
+	swf_SetJPEGBits2(tag, width, height, mem, quality);
     }
 #endif
+    return tag;
+}
+
+/* Guess which of the two encodings will produce the smaller tag, by
+   encoding a few full-width strips of the image both ways. Returns 
+   ENCODING_UNKNOWN if the image is too small for sampling to pay off,
+   or if the two results are too close to call. */
+static int estimate_encoding(RGBA*mem, int width, int height, int has_alpha, int quality)
+{
+    int sheight = ESTIMATE_STRIPS*ESTIMATE_STRIP_HEIGHT;
+    if(height < sheight*4)
+	return ENCODING_UNKNOWN;
 
-    if(quality>100 || !tag2 || (tag1 && tag1->len < tag2->len)) {
+    RGBA*sample = (RGBA*)rfx_alloc(width*sheight*sizeof(RGBA));
+    int t;
+    for(t=0;t<ESTIMATE_STRIPS;t++) {
+	int y = (height-ESTIMATE_STRIP_HEIGHT)*t/(ESTIMATE_STRIPS-1);
+	memcpy(&sample[t*ESTIMATE_STRIP_HEIGHT*width], &mem[y*width], 
+		width*ESTIMATE_STRIP_HEIGHT*sizeof(RGBA));
+    }
+
+    /* the strips might have less colors than the image, which would make
+       palette based compression look better than it is */
+    int num_colors = swf_ImageGetNumberOfPaletteEntries(mem, width, height, 0);
+    TAG*tag1 = 0;
+    if(num_colors<=256) {
+	tag1 = encode_lossless(0, sample, width, sheight);
+    } else {
+	tag1 = swf_InsertTag(0, 0);
+	swf_SetU16(tag1, 0);
+	if(has_alpha)
+	    swf_PreMultiplyAlpha(sample, width, sheight);
+	swf_SetLosslessBits(tag1, width, sheight, sample, BMF_32BIT);
+    }
+    /* (as in swf_AddImage, the jpeg sees the premultiplied data) */
+    TAG*tag2 = encode_jpeg(0, sample, width, sheight, has_alpha, quality);
+    rfx_free(sample);
+
+    int result = ENCODING_UNKNOWN;
+    if(!tag2) {
+	result = ENCODING_LOSSLESS;
+    } else if(tag1->len < tag2->len*ESTIMATE_MARGIN) {
+	result = ENCODING_LOSSLESS;
+    } else if(tag2->len < tag1->len*ESTIMATE_MARGIN) {
+	result = ENCODING_JPEG;
+    }
+    swf_DeleteTag(0, tag1);
+    if(tag2) 
+	swf_DeleteTag(0, tag2);
+    return result;
+}
+
+STAT(stat_estimate, "image", "estimate");
+STAT(stat_lossless, "image", "lossless");
+STAT(stat_jpeg, "image", "jpeg");
+
+/* expects mem to be non-premultiplied */
+TAG* swf_AddImage(TAG*tag, int bitid, RGBA*mem, int width, int height, int quality)
+{
+    TAG *tag1 = 0, *tag2 = 0;
+    int has_alpha = swf_ImageHasAlpha(mem,width,height);
+    int encoding = ENCODING_UNKNOWN;
+    double start = stats_enabled?stats_time():0;
+
+    if(quality>100) {
+	encoding = ENCODING_LOSSLESS;
+    } else {
+	encoding = estimate_encoding(mem, width, height, has_alpha, quality);
+	if(stats_enabled) {
+	    double now = stats_time();
+	    stats_add(&stat_estimate, 1, 0, now-start);
+	    start = now;
+	}
+    }
+
+    /* try lossless image */
+    if(encoding != ENCODING_JPEG) {
+	tag1 = encode_lossless(bitid, mem, width, height);
+	if(stats_enabled) {
+	    double now = stats_time();
+	    stats_add(&stat_lossless, 1, tag1->len, now-start);
+	    start = now;
+	}
+    } else if(has_alpha) {
+	/* the lossless encoder would have premultiplied the data */
+	swf_PreMultiplyAlpha(mem, width, height);
+    }
+
+    /* try jpeg image. Notice that if (and only if) we tried the lossless compression
+       above, the data will now be premultiplied with alpha. */
+    if(encoding != ENCODING_LOSSLESS) {
+	tag2 = encode_jpeg(bitid, mem, width, height, has_alpha, quality);
+	if(stats_enabled && tag2)
+	    stats_add(&stat_jpeg, 1, tag2->len, stats_time()-start);
+    }
+
+    if(!tag2 || (tag1 && tag1->len < tag2->len)) {
 	/* use the zlib version- it's smaller */
 	tag1->prev = tag;
 	if(tag) tag->next = tag1;
 	tag = tag1;
-	swf_DeleteTag(0, tag2);
+	if(tag2)
+	    swf_DeleteTag(0, tag2);
     } else {
 	/* use the jpeg version- it's smaller */
 	tag2->prev = tag;
 	if(tag) tag->next = tag2;
 	tag = tag2;
-	swf_DeleteTag(0, tag1);
+	if(tag1)
+	    swf_DeleteTag(0, tag1);
     }
     return tag;
 }
@@ -24,16 +24,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../rfxswf.h"
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
-static int loadfont_scale = 4;
-static int skip_unused = 1;
-static int full_unicode = 0;
+/* used by the functions which don't take an explicit SWFLOADFONTPARAMS */
+static SWFLOADFONTPARAMS default_params = {4, 1, 0};
 
 void swf_SetLoadFontParameters(int _scale, int _skip_unused, int _full_unicode)
 {
-    if(_scale) loadfont_scale = _scale;
-    skip_unused = _skip_unused;
-    full_unicode = _full_unicode;
+    if(_scale) default_params.scale = _scale;
+    default_params.skip_unused = _skip_unused;
+    default_params.full_unicode = _full_unicode;
 }
 
 #ifdef HAVE_FREETYPE
@@ -114,10 +116,9 @@ static FT_Outline_Funcs outline_functions =
   0,0
 };
 
-static FT_Library ftlibrary = 0;
-
-SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
+SWFFONT* swf_LoadTrueTypeFont2(const char*filename, char flashtype, const SWFLOADFONTPARAMS*params)
 {
+    FT_Library ftlibrary;
     FT_Face face;
     FT_Error error;
     const char* name = 0;
@@ -129,24 +130,26 @@ SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
     int max_unicode = 0;
     int charmap = -1;
 
-    if(ftlibrary == 0) {
-	if(FT_Init_FreeType(&ftlibrary)) {
-	    fprintf(stderr, "Couldn't init freetype library!\n");
-	    exit(1);
-	}
+    /* a library instance per call- FT_Library objects must not be shared between threads */
+    if(FT_Init_FreeType(&ftlibrary)) {
+	fprintf(stderr, "Couldn't init freetype library!\n");
+	exit(1);
     }
     error = FT_New_Face(ftlibrary, filename, 0, &face);
 
     if(error || !face) {
 	fprintf(stderr, "Couldn't load file %s- not a TTF file?\n", filename);
+	FT_Done_FreeType(ftlibrary);
 	return 0;
     }
    
     int scale = flashtype?20:1;
-    FT_Set_Pixel_Sizes (face, 16*loadfont_scale*scale, 16*loadfont_scale*scale);
+    FT_Set_Pixel_Sizes (face, 16*params->scale*scale, 16*params->scale*scale);
 
     if(face->num_glyphs <= 0) {
 	fprintf(stderr, "File %s contains %d glyphs\n", filename, (int)face->num_glyphs);
+	FT_Done_Face(face);
+	FT_Done_FreeType(ftlibrary);
 	return 0;
     }
 
@@ -217,7 +220,7 @@ SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
 	    break;
     }
 
-    if(full_unicode)
+    if(params->full_unicode)
 	font->maxascii = 65535;
     
     font->ascii2glyph = (int*)rfx_calloc(font->maxascii*sizeof(int));
@@ -256,7 +259,7 @@ SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
 		hasname = 1;
 	    }
 	}
-	if(!font->glyph2ascii[t] && !hasname && skip_unused) {
+	if(!font->glyph2ascii[t] && !hasname && params->skip_unused) {
 	    continue;
 	}
 	error = FT_Load_Glyph(face, t, FT_LOAD_NO_BITMAP);
@@ -264,14 +267,14 @@ SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
 	    //tends to happen with some pdfs
 	    fprintf(stderr, "Warning: Glyph %d has return code %d\n", t, error);
 	    glyph=0;
-	    if(skip_unused) 
+	    if(params->skip_unused) 
 		continue;
 	} else {
 	    error = FT_Get_Glyph(face->glyph, &glyph);
 	    if(error) {
 		fprintf(stderr, "Couldn't get glyph %d, error:%d\n", t, error);
 		glyph=0;
-		if(skip_unused) 
+		if(params->skip_unused) 
 		    continue;
 	    }
 	}
@@ -374,13 +377,13 @@ SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
     rfx_free(glyph2glyph);
 
     FT_Done_Face(face);
-    FT_Done_FreeType(ftlibrary);ftlibrary=0;
+    FT_Done_FreeType(ftlibrary);
 
     return font;
 }
 #else  //HAVE_FREETYPE
 
-SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
+SWFFONT* swf_LoadTrueTypeFont2(const char*filename, char flashtype, const SWFLOADFONTPARAMS*params)
 {
     fprintf(stderr, "Warning: no freetype library- not able to load %s\n", filename);
     return 0;
@@ -388,15 +391,18 @@ SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
 
 #endif
 
+SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype)
+{
+    return swf_LoadTrueTypeFont2(filename, flashtype, &default_params);
+}
+
 #ifdef HAVE_T1LIB
 
 #include <t1lib.h>
 
 static int t1lib_initialized = 0;
 
-static int counter = 0;
-
-SWFFONT* swf_LoadT1Font(const char*filename)
+static SWFFONT* t1_load(const char*filename)
 {
     SWFFONT * font;
     int nr;
@@ -544,6 +550,24 @@ SWFFONT* swf_LoadT1Font(const char*filename)
     return font;
 }
 
+/* t1lib keeps all its fonts in one global table */
+#ifdef HAVE_PTHREADS
+static pthread_mutex_t t1lib_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+SWFFONT* swf_LoadT1Font(const char*filename)
+{
+    SWFFONT*font;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&t1lib_mutex);
+#endif
+    font = t1_load(filename);
+#ifdef HAVE_PTHREADS
+    pthread_mutex_unlock(&t1lib_mutex);
+#endif
+    return font;
+}
+
 #else
 
 SWFFONT* swf_LoadT1Font(const char*filename)
@@ -578,7 +602,7 @@ static int isSWF(const char*filename)
     return 0;
 }
 
-SWFFONT* swf_LoadFont(const char*filename, char flashtype)
+SWFFONT* swf_LoadFont2(const char*filename, char flashtype, const SWFLOADFONTPARAMS*params)
 {
     int is_swf;
     if(filename == 0)
@@ -594,7 +618,7 @@ SWFFONT* swf_LoadFont(const char*filename, char flashtype)
     }
 
 #if defined(HAVE_FREETYPE)
-    return swf_LoadTrueTypeFont(filename, flashtype);
+    return swf_LoadTrueTypeFont2(filename, flashtype, params);
 #elif defined(HAVE_T1LIB)
     return swf_LoadT1Font(filename);
 #else
@@ -603,3 +627,7 @@ SWFFONT* swf_LoadFont(const char*filename, char flashtype)
 #endif
 }
 
+SWFFONT* swf_LoadFont(const char*filename, char flashtype)
+{
+    return swf_LoadFont2(filename, flashtype, &default_params);
+}
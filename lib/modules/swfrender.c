@@ -1262,6 +1262,8 @@ void swf_RenderSWF(RENDERBUF*buf, SWF*swf)
     swf_FoldAll(swf);
     
     character_t* idtable = (character_t*)rfx_calloc(sizeof(character_t)*65536);            // id to character mapping
+    SWFFONT**swffonts = 0;
+    int num_swffonts = swf_FontExtractAll(swf, &swffonts);
     
     /* set background color */
     color = swf_GetSWFBackgroundColor(swf);
@@ -1291,11 +1293,10 @@ void swf_RenderSWF(RENDERBUF*buf, SWF*swf)
                       tag->id == ST_DEFINEFONT2 ||
                       tag->id == ST_DEFINEFONT3) {
 		int t;
-		SWFFONT*swffont;
+		SWFFONT*swffont = swf_FontFindID(swffonts, num_swffonts, id);
 		font_t*font = (font_t*)rfx_calloc(sizeof(font_t));
 		idtable[id].obj.font = font;
 		font->version = tag->id == ST_DEFINEFONT3 ? 3 : 2;
-                swf_FontExtract(swf,id,&swffont);
 		font->numchars = swffont->numchars;
 		font->glyphs = (SHAPE2**)rfx_calloc(sizeof(SHAPE2*)*font->numchars);
 		for(t=0;t<font->numchars;t++) {
@@ -1305,7 +1306,6 @@ void swf_RenderSWF(RENDERBUF*buf, SWF*swf)
 		    }
 		    font->glyphs[t] = swf_ShapeToShape2(swffont->glyph[t].shape);
 		}
-		swf_FontFree(swffont);
                 idtable[id].type = font_type;
 
             } else if(tag->id == ST_DEFINEFONTINFO ||
@@ -1322,6 +1322,7 @@ void swf_RenderSWF(RENDERBUF*buf, SWF*swf)
         }
 	tag = tag->next;
     }
+    swf_FontFreeAll(swffonts, num_swffonts);
     MATRIX m;
     swf_GetMatrix(0, &m);
     renderFromTag(buf, idtable, swf->firstTag, &m);
@@ -96,32 +96,50 @@ int swf_mp3_bitrate = 32;
 
 #include <stdarg.h>
 #include <lame.h>
-
-static lame_global_flags*lame_flags;
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
 void null_errorf(const char *format, va_list ap)
 {
 }
 
-static void initlame()
+static int samplerate_code(int samplerate)
+{
+    if(samplerate == 5512) return 0; // lame doesn't support this
+    else if(samplerate == 11025) return 1;
+    else if(samplerate == 22050) return 2;
+    else if(samplerate == 44100) return 3;
+    fprintf(stderr, "Invalid samplerate: %d\n", samplerate);
+    return 1;
+}
+
+SOUNDENCODER* swf_SoundEncoderNew(int in_samplerate, int out_samplerate, int bitrate)
 {
     unsigned char buf[4096];
     int bufsize = 1152*2;
+    SOUNDENCODER*enc = (SOUNDENCODER*)rfx_calloc(sizeof(SOUNDENCODER));
+    lame_global_flags*lame_flags;
+
+    enc->in_samplerate = in_samplerate;
+    enc->out_samplerate = out_samplerate;
+    enc->bitrate = bitrate;
+    enc->blocksize = (int)(((out_samplerate > 22050) ? 1152 : 576) * ((double)in_samplerate/out_samplerate));
 
-    lame_flags = lame_init();
+    enc->internal = lame_flags = lame_init();
 
-    lame_set_in_samplerate(lame_flags, swf_mp3_in_samplerate);
+    lame_set_in_samplerate(lame_flags, in_samplerate);
     lame_set_num_channels(lame_flags, swf_mp3_channels);
     lame_set_scale(lame_flags, 0);
 
     // MPEG1    32, 44.1,   48khz
     // MPEG2    16, 22.05,  24
     // MPEG2.5   8, 11.025, 12
-    lame_set_out_samplerate(lame_flags, swf_mp3_out_samplerate);
+    lame_set_out_samplerate(lame_flags, out_samplerate);
 
     lame_set_quality(lame_flags, 0);
     lame_set_mode(lame_flags, MONO/*3*/);
-    lame_set_brate(lame_flags, swf_mp3_bitrate);
+    lame_set_brate(lame_flags, bitrate);
     //lame_set_compression_ratio(lame_flags, 11.025);
     lame_set_bWriteVbrTag(lame_flags, 0);
 
@@ -136,12 +154,32 @@ static void initlame()
     lame_encode_flush(lame_flags, buf, bufsize);
     //printf("init:flush():%d\n", len);
     lame_set_errorf(lame_flags, 0);
+
+    enc->framesize = lame_get_framesize(lame_flags);
+    return enc;
 }
 
-void swf_SetSoundStreamHead(TAG*tag, int avgnumsamples)
+void swf_SoundEncoderFree(SOUNDENCODER*enc)
+{
+    lame_close((lame_global_flags*)enc->internal);
+    enc->internal = 0;
+    rfx_free(enc);
+}
+
+/* encode one block of enc->blocksize samples. Since we flush after
+   every block, the bit reservoir is empty between blocks, so the
+   frames of one block never reference data of another */
+static int encodeblock(SOUNDENCODER*enc, S16*samples, U8*buf, int bufsize)
 {
-    int len;
+    lame_global_flags*lame_flags = (lame_global_flags*)enc->internal;
+    int len = 0;
+    len += lame_encode_buffer(lame_flags, samples, samples, enc->blocksize, &buf[len], bufsize-len);
+    len += lame_encode_flush_nogap(lame_flags, &buf[len], bufsize-len);
+    return len;
+}
 
+void swf_SetSoundStreamHead2(TAG*tag, SOUNDENCODER*enc, int avgnumsamples)
+{
     U8 playbackrate = 1; // 0 = 5.5 Khz, 1 = 11 Khz, 2 = 22 Khz, 3 = 44 Khz
     U8 playbacksize = 1; // 0 = 8 bit, 1 = 16 bit
     U8 playbacktype = 0; // 0 = mono, 1 = stereo
@@ -150,80 +188,196 @@ void swf_SetSoundStreamHead(TAG*tag, int avgnumsamples)
     U8 size = 1; // 0 = 8 bit, 1 = 16 bit
     U8 type = 0; // 0 = mono, 1 = stereo
 
-    if(swf_mp3_out_samplerate == 5512) playbackrate = rate = 0; // lame doesn't support this
-    else if(swf_mp3_out_samplerate == 11025) playbackrate = rate = 1;
-    else if(swf_mp3_out_samplerate == 22050) playbackrate = rate = 2;
-    else if(swf_mp3_out_samplerate == 44100) playbackrate = rate = 3;
-    else fprintf(stderr, "Invalid samplerate: %d\n", swf_mp3_out_samplerate);
-    
-    initlame();
+    playbackrate = rate = samplerate_code(enc->out_samplerate);
 
     swf_SetU8(tag,(playbackrate<<2)|(playbacksize<<1)|playbacktype);
     swf_SetU8(tag,(compression<<4)|(rate<<2)|(size<<1)|type);
     swf_SetU16(tag,avgnumsamples);
 }
 
-void swf_SetSoundStreamBlock(TAG*tag, S16*samples, int seek, char first)
+void swf_SetSoundStreamBlock2(TAG*tag, SOUNDENCODER*enc, S16*samples, int seek, char first)
 {
-    char*buf;
+    U8*buf;
     int len = 0;
     int bufsize = 16384;
-    int numsamples = (int)(((swf_mp3_out_samplerate > 22050) ? 1152 : 576) * ((double)swf_mp3_in_samplerate/swf_mp3_out_samplerate));
-    int fs = 0;
 
     buf = rfx_alloc(bufsize);
     if(!buf)
 	return;
 
     if(first) {
-	fs = lame_get_framesize(lame_flags);
-	swf_SetU16(tag, fs * first); // samples per mp3 frame
+	swf_SetU16(tag, enc->framesize * first); // samples per mp3 frame
 	swf_SetU16(tag, seek); // seek
     }
 
-    len += lame_encode_buffer(lame_flags, samples, samples, numsamples, &buf[len], bufsize-len);
-    len += lame_encode_flush_nogap(lame_flags, &buf[len], bufsize-len);
+    len = encodeblock(enc, samples, buf, bufsize);
     swf_SetBlock(tag, buf, len);
     if(len == 0) {
 	fprintf(stderr, "error: mp3 empty block, %d samples, first:%d, framesize:%d\n",
-		numsamples, first, fs);
-    }/* else {
-	fprintf(stderr, "ok: mp3 nonempty block, %d samples, first:%d, framesize:%d\n",
-		numsamples, first, fs);
-    }*/
+		enc->blocksize, first, enc->framesize);
+    }
     rfx_free(buf);
 }
 
+/* Number of blocks each segment encoder is fed (and which are discarded)
+   before its first block, so that its psychoacoustic model and
+   sample buffer are in about the same state as a single encoder's. */
+#define SEGMENT_OVERLAP 8
+#define MIN_SEGMENT_SIZE 128
+
+/* lame pads every n-th frame with an extra byte, depending on how many
+   frames it has encoded so far. Returns the period of that pattern. */
+static int padding_period(SOUNDENCODER*enc)
+{
+    int a = (int)(((long)enc->framesize*125*enc->bitrate) % enc->out_samplerate);
+    int b = enc->out_samplerate;
+    if(!a)
+	return 1;
+    while(b) {
+	int t = a%b;
+	a = b;
+	b = t;
+    }
+    return enc->out_samplerate / a;
+}
+
+typedef struct _soundsegment
+{
+    SOUNDENCODER*enc;
+    S16*samples;
+    int start;
+    int end;
+    U8**data;
+    int*len;
+} soundsegment_t;
+
+static void* encodesegment(void*_seg)
+{
+    soundsegment_t*seg = (soundsegment_t*)_seg;
+    int blocksize = seg->enc->blocksize;
+    int bufsize = 16384;
+    U8*buf = rfx_alloc(bufsize);
+    int t;
+    for(t=seg->start;t<seg->end;t++) {
+	int len = encodeblock(seg->enc, &seg->samples[t*blocksize], buf, bufsize);
+	seg->data[t] = rfx_alloc(len?len:1);
+	memcpy(seg->data[t], buf, len);
+	seg->len[t] = len;
+    }
+    rfx_free(buf);
+    return 0;
+}
+
+void swf_SoundEncodeBlocks(SOUNDENCODER*enc, S16*samples, int numblocks, U8**data, int*len, int num_threads)
+{
+    int numsegments = num_threads;
+    if(numsegments > numblocks / MIN_SEGMENT_SIZE)
+	numsegments = numblocks / MIN_SEGMENT_SIZE;
+    if(numsegments < 1)
+	numsegments = 1;
+
+    soundsegment_t*segs = (soundsegment_t*)rfx_calloc(sizeof(soundsegment_t)*numsegments);
+    int t;
+    for(t=0;t<numsegments;t++) {
+	soundsegment_t*seg = &segs[t];
+	seg->samples = samples;
+	seg->start = (int)((double)numblocks*t/numsegments);
+	seg->end = (int)((double)numblocks*(t+1)/numsegments);
+	seg->data = data;
+	seg->len = len;
+	if(!t) {
+	    seg->enc = enc;
+	} else {
+	    /* prime a new encoder with the blocks preceding this segment,
+	       enough of them to also get the frame padding in sync.
+	       This is done here, not in the threads, since the first frames
+	       also initialize lame's global tables. */
+	    int prime = SEGMENT_OVERLAP + (seg->start - SEGMENT_OVERLAP) % padding_period(enc);
+	    int s = seg->start - (prime <= seg->start ? prime : SEGMENT_OVERLAP);
+	    int bufsize = 16384;
+	    U8*buf = rfx_alloc(bufsize);
+	    seg->enc = swf_SoundEncoderNew(enc->in_samplerate, enc->out_samplerate, enc->bitrate);
+	    for(;s<seg->start;s++)
+		encodeblock(seg->enc, &samples[s*enc->blocksize], buf, bufsize);
+	    rfx_free(buf);
+	}
+    }
+
+#ifdef HAVE_PTHREADS
+    pthread_t*threads = (pthread_t*)rfx_calloc(sizeof(pthread_t)*numsegments);
+    char*started = (char*)rfx_calloc(numsegments);
+    for(t=1;t<numsegments;t++) {
+	started[t] = !pthread_create(&threads[t], 0, encodesegment, &segs[t]);
+	if(!started[t])
+	    encodesegment(&segs[t]);
+    }
+    encodesegment(&segs[0]);
+    for(t=1;t<numsegments;t++) {
+	if(started[t])
+	    pthread_join(threads[t], 0);
+    }
+    rfx_free(threads);
+    rfx_free(started);
+#else
+    for(t=0;t<numsegments;t++)
+	encodesegment(&segs[t]);
+#endif
+
+    for(t=1;t<numsegments;t++)
+	swf_SoundEncoderFree(segs[t].enc);
+    rfx_free(segs);
+}
+
+/* the old interface, using a global encoder configured through the
+   swf_mp3_* variables */
+
+static SOUNDENCODER*default_encoder = 0;
+
+void swf_SetSoundStreamHead(TAG*tag, int avgnumsamples)
+{
+    if(default_encoder)
+	swf_SoundEncoderFree(default_encoder);
+    default_encoder = swf_SoundEncoderNew(swf_mp3_in_samplerate, swf_mp3_out_samplerate, swf_mp3_bitrate);
+    swf_SetSoundStreamHead2(tag, default_encoder, avgnumsamples);
+}
+
+void swf_SetSoundStreamBlock(TAG*tag, S16*samples, int seek, char first)
+{
+    swf_SetSoundStreamBlock2(tag, default_encoder, samples, seek, first);
+}
+
 void swf_SetSoundStreamEnd(TAG*tag)
 {
-    lame_close (lame_flags);
+    if(default_encoder) {
+	swf_SoundEncoderFree(default_encoder);
+	default_encoder = 0;
+    }
 }
 
 void swf_SetSoundDefine(TAG*tag, S16*samples, int num)
 {
-    char*buf;
-    int oldlen=0,len = 0;
+    U8*buf;
+    int len = 0;
     int bufsize = 16384;
-    int blocksize = (int)(((swf_mp3_out_samplerate > 22050) ? 1152 : 576) * ((double)swf_mp3_in_samplerate/swf_mp3_out_samplerate));
+    int blocksize;
     int t;
     int blocks;
+    SOUNDENCODER*enc;
 
     U8 compression = 2; // 0 = raw, 1 = ADPCM, 2 = mp3, 3 = raw le, 6 = nellymoser
     U8 rate = 1; // 0 = 5.5 Khz, 1 = 11 Khz, 2 = 22 Khz, 3 = 44 Khz
     U8 size = 1; // 0 = 8 bit, 1 = 16 bit
     U8 type = 0; // 0 = mono, 1 = stereo
     
-    if(swf_mp3_out_samplerate == 5512) rate = 0;
-    else if(swf_mp3_out_samplerate == 11025) rate = 1;
-    else if(swf_mp3_out_samplerate == 22050) rate = 2;
-    else if(swf_mp3_out_samplerate == 44100) rate = 3;
-    else fprintf(stderr, "Invalid samplerate: %d\n", swf_mp3_out_samplerate);
+    rate = samplerate_code(swf_mp3_out_samplerate);
 
+    enc = swf_SoundEncoderNew(swf_mp3_in_samplerate, swf_mp3_out_samplerate, swf_mp3_bitrate);
+    blocksize = enc->blocksize;
     blocks = num / (blocksize);
 
     swf_SetU8(tag,(compression<<4)|(rate<<2)|(size<<1)|type);
 
-    swf_SetU32(tag, (int)(tag,blocks*blocksize / 
+    swf_SetU32(tag, (int)(blocks*blocksize / 
 	    ((double)swf_mp3_in_samplerate/swf_mp3_out_samplerate)) // account for resampling
 	    );
 
@@ -231,20 +385,14 @@ void swf_SetSoundDefine(TAG*tag, S16*samples, int num)
     if(!buf)
 	return;
 
-    initlame();
-
     swf_SetU16(tag, 0); //delayseek
     for(t=0;t<blocks;t++) {
-	int s;
-	U16*pos;
-	pos= &samples[t*blocksize];
-	len += lame_encode_buffer(lame_flags, pos, pos, blocksize, &buf[len], bufsize-len);
-	len += lame_encode_flush_nogap(lame_flags, &buf[len], bufsize-len);
+	len = encodeblock(enc, &samples[t*blocksize], buf, bufsize);
 	swf_SetBlock(tag, buf, len);
-	len = 0;
     }
 
     rfx_free(buf);
+    swf_SoundEncoderFree(enc);
 }
 
 #endif
@@ -271,6 +419,25 @@ void swf_SetSoundDefine(TAG*tag, S16*samples, int num)
 {
     swf_SetSoundDefineRaw(tag, samples,num);
 }
+SOUNDENCODER* swf_SoundEncoderNew(int in_samplerate, int out_samplerate, int bitrate)
+{
+    fprintf(stderr, "Error: no mp3 soundstream support compiled in.\n");exit(1);
+}
+void swf_SoundEncoderFree(SOUNDENCODER*enc)
+{
+}
+void swf_SetSoundStreamHead2(TAG*tag, SOUNDENCODER*enc, int avgnumsamples)
+{
+    fprintf(stderr, "Error: no mp3 soundstream support compiled in.\n");exit(1);
+}
+void swf_SetSoundStreamBlock2(TAG*tag, SOUNDENCODER*enc, S16*samples, int seek, char first)
+{
+    fprintf(stderr, "Error: no mp3 soundstream support compiled in.\n");exit(1);
+}
+void swf_SoundEncodeBlocks(SOUNDENCODER*enc, S16*samples, int numblocks, U8**data, int*len, int num_threads)
+{
+    fprintf(stderr, "Error: no mp3 soundstream support compiled in.\n");exit(1);
+}
 
 #endif
 
@@ -326,8 +493,39 @@ void swf_SetSoundDefineMP3(TAG*tag, U8* data, unsigned length,
 
     swf_SetU8(tag,(compression<<4)|(rate<<2)|(size<<1)|type);
 
-    swf_SetU32(tag, NumFrames * 576);
+    /* mpeg 1 layer 3 frames have 1152 samples, mpeg 2/2.5 frames 576 */
+    swf_SetU32(tag, NumFrames * (SampRate >= 32000 ? 1152 : 576));
 
     swf_SetU16(tag, 0); //delayseek
     swf_SetBlock(tag, data, length);
 }
+
+/* streaming of already encoded mp3 data, without re-encoding */
+
+void swf_SetSoundStreamHeadMP3(TAG*tag, unsigned SampRate, unsigned Channels, int avgnumsamples)
+{
+    U8 compression = 2; // 0 = raw, 1 = ADPCM, 2 = mp3, 3 = raw le, 6 = nellymoser
+    U8 rate;     // 0 = 5.5 Khz, 1 = 11 Khz, 2 = 22 Khz, 3 = 44 Khz
+    U8 size = 1; // 0 = 8 bit, 1 = 16 bit
+    U8 type = Channels==2; // 0=mono, 1=stereo
+
+    rate = (SampRate >= 40000) ? 3
+         : (SampRate >= 19000) ? 2
+         : (SampRate >= 8000) ? 1
+         : 0;
+    if(SampRate != 44100 && SampRate != 22050 && SampRate != 11025)
+	fprintf(stderr, "Warning: mp3 samplerate %d can't be streamed correctly\n", SampRate);
+
+    swf_SetU8(tag,(rate<<2)|(size<<1)|type);
+    swf_SetU8(tag,(compression<<4)|(rate<<2)|(size<<1)|type);
+    swf_SetU16(tag,avgnumsamples);
+}
+
+/* data must contain complete mp3 frames. seek is the number of samples
+   (at the start of the first frame) which belong to the previous movie frame */
+void swf_SetSoundStreamBlockMP3(TAG*tag, U8*data, unsigned length, unsigned numsamples, int seek)
+{
+    swf_SetU16(tag, numsamples);
+    swf_SetU16(tag, seek);
+    swf_SetBlock(tag, data, length);
+}
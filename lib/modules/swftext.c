@@ -255,10 +255,10 @@ int swf_FontExtract_DefineFont2(int id, SWFFONT * font, TAG * tag)
     U32 *offset;
     U8 flags1, langcode, namelen;
     swf_SetTagPos(tag, 0);
-    font->version = tag->id==ST_DEFINEFONT3?3:2;
     fid = swf_GetU16(tag);
     if (id && id != fid)
 	return id;
+    font->version = tag->id==ST_DEFINEFONT3?3:2;
     font->id = fid;
     flags1 = swf_GetU8(tag);
     langcode = swf_GetU8(tag);	//reserved flags
@@ -432,8 +432,10 @@ int swf_FontExtract_DefineFontAlignZones(int id, SWFFONT * font, TAG * tag)
 #define FEDTJ_MODIFY 0x02
 #define FEDTJ_CALLBACK 0x04
 
+/* If id2font is set, jobs apply to whichever font a text record uses,
+   instead of only to font f with the given id. */
 static int
-swf_FontExtract_DefineTextCallback(int id, SWFFONT * f, TAG * t, int jobs,
+swf_FontExtract_DefineTextCallback(int id, SWFFONT * f, SWFFONT ** id2font, TAG * t, int jobs,
 				   void (*callback) (void *self,
 						     int *chars, int *xpos, int nr, int fontid, int fontsize, int xstart, int ystart, RGBA * color), void *self)
 {
@@ -463,8 +465,14 @@ swf_FontExtract_DefineTextCallback(int id, SWFFONT * f, TAG * t, int jobs,
 	    break;
 
 	if (flags & TF_TEXTCONTROL) {
-	    if (flags & TF_HASFONT)
+	    if (flags & TF_HASFONT) {
 		fid = swf_GetU16(t);
+		if (id2font) {
+		    f = id2font[fid];
+		    /* fonts with a layout have their advance values already */
+		    id = (f && !f->layout) ? fid : -2;
+		}
+	    }
 	    if (flags & TF_HASCOLOR) {
 		color.r = swf_GetU8(t);	// rgb
 		color.g = swf_GetU8(t);
@@ -524,12 +532,12 @@ swf_FontExtract_DefineTextCallback(int id, SWFFONT * f, TAG * t, int jobs,
 int swf_ParseDefineText(TAG * tag,
 		    void (*callback) (void *self, int *chars, int *xpos, int nr, int fontid, int fontsize, int xstart, int ystart, RGBA * color), void *self)
 {
-    return swf_FontExtract_DefineTextCallback(-1, 0, tag, FEDTJ_CALLBACK, callback, self);
+    return swf_FontExtract_DefineTextCallback(-1, 0, 0, tag, FEDTJ_CALLBACK, callback, self);
 }
 
 int swf_FontExtract_DefineText(int id, SWFFONT * f, TAG * t, int jobs)
 {
-    return swf_FontExtract_DefineTextCallback(id, f, t, jobs, 0, 0);
+    return swf_FontExtract_DefineTextCallback(id, f, 0, t, jobs, 0, 0);
 }
 
 typedef struct _usagetmp {
@@ -636,6 +644,164 @@ int swf_FontExtract(SWF * swf, int id, SWFFONT * *font)
     return 0;
 }
 
+typedef struct _fontslot {
+    SWFFONT*font;
+    /* glyph usage tracking state, for the text tag in usage_tag */
+    usagetmp_t usage;
+    TAG*usage_tag;
+} fontslot_t;
+
+typedef struct _extractall {
+    SWFFONT**id2font;
+    int*id2slot;
+    fontslot_t*slots;
+    int num;
+    int size;
+    /* slots[num_initialized..num-1] haven't seen any text yet */
+    int num_initialized;
+    TAG*tag;
+} extractall_t;
+
+static void extractall_updateusage(void *self, int *chars, int *xpos, int nr,
+	                int fontid, int fontsize, int xstart, int ystart, RGBA * color)
+{
+    extractall_t*e = (extractall_t*)self;
+    int t;
+    /* as in swf_FontExtract, usage tracking of a font starts with
+       the first text following its definition */
+    for(t=e->num_initialized;t<e->num;t++) {
+	SWFFONT*f = e->slots[t].font;
+	if(f->version>=3 && f->layout && !f->use)
+	    swf_FontInitUsage(f);
+    }
+    e->num_initialized = e->num;
+
+    if(fontid<0 || !e->id2font[fontid])
+	return;
+    fontslot_t*slot = &e->slots[e->id2slot[fontid]];
+    if(slot->font->version<3 || !slot->font->layout)
+	return;
+    if(slot->usage_tag != e->tag) {
+	slot->usage.font = slot->font;
+	slot->usage.lastx = -0x80000000;
+	slot->usage.lasty = -0x80000000;
+	slot->usage.last = 0;
+	slot->usage_tag = e->tag;
+    }
+    updateusage(&slot->usage, chars, xpos, nr, fontid, fontsize, xstart, ystart, color);
+}
+
+static int compare_font_ids(const void*a, const void*b)
+{
+    return (*(SWFFONT**)a)->id - (*(SWFFONT**)b)->id;
+}
+
+int swf_FontExtractAll(SWF * swf, SWFFONT *** fonts)
+{
+    extractall_t e;
+    TAG *t;
+    int i;
+
+    if ((!swf) || (!fonts))
+	return -1;
+
+    memset(&e, 0, sizeof(e));
+    e.id2font = (SWFFONT**)rfx_calloc(sizeof(SWFFONT*)*65536);
+    e.id2slot = (int*)rfx_calloc(sizeof(int)*65536);
+
+    for (t = swf->firstTag; t; t = swf_NextTag(t)) {
+	int id = 0;
+	SWFFONT*f = 0;
+	switch (swf_GetTagID(t)) {
+	case ST_DEFINEFONT:
+	case ST_DEFINEFONT2:
+	case ST_DEFINEFONT3:
+	    id = swf_GetDefineID(t);
+	    if (e.id2font[id]) {
+		/* the first definition of an id wins */
+		break;
+	    }
+	    f = (SWFFONT *) rfx_calloc(sizeof(SWFFONT));
+	    if (swf_GetTagID(t) == ST_DEFINEFONT)
+		swf_FontExtract_DefineFont(id, f, t);
+	    else
+		swf_FontExtract_DefineFont2(id, f, t);
+	    if (e.num == e.size) {
+		e.size = e.size ? e.size*2 : 16;
+		e.slots = (fontslot_t*)rfx_realloc(e.slots, sizeof(fontslot_t)*e.size);
+	    }
+	    memset(&e.slots[e.num], 0, sizeof(fontslot_t));
+	    e.slots[e.num].font = f;
+	    e.id2slot[id] = e.num++;
+	    e.id2font[id] = f;
+	    break;
+
+	case ST_DEFINEFONTALIGNZONES:
+	    id = swf_GetDefineID(t);
+	    if ((f = e.id2font[id]))
+		swf_FontExtract_DefineFontAlignZones(id, f, t);
+	    break;
+
+	case ST_DEFINEFONTINFO:
+	case ST_DEFINEFONTINFO2:
+	    id = swf_GetDefineID(t);
+	    if ((f = e.id2font[id]))
+		swf_FontExtract_DefineFontInfo(id, f, t);
+	    break;
+
+	case ST_DEFINETEXT:
+	case ST_DEFINETEXT2:
+	    /* one pass over the text records updates the advance values and
+	       the glyph usage of all fonts the text uses */
+	    e.tag = t;
+	    swf_FontExtract_DefineTextCallback(-2, 0, e.id2font, t, FEDTJ_MODIFY|FEDTJ_CALLBACK, extractall_updateusage, &e);
+	    break;
+
+	case ST_GLYPHNAMES:
+	    id = swf_GetDefineID(t);
+	    if ((f = e.id2font[id]))
+		swf_FontExtract_GlyphNames(id, f, t);
+	    break;
+	}
+    }
+
+    SWFFONT**list = (SWFFONT**)rfx_alloc(sizeof(SWFFONT*)*(e.num?e.num:1));
+    for (i = 0; i < e.num; i++)
+	list[i] = e.slots[i].font;
+    qsort(list, e.num, sizeof(SWFFONT*), compare_font_ids);
+
+    rfx_free(e.slots);
+    rfx_free(e.id2slot);
+    rfx_free(e.id2font);
+    *fonts = list;
+    return e.num;
+}
+
+SWFFONT* swf_FontFindID(SWFFONT ** fonts, int num, int id)
+{
+    int lo = 0, hi = num-1;
+    while (lo <= hi) {
+	int mid = (lo+hi)/2;
+	if (fonts[mid]->id == id)
+	    return fonts[mid];
+	if (fonts[mid]->id < id)
+	    lo = mid+1;
+	else
+	    hi = mid-1;
+    }
+    return 0;
+}
+
+void swf_FontFreeAll(SWFFONT ** fonts, int num)
+{
+    int i;
+    if (!fonts)
+	return;
+    for (i = 0; i < num; i++)
+	swf_FontFree(fonts[i]);
+    rfx_free(fonts);
+}
+
 int swf_FontSetID(SWFFONT * f, U16 id)
 {
     if (!f)
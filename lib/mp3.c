@@ -54,6 +54,7 @@ int mp3_read(struct MP3*mp3, const char* filename)
     
     unsigned totalsize      = 0;
     unsigned first_samprate = 0;
+    unsigned first_mpegver = 0;
     unsigned nframes = 0;
     int first_chanmode = -1;
 
@@ -126,7 +127,10 @@ int mp3_read(struct MP3*mp3, const char* filename)
             /* Invalid frame */
             /*break;*/
         }
-        if(!first_samprate) first_samprate = samprate;
+        if(!first_samprate) {
+            first_samprate = samprate;
+            first_mpegver = mpegver;
+        }
         else if(first_samprate != samprate)
         {
             /* Sampling rate changed?!? */
@@ -198,17 +202,22 @@ int mp3_read(struct MP3*mp3, const char* filename)
     mp3->SampRate = first_samprate;
     mp3->Channels = first_chanmode == 3 ? 1 : 2;
     mp3->NumFrames = nframes;
+    mp3->SamplesPerFrame = first_mpegver == 3 ? 1152 : 576;
     mp3->size = totalsize;
     mp3->data = (unsigned char*)malloc(mp3->size);
-    if(mp3->data)
+    mp3->FrameOffsets = (unsigned int*)malloc(sizeof(unsigned int)*(nframes+1));
+    if(mp3->data && mp3->FrameOffsets)
     {
         unsigned pos=0;
+        unsigned n=0;
         struct MP3Frame* it;
         for(it=root; it; it=it->next)
         {
+            mp3->FrameOffsets[n++] = pos;
             memcpy(mp3->data + pos, it->data, it->framesize);
             pos += it->framesize;
         }
+        mp3->FrameOffsets[n] = pos;
     }
     else
     {
@@ -224,13 +233,15 @@ int mp3_read(struct MP3*mp3, const char* filename)
     }
     
     fclose(fi);
-    return mp3->data != NULL;
+    return mp3->data != NULL && mp3->FrameOffsets != NULL;
 }
 
 void mp3_clear(struct MP3*mp3)
 {
     free(mp3->data);
     mp3->data = 0;
+    free(mp3->FrameOffsets);
+    mp3->FrameOffsets = 0;
 }
 
 
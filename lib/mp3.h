@@ -13,6 +13,8 @@ struct MP3 {
     unsigned int    NumFrames;
     unsigned char*  data;
     unsigned long   size;
+    unsigned int    SamplesPerFrame;
+    unsigned int*   FrameOffsets; /* NumFrames+1 entries, frame n is data[FrameOffsets[n]..FrameOffsets[n+1]] */
 };
 
 int mp3_read(struct MP3*mp3, const char* filename);
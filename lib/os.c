@@ -280,23 +280,18 @@ void memfile_close(memfile_t*file)
     free(file);
 }
 
-void move_file(const char*from, const char*to)
+int copy_file(const char*from, const char*to)
 {
-    int result = rename(from, to);
-
-    if(result==0) return; //done!
-
-    /* if we can't rename, for some reason, copy the file
-       manually */
     FILE*fi = fopen(from, "rb");
     if(!fi) {
 	perror(from);
-	return;
+	return 0;
     }
     FILE*fo = fopen(to, "wb");
     if(!fo) {
 	perror(to);
-	return;
+	fclose(fi);
+	return 0;
     }
     char buffer[16384];
     while(1) {
@@ -308,7 +303,19 @@ void move_file(const char*from, const char*to)
 
     fclose(fo);
     fclose(fi);
-    unlink(from);
+    return 1;
+}
+
+void move_file(const char*from, const char*to)
+{
+    int result = rename(from, to);
+
+    if(result==0) return; //done!
+
+    /* if we can't rename, for some reason, copy the file
+       manually */
+    if(copy_file(from, to))
+	unlink(from);
 }
 
 char file_exists(const char*filename)
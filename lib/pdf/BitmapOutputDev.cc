@@ -28,12 +28,14 @@
   #include "splash/SplashBitmap.h"
   #include "splash/SplashPattern.h"
   #include "splash/Splash.h"
+  #include "splash/SplashClip.h"
 #else
   #include "xpdf/config.h"
   #include "SplashBitmap.h"
   #include "SplashGlyphBitmap.h"
   #include "SplashPattern.h"
   #include "Splash.h"
+  #include "SplashClip.h"
 #endif
 
 #include "../log.h"
@@ -102,6 +104,10 @@ BitmapOutputDev::BitmapOutputDev(InfoOutputDev*info, PDFDoc*doc, int*page2page,
     this->config_optimizeplaincolorfills = 0;
     this->config_skewedtobitmap = 0;
     this->config_alphatobitmap = 0;
+    this->config_singlepass = 1;
+    this->clip1_softmask = 0;
+    this->stalepolytiles = 0;
+    this->staletexttiles = 0;
     this->bboxpath = 0;
     //this->clipdev = 0;
     //this->clipstates = 0;
@@ -136,6 +142,12 @@ BitmapOutputDev::~BitmapOutputDev()
     if(this->staletextbitmap) {
 	delete this->staletextbitmap;this->staletextbitmap = 0;
     }
+    if(this->stalepolytiles) {
+	delete this->stalepolytiles;this->stalepolytiles = 0;
+    }
+    if(this->staletexttiles) {
+	delete this->staletexttiles;this->staletexttiles = 0;
+    }
     if(this->booltextdev) {
 	delete this->booltextdev;this->booltextdev = 0;
     }
@@ -176,6 +188,8 @@ void BitmapOutputDev::setParameter(const char*key, const char*value)
        this->config_alphatobitmap = atoi(value);
     } else if(!strcmp(key, "transparent")) {
        this->config_transparent = atoi(value);
+    } else if(!strcmp(key, "singlepass")) {
+       this->config_singlepass = atoi(value);
     }
 
     this->gfxdev->setParameter(key, value);
@@ -259,7 +273,7 @@ void BitmapOutputDev::flushBitmap()
 
 	int rangex = xmax-xmin;
 	int rangey = ymax-ymin;
-	gfximage_t*img = (gfximage_t*)malloc(sizeof(gfximage_t)); 
+	gfximage_t*img = (gfximage_t*)calloc(1, sizeof(gfximage_t)); 
 	img->data = (gfxcolor_t*)malloc(rangex * rangey * 4);
 	img->width = rangex;
 	img->height = rangey;
@@ -565,6 +579,56 @@ static void clearBooleanBitmap(SplashBitmap*btm, int x1, int y1, int x2, int y2)
     }
 }
 
+#define TILE_SHIFT 6
+#define TILE_SIZE (1<<TILE_SHIFT)
+
+TileMap::TileMap(int bitmap_width, int bitmap_height)
+{
+    this->width = (bitmap_width+TILE_SIZE-1)>>TILE_SHIFT;
+    this->height = (bitmap_height+TILE_SIZE-1)>>TILE_SHIFT;
+    this->tiles = (unsigned char*)calloc(1, this->width*this->height+1);
+}
+TileMap::~TileMap()
+{
+    free(this->tiles);this->tiles = 0;
+}
+void TileMap::clear()
+{
+    memset(this->tiles, 0, this->width*this->height);
+}
+/* mark all tiles in which the given area of the bitmap has pixels set */
+void TileMap::update(SplashBitmap*bitmap, int x1, int y1, int x2, int y2)
+{
+    assert(bitmap->getMode()==splashModeMono1);
+    if(!fixBBox(&x1, &y1, &x2, &y2, bitmap->getWidth(), bitmap->getHeight()))
+	return;
+    int width8 = bitmap->getRowSize();
+    Guchar*data = bitmap->getDataPtr();
+    int tx,ty;
+    for(ty=y1>>TILE_SHIFT;ty<=(y2-1)>>TILE_SHIFT;ty++) {
+	int ty1 = ty*TILE_SIZE > y1 ? ty*TILE_SIZE : y1;
+	int ty2 = (ty+1)*TILE_SIZE < y2 ? (ty+1)*TILE_SIZE : y2;
+	for(tx=x1>>TILE_SHIFT;tx<=(x2-1)>>TILE_SHIFT;tx++) {
+	    unsigned char*tile = &this->tiles[ty*this->width+tx];
+	    if(*tile)
+		continue;
+	    /* tiles are 64 pixels (8 bytes) wide, so they start at byte boundaries */
+	    int b1 = tx*TILE_SIZE > x1 ? tx*(TILE_SIZE/8) : x1/8;
+	    int b2 = (tx+1)*TILE_SIZE < x2 ? (tx+1)*(TILE_SIZE/8) : (x2+7)/8;
+	    int y,b;
+	    for(y=ty1;y<ty2 && !*tile;y++) {
+		Guchar*row = &data[y*width8];
+		for(b=b1;b<b2;b++) {
+		    if(row[b]) {
+			*tile = 1;
+			break;
+		    }
+		}
+	    }
+	}
+    }
+}
+
 void BitmapOutputDev::dbg_newdata(char*newdata)
 {
     if(0) {
@@ -650,7 +714,7 @@ GBool BitmapOutputDev::checkNewText(int x1, int y1, int x2, int y2)
     msg("<trace> Testing new text data against current bitmap data, state=%s, counter=%d\n", STATE_NAME[layerstate], dbg_btm_counter);
     
     GBool ret = false;
-    if(intersection(booltextbitmap, stalepolybitmap, x1,y1,x2,y2)) {
+    if(intersection(booltextbitmap, stalepolybitmap, stalepolytiles, x1,y1,x2,y2)) {
 	if(layerstate==STATE_PARALLEL) {
 	    /* the new text is above the bitmap. So record that fact. */
 	    msg("<verbose> Text is above current bitmap/polygon data");
@@ -682,12 +746,13 @@ GBool BitmapOutputDev::checkNewText(int x1, int y1, int x2, int y2)
         msg("<verbose> no intersection");
 	update_bitmap(staletextbitmap, booltextbitmap, x1, y1, x2, y2, 0);
     }
+    staletexttiles->update(booltextbitmap, x1, y1, x2, y2);
     
     /* clear the thing we just drew from our temporary drawing bitmap */
     clearBooleanBitmap(booltextbitmap, x1, y1, x2, y2);
 
 #ifdef DEBUG
-    if(intersection(booltextbitmap, booltextbitmap, UNKNOWN_BOUNDING_BOX)) {
+    if(intersection(booltextbitmap, booltextbitmap, 0, UNKNOWN_BOUNDING_BOX)) {
         msg("<fatal> Text bitmap is not empty after clear. Bad bounding box?");
         exit(1);
     }
@@ -700,8 +765,22 @@ GBool BitmapOutputDev::checkNewBitmap(int x1, int y1, int x2, int y2)
     /* similar to checkNewText() above, only in reverse */
     msg("<trace> Testing new graphics data against current text data, state=%s, counter=%d\n", STATE_NAME[layerstate], dbg_btm_counter);
 
+    /* whatever boolpolydev just drew is inside its clipping rectangle. This also
+       gives us a bounding box for patterns, shadings, forms and transparency groups */
+    SplashClip*clip = boolpolydev->getSplash()->getClip();
+    if(!(x1|y1|x2|y2)) {
+	x1 = y1 = INT_MIN;
+	x2 = y2 = INT_MAX;
+    }
+    if(x1 < clip->getXMinI()) x1 = clip->getXMinI();
+    if(y1 < clip->getYMinI()) y1 = clip->getYMinI();
+    if(x2 > clip->getXMaxI()+1) x2 = clip->getXMaxI()+1;
+    if(y2 > clip->getYMaxI()+1) y2 = clip->getYMaxI()+1;
+    if(x2 <= x1 || y2 <= y1)
+	return gFalse;
+
     GBool ret = false;
-    if(intersection(boolpolybitmap, staletextbitmap, x1,y1,x2,y2)) {
+    if(intersection(boolpolybitmap, staletextbitmap, staletexttiles, x1,y1,x2,y2)) {
 	if(layerstate==STATE_PARALLEL) {
 	    msg("<verbose> Bitmap is above current text data");
 	    layerstate=STATE_BITMAP_IS_ABOVE;
@@ -721,12 +800,13 @@ GBool BitmapOutputDev::checkNewBitmap(int x1, int y1, int x2, int y2)
         msg("<verbose> no intersection");
 	update_bitmap(stalepolybitmap, boolpolybitmap, x1, y1, x2, y2, 0);
     }
+    stalepolytiles->update(boolpolybitmap, x1, y1, x2, y2);
     
     /* clear the thing we just drew from our temporary drawing bitmap */
     clearBooleanBitmap(boolpolybitmap, x1, y1, x2, y2);
 
 #ifdef DEBUG
-    if(intersection(boolpolybitmap, boolpolybitmap, UNKNOWN_BOUNDING_BOX)) {
+    if(intersection(boolpolybitmap, boolpolybitmap, 0, UNKNOWN_BOUNDING_BOX)) {
 	writeAlpha(boolpolybitmap, "notempty.png");
         msg("<fatal> Polygon bitmap is not empty after clear. Bad bounding box?");
         int _x1, _y1, _x2, _y2;
@@ -901,7 +981,10 @@ GBool compare8(unsigned char*data1, unsigned char*data2, int len)
     return 0;
 }
 
-GBool BitmapOutputDev::intersection(SplashBitmap*boolpoly, SplashBitmap*booltext, int x1, int y1, int x2, int y2)
+/* tests whether boolpoly and booltext have pixels in common in the given area.
+   If tiles is given, it's the tile map of booltext, and only tiles in which
+   booltext has pixels are compared. */
+GBool BitmapOutputDev::intersection(SplashBitmap*boolpoly, SplashBitmap*booltext, TileMap*tiles, int x1, int y1, int x2, int y2)
 {
     if(boolpoly->getMode()==splashModeMono1) {
 	/* alternative implementation, using one bit per pixel-
@@ -918,6 +1001,26 @@ GBool BitmapOutputDev::intersection(SplashBitmap*boolpoly, SplashBitmap*booltext
 	Guchar*textpixels = booltext->getDataPtr();
 
         int width8 = (width+7)/8;
+
+	if(tiles) {
+	    int tx,ty,y;
+	    for(ty=y1>>TILE_SHIFT;ty<=(y2-1)>>TILE_SHIFT;ty++) {
+		int ty1 = ty*TILE_SIZE > y1 ? ty*TILE_SIZE : y1;
+		int ty2 = (ty+1)*TILE_SIZE < y2 ? (ty+1)*TILE_SIZE : y2;
+		for(tx=x1>>TILE_SHIFT;tx<=(x2-1)>>TILE_SHIFT;tx++) {
+		    if(!tiles->tiles[ty*tiles->width+tx])
+			continue;
+		    int b1 = tx*TILE_SIZE > x1 ? tx*(TILE_SIZE/8) : x1/8;
+		    int b2 = (tx+1)*TILE_SIZE < x2 ? (tx+1)*(TILE_SIZE/8) : (x2+7)/8;
+		    for(y=ty1;y<ty2;y++) {
+			if(compare8(&polypixels[y*width8+b1], &textpixels[y*width8+b1], b2-b1))
+			    return gTrue;
+		    }
+		}
+	    }
+	    return gFalse;
+	}
+
         int runx = width8;
         int runy = height;
 	
@@ -1024,6 +1127,13 @@ void BitmapOutputDev::beginPage(GfxState *state, int pageNum)
     staletextbitmap = new SplashBitmap(booltextbitmap->getWidth(), booltextbitmap->getHeight(), 1, booltextbitmap->getMode(), 0);
     assert(staletextbitmap->getRowSize() == booltextbitmap->getRowSize());
 
+    if(stalepolytiles)
+	delete stalepolytiles;
+    stalepolytiles = new TileMap(stalepolybitmap->getWidth(), stalepolybitmap->getHeight());
+    if(staletexttiles)
+	delete staletexttiles;
+    staletexttiles = new TileMap(staletextbitmap->getWidth(), staletextbitmap->getHeight());
+
     msg("<debug> startPage %dx%d (%dx%d)", this->width, this->height, booltextbitmap->getWidth(), booltextbitmap->getHeight());
 
     clip0bitmap = clip0dev->getBitmap();
@@ -1048,6 +1158,7 @@ void BitmapOutputDev::beginPage(GfxState *state, int pageNum)
 
     this->layerstate = STATE_PARALLEL;
     this->emptypage = 1;
+    this->clip1_softmask = 0;
     msg("<debug> startPage done");
 }
 
@@ -1619,13 +1730,25 @@ void BitmapOutputDev::clearClips(int x1, int y1, int x2, int y2)
     clearBooleanBitmap(clip0bitmap, x1,y1,x2,y2);
     clearBooleanBitmap(clip1bitmap, x1,y1,x2,y2);
 }
+/* In single pass mode, we try to find out whether a char is affected by clipping
+   without rendering it twice: if its bounding box is inside the clipping
+   rectangle, and there's no clip path, soft mask or transparency group on
+   clip1dev, then clip0dev and clip1dev would draw exactly the same pixels. */
+GBool BitmapOutputDev::charIsInsideClip(int x1, int y1, int x2, int y2)
+{
+    if(!config_singlepass || clip1_softmask || clip1dev->getBitmap() != clip1bitmap)
+	return gFalse;
+    return clip1dev->getSplash()->getClip()->testRect(x1, y1, x2-1, y2-1) == splashClipAllInside;
+}
 void BitmapOutputDev::clearBoolPolyDev()
 {
     clearBooleanBitmap(stalepolybitmap, 0, 0, stalepolybitmap->getWidth(), stalepolybitmap->getHeight());
+    stalepolytiles->clear();
 }
 void BitmapOutputDev::clearBoolTextDev()
 {
     clearBooleanBitmap(staletextbitmap, 0, 0, staletextbitmap->getWidth(), staletextbitmap->getHeight());
+    staletexttiles->clear();
 }
 
 #define USE_GETGLYPH_BBOX
@@ -1731,20 +1854,17 @@ void BitmapOutputDev::drawChar(GfxState *state, double x, double y,
         int x1, y1, x2, y2;
 
         /* Calculate the bbox of this character (relative to splash's coordinate
-          system, which is offset from our coordinate system by (-movex,-movey))
+          system, which is offset from our coordinate system by (-movex,-movey)).
+          We ask booltextdev, since that's the device which usually draws the
+          char, too, so font changes only need to be processed once.
         */
-        getGlyphBbox(state, boolpolydev, x, y, originX, originY, code, &x1, &y1, &x2, &y2);
+        getGlyphBbox(state, booltextdev, x, y, originX, originY, code, &x1, &y1, &x2, &y2);
 
 	if(x1 < text_x1) text_x1 = x1;
 	if(y1 < text_y1) text_y1 = y1;
 	if(x2 > text_x2) text_x2 = x2;
 	if(y2 > text_y2) text_y2 = y2;
 
-	/* only clear the area we're going to check */
-	clearClips(x1,y1,x2,y2);
-	clip0dev->drawChar(state, x, y, dx, dy, originX, originY, code, nBytes, u, uLen);
-	clip1dev->drawChar(state, x, y, dx, dy, originX, originY, code, nBytes, u, uLen);
-
         int page_area_x1 = -this->movex;
         int page_area_y1 = -this->movey;
         int page_area_x2 = this->width-this->movex;
@@ -1757,7 +1877,16 @@ void BitmapOutputDev::drawChar(GfxState *state, double x, double y,
 	/* if this character is affected somehow by the various clippings (i.e., it looks
 	   different on a device without clipping), then draw it on the bitmap, not as
 	   text */
-	if(char_is_outside || render_as_bitmap || clip0and1differ(x1,y1,x2,y2)) {
+	char char_is_clipped = 0;
+	if(!char_is_outside && !render_as_bitmap && !charIsInsideClip(x1,y1,x2,y2)) {
+	    /* only clear the area we're going to check */
+	    clearClips(x1,y1,x2,y2);
+	    clip0dev->drawChar(state, x, y, dx, dy, originX, originY, code, nBytes, u, uLen);
+	    clip1dev->drawChar(state, x, y, dx, dy, originX, originY, code, nBytes, u, uLen);
+	    char_is_clipped = clip0and1differ(x1,y1,x2,y2);
+	}
+
+	if(char_is_outside || render_as_bitmap || char_is_clipped) {
             if(char_is_outside) msg("<verbose> Char %d is outside the page (%d,%d,%d,%d)", code, x1, y1, x2, y2);
             else if(render_as_bitmap)  msg("<verbose> Char %d needs to be rendered as bitmap", code);
             else msg("<verbose> Char %d is affected by clipping", code);
@@ -2072,6 +2201,7 @@ void BitmapOutputDev::setSoftMask(GfxState *state, double *bbox, GBool alpha, Fu
     checkNewBitmap(UNKNOWN_BOUNDING_BOX);
     rgbdev->setSoftMask(state, bbox, alpha, transferFunc, backdropColor);
     clip1dev->setSoftMask(state, bbox, alpha, transferFunc, backdropColor);
+    clip1_softmask = 1;
     dbg_newdata("setsoftmask");
 }
 void BitmapOutputDev::clearSoftMask(GfxState *state)
@@ -2081,5 +2211,6 @@ void BitmapOutputDev::clearSoftMask(GfxState *state)
     checkNewBitmap(UNKNOWN_BOUNDING_BOX);
     rgbdev->clearSoftMask(state);
     clip1dev->clearSoftMask(state);
+    clip1_softmask = 0;
     dbg_newdata("clearsoftmask");
 }
@@ -39,6 +39,19 @@ struct ClipState
     ClipState();
 };
 
+/* Coarse summary of where a monochrome bitmap has pixels set: one byte
+   per tile of 64x64 pixels, which is zero if the tile is empty. */
+struct TileMap
+{
+    int width;
+    int height;
+    unsigned char*tiles;
+    TileMap(int bitmap_width, int bitmap_height);
+    ~TileMap();
+    void clear();
+    void update(SplashBitmap*bitmap, int x1, int y1, int x2, int y2);
+};
+
 #define STATE_PARALLEL 0
 #define STATE_TEXT_IS_ABOVE 1
 #define STATE_BITMAP_IS_ABOVE 2
@@ -194,7 +207,8 @@ private:
     GBool checkNewText(int x1, int y1, int x2, int y2);
     GBool checkNewBitmap(int x1, int y1, int x2, int y2);
     GBool clip0and1differ(int x1,int y1,int x2,int y2);
-    GBool intersection(SplashBitmap*boolpoly, SplashBitmap*booltext, int x1, int y1, int x2, int y2);
+    GBool charIsInsideClip(int x1,int y1,int x2,int y2);
+    GBool intersection(SplashBitmap*boolpoly, SplashBitmap*booltext, TileMap*tiles, int x1, int y1, int x2, int y2);
     
     virtual gfxbbox_t getImageBBox(GfxState*state);
     virtual gfxbbox_t getBBox(GfxState*state);
@@ -204,6 +218,10 @@ private:
     char config_skewedtobitmap;
     char config_alphatobitmap;
     char config_transparent;
+    char config_singlepass;
+
+    /* whether a soft mask was set on clip1dev (not reset by restoreState) */
+    char clip1_softmask;
 
     int text_x1,text_y1,text_x2,text_y2;
 
@@ -226,6 +244,9 @@ private:
     SplashBitmap*booltextbitmap;
     SplashBitmap*staletextbitmap;
 
+    TileMap*stalepolytiles;
+    TileMap*staletexttiles;
+
     gfxdevice_t* gfxoutput;
     gfxdevice_t* gfxoutput_string;
     CharOutputDev*gfxdev;
@@ -9,6 +9,7 @@
 #include "../q.h"
 #include "../gfxdevice.h"
 #include "../gfxfont.h"
+#include "../stats.h"
 #include <math.h>
 #include <assert.h>
 
@@ -274,8 +275,11 @@ gfxbbox_t gfxfont_bbox(gfxfont_t*font)
     return tmp;
 }
 
+STAT(stat_extract, "font", "extract");
+
 gfxfont_t* FontInfo::createGfxFont()
 {
+    double start = stats_enabled?stats_time():0;
     gfxfont_t*font = (gfxfont_t*)rfx_calloc(sizeof(gfxfont_t));
 
     font->glyphs = (gfxglyph_t*)malloc(sizeof(gfxglyph_t)*(this->num_glyphs+2));
@@ -393,6 +397,8 @@ gfxfont_t* FontInfo::createGfxFont()
 	}
     }
 
+    if(stats_enabled)
+	stats_add(&stat_extract, 1, font->num_glyphs, stats_time()-start);
     return font;
 }
 
@@ -51,6 +51,7 @@
 
 /* config */
 static int verbose = 0;
+/* only touched if verbose is set, since it's shared between all instances */
 static int dbgindent = 1;
 static void dbg(const char*format, ...)
 {
@@ -102,6 +103,7 @@ VectorGraphicOutputDev::VectorGraphicOutputDev(InfoOutputDev*info, PDFDoc*doc, i
     this->config_disable_polygon_conversion = 0;
     this->config_multiply = 1;
     this->config_textonly = 0;
+    this->config_jpegpassthrough = 1;
 
     /* for processing drawChar events */
     this->charDev = new CharOutputDev(info, doc, page2page, num_pages, x, y, x1, y1, x2, y2);
@@ -129,6 +131,8 @@ void VectorGraphicOutputDev::setParameter(const char*key, const char*value)
         this->config_disable_polygon_conversion = atoi(value);
     } else if(!strcmp(key,"disable_tiling_pattern_fills")) {
         this->config_disable_tiling_pattern_fills = atoi(value);
+    } else if(!strcmp(key,"jpegpassthrough")) {
+        this->config_jpegpassthrough = atoi(value);
     }
     this->charDev->setParameter(key, value);
 }
@@ -884,7 +888,7 @@ void VectorGraphicOutputDev::beginPage(GfxState *state, int pageNum)
 }
 
 void VectorGraphicOutputDev::saveState(GfxState *state) {
-    dbg("saveState %p", state); dbgindent+=2;
+    dbg("saveState %p", state); if(verbose) dbgindent+=2;
 
     msg("<trace> saveState %p", state);
     updateAll(state);
@@ -906,7 +910,7 @@ void VectorGraphicOutputDev::saveState(GfxState *state) {
 };
 
 void VectorGraphicOutputDev::restoreState(GfxState *state) {
-  dbgindent-=2; dbg("restoreState %p", state);
+  if(verbose) dbgindent-=2; dbg("restoreState %p", state);
 
   if(statepos==0) {
       msg("<fatal> Invalid restoreState");
@@ -1030,7 +1034,8 @@ static void drawimage(gfxdevice_t*dev, gfxcolor_t* data, int sizex,int sizey,
         double x1,double y1,
         double x2,double y2,
         double x3,double y3,
-        double x4,double y4, int type, int multiply)
+        double x4,double y4, int type, int multiply,
+        unsigned char*jpeg_data=0, int jpeg_size=0)
 {
     gfxcolor_t*newpic=0;
     
@@ -1064,9 +1069,12 @@ static void drawimage(gfxdevice_t*dev, gfxcolor_t* data, int sizex,int sizey,
     m.ty = p1.y - 0.5*multiply;
 
     gfximage_t img;
+    memset(&img, 0, sizeof(img));
     img.data = (gfxcolor_t*)data;
     img.width = sizex;
     img.height = sizey;
+    img.jpeg_data = jpeg_data;
+    img.jpeg_size = jpeg_size;
   
     if(type == IMAGE_TYPE_JPEG)
 	/* TODO: pass image_dpi to device instead */
@@ -1077,9 +1085,10 @@ static void drawimage(gfxdevice_t*dev, gfxcolor_t* data, int sizex,int sizey,
 }
 
 void drawimagejpeg(gfxdevice_t*dev, gfxcolor_t*mem, int sizex,int sizey, 
-        double x1,double y1, double x2,double y2, double x3,double y3, double x4,double y4, int multiply)
+        double x1,double y1, double x2,double y2, double x3,double y3, double x4,double y4, int multiply,
+        unsigned char*jpeg_data=0, int jpeg_size=0)
 {
-    drawimage(dev,mem,sizex,sizey,x1,y1,x2,y2,x3,y3,x4,y4, IMAGE_TYPE_JPEG, multiply);
+    drawimage(dev,mem,sizex,sizey,x1,y1,x2,y2,x3,y3,x4,y4, IMAGE_TYPE_JPEG, multiply, jpeg_data, jpeg_size);
 }
 
 void drawimagelossless(gfxdevice_t*dev, gfxcolor_t*mem, int sizex,int sizey, 
@@ -1089,6 +1098,102 @@ void drawimagelossless(gfxdevice_t*dev, gfxcolor_t*mem, int sizex,int sizey,
 }
 
 
+/* check whether the (undecoded) jpeg data of a DCT stream can be stored
+   in a SWF as-is: baseline, 8 bit, with the expected size and number
+   of components, and YCbCr (not RGB) for color images */
+static int jpeg_can_passthrough(unsigned char*data, int len, int width, int height, int ncomps)
+{
+    if(len<4 || data[0]!=0xff || data[1]!=0xd8)
+	return 0;
+    int pos = 2;
+    int sof = 0;
+    while(pos+4<=len) {
+	if(data[pos]!=0xff)
+	    return 0;
+	int marker = data[pos+1];
+	if(marker==0xff) {pos++;continue;}
+	int seglen = data[pos+2]<<8|data[pos+3];
+	unsigned char*seg = &data[pos+4];
+	if(seglen<2 || pos+2+seglen>len)
+	    return 0;
+	if(marker==0xda) // SOS
+	    break;
+	if(marker>=0xc0 && marker<=0xcf && marker!=0xc4 && marker!=0xc8 && marker!=0xcc) {
+	    /* only baseline jpegs */
+	    if(marker!=0xc0)
+		return 0;
+	    if(seglen<8 || seg[0]!=8)
+		return 0;
+	    if((seg[1]<<8|seg[2])!=height || (seg[3]<<8|seg[4])!=width || seg[5]!=ncomps)
+		return 0;
+	    sof = 1;
+	}
+	if(marker==0xee && seglen>=14 && !memcmp(seg, "Adobe", 5)) {
+	    /* APP14 color transform: 0 means RGB (or CMYK) */
+	    if(ncomps==3 && seg[11]==0)
+		return 0;
+	}
+	pos += 2+seglen;
+    }
+    return sof;
+}
+
+/* returns the original jpeg data of a DCT image stream, if the decoded
+   image is just the jpeg as-is (no color conversion, no decode array) */
+static unsigned char* getPassthroughJPEG(Stream*str, GfxImageColorMap*colorMap, int width, int height, int*size)
+{
+    *size = 0;
+    if(str->getKind()!=strDCT || !colorMap)
+	return 0;
+    int ncomps = colorMap->getNumPixelComps();
+    GfxColorSpace*cs = colorMap->getColorSpace();
+    GfxColorSpaceMode mode = cs->getMode();
+    if(mode==csICCBased) {
+	/* we don't do color management, so the pixels are only the jpeg
+	   as-is if the profile falls back to a device color space */
+	GfxColorSpace*alt = ((GfxICCBasedColorSpace*)cs)->getAlt();
+	if(!alt)
+	    return 0;
+	mode = alt->getMode();
+    }
+    if(ncomps==3) {
+	if(mode!=csDeviceRGB)
+	    return 0;
+    } else if(ncomps==1) {
+	if(mode!=csDeviceGray)
+	    return 0;
+    } else {
+	return 0;
+    }
+    int t;
+    for(t=0;t<ncomps;t++) {
+	if(colorMap->getDecodeLow(t)!=0.0 || colorMap->getDecodeHigh(t)!=1.0)
+	    return 0;
+    }
+    Stream*raw = str->getNextStream();
+    if(!raw)
+	return 0;
+
+    int len = 0, alloc = 65536;
+    unsigned char*data = (unsigned char*)malloc(alloc);
+    raw->reset();
+    int c;
+    while((c = raw->getChar()) != EOF) {
+	if(len == alloc) {
+	    alloc *= 2;
+	    data = (unsigned char*)realloc(data, alloc);
+	}
+	data[len++] = c;
+    }
+
+    if(!jpeg_can_passthrough(data, len, width, height, ncomps)) {
+	free(data);
+	return 0;
+    }
+    *size = len;
+    return data;
+}
+
 void VectorGraphicOutputDev::drawGeneralImage(GfxState *state, Object *ref, Stream *str,
 				   int width, int height, GfxImageColorMap*colorMap, GBool invert,
 				   GBool inlineImg, int mask, int*maskColors,
@@ -1264,6 +1369,18 @@ void VectorGraphicOutputDev::drawGeneralImage(GfxState *state, Object *ref, Stre
 
   int x,y;
 
+  /* if the decoded pixels are just the jpeg as-is, pass the jpeg data
+     along with them, so that the device can store it instead of
+     re-encoding the pixels */
+  int jpeg_size = 0;
+  unsigned char*jpeg_data = 0;
+  if(str->getKind()==strDCT && config_jpegpassthrough && !maskbitmap && !maskColors &&
+     !inlineImg && !type3active) {
+      jpeg_data = getPassthroughJPEG(str, colorMap, width, height, &jpeg_size);
+      /* getPassthroughJPEG() read the raw stream */
+      imgStr->reset();
+  }
+
   if(colorMap->getNumPixelComps()!=1 || str->getKind()==strDCT) {
       gfxcolor_t*pic=new gfxcolor_t[width*height];
       for (y = 0; y < height; ++y) {
@@ -1296,11 +1413,12 @@ void VectorGraphicOutputDev::drawGeneralImage(GfxState *state, Object *ref, Stre
 	}
       }
       if(str->getKind()==strDCT)
-	  drawimagejpeg(device, pic, width, height, x1,y1,x2,y2,x3,y3,x4,y4, config_multiply);
+	  drawimagejpeg(device, pic, width, height, x1,y1,x2,y2,x3,y3,x4,y4, config_multiply, jpeg_data, jpeg_size);
       else
 	  drawimagelossless(device, pic, width, height, x1,y1,x2,y2,x3,y3,x4,y4, config_multiply);
       delete[] pic;
       delete imgStr;
+      if(jpeg_data) free(jpeg_data);
       if(maskbitmap) free(maskbitmap);
       return;
   } else {
@@ -1514,12 +1632,12 @@ void VectorGraphicOutputDev::beginTransparencyGroup(GfxState *state, double *bbo
     /*if(!forSoftMask) { ////???
 	state->setFillOpacity(0.0);
     }*/
-    dbgindent+=2;
+    if(verbose) dbgindent+=2;
 }
 
 void VectorGraphicOutputDev::endTransparencyGroup(GfxState *state)
 {
-    dbgindent-=2;
+    if(verbose) dbgindent-=2;
     gfxdevice_t*r = this->device;
 
     dbg("endTransparencyGroup this->device now back to %p (destroying %p)", states[statepos].olddevice, this->device);
@@ -206,6 +206,7 @@ virtual POPPLER_TILING_PATERN_RETURN tilingPatternFill(GfxState *state,
   int config_drawonlyshapes;
   int config_textonly;
   int config_disable_tiling_pattern_fills;
+  int config_jpegpassthrough;
 
   gfxdevice_t char_output_dev;
   CharOutputDev*charDev;
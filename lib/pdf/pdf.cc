@@ -330,7 +330,9 @@ static char*getInfoString(Dict *infoDict, const char *key)
 	    s2 = new GString();
 	    for (i = 2; i < obj.getString()->getLength(); i += 2) {
               u = ((s1->getChar(i) & 0xff) << 8) | (s1->getChar(i+1) & 0xff);
-              s2->append(getUTF8(u));
+              char utf8[8];
+              writeUTF8(u, utf8);
+              s2->append(utf8);
 	    }
 	    char*ret = strdup(s2->getCString());
 	    delete s2;
@@ -24,6 +24,13 @@
 #include <fcntl.h>
 #include <zlib.h>
 #include <limits.h>
+#include "../config.h"
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
 #ifdef EXPORT
 #undef EXPORT
@@ -35,6 +42,7 @@
 #define EXPORT
 #include "png.h"
 #endif
+#include "bitio.h"
 
 typedef unsigned u32;
 
@@ -782,373 +790,383 @@ static char hasAlpha(unsigned char*_image, int size)
     return 0;
 }
 
-typedef struct {
-    u32 num;
-    u32 color;
-} colornum_t;
+/* ------------------------------- quantization ---------------------------------- */
 
-static int compare_colors(const void*_c1, const void*_c2) {
-    colornum_t*c1 = (colornum_t*)_c1;
-    colornum_t*c2 = (colornum_t*)_c2;
-    return c2->num - c1->num;
-}
+/* color distance is measured with the following per-channel weights */
+#define WEIGHT_R 5
+#define WEIGHT_G 6
+#define WEIGHT_B 4
 
-static colornum_t* getColors(COL*image, int size, int*num)
-{
-    unsigned char*colexists = malloc((256*256*256)/8);
-    memset(colexists, 0, (256*256*256)/8);
-    int t;
-    int count=0;
+static const int channel_weight[3] = {WEIGHT_R, WEIGHT_G, WEIGHT_B};
 
-    /* find all different colors in the image */
-    for(t=0;t<size;t++) {
-        int index = (image[t].r)|(image[t].g)<<8|(image[t].b)<<16;
-        if(!(colexists[index/8]&(1<<(index&7)))) {
-            count++;
-            colexists[index/8]|=(1<<(index&7));
-        }
-    }
-    
-    /* now store them in an array */
-    colornum_t*colors=(colornum_t*)malloc(sizeof(colornum_t)*count);
-    int pos=0;
-    for(t=0;t<256*256*256;t++) {
-        if(colexists[t/8]&(1<<(t&7))) {
-            colors[pos].color = t;
-            colors[pos].num = 0;
-            pos++;
-        }
-    }
-
-    /* next, count how often each color occurs */
-    for(t=0;t<size;t++) {
-        int col = (image[t].r)|(image[t].g)<<8|(image[t].b)<<16;
-        int min,max,i,l;
-        for(min=0, max=count, i=count/2, l=count; i != l; l=i,i=(min+max)/2) {
-	    // binary search
-            if(colors[i].color >= col) max=i;
-            else min=i+1;
-        }
-        assert(colors[i].color==col);
-        colors[i].num++;
-    }
-    free(colexists);
-    *num = count;
-    return colors;
+static inline int col_channel(COL*c, int axis)
+{
+    return axis==0?c->r:(axis==1?c->g:c->b);
 }
 
-static void getOptimalPalette(COL*image, int size, int palettesize, COL*palette)
+static inline int col_distance(COL*c1, COL*c2)
 {
+    int dr = c1->r - c2->r;
+    int dg = c1->g - c2->g;
+    int db = c1->b - c2->b;
+    return dr*dr*WEIGHT_R + dg*dg*WEIGHT_G + db*db*WEIGHT_B;
+}
+
+/* A static 3d tree over the palette entries, for nearest color lookups.
+   (lib/kdtree.c partitions the plane into areas, which doesn't help with 
+    nearest neighbor searches in color space.)
+   The tree is stored implicitly: for every range [lo,hi) of the entry
+   array, the middle element is the node, split along axis[middle]. */
+typedef struct _colortree {
+    COL*palette;
+    unsigned char entry[256];
+    unsigned char axis[256];
     int num;
-    memset(palette, 0, sizeof(COL)*256);
-    colornum_t*colors = getColors(image, size, &num);
+} colortree_t;
 
-    assert(palettesize<=256);
+/* stable counting sort of entry[lo..hi) by one color channel. (Not qsort,
+   which would need the palette and axis in globals.) */
+static void colortree_sort(colortree_t*tree, int lo, int hi, int axis)
+{
+    int count[257];
+    unsigned char tmp[256];
+    int t;
+    memset(count, 0, sizeof(count));
+    for(t=lo;t<hi;t++)
+	count[col_channel(&tree->palette[tree->entry[t]], axis)+1]++;
+    for(t=0;t<256;t++)
+	count[t+1] += count[t];
+    for(t=lo;t<hi;t++)
+	tmp[count[col_channel(&tree->palette[tree->entry[t]], axis)]++] = tree->entry[t];
+    memcpy(&tree->entry[lo], tmp, hi-lo);
+}
 
-    qsort(colors, num, sizeof(colornum_t), compare_colors);
-
-    if(num<=palettesize) {
-        /* if there are not more than palettesize different colors in 
-           the image anyway, we are done */
-        int t;
-        for(t=0;t<num;t++) {
-            palette[t].r = colors[t].color;
-            palette[t].g = colors[t].color>>8;
-            palette[t].b = colors[t].color>>16;
-            palette[t].a = 255;
-        }
-        return;
+static void colortree_build(colortree_t*tree, int lo, int hi)
+{
+    if(hi-lo <= 0)
+	return;
+    int min[3] = {255,255,255};
+    int max[3] = {0,0,0};
+    int t, axis, best_axis = 0, best_spread = -1;
+    for(t=lo;t<hi;t++) {
+	for(axis=0;axis<3;axis++) {
+	    int v = col_channel(&tree->palette[tree->entry[t]], axis);
+	    if(v<min[axis]) min[axis] = v;
+	    if(v>max[axis]) max[axis] = v;
+	}
     }
-
-    if(num>2048) {
-	/* if there are too many different colors, pick the ones that
-	   occur most often */
-	num = 2048;
+    for(axis=0;axis<3;axis++) {
+	int spread = (max[axis]-min[axis])*channel_weight[axis];
+	if(spread > best_spread) {
+	    best_spread = spread;
+	    best_axis = axis;
+	}
     }
+    colortree_sort(tree, lo, hi, best_axis);
 
-    colornum_t*centers = malloc(sizeof(colornum_t)*palettesize);
-    int t;
-    for(t=0;t<palettesize;t++) {
-        centers[t].color = colors[t].color;
-    }
-    unsigned char*belongsto = (unsigned char*)malloc(num);
-    memset(belongsto, 0, num);
-    /* do a k-means clustering on the colors */
-    char change = 1;
-    int tries = 0;
-    while(change) {
-        if(tries++ >= (palettesize+num)*2) {
-            fprintf(stderr, "Warning: didn't find optimal palette\n");
-            break;
-        }
-        change = 0;
-        int s,t;
-        for(s=0;s<palettesize;s++) {
-            centers[s].num = 0;
-        }
-        for(t=0;t<num;t++) {
-            int best=0x7fffffff;
-            int bestpos=0;
-            for(s=0;s<palettesize;s++) {
-                int distance = 0;
-                distance += abs((centers[s].color>>0&0xff) - (colors[t].color>>0&0xff));
-                distance += abs((centers[s].color>>8&0xff) - (colors[t].color>>8&0xff));
-                distance += abs((centers[s].color>>16&0xff) - (colors[t].color>>16&0xff));
-                distance *= colors[t].num;
-                if(distance<best) {
-                    best = distance;
-                    bestpos = s;
-                }
-            }
-            if(bestpos!=belongsto[t])
-                change = 1;
-            belongsto[t] = bestpos;
-        }
-        for(s=0;s<palettesize;s++) {
-            int r=0;
-            int g=0;
-            int b=0;
-            int count=0;
-            for(t=0;t<num;t++) {
-                if(belongsto[t]==s) {
-                    r += ((colors[t].color>>0)&0xff)*colors[t].num;
-                    g += ((colors[t].color>>8)&0xff)*colors[t].num;
-                    b += ((colors[t].color>>16)&0xff)*colors[t].num;
-                    count+=colors[t].num;
-                }
-            }
-            if(!count) {
-                int random = rand()%num;
-                centers[s].color = colors[random].color;
-                centers[s].num = 0;
-                change = 1;
-            } else {
-                r /= count;
-                g /= count;
-                b /= count;
-                centers[s].color = r|g<<8|b<<16;
-                centers[s].num = count;
-            }
-        }
-    }
-    free(belongsto);
-    free(colors);
-    for(t=0;t<palettesize;t++) {
-        palette[t].r = centers[t].color;
-        palette[t].g = centers[t].color>>8;
-        palette[t].b = centers[t].color>>16;
-        palette[t].a = 255;
-    }
-    free(centers);
+    int mid = (lo+hi)/2;
+    tree->axis[mid] = best_axis;
+    colortree_build(tree, lo, mid);
+    colortree_build(tree, mid+1, hi);
 }
 
-static int sqr(const int x) {return x*x;}
-
-static void png_quantize_image(unsigned char*_image, int size, int numcolors, unsigned char**newimage, COL*palette) 
+static void colortree_init(colortree_t*tree, COL*palette, int num)
 {
-    COL*image = (COL*)_image;
-    getOptimalPalette(image, size, numcolors, palette);
-    *newimage = (unsigned char*)malloc(size);
     int t;
-    for(t=0;t<size;t++) {
-        int best=0x7fffffff;
-        int bestcol = 0;
-        int s;
-        for(s=0;s<numcolors;s++) {
-            int distance = 0;
-            distance += sqr((palette[s].r) - (image[t].r))*5;
-            distance += sqr((palette[s].g) - (image[t].g))*6;
-            distance += sqr((palette[s].b) - (image[t].b))*4;
-            if(distance<best) {
-                best = distance;
-                bestcol = s;
-            }
-        }
-        (*newimage)[t] = bestcol;
-    }
+    tree->palette = palette;
+    tree->num = num;
+    for(t=0;t<num;t++)
+	tree->entry[t] = t;
+    colortree_build(tree, 0, num);
 }
 
-static u32 mycrc32;
-
-static u32*crc32_table = 0;
-static void make_crc32_table(void)
-{
-  int t;
-  if(crc32_table) 
-      return;
-  crc32_table = (u32*)malloc(1024);
-
-  for (t = 0; t < 256; t++) {
-    u32 c = t;
-    int s;
-    for (s = 0; s < 8; s++) {
-      c = (0xedb88320L*(c&1)) ^ (c >> 1);
-    }
-    crc32_table[t] = c;
-  }
-}
-static inline void png_write_byte(FILE*fi, unsigned char byte)
+static void colortree_search(colortree_t*tree, COL*c, int lo, int hi, int*best, int*best_distance)
 {
-    fwrite(&byte,1,1,fi);
-    mycrc32 = crc32_table[(mycrc32 ^ byte) & 0xff] ^ (mycrc32 >> 8);
+    while(hi-lo > 0) {
+	int mid = (lo+hi)/2;
+	int index = tree->entry[mid];
+	int axis = tree->axis[mid];
+	COL*p = &tree->palette[index];
+	int distance = col_distance(c, p);
+	if(distance < *best_distance) {
+	    *best_distance = distance;
+	    *best = index;
+	}
+	int diff = col_channel(c, axis) - col_channel(p, axis);
+	int plane_distance = diff*diff*channel_weight[axis];
+	/* search the side of the split we're on first, so that the
+	   other side can be skipped if it's too far away */
+	if(diff < 0) {
+	    colortree_search(tree, c, lo, mid, best, best_distance);
+	    if(plane_distance >= *best_distance)
+		return;
+	    lo = mid+1;
+	} else {
+	    colortree_search(tree, c, mid+1, hi, best, best_distance);
+	    if(plane_distance >= *best_distance)
+		return;
+	    hi = mid;
+	}
+    }
 }
-static long png_start_chunk(FILE*fi, char*type, int len)
+
+static int colortree_find(colortree_t*tree, COL*c)
 {
-    unsigned char mytype[4]={0,0,0,0};
-    unsigned char mylen[4];
-    long filepos;
-    mylen[0] = len>>24;
-    mylen[1] = len>>16;
-    mylen[2] = len>>8;
-    mylen[3] = len;
-    memcpy(mytype,type,strlen(type));
-    filepos = ftell(fi);
-    fwrite(&mylen, 4, 1, fi);
-    mycrc32=0xffffffff;
-    png_write_byte(fi,mytype[0]);
-    png_write_byte(fi,mytype[1]);
-    png_write_byte(fi,mytype[2]);
-    png_write_byte(fi,mytype[3]);
-    return filepos;
+    int best = 0;
+    int best_distance = INT_MAX;
+    colortree_search(tree, c, 0, tree->num, &best, &best_distance);
+    return best;
 }
-static void png_patch_len(FILE*fi, int pos, int len)
+
+/* histogram with 5 bits per channel */
+#define HIST_BITS 5
+#define HIST_SIZE (1<<(HIST_BITS*3))
+#define HIST_INDEX(r,g,b) ((((r)>>(8-HIST_BITS))<<(HIST_BITS*2))|(((g)>>(8-HIST_BITS))<<HIST_BITS)|((b)>>(8-HIST_BITS)))
+
+typedef struct _colorbin {
+    COL color; // average color of all pixels in this bin
+    u32 count;
+} colorbin_t;
+
+typedef struct _colorbox {
+    int start, end; // range of bins
+    u32 count;
+    int axis;
+    int spread;
+} colorbox_t;
+
+static void colorbox_update(colorbox_t*box, colorbin_t*bins)
 {
-    unsigned char mylen[4];
-    long filepos;
-    mylen[0] = len>>24;
-    mylen[1] = len>>16;
-    mylen[2] = len>>8;
-    mylen[3] = len;
-    fseek(fi, pos, SEEK_SET);
-    fwrite(&mylen, 4, 1, fi);
-    fseek(fi, 0, SEEK_END);
+    int min[3] = {255,255,255};
+    int max[3] = {0,0,0};
+    int t, axis;
+    box->count = 0;
+    for(t=box->start;t<box->end;t++) {
+	for(axis=0;axis<3;axis++) {
+	    int v = col_channel(&bins[t].color, axis);
+	    if(v<min[axis]) min[axis] = v;
+	    if(v>max[axis]) max[axis] = v;
+	}
+	box->count += bins[t].count;
+    }
+    box->spread = -1;
+    for(axis=0;axis<3;axis++) {
+	int spread = (max[axis]-min[axis])*channel_weight[axis];
+	if(spread > box->spread) {
+	    box->spread = spread;
+	    box->axis = axis;
+	}
+    }
 }
-static void png_write_bytes(FILE*fi, unsigned char*bytes, int len)
+
+static int compare_bins_r(const void*b1, const void*b2) {return ((colorbin_t*)b1)->color.r - ((colorbin_t*)b2)->color.r;}
+static int compare_bins_g(const void*b1, const void*b2) {return ((colorbin_t*)b1)->color.g - ((colorbin_t*)b2)->color.g;}
+static int compare_bins_b(const void*b1, const void*b2) {return ((colorbin_t*)b1)->color.b - ((colorbin_t*)b2)->color.b;}
+
+/* returns the number of palette entries. If the image doesn't have more than
+   palettesize different colors, those are returned unchanged and *exact is set. */
+static int getOptimalPalette(COL*image, int size, int palettesize, COL*palette, char*exact)
 {
     int t;
-    for(t=0;t<len;t++)
-	png_write_byte(fi,bytes[t]);
-}
-static void png_write_dword(FILE*fi, u32 dword)
-{
-    png_write_byte(fi,dword>>24);
-    png_write_byte(fi,dword>>16);
-    png_write_byte(fi,dword>>8);
-    png_write_byte(fi,dword);
-}
-static void png_end_chunk(FILE*fi)
-{
-    u32 tmp = mycrc32^0xffffffff;
-    unsigned char tmp2[4];
-    tmp2[0] = tmp>>24;
-    tmp2[1] = tmp>>16;
-    tmp2[2] = tmp>>8;
-    tmp2[3] = tmp;
-    fwrite(&tmp2,4,1,fi);
-}
+    memset(palette, 0, sizeof(COL)*256);
+    assert(palettesize<=256);
 
-#define ZLIB_BUFFER_SIZE 16384
+    /* if there are not more than palettesize different colors in 
+       the image anyway, we are done */
+    u32 colors[256];
+    u32 hash[1024];
+    int num_exact = 0;
+    u32 last = 0xffffffff;
+    memset(hash, 0xff, sizeof(hash));
+    for(t=0;t<size;t++) {
+	u32 c = image[t].r|image[t].g<<8|image[t].b<<16;
+	if(c == last)
+	    continue;
+	last = c;
+	u32 h = (c ^ (c>>9) ^ (c>>17)) & 1023;
+	while(hash[h] != 0xffffffff && hash[h] != c)
+	    h = (h+1)&1023;
+	if(hash[h] == c)
+	    continue;
+	if(num_exact == palettesize) {
+	    num_exact++;
+	    break;
+	}
+	hash[h] = c;
+	colors[num_exact++] = c;
+    }
+    if(num_exact <= palettesize) {
+	for(t=0;t<num_exact;t++) {
+	    palette[t].r = colors[t];
+	    palette[t].g = colors[t]>>8;
+	    palette[t].b = colors[t]>>16;
+	    palette[t].a = 255;
+	}
+	*exact = 1;
+	return num_exact;
+    }
 
-static long compress_line(z_stream*zs, Bytef*line, int len, FILE*fi)
-{
-    long size = 0;
-    zs->next_in = line;
-    zs->avail_in = len;
+    *exact = 0;
 
-    while(1) {
-	int ret = deflate(zs, Z_NO_FLUSH);
-	if (ret != Z_OK) {
-	    fprintf(stderr, "error in deflate(): %s", zs->msg?zs->msg:"unknown");
-	    return 0;
+    /* otherwise, do a median cut on a color histogram */
+    u32*hist = (u32*)calloc(HIST_SIZE, sizeof(u32)*4);
+    for(t=0;t<size;t++) {
+	u32*h = &hist[HIST_INDEX(image[t].r, image[t].g, image[t].b)*4];
+	h[0] += image[t].r;
+	h[1] += image[t].g;
+	h[2] += image[t].b;
+	h[3]++;
+    }
+    int num_bins = 0;
+    colorbin_t*bins = (colorbin_t*)malloc(sizeof(colorbin_t)*HIST_SIZE);
+    for(t=0;t<HIST_SIZE;t++) {
+	u32*h = &hist[t*4];
+	if(h[3]) {
+	    bins[num_bins].color.r = h[0] / h[3];
+	    bins[num_bins].color.g = h[1] / h[3];
+	    bins[num_bins].color.b = h[2] / h[3];
+	    bins[num_bins].color.a = 255;
+	    bins[num_bins].count = h[3];
+	    num_bins++;
 	}
-	if(zs->avail_out != ZLIB_BUFFER_SIZE) {
-	    int consumed = ZLIB_BUFFER_SIZE - zs->avail_out;
-	    size += consumed;
-	    png_write_bytes(fi, zs->next_out - consumed , consumed);
-	    zs->next_out = zs->next_out - consumed;
-	    zs->avail_out = ZLIB_BUFFER_SIZE;
+    }
+    free(hist);
+
+    colorbox_t boxes[256];
+    int num_boxes = 1;
+    boxes[0].start = 0;
+    boxes[0].end = num_bins;
+    colorbox_update(&boxes[0], bins);
+    while(num_boxes < palettesize) {
+	/* split the box with the largest (weighted) extent */
+	int s, best = -1;
+	double best_score = 0;
+	for(s=0;s<num_boxes;s++) {
+	    if(boxes[s].end - boxes[s].start < 2 || boxes[s].spread<=0)
+		continue;
+	    double score = (double)boxes[s].spread * sqrt((double)boxes[s].count);
+	    if(score > best_score) {
+		best_score = score;
+		best = s;
+	    }
 	}
-	if(!zs->avail_in) {
+	if(best<0)
 	    break;
+	colorbox_t*box = &boxes[best];
+	qsort(&bins[box->start], box->end - box->start, sizeof(colorbin_t), 
+		box->axis==0?compare_bins_r:(box->axis==1?compare_bins_g:compare_bins_b));
+	u32 half = 0;
+	int split = box->start;
+	while(split < box->end-1 && half + bins[split].count/2 < box->count/2) {
+	    half += bins[split].count;
+	    split++;
 	}
+	if(split == box->start)
+	    split++;
+	colorbox_t*box2 = &boxes[num_boxes++];
+	box2->start = split;
+	box2->end = box->end;
+	box->end = split;
+	colorbox_update(box, bins);
+	colorbox_update(box2, bins);
     }
-    return size;
-}
 
-static int test_line(z_stream*zs_orig, Bytef*line, int linelen)
-{
-    z_stream zs;
-    int ret = deflateCopy(&zs, zs_orig);
-    if(ret != Z_OK) {
-	fprintf(stderr, "Couldn't copy stream\n");
-	return 0;
+    /* the palette entries are the average colors of the boxes */
+    double*sums = (double*)malloc(sizeof(double)*4*palettesize);
+    memset(sums, 0, sizeof(double)*4*num_boxes);
+    for(t=0;t<num_boxes;t++) {
+	int s;
+	for(s=boxes[t].start;s<boxes[t].end;s++) {
+	    sums[t*4+0] += bins[s].color.r*(double)bins[s].count;
+	    sums[t*4+1] += bins[s].color.g*(double)bins[s].count;
+	    sums[t*4+2] += bins[s].color.b*(double)bins[s].count;
+	    sums[t*4+3] += bins[s].count;
+	}
     }
 
-    zs.next_in = line;
-    zs.avail_in = linelen;
-
-    long size = 0;
-
-    int mode = Z_SYNC_FLUSH;
-    while(1) {
-	int ret = deflate(&zs, mode);
-	if (ret != Z_OK && ret != Z_STREAM_END) {
-	    fprintf(stderr, "error in deflate(): %s (mode %s, %d bytes remaining)\n", zs.msg?zs.msg:"unknown", 
-		    mode==Z_SYNC_FLUSH?"Z_SYNC_FLUSH":"Z_FINISH", zs.avail_in);
-	    return 0;
-	}
-	if(zs.avail_out != ZLIB_BUFFER_SIZE) {
-	    int consumed = ZLIB_BUFFER_SIZE - zs.avail_out;
-	    size += consumed;
-	    zs.next_out = zs.next_out - consumed;
-	    zs.avail_out = ZLIB_BUFFER_SIZE;
+    /* refine the result with a few k-means iterations over the histogram */
+    int iteration;
+    for(iteration=0;;iteration++) {
+	for(t=0;t<num_boxes;t++) {
+	    if(sums[t*4+3]) {
+		palette[t].r = (int)(sums[t*4+0] / sums[t*4+3] + 0.5);
+		palette[t].g = (int)(sums[t*4+1] / sums[t*4+3] + 0.5);
+		palette[t].b = (int)(sums[t*4+2] / sums[t*4+3] + 0.5);
+	    }
+	    palette[t].a = 255;
 	}
-        if (ret == Z_STREAM_END) {
-            break;
-        }
-	if(!zs.avail_in) {
-	    mode = Z_FINISH;
+	if(iteration == 3)
+	    break;
+	colortree_t tree;
+	colortree_init(&tree, palette, num_boxes);
+	memset(sums, 0, sizeof(double)*4*num_boxes);
+	for(t=0;t<num_bins;t++) {
+	    int s = colortree_find(&tree, &bins[t].color);
+	    sums[s*4+0] += bins[t].color.r*(double)bins[t].count;
+	    sums[s*4+1] += bins[t].color.g*(double)bins[t].count;
+	    sums[s*4+2] += bins[t].color.b*(double)bins[t].count;
+	    sums[s*4+3] += bins[t].count;
 	}
     }
-    ret = deflateEnd(&zs);
-    if (ret != Z_OK) {
-	fprintf(stderr, "error in deflateEnd(): %s\n", zs.msg?zs.msg:"unknown");
-	return 0;
-    }
-    return size;
+    free(sums);
+    free(bins);
+    return num_boxes;
 }
 
-static int finishzlib(z_stream*zs, FILE*fi)
+/* nearest palette entries are looked up on a grid with 6 bits per channel */
+#define CMAP_BITS 6
+#define CMAP_SIZE (1<<(CMAP_BITS*3))
+
+static void png_quantize_image(unsigned char*_image, int size, int numcolors, unsigned char**newimage, COL*palette) 
 {
-    int size = 0;
-    int ret;
-    while(1) {
-        ret = deflate(zs, Z_FINISH);
-        if (ret != Z_OK &&
-            ret != Z_STREAM_END) {
-	    fprintf(stderr, "error in deflate(finish): %s\n", zs->msg?zs->msg:"unknown");
-	    return 0;
-	}
+    COL*image = (COL*)_image;
+    char exact = 0;
+    int num = getOptimalPalette(image, size, numcolors, palette, &exact);
+    *newimage = (unsigned char*)malloc(size);
 
-	if(zs->avail_out != ZLIB_BUFFER_SIZE) {
-	    int consumed = ZLIB_BUFFER_SIZE - zs->avail_out;
-	    size += consumed;
-	    png_write_bytes(fi, zs->next_out - consumed , consumed);
-	    zs->next_out = zs->next_out - consumed;
-	    zs->avail_out = ZLIB_BUFFER_SIZE;
+    colortree_t tree;
+    colortree_init(&tree, palette, num);
+
+    int t;
+    if(exact) {
+	u32 last = 0xffffffff;
+	int last_index = 0;
+	for(t=0;t<size;t++) {
+	    u32 c = image[t].r|image[t].g<<8|image[t].b<<16;
+	    if(c != last) {
+		last = c;
+		last_index = colortree_find(&tree, &image[t]);
+	    }
+	    (*newimage)[t] = last_index;
 	}
-        if (ret == Z_STREAM_END) {
-            break;
-        }
+	return;
     }
-    ret = deflateEnd(zs);
-    if (ret != Z_OK) {
-	fprintf(stderr, "error in deflateEnd(): %s\n", zs->msg?zs->msg:"unknown");
-	return 0;
+
+    /* inverse color map, filled on demand */
+    unsigned short*cmap = (unsigned short*)malloc(sizeof(unsigned short)*CMAP_SIZE);
+    memset(cmap, 0xff, sizeof(unsigned short)*CMAP_SIZE);
+
+    int shift = 8-CMAP_BITS;
+    int center = 1<<(shift-1);
+    for(t=0;t<size;t++) {
+	int r = image[t].r>>shift;
+	int g = image[t].g>>shift;
+	int b = image[t].b>>shift;
+	int index = (r<<(CMAP_BITS*2))|(g<<CMAP_BITS)|b;
+	if(cmap[index] == 0xffff) {
+	    COL c;
+	    c.r = (r<<shift)|center;
+	    c.g = (g<<shift)|center;
+	    c.b = (b<<shift)|center;
+	    cmap[index] = colortree_find(&tree, &c);
+	}
+	(*newimage)[t] = cmap[index];
     }
-    return size;
+    free(cmap);
 }
 
+#define ZLIB_BUFFER_SIZE 16384
+
 static inline u32 color_hash(COL*col)
 {
     u32 col32 = *(u32*)col;
@@ -1201,7 +1219,7 @@ static int png_get_number_of_palette_entries(COL*img, unsigned width, unsigned h
 		palette_overflow = 1;
 		break;
 	    }
-	    count[size[hash]] = 1;
+	    ccount[size[hash]] = 1;
 	    cpal[size[hash]++] = col32;
 	    palsize++;
 	}
@@ -1209,6 +1227,7 @@ static int png_get_number_of_palette_entries(COL*img, unsigned width, unsigned h
     }
     if(palette_overflow) {
 	free(pal);
+	free(count);
 	*has_alpha=1;
 	return width*height;
     }
@@ -1384,28 +1403,8 @@ static int png_apply_specific_filter_32(int filtermode, unsigned char*dest, unsi
     return filtermode;
 }
 
-static int*num_bits_table = 0;
-
-static void make_num_bits_table()
-{
-    if(num_bits_table) return;
-    num_bits_table = malloc(sizeof(num_bits_table[0])*256);
-    int t;
-    for(t=0;t<256;t++) {
-	int bits=0;
-	int v = t;
-	while(v) {
-	    bits++;
-	    v&=v-1;
-	}
-	num_bits_table[t]=bits;
-    }
-}
-
 static int png_find_best_filter(unsigned char*src, unsigned width, int bpp, int y)
 {
-    make_num_bits_table();
-    
     int num_filters = y>0?5:2; //don't apply y-direction filter in first line
     
     int bytes_per_pixel = bpp>>3;
@@ -1474,7 +1473,6 @@ static int png_apply_filter(unsigned char*dest, unsigned char*src, unsigned widt
 {
     int best_nr = 0;
 #if 0
-    make_num_bits_table();
     int num_filters = y>0?5:2; //don't apply y-direction filter in first line
     int f;
     int best_energy = INT_MAX;
@@ -1527,32 +1525,405 @@ int png_apply_filter_32(unsigned char*dest, unsigned char*src, unsigned width, i
     return png_apply_filter(dest, src, width, y, 32);
 }
 
-static void png_write_palette_based2(const char*filename, unsigned char*data, unsigned width, unsigned height, int numcolors, int compression)
+/* ----------------------- streaming (scanline based) writer ----------------------- */
+
+#define PNG_WRITER_CHUNK_SIZE 65536
+
+/* with more than one thread, the filtered image data is cut into blocks which
+   are deflated independently (with the preceding 32k as dictionary) and then
+   concatenated (like pigz does). */
+#define PNG_WRITER_BLOCK_SIZE 131072
+#define PNG_WRITER_DICT_SIZE 32768
+
+typedef struct _png_writer_internal {
+    struct _writer*w;
+    int bpp;
+    int num_threads;
+    int compression;
+
+    unsigned srcwidth;
+    unsigned linelen;
+
+    /* raw lines of the current batch, preceded by the last line of the previous batch */
+    unsigned char*raw;
+    unsigned char*filtered;
+    int batch_lines;
+    int num_lines;
+
+    unsigned char*zbuf;
+    int zpos;
+
+    /* single threaded: one continuous zlib stream */
+    z_stream zs;
+
+    /* multi threaded: raw deflate blocks */
+    unsigned char*dict;
+    int dictlen;
+    u32 adler;
+} png_writer_internal_t;
+
+static void png_writer_chunk(struct _writer*w, char*type, unsigned char*data, int len)
 {
-    FILE*fi;
-    int crc;
+    unsigned char head[8] = {len>>24, len>>16, len>>8, len, type[0], type[1], type[2], type[3]};
+    u32 crc = crc32(0, head+4, 4);
+    if(len)
+	crc = crc32(crc, data, len);
+    unsigned char tail[4] = {crc>>24, crc>>16, crc>>8, crc};
+    w->write(w, head, 8);
+    if(len)
+	w->write(w, data, len);
+    w->write(w, tail, 4);
+}
+
+static void png_writer_output(png_writer_internal_t*i, unsigned char*data, int len)
+{
+    while(len) {
+	int l = PNG_WRITER_CHUNK_SIZE - i->zpos;
+	if(l > len)
+	    l = len;
+	memcpy(i->zbuf+i->zpos, data, l);
+	i->zpos += l;
+	data += l;
+	len -= l;
+	if(i->zpos == PNG_WRITER_CHUNK_SIZE) {
+	    png_writer_chunk(i->w, "IDAT", i->zbuf, i->zpos);
+	    i->zpos = 0;
+	}
+    }
+}
+
+static int png_deflate(z_stream*zs, unsigned char*data, int len, int flush, void (*output)(void*, unsigned char*, int), void*user)
+{
+    unsigned char buf[ZLIB_BUFFER_SIZE];
+    zs->next_in = data;
+    zs->avail_in = len;
+    while(1) {
+	zs->next_out = buf;
+	zs->avail_out = ZLIB_BUFFER_SIZE;
+	int ret = deflate(zs, flush);
+	if(ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+	    fprintf(stderr, "error in deflate(): %s\n", zs->msg?zs->msg:"unknown");
+	    return 0;
+	}
+	if(zs->avail_out != ZLIB_BUFFER_SIZE)
+	    output(user, buf, ZLIB_BUFFER_SIZE - zs->avail_out);
+	if(ret == Z_STREAM_END)
+	    break;
+	if(!zs->avail_in && zs->avail_out) {
+	    /* all input consumed, and deflate didn't need all of the output buffer-
+	       so there's nothing pending anymore */
+	    if(flush != Z_FINISH)
+		break;
+	}
+    }
+    return 1;
+}
+
+static void png_writer_output_callback(void*user, unsigned char*data, int len)
+{
+    png_writer_output((png_writer_internal_t*)user, data, len);
+}
+
+typedef struct _png_block {
+    png_writer_internal_t*i;
+    int start_line, end_line;
+    int y;
+    /* deflate */
+    unsigned char*data;
+    int len;
+    unsigned char*dict;
+    int dictlen;
+    unsigned char*out;
+    int outlen;
+    int outsize;
+} png_block_t;
+
+static void png_filter_lines(png_block_t*b)
+{
+    png_writer_internal_t*i = b->i;
     int t;
-    unsigned char format;
-    unsigned char tmp;
-    unsigned char* data2=0;
+    for(t=b->start_line;t<b->end_line;t++) {
+	unsigned char*dest = &i->filtered[t*i->linelen];
+	unsigned char*src = &i->raw[(t+1)*i->srcwidth];
+	dest[0] = png_apply_filter(dest+1, src, i->srcwidth*8/i->bpp, b->y+t, i->bpp);
+    }
+}
+
+static void png_block_output(void*user, unsigned char*data, int len)
+{
+    png_block_t*b = (png_block_t*)user;
+    if(b->outlen + len > b->outsize) {
+	b->outsize = (b->outlen + len)*2;
+	b->out = (unsigned char*)realloc(b->out, b->outsize);
+    }
+    memcpy(b->out+b->outlen, data, len);
+    b->outlen += len;
+}
+
+static void png_deflate_block(png_block_t*b)
+{
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    /* negative window bits: raw deflate, without zlib header and checksum */
+    if(deflateInit2(&zs, b->i->compression, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+	fprintf(stderr, "error in deflateInit2(): %s\n", zs.msg?zs.msg:"unknown");
+	return;
+    }
+    if(b->dictlen)
+	deflateSetDictionary(&zs, b->dict, b->dictlen);
+    /* end on a byte boundary, so that the blocks can be concatenated */
+    png_deflate(&zs, b->data, b->len, Z_SYNC_FLUSH, png_block_output, b);
+    deflateEnd(&zs);
+}
+
+#ifdef HAVE_PTHREADS
+static void* png_filter_thread(void*data)
+{
+    png_filter_lines((png_block_t*)data);
+    return 0;
+}
+static void* png_deflate_thread(void*data)
+{
+    png_deflate_block((png_block_t*)data);
+    return 0;
+}
+static void png_run_parallel(void*(*f)(void*), png_block_t*blocks, int num)
+{
+    pthread_t*threads = (pthread_t*)malloc(sizeof(pthread_t)*num);
+    int t;
+    for(t=1;t<num;t++) {
+	if(pthread_create(&threads[t], 0, f, &blocks[t])) {
+	    /* couldn't spawn thread- do it ourselves */
+	    f(&blocks[t]);
+	    threads[t] = 0;
+	}
+    }
+    f(&blocks[0]);
+    for(t=1;t<num;t++) {
+	if(threads[t])
+	    pthread_join(threads[t], 0);
+    }
+    free(threads);
+}
+#endif
+
+static void png_writer_flush_batch(png_writer_t*png)
+{
+    png_writer_internal_t*i = (png_writer_internal_t*)png->internal;
+    int num = i->num_lines;
+    int y = png->y - num;
+    if(!num)
+	return;
+
+    int len = num*i->linelen;
+    int t;
+    if(i->num_threads <= 1) {
+	png_block_t b;
+	memset(&b, 0, sizeof(b));
+	b.i = i;
+	b.start_line = 0;
+	b.end_line = num;
+	b.y = y;
+	png_filter_lines(&b);
+	png_deflate(&i->zs, i->filtered, len, Z_NO_FLUSH, png_writer_output_callback, i);
+    } else {
+	int num_blocks = i->num_threads;
+	png_block_t*blocks = (png_block_t*)calloc(num_blocks, sizeof(png_block_t));
+	int lines_per_block = (num+num_blocks-1) / num_blocks;
+	for(t=0;t<num_blocks;t++) {
+	    blocks[t].i = i;
+	    blocks[t].y = y;
+	    blocks[t].start_line = t*lines_per_block;
+	    blocks[t].end_line = (t+1)*lines_per_block;
+	    if(blocks[t].start_line > num) blocks[t].start_line = num;
+	    if(blocks[t].end_line > num) blocks[t].end_line = num;
+	}
+#ifdef HAVE_PTHREADS
+	png_run_parallel(png_filter_thread, blocks, num_blocks);
+#else
+	for(t=0;t<num_blocks;t++)
+	    png_filter_lines(&blocks[t]);
+#endif
+	for(t=0;t<num_blocks;t++) {
+	    png_block_t*b = &blocks[t];
+	    int start = b->start_line*i->linelen;
+	    b->data = &i->filtered[start];
+	    b->len = (b->end_line - b->start_line)*i->linelen;
+	    if(start >= PNG_WRITER_DICT_SIZE) {
+		b->dict = b->data - PNG_WRITER_DICT_SIZE;
+		b->dictlen = PNG_WRITER_DICT_SIZE;
+	    } else if(start) {
+		b->dict = i->filtered;
+		b->dictlen = start;
+	    } else {
+		b->dict = i->dict;
+		b->dictlen = i->dictlen;
+	    }
+	}
+#ifdef HAVE_PTHREADS
+	png_run_parallel(png_deflate_thread, blocks, num_blocks);
+#else
+	for(t=0;t<num_blocks;t++)
+	    png_deflate_block(&blocks[t]);
+#endif
+	for(t=0;t<num_blocks;t++) {
+	    png_writer_output(i, blocks[t].out, blocks[t].outlen);
+	    if(blocks[t].out)
+		free(blocks[t].out);
+	}
+	free(blocks);
+
+	i->adler = adler32(i->adler, i->filtered, len);
+
+	/* remember the end of the filtered data as dictionary for the next batch */
+	if(len >= PNG_WRITER_DICT_SIZE) {
+	    memcpy(i->dict, i->filtered+len-PNG_WRITER_DICT_SIZE, PNG_WRITER_DICT_SIZE);
+	    i->dictlen = PNG_WRITER_DICT_SIZE;
+	} else {
+	    int keep = i->dictlen + len > PNG_WRITER_DICT_SIZE ? PNG_WRITER_DICT_SIZE - len : i->dictlen;
+	    memmove(i->dict, i->dict+i->dictlen-keep, keep);
+	    memcpy(i->dict+keep, i->filtered, len);
+	    i->dictlen = keep + len;
+	}
+    }
+
+    /* keep the last line, the y filters of the next batch need it */
+    memcpy(i->raw, &i->raw[num*i->srcwidth], i->srcwidth);
+    i->num_lines = 0;
+}
+
+static void png_writer_init(png_writer_t*png, struct _writer*w, unsigned width, unsigned height, 
+	                    int bpp, COL*palette, int numcolors, char has_alpha, int compression, int num_threads)
+{
     unsigned char head[] = {137,80,78,71,13,10,26,10}; // PNG header
-    int cols;
-    char alpha = 1;
-    int pos = 0;
-    int error;
-    u32 tmp32;
+    unsigned char ihdr[13] = {width>>24, width>>16, width>>8, width,
+                              height>>24, height>>16, height>>8, height,
+			      8, bpp==8?3:6, 0, 0, 0}; // indexed or rgba, no interlacing
+    png_writer_internal_t*i = (png_writer_internal_t*)calloc(1, sizeof(png_writer_internal_t));
+    memset(png, 0, sizeof(png_writer_t));
+    png->width = width;
+    png->height = height;
+    png->internal = i;
+
+#ifndef HAVE_PTHREADS
+    num_threads = 1;
+#endif
+    if(num_threads < 1)
+	num_threads = 1;
+
+    i->w = w;
+    i->bpp = bpp;
+    i->compression = compression;
+    i->num_threads = num_threads;
+    i->srcwidth = width*(bpp/8);
+    i->linelen = i->srcwidth+1;
+    i->batch_lines = num_threads * (PNG_WRITER_BLOCK_SIZE / i->linelen + 1);
+    i->raw = (unsigned char*)calloc(i->batch_lines+1, i->srcwidth);
+    i->filtered = (unsigned char*)malloc(i->batch_lines*i->linelen);
+    i->zbuf = (unsigned char*)malloc(PNG_WRITER_CHUNK_SIZE);
+
+    w->write(w, head, sizeof(head));
+    png_writer_chunk(w, "IHDR", ihdr, sizeof(ihdr));
+
+    if(bpp == 8) {
+	unsigned char plte[256*3];
+	unsigned char trns[256];
+	int t;
+	for(t=0;t<numcolors;t++) {
+	    plte[t*3+0] = palette[t].r;
+	    plte[t*3+1] = palette[t].g;
+	    plte[t*3+2] = palette[t].b;
+	    trns[t] = palette[t].a;
+	}
+	png_writer_chunk(w, "PLTE", plte, numcolors*3);
+	if(has_alpha)
+	    png_writer_chunk(w, "tRNS", trns, numcolors);
+    }
+
+    if(num_threads == 1) {
+	if(deflateInit(&i->zs, compression) != Z_OK) {
+	    fprintf(stderr, "error in deflateInit(): %s\n", i->zs.msg?i->zs.msg:"unknown");
+	}
+    } else {
+	/* zlib header (deflate, 32k window, no dictionary) */
+	unsigned char zhead[2] = {0x78, 0xda};
+	png_writer_output(i, zhead, 2);
+	i->dict = (unsigned char*)malloc(PNG_WRITER_DICT_SIZE);
+	i->adler = adler32(0, 0, 0);
+    }
+}
+
+EXPORT void png_writer_start(png_writer_t*png, struct _writer*w, unsigned width, unsigned height)
+{
+    png_writer_init(png, w, width, height, 32, 0, 0, 1, Z_BEST_COMPRESSION, 1);
+}
+
+EXPORT void png_writer_start2(png_writer_t*png, struct _writer*w, unsigned width, unsigned height, int compression, int num_threads)
+{
+    png_writer_init(png, w, width, height, 32, 0, 0, 1, compression, num_threads);
+}
+
+EXPORT void png_writer_addlines(png_writer_t*png, unsigned char*data, unsigned num_lines)
+{
+    png_writer_internal_t*i = (png_writer_internal_t*)png->internal;
+    while(num_lines && png->y<png->height) {
+	int l = i->batch_lines - i->num_lines;
+	if(l > num_lines)
+	    l = num_lines;
+	if(l > png->height - png->y)
+	    l = png->height - png->y;
+	memcpy(&i->raw[(i->num_lines+1)*i->srcwidth], data, l*i->srcwidth);
+	i->num_lines += l;
+	png->y += l;
+	data += l*i->srcwidth;
+	num_lines -= l;
+	if(i->num_lines == i->batch_lines)
+	    png_writer_flush_batch(png);
+    }
+}
+
+EXPORT void png_writer_finish(png_writer_t*png)
+{
+    png_writer_internal_t*i = (png_writer_internal_t*)png->internal;
+    if(png->y < png->height) {
+	fprintf(stderr, "png_writer_finish: only %d of %d lines written\n", png->y, png->height);
+	unsigned char*empty = (unsigned char*)calloc(1, i->srcwidth);
+	while(png->y < png->height)
+	    png_writer_addlines(png, empty, 1);
+	free(empty);
+    }
+    png_writer_flush_batch(png);
+
+    if(i->num_threads == 1) {
+	png_deflate(&i->zs, 0, 0, Z_FINISH, png_writer_output_callback, i);
+	deflateEnd(&i->zs);
+    } else {
+	/* an empty final block, followed by the adler32 of the whole stream */
+	unsigned char tail[6] = {0x03, 0x00, i->adler>>24, i->adler>>16, i->adler>>8, i->adler};
+	png_writer_output(i, tail, 6);
+	free(i->dict);
+    }
+    if(i->zpos)
+	png_writer_chunk(i->w, "IDAT", i->zbuf, i->zpos);
+    png_writer_chunk(i->w, "IEND", 0, 0);
+
+    free(i->zbuf);
+    free(i->raw);
+    free(i->filtered);
+    free(i);
+    png->internal = 0;
+}
+
+static void png_write_palette_based2(const char*filename, unsigned char*data, unsigned width, unsigned height, int numcolors, int compression)
+{
+    unsigned char* data2=0;
+    int cols = 0;
     int bpp;
-    int ret;
     char has_alpha=0;
-    z_stream zs;
     COL palette[256];
 
-    make_crc32_table();
-
     if(numcolors>256) {
 	bpp = 32;
-	cols = 0;
-	format = 5;
     } else if(!numcolors) {
 	int num = png_get_number_of_palette_entries((COL*)data, width, height, palette, &has_alpha);
 	if(num<=255) {
@@ -1562,139 +1933,39 @@ static void png_write_palette_based2(const char*filename, unsigned char*data, un
 	    data = data2;
 	    bpp = 8;
 	    cols = num;
-	    format = 3;
 	} else {
 	    bpp = 32;
-	    cols = 0;
-	    format = 5;
 	}
     } else {
         bpp = 8;
         cols = numcolors;
-        format = 3;
-        png_quantize_image(data, width*height, numcolors, &data, palette);
+        png_quantize_image(data, width*height, numcolors, &data2, palette);
+	data = data2;
     }
 
-    fi = fopen(filename, "wb");
-    if(!fi) {
-	perror("open");
-	return;
-    }
-    fwrite(head,sizeof(head),1,fi);     
-
-    png_start_chunk(fi, "IHDR", 13);
-     png_write_dword(fi,width);
-     png_write_dword(fi,height);
-     png_write_byte(fi,8);
-     if(format == 3)
-     png_write_byte(fi,3); //indexed
-     else if(format == 5 && alpha==0)
-     png_write_byte(fi,2); //rgb
-     else if(format == 5 && alpha==1)
-     png_write_byte(fi,6); //rgba
-     else return;
-
-     png_write_byte(fi,0); //compression mode
-     png_write_byte(fi,0); //filter mode
-     png_write_byte(fi,0); //interlace mode
-    png_end_chunk(fi);
-
-    if(format == 3) {
-	png_start_chunk(fi, "PLTE", cols*3);
-	for(t=0;t<cols;t++) {
-	    png_write_byte(fi,palette[t].r);
-	    png_write_byte(fi,palette[t].g);
-	    png_write_byte(fi,palette[t].b);
-	}
-	png_end_chunk(fi);
-
-	if(has_alpha) {
-	    png_start_chunk(fi, "tRNS", cols);
-	    for(t=0;t<cols;t++) {
-		png_write_byte(fi,palette[t].a);
-	    }
-	    png_end_chunk(fi);
-	}
-    }
-
-    long idatpos = png_start_chunk(fi, "IDAT", 0);
-    
-    memset(&zs,0,sizeof(z_stream));
-    Bytef*writebuf = (Bytef*)malloc(ZLIB_BUFFER_SIZE);
-    zs.zalloc = Z_NULL;
-    zs.zfree  = Z_NULL;
-    zs.opaque = Z_NULL;
-    zs.next_out = writebuf;
-    zs.avail_out = ZLIB_BUFFER_SIZE;
-    ret = deflateInit(&zs, compression);
-    if (ret != Z_OK) {
-	fprintf(stderr, "error in deflateInit(): %s", zs.msg?zs.msg:"unknown");
-	return;
-    }
-
-    long idatsize = 0;
-    {
-	int x,y;
-        int bypp = bpp/8;
-	unsigned srcwidth = width * bypp;
-	unsigned linelen = 1 + srcwidth;
-        if(bypp==2) 
-            linelen = 1 + ((srcwidth+1)&~1);
-        else if(bypp==3) 
-            linelen = 1 + ((srcwidth+2)/3)*3;
-        else if(bypp==4) 
-            linelen = 1 + ((srcwidth+3)&~3);
-	unsigned char* line = (unsigned char*)malloc(linelen);
-	memset(line, 0, linelen);
-#if 0
-	unsigned char* bestline = (unsigned char*)malloc(linelen);
-	memset(bestline, 0, linelen);
-	for(y=0;y<height;y++)
-	{
-	    int filtermode;
-	    int bestsize = 0x7fffffff;
-	    for(filtermode=0;filtermode<=4;filtermode++) {
-		if(!y && filtermode>=2)
-		    continue; // don't do y direction filters in the first row
-		
-		line[0]=filtermode; //filter type
-                if(bpp==8)
-		    png_apply_specific_filter_8(filtermode, line+1, &data[y*srcwidth], width);
-                else
-		    png_apply_specific_filter_32(filtermode, line+1, &data[y*srcwidth], width);
-
-		int size = test_line(&zs, line, linelen);
-		if(size < bestsize) {
-		    memcpy(bestline, line, linelen);
-		    bestsize = size;
-		}
-	    }
-	    idatsize += compress_line(&zs, bestline, linelen, fi);
-	}
-	free(bestline);
-#else
-	for(y=0;y<height;y++) {
-            if(bpp==8)
-		line[0] = png_apply_filter_8(line+1, &data[y*srcwidth], width, y);
-            else
-		line[0] = png_apply_filter_32(line+1, &data[y*srcwidth], width, y);
-
-	    idatsize += compress_line(&zs, line, linelen, fi);
-	}
+    writer_t w;
+    int fi = open(filename, O_WRONLY|O_CREAT|O_TRUNC
+#ifdef O_BINARY
+	    |O_BINARY
 #endif
-	free(line);
+	    , 0644);
+    if(fi<0) {
+	perror(filename);
+	if(data2)
+	    free(data2);
+	return;
     }
-    idatsize += finishzlib(&zs, fi);
-    png_patch_len(fi, idatpos, idatsize);
-    png_end_chunk(fi);
+    writer_init_filewriter(&w, fi);
 
-    png_start_chunk(fi, "IEND", 0);
-    png_end_chunk(fi);
+    png_writer_t png;
+    png_writer_init(&png, &w, width, height, bpp, palette, cols, has_alpha, compression, 1);
+    png_writer_addlines(&png, data, height);
+    png_writer_finish(&png);
 
-    free(writebuf);
+    w.finish(&w);
+    close(fi);
     if(data2)
 	free(data2);
-    fclose(fi);
 }
 
 EXPORT void png_write_palette_based(const char*filename, unsigned char*data, unsigned width, unsigned height, int numcolors)
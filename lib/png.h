@@ -35,6 +35,22 @@ void png_write(const char*filename, unsigned char*data, unsigned width, unsigned
 void png_write_quick(const char*filename, unsigned char*data, unsigned width, unsigned height);
 void png_write_palette_based_2(const char*filename, unsigned char*data, unsigned width, unsigned height);
 
+/* streaming interface: write a (truecolor+alpha) PNG a couple of scanlines at a time.
+   Lines are in the same (a,r,g,b) layout png_write() expects.
+   png_writer_start2() can use num_threads threads for filtering and compression. */
+struct _writer;
+typedef struct _png_writer {
+    unsigned width;
+    unsigned height;
+    unsigned y;
+    void*internal;
+} png_writer_t;
+
+void png_writer_start(png_writer_t*png, struct _writer*w, unsigned width, unsigned height);
+void png_writer_start2(png_writer_t*png, struct _writer*w, unsigned width, unsigned height, int compression, int num_threads);
+void png_writer_addlines(png_writer_t*png, unsigned char*data, unsigned num_lines);
+void png_writer_finish(png_writer_t*png);
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,6 +30,7 @@
 #include "../devices/render.h"
 #include "../devices/rescale.h"
 #include "../devices/text.h"
+#include "../devices/stats.h"
 #ifdef USE_OPENGL
 #include "../devices/opengl.h"
 #endif
@@ -41,6 +42,7 @@
 #include "../utf8.h"
 #include "../gfxdevice.h"
 #include "../gfximage.h"
+#include "../stats.h"
 
 #define PYTHON_GFX_VERSION VERSION
 
@@ -441,6 +443,16 @@ static PyObject* output_setparameter(PyObject* _self, PyObject* args, PyObject*
     self->output_device->setparameter(self->output_device, key, value);
     return PY_NONE;
 }
+/* with collectstats() enabled, devices report their timings */
+static gfxdevice_t* wrap_device(gfxdevice_t*dev)
+{
+    if(!stats_enabled)
+        return dev;
+    gfxdevice_t*stats = (gfxdevice_t*)malloc(sizeof(gfxdevice_t));
+    gfxdevice_stats_init(stats, dev);
+    return stats;
+}
+
 PyDoc_STRVAR(f_createSWF_doc, \
 "SWF()\n\n"
 "Creates a device which renders documents to SWF (Flash) files.\n"
@@ -457,6 +469,7 @@ static PyObject* f_createSWF(PyObject* module, PyObject* args, PyObject* kwargs)
     
     self->output_device = (gfxdevice_t*)malloc(sizeof(gfxdevice_t));
     gfxdevice_swf_init(self->output_device);
+    self->output_device = wrap_device(self->output_device);
     return (PyObject*)self;
 }
 
@@ -476,6 +489,7 @@ static PyObject* f_createImageList(PyObject* module, PyObject* args, PyObject* k
     
     self->output_device = (gfxdevice_t*)malloc(sizeof(gfxdevice_t));
     gfxdevice_render_init(self->output_device);
+    self->output_device = wrap_device(self->output_device);
     return (PyObject*)self;
 }
 
@@ -494,6 +508,7 @@ static PyObject* f_createPlainText(PyObject* module, PyObject* args, PyObject* k
     
     self->output_device = (gfxdevice_t*)malloc(sizeof(gfxdevice_t));
     gfxdevice_text_init(self->output_device);
+    self->output_device = wrap_device(self->output_device);
     return (PyObject*)self;
 }
 
@@ -513,6 +528,7 @@ static PyObject* f_createOpenGL(PyObject* module, PyObject* args, PyObject* kwar
     
     self->output_device = (gfxdevice_t*)malloc(sizeof(gfxdevice_t));
     gfxdevice_opengl_init(self->output_device);
+    self->output_device = wrap_device(self->output_device);
     return (PyObject*)self;
 }
 #endif
@@ -1582,7 +1598,7 @@ PyDoc_STRVAR(f_createBitmap_doc, \
 static PyObject* create_bitmap(gfximage_t*img)
 {
     BitmapObject*self = PyObject_New(BitmapObject, &BitmapClass);
-    self->image = malloc(sizeof(gfximage_t));
+    self->image = calloc(1, sizeof(gfximage_t));
     self->image->data = malloc(sizeof(gfxcolor_t)*img->width*img->height);
     memcpy(self->image->data, img->data, sizeof(gfxcolor_t)*img->width*img->height);
     self->image->width = img->width;
@@ -1896,6 +1912,59 @@ static PyObject* f_addfontdir(PyObject* module, PyObject* args, PyObject* kwargs
     return PY_NONE;
 }
 
+PyDoc_STRVAR(f_collectstats_doc, \
+"collectstats(flag)\n\n"
+"Start (flag=1) or stop (flag=0) collecting timing information and\n"
+"counters for the conversion stages. Only output devices created\n"
+"while this is enabled report their timings.\n"
+);
+static PyObject* f_collectstats(PyObject* module, PyObject* args, PyObject* kwargs)
+{
+    static char *kwlist[] = {"flag", NULL};
+    int flag = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|i", kwlist, &flag))
+	return NULL;
+    stats_enable(flag);
+    return PY_NONE;
+}
+
+PyDoc_STRVAR(f_stats_doc, \
+"stats(reset=0)\n\n"
+"Returns the statistics collected since collectstats() was called,\n"
+"as a dictionary {group: {name: {\"count\": ..., \"time\": ..., \"size\": ...}}},\n"
+"e.g. stats()[\"device.swf\"][\"fill\"][\"time\"]. Times are in seconds.\n"
+"If reset is set, all counters are set back to zero afterwards.\n"
+);
+static PyObject* f_stats(PyObject* module, PyObject* args, PyObject* kwargs)
+{
+    static char *kwlist[] = {"reset", NULL};
+    int reset = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|i", kwlist, &reset))
+	return NULL;
+    PyObject*dict = PyDict_New();
+    stat_t*s;
+    for(s=stats_list();s;s=s->next) {
+	if(!s->count)
+	    continue;
+	PyObject*group = PyDict_GetItemString(dict, s->group);
+	if(!group) {
+	    group = PyDict_New();
+	    PyDict_SetItemString(dict, s->group, group);
+	    Py_DECREF(group);
+	}
+	PyObject*entry = PyDict_New();
+	PyObject*v;
+	v = pyint_fromlong(s->count);PyDict_SetItemString(entry, "count", v);Py_DECREF(v);
+	v = PyFloat_FromDouble(s->time);PyDict_SetItemString(entry, "time", v);Py_DECREF(v);
+	v = PyFloat_FromDouble(s->size);PyDict_SetItemString(entry, "size", v);Py_DECREF(v);
+	PyDict_SetItemString(group, s->name, entry);
+	Py_DECREF(entry);
+    }
+    if(reset)
+	stats_reset();
+    return dict;
+}
+
 static PyMethodDef gfx_methods[] =
 {
     /* sources */
@@ -1904,6 +1973,8 @@ static PyMethodDef gfx_methods[] =
     {"addfontdir", (PyCFunction)f_addfontdir, M_FLAGS, f_addfontdir_doc},
     {"setparameter", (PyCFunction)f_setparameter, M_FLAGS, f_setparameter_doc},
     {"verbose", (PyCFunction)f_verbose, M_FLAGS, f_verbose_doc},
+    {"collectstats", (PyCFunction)f_collectstats, M_FLAGS, f_collectstats_doc},
+    {"stats", (PyCFunction)f_stats, M_FLAGS, f_stats_doc},
 
     /* devices */
     {"SWF", (PyCFunction)f_createSWF, M_FLAGS, f_createSWF_doc},
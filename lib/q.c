@@ -25,6 +25,10 @@
 #include <string.h>
 #include <assert.h>
 #include <memory.h>
+#include "../config.h"
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
 #include "mem.h"
 #include "types.h"
 #include "q.h"
@@ -555,13 +559,9 @@ void trie_rollback(trie_t*t)
 
 // ------------------------------- crc32 --------------------------------------
 static unsigned int crc32[256];
-static char crc32_initialized=0;
-static void crc32_init(void)
+static void crc32_fill(void)
 {
     int t;
-    if(crc32_initialized)
-        return;
-    crc32_initialized = 1;
     for(t=0; t<256; t++) {
         unsigned int c = t;
         int s;
@@ -572,15 +572,11 @@ static void crc32_init(void)
     }
 }
 static uint64_t crc64[256];
-static char crc64_initialized=0;
-static void crc64_init(void)
+static void crc64_fill(void)
 {
     int t;
-    if(crc64_initialized)
-        return;
-    crc64_initialized = 1;
     for(t=0; t<256; t++) {
-        unsigned int c = t;
+        uint64_t c = t;
         int s;
         for (s = 0; s < 8; s++) {
           c = ((c&1)?0xC96C5795D7870F42ll:0) ^ (c >> 1);
@@ -588,6 +584,36 @@ static void crc64_init(void)
         crc64[t] = c;
     }
 }
+/* the tables are filled exactly once, even if several threads hash at the same time */
+#ifdef HAVE_PTHREADS
+static pthread_once_t crc32_once = PTHREAD_ONCE_INIT;
+static pthread_once_t crc64_once = PTHREAD_ONCE_INIT;
+static inline void crc32_init(void)
+{
+    pthread_once(&crc32_once, crc32_fill);
+}
+static inline void crc64_init(void)
+{
+    pthread_once(&crc64_once, crc64_fill);
+}
+#else
+static char crc32_initialized=0;
+static char crc64_initialized=0;
+static void crc32_init(void)
+{
+    if(crc32_initialized)
+        return;
+    crc32_fill();
+    crc32_initialized = 1;
+}
+static void crc64_init(void)
+{
+    if(crc64_initialized)
+        return;
+    crc64_fill();
+    crc64_initialized = 1;
+}
+#endif
 // ------------------------------- string_t -----------------------------------
 
 void string_set2(string_t*str, const char*text, int len)
@@ -718,6 +744,17 @@ unsigned int crc32_add_bytes(unsigned int checksum, const void*_s, int len)
     return checksum;
 }
 
+uint64_t crc64_add_bytes(uint64_t checksum, const void*_s, int len)
+{
+    unsigned char*s = (unsigned char*)_s;
+    crc64_init();
+    while(len-- > 0) {
+        checksum = checksum>>8 ^ crc64[(*s^checksum)&0xff];
+        s++;
+    }
+    return checksum;
+}
+
 unsigned int string_hash(const string_t*str)
 {
     int t;
@@ -1065,8 +1102,174 @@ type_t stringstruct_type = {
 
 #define INITIAL_SIZE 1
 
-static int max(int x, int y) {
-    return x>y?x:y;
+/* the slot array is at most 3/4 full */
+#define DICT_FULL(size,used) ((used)*4 >= (size)*3)
+
+typedef struct _dictblock {
+    struct _dictblock*next;
+    dictentry_t entries[0];
+} dictblock_t;
+
+static inline unsigned int hash_mix(unsigned int h)
+{
+    h ^= h >> 16;
+    h *= 0x7feb352d;
+    h ^= h >> 15;
+    return h;
+}
+static inline unsigned int hash_ptr(const void*o)
+{
+    uint64_t v = (uint64_t)(ptroff_t)o * 0x9e3779b97f4a7c15ull;
+    return (unsigned int)(v >> 32);
+}
+static inline unsigned int hash_str(const char*s)
+{
+    if(!s)
+        return 0;
+    unsigned int h = 2166136261u;
+    while(*s) {
+        h = (h ^ (unsigned char)*s++) * 16777619u;
+    }
+    return hash_mix(h);
+}
+/* Pointers, ints and strings are what most dictionaries are keyed by.
+   For those, hash and compare inline instead of calling through key_type.
+   We look at the functions rather than the type itself, since some code
+   (pool.c) uses copies of the standard types. */
+static inline unsigned int dict_hash(dict_t*h, const void*key)
+{
+    hash_func f = h->key_type->hash;
+    if(f == ptr_hash || f == int_hash)
+        return hash_ptr(key);
+    if(f == charptr_hash)
+        return hash_str((const char*)key);
+    return hash_mix(f(key));
+}
+static inline char dict_equals(dict_t*h, const void*k1, const void*k2)
+{
+    equals_func f = h->key_type->equals;
+    if(k1 == k2)
+        return 1;
+    if(f == ptr_equals || f == int_equals)
+        return 0;
+    if(f == charptr_equals)
+        return k1 && k2 && !strcmp((const char*)k1, (const char*)k2);
+    return f(k1, k2);
+}
+static inline void* dict_dupkey(dict_t*h, dictentry_t*e, const void*key)
+{
+    if(h->key_type->key_size) {
+        memcpy(e+1, key, h->key_type->key_size);
+        return e+1;
+    }
+    dup_func f = h->key_type->dup;
+    if(f == ptr_dup || f == int_dup)
+        return (void*)key;
+    return f(key);
+}
+static inline void dict_freekey(dict_t*h, dictentry_t*e)
+{
+    if(!h->key_type->key_size)
+        h->key_type->free(e->key);
+}
+
+/* returns the slot for key, or -1 */
+static inline int dict_find(dict_t*h, const void*key)
+{
+    if(!h->used)
+        return -1;
+    unsigned int hash = dict_hash(h, key);
+    unsigned int mask = h->hashsize-1;
+    unsigned int i = hash & mask;
+    dictentry_t*e;
+    while((e = h->slots[i])) {
+        if(e->hash == hash && dict_equals(h, e->key, key))
+            return i;
+        i = (i+1) & mask;
+    }
+    return -1;
+}
+
+static dictentry_t* dict_new_entry(dict_t*h)
+{
+    if(!h->free_entries) {
+        if(!h->entry_size) {
+            /* inline keys are stored behind the entry, pointer aligned */
+            int key_size = (h->key_type->key_size + sizeof(void*)-1) & ~(sizeof(void*)-1);
+            h->entry_size = sizeof(dictentry_t) + key_size;
+        }
+        int n = h->num < 8 ? 8 : h->num;
+        dictblock_t*b = (dictblock_t*)rfx_alloc(sizeof(dictblock_t) + h->entry_size*n);
+        b->next = (dictblock_t*)h->blocks;
+        h->blocks = b;
+        int t;
+        for(t=0;t<n;t++) {
+            dictentry_t*e = (dictentry_t*)((char*)b->entries + h->entry_size*t);
+            e->next = h->free_entries;
+            h->free_entries = e;
+        }
+    }
+    dictentry_t*e = h->free_entries;
+    h->free_entries = e->next;
+    return e;
+}
+static void dict_free_entry(dict_t*h, dictentry_t*e)
+{
+    memset(e, 0, sizeof(dictentry_t));
+    e->next = h->free_entries;
+    h->free_entries = e;
+}
+
+static void dict_expand(dict_t*h, int newlen)
+{
+    assert(h->hashsize < newlen && !(newlen&(newlen-1)));
+    dictentry_t**newslots = (dictentry_t**)rfx_calloc(sizeof(dictentry_t*)*newlen);
+    unsigned int mask = newlen-1;
+    int t;
+    for(t=0;t<h->hashsize;t++) {
+        dictentry_t*e = h->slots[t];
+        if(e) {
+            unsigned int i = e->hash & mask;
+            while(newslots[i])
+                i = (i+1) & mask;
+            newslots[i] = e;
+        }
+    }
+    if(h->slots)
+        rfx_free(h->slots);
+    h->slots = newslots;
+    h->hashsize = newlen;
+}
+
+/* empty a slot, and move up following entries which would otherwise
+   become unreachable (there are no tombstones) */
+static void dict_remove_slot(dict_t*h, unsigned int i)
+{
+    unsigned int mask = h->hashsize-1;
+    unsigned int j = i;
+    h->slots[i] = 0;
+    while(1) {
+        j = (j+1) & mask;
+        dictentry_t*e = h->slots[j];
+        if(!e)
+            break;
+        unsigned int k = e->hash & mask;
+        /* e may stay where it is if its home slot is cyclically in (i,j] */
+        if(i<=j ? (i<k && k<=j) : (i<k || k<=j))
+            continue;
+        h->slots[i] = e;
+        h->slots[j] = 0;
+        i = j;
+    }
+    h->used--;
+}
+
+static int dict_size_for(int num)
+{
+    int size = 1;
+    while(size < num)
+        size <<= 1;
+    return size;
 }
 
 dict_t*dict_new()
@@ -1084,78 +1287,71 @@ dict_t*dict_new2(type_t*t)
 }
 void dict_init(dict_t*h, int size) 
 {
-    memset(h, 0, sizeof(dict_t));
-    h->hashsize = size;
-    h->slots = h->hashsize?(dictentry_t**)rfx_calloc(sizeof(dictentry_t*)*h->hashsize):0;
-    h->num = 0;
-    h->key_type = &charptr_type;
+    dict_init2(h, &charptr_type, size);
 }
 void dict_init2(dict_t*h, type_t*t, int size) 
 {
     memset(h, 0, sizeof(dict_t));
-    h->hashsize = size;
+    h->hashsize = size>0?dict_size_for(size):0;
     h->slots = h->hashsize?(dictentry_t**)rfx_calloc(sizeof(dictentry_t*)*h->hashsize):0;
-    h->num = 0;
     h->key_type = t;
 }
 
 dict_t*dict_clone(dict_t*o)
 {
     dict_t*h = rfx_alloc(sizeof(dict_t));
-    memcpy(h, o, sizeof(dict_t));
-    h->slots = h->hashsize?(dictentry_t**)rfx_calloc(sizeof(dictentry_t*)*h->hashsize):0;
+    dict_init2(h, o->key_type, o->hashsize);
     int t;
     for(t=0;t<o->hashsize;t++) {
         dictentry_t*e = o->slots[t];
+        dictentry_t**last = &h->slots[t];
         while(e) {
-            dictentry_t*n = (dictentry_t*)rfx_alloc(sizeof(dictentry_t));
-            memcpy(n, e, sizeof(dictentry_t));
-            n->key = h->key_type->dup(e->key);
+            dictentry_t*n = dict_new_entry(h);
+            n->key = dict_dupkey(h, n, e->key);
+            n->hash = e->hash;
             n->data = e->data;
-            n->next = h->slots[t];
-            h->slots[t] = n;
+            n->next = 0;
+            *last = n;
+            last = &n->next;
+            h->num++;
             e = e->next;
         }
+        if(o->slots[t])
+            h->used++;
     }
     return h;
 }
 
-static void dict_expand(dict_t*h, int newlen)
-{
-    assert(h->hashsize < newlen);
-    dictentry_t**newslots = (dictentry_t**)rfx_calloc(sizeof(dictentry_t*)*newlen);
-    int t; 
-    for(t=0;t<h->hashsize;t++) {
-        dictentry_t*e = h->slots[t];
-        while(e) {
-            dictentry_t*next = e->next;
-            unsigned int newhash = e->hash%newlen;
-            e->next = newslots[newhash];
-            newslots[newhash] = e;
-            e = next;
-        }
-    }
-    if(h->slots)
-        rfx_free(h->slots);
-    h->slots = newslots;
-    h->hashsize = newlen;
-}
-
 dictentry_t* dict_put(dict_t*h, const void*key, void* data)
 {
-    unsigned int hash = h->key_type->hash(key);
-    dictentry_t*e = (dictentry_t*)rfx_alloc(sizeof(dictentry_t));
-    
-    if(!h->hashsize)
-        dict_expand(h, 1);
+    unsigned int hash = dict_hash(h, key);
+    if(!h->hashsize || DICT_FULL(h->hashsize, h->used+1)) {
+        int newsize = h->hashsize<8?8:h->hashsize;
+        while(DICT_FULL(newsize, h->used+1))
+            newsize <<= 1;
+        if(newsize > h->hashsize)
+            dict_expand(h, newsize);
+    }
 
-    unsigned int hash2 = hash % h->hashsize;
-    
-    e->key = h->key_type->dup(key);
-    e->hash = hash; //for resizing
-    e->next = h->slots[hash2];
+    dictentry_t*e = dict_new_entry(h);
+    e->key = dict_dupkey(h, e, key);
+    e->hash = hash;
     e->data = data;
-    h->slots[hash2] = e;
+    e->next = 0;
+
+    unsigned int mask = h->hashsize-1;
+    unsigned int i = hash & mask;
+    dictentry_t*old;
+    while((old = h->slots[i])) {
+        if(old->hash == hash && dict_equals(h, old->key, key)) {
+            e->next = old;
+            break;
+        }
+        i = (i+1) & mask;
+    }
+    if(!old)
+        h->used++;
+    h->slots[i] = e;
     h->num++;
     return e;
 }
@@ -1185,133 +1381,64 @@ int dict_count(dict_t*h)
     return h->num;
 }
 
-static inline dictentry_t* dict_do_lookup(dict_t*h, const void*key)
-{
-    if(!h->num) {
-        return 0;
-    }
-    
-    unsigned int ohash = h->key_type->hash(key);
-    unsigned int hash = ohash % h->hashsize;
-
-    /* check first entry for match */
-    dictentry_t*e = h->slots[hash];
-    if(e && h->key_type->equals(e->key, key)) {
-        return e;
-    } else if(e) {
-        e = e->next;
-    }
-
-    /* if dict is 2/3 filled, double the size. Do
-       this the first time we have to actually iterate
-       through a slot to find our data */
-    if(e && h->num*3 >= h->hashsize*2) {
-        int newsize = h->hashsize;
-        while(h->num*3 >= newsize*2) {
-            newsize = newsize<15?15:(newsize+1)*2-1;
-        }
-        dict_expand(h, newsize);
-        hash = ohash % h->hashsize;
-        e = h->slots[hash];
-        if(e && h->key_type->equals(e->key, key)) {
-            // omit move to front
-            return e;
-        } else if(e) {
-            e = e->next;
-        }
-    }
-
-    /* check subsequent entries for a match */
-    dictentry_t*last = h->slots[hash];
-    while(e) {
-        if(h->key_type->equals(e->key, key)) {
-            /* move to front- makes a difference of about 10% in most applications */
-            last->next = e->next;
-            e->next = h->slots[hash];
-            h->slots[hash] = e;
-            return e;
-        }
-        last=e;
-        e = e->next;
-    }
-    return 0;
-}
 void* dict_lookup(dict_t*h, const void*key)
 {
-    dictentry_t*e = dict_do_lookup(h, key);
-    if(e)
-        return e->data;
-    return 0;
+    int i = dict_find(h, key);
+    if(i<0)
+        return 0;
+    return h->slots[i]->data;
 }
 char dict_contains(dict_t*h, const void*key)
 {
-    dictentry_t*e = dict_do_lookup(h, key);
-    return !!e;
+    return dict_find(h, key) >= 0;
 }
 
 char dict_del(dict_t*h, const void*key)
 {
-    if(!h->num)
+    int i = dict_find(h, key);
+    if(i<0)
         return 0;
-    unsigned int hash = h->key_type->hash(key) % h->hashsize;
-    dictentry_t*head = h->slots[hash];
-    dictentry_t*e = head, *prev=0;
-    while(e) {
-        if(h->key_type->equals(e->key, key)) {
-            dictentry_t*next = e->next;
-            h->key_type->free(e->key);
-            memset(e, 0, sizeof(dictentry_t));
-            rfx_free(e);
-            if(e == head) {
-                h->slots[hash] = next;
-            } else {
-                assert(prev);
-                prev->next = next;
-            }
-            h->num--;
-            return 1;
-        }
-        prev = e;
-        e = e->next;
-    }
-    return 0;
+    dictentry_t*e = h->slots[i];
+    if(e->next)
+        h->slots[i] = e->next;
+    else
+        dict_remove_slot(h, i);
+    dict_freekey(h, e);
+    dict_free_entry(h, e);
+    h->num--;
+    return 1;
 }
 
 char dict_del2(dict_t*h, const void*key, void*data)
 {
-    if(!h->num)
+    int i = dict_find(h, key);
+    if(i<0)
         return 0;
-    unsigned int hash = h->key_type->hash(key) % h->hashsize;
-    dictentry_t*head = h->slots[hash];
-    dictentry_t*e = head, *prev=0;
-    while(e) {
-        if(h->key_type->equals(e->key, key) && e->data == data) {
-            dictentry_t*next = e->next;
-            h->key_type->free(e->key);
-            memset(e, 0, sizeof(dictentry_t));
-            rfx_free(e);
-            if(e == head) {
-                h->slots[hash] = next;
-            } else {
-                assert(prev);
-                prev->next = next;
-            }
-            h->num--;
-            return 1;
-        }
-        prev = e;
+    dictentry_t**prev = &h->slots[i];
+    dictentry_t*e = *prev;
+    while(e && e->data != data) {
+        prev = &e->next;
         e = e->next;
     }
-    return 0;
+    if(!e)
+        return 0;
+    if(e == h->slots[i] && !e->next)
+        dict_remove_slot(h, i);
+    else
+        *prev = e->next;
+    dict_freekey(h, e);
+    dict_free_entry(h, e);
+    h->num--;
+    return 1;
 }
 
+/* all entries with the given key, newest first */
 dictentry_t* dict_get_slot(dict_t*h, const void*key)
 {
-    if(!h->num)
+    int i = dict_find(h, key);
+    if(i<0)
         return 0;
-    unsigned int ohash = h->key_type->hash(key);
-    unsigned int hash = ohash % h->hashsize;
-    return h->slots[hash];
+    return h->slots[i];
 }
 
 void dict_foreach_keyvalue(dict_t*h, void (*runFunction)(void*data, const void*key, void*val), void*data)
@@ -1320,7 +1447,6 @@ void dict_foreach_keyvalue(dict_t*h, void (*runFunction)(void*data, const void*k
     for(t=0;t<h->hashsize;t++) {
         dictentry_t*e = h->slots[t];
         while(e) {
-            dictentry_t*next = e->next;
             if(runFunction) {
                 runFunction(data, e->key, e->data);
             }
@@ -1334,7 +1460,6 @@ void dict_foreach_value(dict_t*h, void (*runFunction)(void*))
     for(t=0;t<h->hashsize;t++) {
         dictentry_t*e = h->slots[t];
         while(e) {
-            dictentry_t*next = e->next;
             if(runFunction) {
                 runFunction(e->data);
             }
@@ -1346,23 +1471,28 @@ void dict_foreach_value(dict_t*h, void (*runFunction)(void*))
 void dict_free_all(dict_t*h, char free_keys, void (*free_data_function)(void*))
 {
     int t;
-    for(t=0;t<h->hashsize;t++) {
-        dictentry_t*e = h->slots[t];
-        while(e) {
-            dictentry_t*next = e->next;
-            if(free_keys) {
-                h->key_type->free(e->key);
-            }
-            if(free_data_function) {
-                free_data_function(e->data);
+    if(free_keys || free_data_function) {
+        for(t=0;t<h->hashsize;t++) {
+            dictentry_t*e = h->slots[t];
+            while(e) {
+                if(free_keys) {
+                    dict_freekey(h, e);
+                }
+                if(free_data_function) {
+                    free_data_function(e->data);
+                }
+                e = e->next;
             }
-            memset(e, 0, sizeof(dictentry_t));
-            rfx_free(e);
-            e = next;
         }
-        h->slots[t]=0;
     }
-    rfx_free(h->slots);
+    dictblock_t*b = (dictblock_t*)h->blocks;
+    while(b) {
+        dictblock_t*next = b->next;
+        rfx_free(b);
+        b = next;
+    }
+    if(h->slots)
+        rfx_free(h->slots);
     memset(h, 0, sizeof(dict_t));
 }
 
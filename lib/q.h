@@ -71,6 +71,9 @@ typedef struct _type_t {
     hash_func hash;
     dup_func dup;
     free_func free;
+    /* for small fixed-size keys (e.g. points): if set, dictionaries copy
+       keys into their own entries, instead of calling dup() and free() */
+    int key_size;
 } type_t;
 
 extern type_t charptr_type;
@@ -82,15 +85,24 @@ typedef struct _dictentry {
     void*key;
     unsigned int hash;
     void*data;
-    struct _dictentry*next;
+    struct _dictentry*next; // older entries with the same key
 } dictentry_t;
 
-/* (void*) pointers referenced by strings */
+/* (void*) pointers referenced by strings.
+   This is an open addressing hashtable: slots[] (hashsize is a power of two)
+   holds at most one entry per distinct key. Putting a key a second time
+   doesn't overwrite the existing entry, but hides it behind the new one,
+   in the entry's next chain. Entries are allocated in blocks, which also
+   store the keys if the key type has a key_size. */
 typedef struct _dict {
     dictentry_t**slots;
     type_t*key_type;
     int hashsize;
-    int num;
+    int num;   // number of entries
+    int used;  // number of occupied slots
+    int entry_size;
+    dictentry_t*free_entries;
+    void*blocks;
 } dict_t;
 
 /* array of key/value pairs, with fast lookup */
@@ -156,6 +168,7 @@ float medianf(float*values, int n);
 unsigned int crc32_add_byte(unsigned int crc32, unsigned char b);
 unsigned int crc32_add_string(unsigned int crc32, const char*s);
 unsigned int crc32_add_bytes(unsigned int checksum, const void*s, int len);
+uint64_t crc64_add_bytes(uint64_t checksum, const void*s, int len);
 
 void mem_init(mem_t*mem);
 int mem_put(mem_t*m, void*data, int length);
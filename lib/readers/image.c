@@ -122,7 +122,7 @@ static gfxdocument_t*image_open(gfxsource_t*src, const char*filename)
 {
     gfxdocument_t*image_doc = (gfxdocument_t*)malloc(sizeof(gfxdocument_t));
     memset(image_doc, 0, sizeof(gfxdocument_t));
-    image_doc_internal_t*i= (image_doc_internal_t*)malloc(sizeof(image_doc_internal_t));
+    image_doc_internal_t*i= (image_doc_internal_t*)calloc(1, sizeof(image_doc_internal_t));
     memset(i, 0, sizeof(image_doc_internal_t));
 
     gfxcolor_t*data = 0;
@@ -149,12 +149,19 @@ static gfxdocument_t*image_open(gfxsource_t*src, const char*filename)
     return image_doc;
 }
 
+static void image_destroy(gfxsource_t*src)
+{
+    memset(src, 0, sizeof(*src));
+    free(src);
+}
+
 gfxsource_t*gfxsource_image_create()
 {
     gfxsource_t*src = (gfxsource_t*)malloc(sizeof(gfxsource_t));
     memset(src, 0, sizeof(gfxsource_t));
     src->setparameter = image_setparameter;
     src->open = image_open;
+    src->destroy = image_destroy;
     return src;
 }
 
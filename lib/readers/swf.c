@@ -330,6 +330,8 @@ static void textcallback(void*self, int*chars, int*xpos, int nr, int fontid, int
 static map16_t* extractDefinitions(SWF*swf)
 {
     map16_t*map = map16_new();
+    SWFFONT**swffonts = 0;
+    int num_swffonts = swf_FontExtractAll(swf, &swffonts);
     TAG*tag = swf->firstTag;
     while(tag)
     {
@@ -361,9 +363,8 @@ static map16_t* extractDefinitions(SWF*swf)
 		tag->id == ST_DEFINEFONT2 ||
 		tag->id == ST_DEFINEFONT3) {
 	    character_t*c = rfx_calloc(sizeof(character_t));
-	    SWFFONT*swffont = 0;
+	    SWFFONT*swffont = swf_FontFindID(swffonts, num_swffonts, id);
 	    font_t*font = (font_t*)rfx_calloc(sizeof(font_t));
-	    swf_FontExtract(swf, id, &swffont);
             font->numchars = swffont->numchars;
             font->glyphs = (gfxline_t**)rfx_calloc(sizeof(gfxline_t*)*font->numchars);
             int t;
@@ -380,7 +381,6 @@ static map16_t* extractDefinitions(SWF*swf)
 		}
                 swf_Shape2Free(s2);
             }
-            swf_FontFree(swffont);
 
 	    c->tag = tag;
 	    c->type = TYPE_FONT;
@@ -412,6 +412,7 @@ static map16_t* extractDefinitions(SWF*swf)
 
 	tag = tag->next;
     }
+    swf_FontFreeAll(swffonts, num_swffonts);
     return map;
 }
 
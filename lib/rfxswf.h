@@ -633,6 +633,11 @@ int swf_FontEnumerate(SWF * swf,void (*FontCallback) (void*,U16,U8*), void*self)
 int swf_FontExtract(SWF * swf,int id,SWFFONT ** f);
 // Fetches all available information from DefineFont, DefineFontInfo, DefineText, ...
 // id = FontID, id=0 -> Extract first Font
+int swf_FontExtractAll(SWF * swf, SWFFONT *** fonts);
+// Extracts all fonts in a single pass over the tags, and returns their number.
+// *fonts is set to an array of the fonts, sorted by id. Free with swf_FontFreeAll.
+SWFFONT* swf_FontFindID(SWFFONT ** fonts, int num, int id);
+void swf_FontFreeAll(SWFFONT ** fonts, int num);
 int swf_FontExtract_DefineFont2(int id, SWFFONT * font, TAG * tag);
 int swf_FontExtract_DefineFontInfo(int id, SWFFONT * f, TAG * t);
 int swf_FontExtract_DefineFont(int id, SWFFONT * f, TAG * t);
@@ -695,10 +700,21 @@ void swf_DrawText(drawer_t*draw, SWFFONT*font, int size, const char*text);
 
 // swffont.c
 
+typedef struct _SWFLOADFONTPARAMS
+{
+    int scale;          // glyph outlines are loaded at 16*scale pixels
+    int skip_unused;    // drop glyphs which have neither a unicode index nor a name
+    int full_unicode;   // map all of unicode, not just the first 256 characters
+} SWFLOADFONTPARAMS;
+
 SWFFONT* swf_LoadTrueTypeFont(const char*filename, char flashtype);
 SWFFONT* swf_LoadT1Font(const char*filename);
 SWFFONT* swf_LoadFont(const char*filename, char flashtype);
 
+// these don't depend on swf_SetLoadFontParameters(), and are safe to call from several threads
+SWFFONT* swf_LoadTrueTypeFont2(const char*filename, char flashtype, const SWFLOADFONTPARAMS*params);
+SWFFONT* swf_LoadFont2(const char*filename, char flashtype, const SWFLOADFONTPARAMS*params);
+
 void swf_SetLoadFontParameters(int scale, int skip_unused, int full_unicode);
 
 // swfdump.c
@@ -749,13 +765,36 @@ RGBA* swf_ExtractImage(TAG*tag, int*dwidth, int*dheight);
 TAG* swf_AddImage(TAG*tag, int bitid, RGBA*mem, int width, int height, int quality);
 
 // swfsound.c
+typedef struct _SOUNDENCODER
+{
+    int in_samplerate;
+    int out_samplerate;
+    int bitrate;
+    int blocksize; // number of (input) samples per block
+    int framesize; // number of (output) samples per mp3 frame
+    void*internal;
+} SOUNDENCODER;
+
+SOUNDENCODER* swf_SoundEncoderNew(int in_samplerate, int out_samplerate, int bitrate);
+void swf_SoundEncoderFree(SOUNDENCODER*enc);
+void swf_SetSoundStreamHead2(TAG*tag, SOUNDENCODER*enc, int avgnumsamples);
+void swf_SetSoundStreamBlock2(TAG*tag, SOUNDENCODER*enc, S16*samples, int seek, char first); /* expects enc->blocksize samples */
+/* encode numblocks blocks of enc->blocksize samples each, splitting them into up
+   to num_threads segments which are encoded in parallel. data[t] (allocated with
+   rfx_alloc) and len[t] receive the mp3 data of block t. */
+void swf_SoundEncodeBlocks(SOUNDENCODER*enc, S16*samples, int numblocks, U8**data, int*len, int num_threads);
+
+/* the following use a global encoder, configured with the swf_mp3_* variables */
 void swf_SetSoundStreamHead(TAG*tag, int avgnumsamples);
 void swf_SetSoundStreamBlock(TAG*tag, S16*samples, int seek, char first); /* expects 2304 samples */
+void swf_SetSoundStreamEnd(TAG*tag);
 void swf_SetSoundDefine(TAG*tag, S16*samples, int num);
 void swf_SetSoundDefineMP3(TAG*tag, U8* data, unsigned length,
                            unsigned SampRate,
                            unsigned Channels,
                            unsigned NumFrames);
+void swf_SetSoundStreamHeadMP3(TAG*tag, unsigned SampRate, unsigned Channels, int avgnumsamples);
+void swf_SetSoundStreamBlockMP3(TAG*tag, U8*data, unsigned length, unsigned numsamples, int seek);
 void swf_SetSoundInfo(TAG*tag, SOUNDINFO*info);
 
 // swftools.c
@@ -1018,6 +1057,7 @@ typedef struct _VIDEOSTREAM
 
     /* modifyable: */
     int do_motion; //enable motion compensation (slow!)
+    int fast_motion; //use a fast (SAD based) motion search instead of the exhaustive one
 
 } VIDEOSTREAM;
 
@@ -0,0 +1,191 @@
+/* stats.c
+   Counters and timers for finding out where conversion time goes.
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../config.h"
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+#include "stats.h"
+
+int stats_enabled = 0;
+
+static stat_t*first = 0;
+static stat_t*last = 0;
+
+/* counters are updated from the image encoding threads, too */
+#ifdef HAVE_PTHREADS
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define STATS_LOCK() pthread_mutex_lock(&stats_mutex)
+#define STATS_UNLOCK() pthread_mutex_unlock(&stats_mutex)
+#else
+#define STATS_LOCK()
+#define STATS_UNLOCK()
+#endif
+
+void stats_enable(int enable)
+{
+    stats_enabled = enable;
+}
+
+double stats_time()
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec*1e-9;
+#elif defined(HAVE_SYS_TIME_H)
+    struct timeval t;
+    gettimeofday(&t, 0);
+    return t.tv_sec + t.tv_usec*1e-6;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static void stats_register(stat_t*stat)
+{
+    stat->registered = 1;
+    stat->next = 0;
+    if(last)
+	last->next = stat;
+    else
+	first = stat;
+    last = stat;
+}
+
+void stats_add(stat_t*stat, long count, double size, double time)
+{
+    STATS_LOCK();
+    if(!stat->registered)
+	stats_register(stat);
+    stat->count += count;
+    stat->size += size;
+    stat->time += time;
+    STATS_UNLOCK();
+}
+
+stat_t* stats_get(const char*group, const char*name)
+{
+    STATS_LOCK();
+    stat_t*s;
+    for(s=first;s;s=s->next) {
+	if(!strcmp(s->group, group) && !strcmp(s->name, name))
+	    break;
+    }
+    if(!s) {
+	s = (stat_t*)calloc(1, sizeof(stat_t));
+	s->group = strdup(group);
+	s->name = strdup(name);
+	stats_register(s);
+    }
+    STATS_UNLOCK();
+    return s;
+}
+
+void stats_reset()
+{
+    STATS_LOCK();
+    stat_t*s;
+    for(s=first;s;s=s->next) {
+	s->count = 0;
+	s->size = 0;
+	s->time = 0;
+    }
+    STATS_UNLOCK();
+}
+
+stat_t* stats_list()
+{
+    return first;
+}
+
+static void write_string(FILE*fi, const char*s)
+{
+    fputc('"', fi);
+    for(;*s;s++) {
+	if(*s=='"' || *s=='\\')
+	    fputc('\\', fi);
+	if((unsigned char)*s >= 32)
+	    fputc(*s, fi);
+    }
+    fputc('"', fi);
+}
+
+void stats_write_json(FILE*fi)
+{
+    STATS_LOCK();
+    stat_t*s,*s2;
+    int groups = 0;
+    fprintf(fi, "{");
+    for(s=first;s;s=s->next) {
+	if(!s->count)
+	    continue;
+	/* every group is written when we encounter its first counter */
+	for(s2=first;s2!=s;s2=s2->next) {
+	    if(s2->count && !strcmp(s2->group, s->group))
+		break;
+	}
+	if(s2!=s)
+	    continue;
+	fprintf(fi, "%s\n  ", groups++?",":"");
+	write_string(fi, s->group);
+	fprintf(fi, ": {");
+	int num = 0;
+	for(s2=s;s2;s2=s2->next) {
+	    if(!s2->count || strcmp(s2->group, s->group))
+		continue;
+	    fprintf(fi, "%s\n    ", num++?",":"");
+	    write_string(fi, s2->name);
+	    fprintf(fi, ": {\"count\": %ld, \"time\": %.6f", s2->count, s2->time);
+	    if(s2->size)
+		fprintf(fi, ", \"size\": %.0f", s2->size);
+	    fprintf(fi, "}");
+	}
+	fprintf(fi, "\n  }");
+    }
+    fprintf(fi, "\n}\n");
+    STATS_UNLOCK();
+}
+
+int stats_save_json(const char*filename)
+{
+    FILE*fi;
+    if(!strcmp(filename, "-")) {
+	stats_write_json(stdout);
+	fflush(stdout);
+	return 0;
+    }
+    fi = fopen(filename, "wb");
+    if(!fi) {
+	perror(filename);
+	return -1;
+    }
+    stats_write_json(fi);
+    fclose(fi);
+    return 0;
+}
@@ -0,0 +1,85 @@
+/* stats.h
+   Counters and timers for finding out where conversion time goes.
+
+   Part of the swftools package.
+
+   Copyright (c) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#ifndef __stats_h__
+#define __stats_h__
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A counter records how often something happened, how long it took in total,
+   and an optional size (bytes written, polygon edges, ...).
+   Counters are declared as statics next to the code they measure, and add
+   themselves to a global list the first time they're used. */
+typedef struct _stat
+{
+    const char*group;
+    const char*name;
+    long count;
+    double size;
+    double time;
+    char registered;
+    struct _stat*next;
+} stat_t;
+
+#define STAT(var,group,name) static stat_t var = {group, name, 0, 0, 0, 0, 0}
+
+/* Recording is off by default. Code being measured checks this flag first,
+   so that disabled statistics only cost a branch:
+
+       STAT(s_fill, "device.swf", "fill");
+       double start = stats_enabled?stats_time():0;
+       ...
+       if(stats_enabled) stats_add(&s_fill, 1, 0, stats_time()-start);
+ */
+extern int stats_enabled;
+
+void stats_enable(int enable);
+
+/* a monotonic clock, in seconds */
+double stats_time();
+
+/* add count events, which took the given time (in seconds) */
+void stats_add(stat_t*stat, long count, double size, double time);
+
+/* find or create a counter with a group or name only known at runtime
+   (e.g. the name of a device). Such counters are never freed. */
+stat_t* stats_get(const char*group, const char*name);
+
+/* reset all counters to zero */
+void stats_reset();
+
+/* the list of all counters which have been used so far */
+stat_t* stats_list();
+
+/* write all counters which have counted anything as JSON object, grouped by group:
+   {"group": {"name": {"count": 1, "time": 0.5, "size": 100}, ...}, ...} */
+void stats_write_json(FILE*fi);
+int stats_save_json(const char*filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__stats_h__
@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 int writeUTF8(unsigned int charnum, char*dest);
+/* returns a static buffer- use writeUTF8() in code that may run in threads */
 char* getUTF8(unsigned int charnum);
 
 #ifdef __cplusplus
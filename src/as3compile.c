@@ -28,6 +28,7 @@
 #include "../lib/args.h"
 #include "../lib/q.h"
 #include "../lib/os.h"
+#include "../lib/as3/builtin.h"
 
 static char * filename = 0;
 static char * outputname = 0;
@@ -41,6 +42,10 @@ static int verbose = 1;
 static char local_with_networking = 0;
 static char local_with_filesystem = 0;
 static char*mainclass = 0;
+static char*cachename = 0;
+static char**libraries = 0;
+static int num_libraries = 0;
+static mem_t cache_options;
 
 static struct options_t options[] = {
 {"h", "help"},
@@ -49,6 +54,7 @@ static struct options_t options[] = {
 {"q", "quiet"},
 {"C", "cgi"},
 {"R", "resolve"},
+{"O", "optimize"},
 {"D", "define"},
 {"X", "width"},
 {"Y", "height"},
@@ -60,10 +66,11 @@ static struct options_t options[] = {
 {"L", "local-with-filesystem"},
 {"T", "flashversion"},
 {"o", "output"},
+{"c", "cache"},
 {0,0}
 };
 
-int args_callback_option(char*name,char*val)
+static int handle_option(char*name,char*val)
 {
     if(!strcmp(name, "V")) {
         printf("swfc - part of %s %s\n", PACKAGE, VERSION);
@@ -107,7 +114,13 @@ int args_callback_option(char*name,char*val)
 	return 0;
     }
     else if(!strcmp(name, "l")) {
-        as3_import_file(val);
+        /* imported after we know whether the build cache is up to date */
+        libraries = rfx_realloc(libraries, sizeof(char*)*(num_libraries+1));
+        libraries[num_libraries++] = val;
+	return 1;
+    }
+    else if(!strcmp(name, "c")) {
+        cachename = val;
 	return 1;
     }
     else if(!strcmp(name, "I")) {
@@ -118,6 +131,10 @@ int args_callback_option(char*name,char*val)
         as3_set_option("recurse","1");
 	return 0;
     }
+    else if(!strcmp(name, "O")) {
+        as3_set_option("optimize","1");
+	return 0;
+    }
     else if(!strcmp(name, "D")) {
         if(!strstr(val, "::")) {
             fprintf(stderr, "Error: compile definition must contain \"::\"\n");
@@ -142,6 +159,21 @@ int args_callback_option(char*name,char*val)
     }
     return 0;
 }
+int args_callback_option(char*name,char*val)
+{
+    int ret = handle_option(name, val);
+    if(!strchr("VovqcC", name[0])) {
+        /* all options which influence the generated SWF */
+        mem_put(&cache_options, "opt ", 4);
+        mem_put(&cache_options, name, strlen(name));
+        if(ret) {
+            mem_put(&cache_options, " ", 1);
+            mem_put(&cache_options, val, strlen(val));
+        }
+        mem_put(&cache_options, "\n", 1);
+    }
+    return ret;
+}
 int args_callback_longoption(char*name,char*val)
 {
     return args_long2shortoption(options, name, val);
@@ -157,6 +189,7 @@ void args_callback_usage(char *name)
     printf("-q , --quiet                   Decrease verbosity\n");
     printf("-C , --cgi                     Output to stdout (for use in CGI environments)\n");
     printf("-R , --resolve                 Try to resolve undefined classes automatically.\n");
+    printf("-O , --optimize                Optimize the generated bytecode\n");
     printf("-D , --define <namespace::variable>    Set a compile time variable (for doing conditional compilation)\n");
     printf("-X , --width                   Set target SWF width\n");
     printf("-Y , --height                  Set target SWF width\n");
@@ -168,6 +201,7 @@ void args_callback_usage(char *name)
     printf("-L , --local-with-filesystem     Make output file \"local with filesystem\"\n");
     printf("-T , --flashversion <num>      Set target SWF flash version to <num>.\n");
     printf("-o , --output <filename>       Set output file to <filename>.\n");
+    printf("-c , --cache <file>            Reuse the output of the last run if no input file changed since then.\n");
     printf("\n");
 }
 int args_callback_command(char*name,char*val)
@@ -204,6 +238,155 @@ void writeSWF(SWF*swf)
     }
 }
 
+/* The build cache remembers the options, the current directory and the
+   state of every file and directory the compiler looked at (including the
+   places where it searched for files that didn't exist), together with the
+   resulting SWF. If none of these changed, compiling again would produce the
+   same output, so we write the cached SWF instead. The state of a file is
+   the checksum of the bytes the compiler read from it. If anything changed,
+   everything is compiled again; there's no caching of individual files. */
+
+static void cache_add_dependency(void*data, const char*path, uint64_t state)
+{
+    mem_t*m = (mem_t*)data;
+    char buf[32];
+    sprintf(buf, "dep %016llx ", (unsigned long long)state);
+    mem_put(m, buf, strlen(buf));
+    mem_put(m, (void*)path, strlen(path));
+    mem_put(m, "\n", 1);
+}
+
+static uint64_t hash_slot(uint64_t h, slotinfo_t*s)
+{
+    /* compiling marks slots as used, so leave that flag out */
+    U8 head[4] = {s->kind, s->subtype, s->flags&~FLAG_USED, s->access};
+    h = crc64_add_bytes(h, head, 4);
+    if(s->package)
+        h = crc64_add_bytes(h, s->package, strlen(s->package)+1);
+    if(s->name)
+        h = crc64_add_bytes(h, s->name, strlen(s->name)+1);
+    if(s->kind == INFOTYPE_VAR || s->kind == INFOTYPE_METHOD) {
+        classinfo_t*type = ((memberinfo_t*)s)->type;
+        if(type && type->name)
+            h = crc64_add_bytes(h, type->name, strlen(type->name)+1);
+    }
+    return h;
+}
+
+/* A different compiler build may compile the same sources differently,
+   so the cache is only valid for the build that wrote it. The builtin
+   library is identified by a checksum of its classes and members, the
+   code generator (where we can find the executable) by a checksum of
+   the executable. */
+static uint64_t build_id()
+{
+    static uint64_t id = 0;
+    if(id)
+        return id;
+    int num = 0, t;
+    const builtin_t*b = builtin_getclasses(&num);
+    for(t=0;t<num;t++) {
+        slotinfo_t*const*m;
+        id = hash_slot(id, b[t].slot);
+        for(m=b[t].members;m && *m;m++)
+            id = hash_slot(id, *m);
+        for(m=b[t].static_members;m && *m;m++)
+            id = hash_slot(id, *m);
+    }
+#ifdef __linux__
+    id ^= as3_path_state("/proc/self/exe");
+#endif
+    return id?id:1;
+}
+
+static void cache_key(mem_t*m, const char*currentdir)
+{
+    char buf[80];
+    sprintf(buf, "as3compile cache 2 %s %016llx\n", VERSION, (unsigned long long)build_id());
+    mem_put(m, buf, strlen(buf));
+    mem_put(m, cache_options.buffer, cache_options.pos);
+    mem_put(m, "file ", 5);
+    mem_put(m, filename, strlen(filename));
+    mem_put(m, "\ncwd ", 5);
+    if(currentdir)
+        mem_put(m, (void*)currentdir, strlen(currentdir));
+    mem_put(m, "\n", 1);
+}
+
+static char read_cache(SWF*swf, const char*currentdir)
+{
+    FILE*fi = fopen(cachename, "rb");
+    if(!fi)
+        return 0;
+    fseek(fi, 0, SEEK_END);
+    int size = ftell(fi);
+    fseek(fi, 0, SEEK_SET);
+    char*data = rfx_alloc(size+1);
+    int len = fread(data, 1, size, fi);
+    fclose(fi);
+    data[len] = 0;
+
+    mem_t key;
+    mem_init(&key);
+    cache_key(&key, currentdir);
+    char ok = len >= key.pos && !memcmp(data, key.buffer, key.pos);
+    char*p = data + key.pos;
+    mem_clear(&key);
+
+    while(ok && !strncmp(p, "dep ", 4)) {
+        char*end = strchr(p, '\n');
+        if(!end || end-p < 22) {
+            ok = 0;
+            break;
+        }
+        *end = 0;
+        unsigned long long state = strtoull(p+4, 0, 16);
+        if(state != as3_path_state(p+21))
+            ok = 0;
+        p = end+1;
+    }
+    int swflen = 0;
+    if(ok && (sscanf(p, "swf %d\n", &swflen)!=1 || !(p = strchr(p, '\n'))
+                                                 || data+len-(p+1) != swflen)) {
+        ok = 0;
+    }
+    if(ok) {
+        reader_t r;
+        reader_init_memreader(&r, p+1, swflen);
+        memset(swf, 0, sizeof(SWF));
+        ok = swf_ReadSWF2(&r, swf) >= 0;
+        r.dealloc(&r);
+    }
+    rfx_free(data);
+    return ok;
+}
+
+static void write_cache(SWF*swf, const char*currentdir)
+{
+    mem_t m;
+    mem_init(&m);
+    cache_key(&m, currentdir);
+    as3_getdependencies(cache_add_dependency, &m);
+
+    writer_t w;
+    writer_init_growingmemwriter(&w, 65536);
+    int swflen = swf_WriteSWF2(&w, swf);
+    FILE*fi = fopen(cachename, "wb");
+    if(!fi || swflen<0) {
+        fprintf(stderr, "couldn't write cache file %s\n", cachename);
+    } else {
+        char buf[32];
+        sprintf(buf, "swf %d\n", swflen);
+        mem_put(&m, buf, strlen(buf));
+        fwrite(m.buffer, m.pos, 1, fi);
+        fwrite(writer_growmemwrite_memptr(&w, 0), swflen, 1, fi);
+    }
+    if(fi)
+        fclose(fi);
+    w.finish(&w);
+    mem_clear(&m);
+}
+
 int main (int argc,char ** argv)
 {
     char buf[512];
@@ -227,6 +410,18 @@ int main (int argc,char ** argv)
         //as3_warning("output name not given, writing to %s", outputname);
     }
 
+    SWF swf;
+    if(cachename && read_cache(&swf, currentdir)) {
+        if(verbose>1)
+            fprintf(stderr, "nothing changed, using %s\n", cachename);
+        writeSWF(&swf);
+        swf_FreeTags(&swf);
+        return 0;
+    }
+
+    for(t=0;t<num_libraries;t++)
+        as3_import_file(libraries[t]);
+
     if(!strcmp(filename, ".")) {
         as3_parse_directory(".");
     } else {
@@ -235,7 +430,6 @@ int main (int argc,char ** argv)
 
     void*code = as3_getcode();
 
-    SWF swf;
     memset(&swf, 0, sizeof(swf));
     swf.fileVersion = flashversion;
     swf.frameRate = framerate*0x100;
@@ -269,6 +463,8 @@ int main (int argc,char ** argv)
     if(local_with_networking)
         swf.fileAttributes |= FILEATTRIBUTE_USENETWORK;
 
+    if(cachename)
+        write_cache(&swf, currentdir);
     writeSWF(&swf);
     swf_FreeTags(&swf);
 
@@ -41,10 +41,12 @@
 #endif
 #include "../../swftools/lib/devices/rescale.h"
 #include "../../swftools/lib/devices/record.h"
+#include "../../swftools/lib/devices/stats.h"
 #include "../../swftools/lib/readers/image.h"
 #include "../../swftools/lib/readers/swf.h"
 #include "../../swftools/lib/pdf/pdf.h"
 #include "../../swftools/lib/log.h"
+#include "../../swftools/lib/stats.h"
 
 static gfxsource_t*driver = 0;
 
@@ -54,6 +56,7 @@ static char * maxdpi = "72";
 static char * pagerange = 0;
 static char * filename = 0;
 static const char * format = 0;
+static char * statsfile = 0;
 
 int args_callback_option(char*name,char*val) {
     if (!strcmp(name, "o"))
@@ -83,6 +86,12 @@ int args_callback_option(char*name,char*val) {
 	maxdpi = val;
 	return 1;
     }
+    else if (!strcmp(name, "st"))
+    {
+	statsfile = val;
+	stats_enable(1);
+	return 1;
+    }
     else if (name[0]=='p')
     {
 	do {
@@ -134,6 +143,7 @@ struct options_t options[] =
  {"s","set"},
  {"r","resolution"},
  {"p","pages"},
+ {"st","stats"},
  {0,0}
 };
 
@@ -272,6 +282,12 @@ int main(int argn, char *argv[])
 	    msg("<error> Invalid output format: %s", format);
 	    exit(1);
 	}
+
+	gfxdevice_t stats;
+	if(statsfile) {
+	    gfxdevice_stats_init(&stats, out);
+	    out = &stats;
+	}
 	    
 	out->setparameter(out, "maxdpi", maxdpi);
 
@@ -299,6 +315,10 @@ int main(int argn, char *argv[])
     doc->destroy(doc);
 
     driver->destroy(driver);
+
+    if(statsfile && stats_save_json(statsfile) < 0) {
+	exit(1);
+    }
     return 0;
 }
 
@@ -44,9 +44,11 @@
 #include "../lib/devices/polyops.h"
 #include "../lib/devices/record.h"
 #include "../lib/devices/rescale.h"
+#include "../lib/devices/stats.h"
 #include "../lib/gfxfilter.h"
 #include "../lib/pdf/pdf.h"
 #include "../lib/log.h"
+#include "../lib/stats.h"
 
 #define SWFDIR concatPaths(getInstallationPath(), "swfs")
 
@@ -75,6 +77,8 @@ static int flatten = 0;
 
 static char* filters = 0;
 
+static char* statsfile = 0;
+
 char* fontpaths[256];
 int fontpathpos = 0;
 
@@ -352,6 +356,12 @@ int args_callback_option(char*name,char*val) {
 	}
 	return 1;
     }
+    else if (!strcmp(name, "st"))
+    {
+	statsfile = val;
+	stats_enable(1);
+	return 1;
+    }
     else if (!strcmp(name, "w"))
     {
 	store_parameter("linksopennewwindow", "0");
@@ -485,6 +495,7 @@ static struct options_t options[] = {
 {"Q", "maxtime"},
 {"X", "width"},
 {"Y", "height"},
+{"st", "stats"},
 {0,0}
 };
 
@@ -536,6 +547,7 @@ void args_callback_usage(char *name)
     printf("-G , --flatten                 Remove as many clip layers from file as possible. \n");
     printf("-I , --info                    Don't do actual conversion, just display a list of all pages in the PDF.\n");
     printf("-Q , --maxtime n               Abort conversion after n seconds. Only available on Unix.\n");
+    printf("     --stats file.json         Write timing and counters for the conversion stages to file.json (- for stdout).\n");
     printf("\n");
 }
 
@@ -589,7 +601,7 @@ void show_info(gfxsource_t*driver, char*filename)
 }
 
 
-static gfxdevice_t swf,wrap,rescale;
+static gfxdevice_t swf,stats,wrap,rescale;
 gfxdevice_t*create_output_device()
 {
     gfxdevice_swf_init(&swf);
@@ -597,8 +609,12 @@ gfxdevice_t*create_output_device()
     /* set up filter chain */
 	
     out = &swf;
+    if(statsfile) {
+        gfxdevice_stats_init(&stats, &swf);
+        out = &stats;
+    }
     if(flatten) {
-        gfxdevice_removeclippings_init(&wrap, &swf);
+        gfxdevice_removeclippings_init(&wrap, out);
         out = &wrap;
     }
 
@@ -921,6 +937,10 @@ int main(int argn, char *argv[])
 	free(filters);
     }
 
+    if(statsfile && stats_save_json(statsfile) < 0) {
+	exit(1);
+    }
+
     return 0;
 }
 
@@ -215,21 +215,6 @@ MATRIX getmatrix(TAG*tag)
 
 static int fontnum = -1;
 static SWFFONT**fonts;
-static SWF*c_swf;
-static void fontcallback1(void*self, U16 id,U8 * name)
-{ fontnum++;
-}
-static void fontcallback2(void*self, U16 id,U8 * name)
-{ 
-    fonts[fontnum] = 0;
-    swf_FontExtract(c_swf,id,&fonts[fontnum]);
-    if(verbose) {
-	if(fonts[fontnum]) printf("Extracting font %d (%s)\n", id, name);
-	else		   printf("Extracting font %d (%s) failed\n", id, name);
-	fflush(stdout);
-    }
-    fontnum++;
-}
 typedef struct _textbounds
 {
     SRECT r;
@@ -359,14 +344,8 @@ static void textcallback(void*self, int*chars, int*xpos, int nr, int fontid, int
 		    int xstart, int ystart, RGBA* color)
 {
     textbounds_t * bounds = (textbounds_t*)self;
-    SWFFONT*font = 0;
+    SWFFONT*font = swf_FontFindID(fonts, fontnum, fontid);
     int t;
-    for(t=0;t<fontnum;t++) {
-	if(fonts[t]->id == fontid) {
-	    font = fonts[t];
-	    break;
-	}
-    }
     if(!font) {
 	fprintf(stderr, "Font %d unknown\n", fontid);
 	exit(1);
@@ -453,13 +432,8 @@ static void swf_OptimizeBoundingBoxes(SWF*swf)
 	    if(verbose) printf("%s\n", swf_TagGetName(tag));
 	    if(fontnum < 0) {
 		if(verbose) printf("Extracting fonts...\n");
-		c_swf = swf;
-		fontnum = 0;
-		swf_FontEnumerate(swf,&fontcallback1,0);
-		fonts = (SWFFONT**)malloc(fontnum*sizeof(SWFFONT*));
-		memset(fonts, 0, fontnum*sizeof(SWFFONT*));
-		fontnum = 0;
-		swf_FontEnumerate(swf,&fontcallback2,0);
+		fontnum = swf_FontExtractAll(swf, &fonts);
+		if(verbose) printf("Extracted %d fonts\n", fontnum);
 	    }
 
 	    memset(&bounds, 0, sizeof(bounds));
@@ -400,28 +400,22 @@ static SWFFONT**fonts;
 
 void textcallback(void*self, int*glyphs, int*xpos, int nr, int fontid, int fontsize, int startx, int starty, RGBA*color) 
 {
-    int font=-1,t;
+    int t;
     if(nr<1) 
 	return;
     printf("                <%2d glyphs in font %04d size %d, color #%02x%02x%02x%02x at %.2f,%.2f> ",nr, fontid, fontsize, color->r, color->g, color->b, color->a, (startx+xpos[0])/20.0, starty/20.0);
-    for(t=0;t<fontnum;t++)
-    {
-	if(fonts[t]->id == fontid) {
-	    font = t;
-	    break;
-	}
-    }
+    SWFFONT*font = swf_FontFindID(fonts, fontnum, fontid);
 
     for(t=0;t<nr;t++)
     {
 	unsigned int a;
-	if(font>=0) {
-	    if(glyphs[t] >= fonts[font]->numchars  /*glyph is in range*/
-		    || !fonts[font]->glyph2ascii /* font has ascii<->glyph mapping */
+	if(font) {
+	    if(glyphs[t] >= font->numchars  /*glyph is in range*/
+		    || !font->glyph2ascii /* font has ascii<->glyph mapping */
 	      ) a = glyphs[t];
 	    else {
-		if(fonts[font]->glyph2ascii[glyphs[t]])
-		    a = fonts[font]->glyph2ascii[glyphs[t]];
+		if(font->glyph2ascii[glyphs[t]])
+		    a = font->glyph2ascii[glyphs[t]];
 		else
 		    a = glyphs[t];
 	    }
@@ -932,16 +926,6 @@ void handleShape(TAG*tag, char*prefix)
     printf("%s |\n", prefix);
 }
     
-void fontcallback1(void*self, U16 id,U8 * name)
-{ fontnum++;
-}
-
-void fontcallback2(void*self, U16 id,U8 * name)
-{ 
-  swf_FontExtract(&swf,id,&fonts[fontnum]);
-  fontnum++;
-}
-
 static U8 printable(U8 a)
 {
     if(a<32 || a==127) return '.';
@@ -1289,11 +1273,7 @@ int main (int argc,char ** argv)
     tag = swf.firstTag;
    
     if(showtext) {
-	fontnum = 0;
-	swf_FontEnumerate(&swf,&fontcallback1, 0);
-	fonts = (SWFFONT**)malloc(fontnum*sizeof(SWFFONT*));
-	fontnum = 0;
-	swf_FontEnumerate(&swf,&fontcallback2, 0);
+	fontnum = swf_FontExtractAll(&swf, &fonts);
     }
 
     while(tag) {
@@ -11,6 +11,8 @@
 #include "../lib/readers/swf.h"
 #include "../lib/devices/render.h"
 #include "../lib/devices/rescale.h"
+#include "../lib/devices/stats.h"
+#include "../lib/stats.h"
 
 static struct options_t options[] = {
 {"h", "help"},
@@ -21,6 +23,7 @@ static struct options_t options[] = {
 {"V", "version"},
 {"X", "width"},
 {"Y", "height"},
+{"st", "stats"},
 {0,0}
 };
 
@@ -34,6 +37,8 @@ static int width = 0;
 static int height = 0;
 static int resolution = 0;
 
+static char*statsfile = 0;
+
 typedef struct _parameter {
     const char*name;
     const char*value;
@@ -88,6 +93,10 @@ int args_callback_option(char*name,char*val)
     } else if(!strcmp(name, "Y")) {
 	height = atoi(val);
 	return 1;
+    } else if(!strcmp(name, "st")) {
+	statsfile = val;
+	stats_enable(1);
+	return 1;
     } else {
         printf("Unknown option: -%s\n", name);
 	exit(1);
@@ -111,6 +120,7 @@ void args_callback_usage(char *name)
     printf("-r , --resolution dpi          Scale width and height to a specific DPI resolution, assuming input is 1px per pt (default: 72)\n");
     printf("-X , --width width             Scale output to specific width (proportional unless height specified)\n");
     printf("-Y , --height height           Scale output to specific height (proportional unless width specified)\n");
+    printf("     --stats file.json         Write timing and counters for the rendering stages to file.json (- for stdout)\n");
     printf("\n");
 }
 int args_callback_command(char*name,char*val)
@@ -124,6 +134,8 @@ int args_callback_command(char*name,char*val)
 }
 
 
+STAT(stat_render, "swfrender", "render");
+STAT(stat_save, "swfrender", "save");
 
 int main(int argn, char*argv[])
 {
@@ -157,12 +169,20 @@ int main(int argn, char*argv[])
         RENDERBUF buf;
         swf_Render_Init(&buf, 0,0, (swf.movieSize.xmax - swf.movieSize.xmin) / 20,
                        (swf.movieSize.ymax - swf.movieSize.ymin) / 20, 2, 1);
+        double start = stats_enabled?stats_time():0;
         swf_RenderSWF(&buf, &swf);
         RGBA* img = swf_Render(&buf);
+        if(stats_enabled) {
+            double now = stats_time();
+            stats_add(&stat_render, 1, 0, now-start);
+            start = now;
+        }
             if(quantize)
             png_write_palette_based_2(outputname, (unsigned char*)img, buf.width, buf.height);
             else
             png_write(outputname, (unsigned char*)img, buf.width, buf.height);
+        if(stats_enabled)
+            stats_add(&stat_save, 1, 0, stats_time()-start);
         swf_Render_Delete(&buf);
     } else {
         parameter_t*p;
@@ -195,12 +215,16 @@ int main(int argn, char*argv[])
         }
         for(t=1;t<=sizeof(to_output);t++) {
             if (to_output[t-1]) {
-                gfxdevice_t dev2,*dev=&dev2;
+                gfxdevice_t dev2,stats_dev,*dev=&dev2;
                 gfxdevice_render_init(dev);
                     dev->setparameter(dev, "antialise", "4");
                     if(quantize) {
                         dev->setparameter(dev, "palette", "1");
                     }
+                if(statsfile) {
+                    gfxdevice_stats_init(&stats_dev, dev);
+                    dev = &stats_dev;
+                }
                 if(width || height || resolution) {
                     double scale = 0.0;
                     if (resolution) {
@@ -213,6 +237,7 @@ int main(int argn, char*argv[])
                     dev->setparameter(dev, p->name, p->value);
                 }
 
+                double start = stats_enabled?stats_time():0;
                 gfxpage_t* page = doc->getpage(doc, t);
                 dev->startpage(dev, page->width, page->height);
                 page->render(page, dev);
@@ -220,6 +245,11 @@ int main(int argn, char*argv[])
                 page->destroy(page);
                 
                 gfxresult_t* result = dev->finish(dev);
+                if(stats_enabled) {
+                    double now = stats_time();
+                    stats_add(&stat_render, 1, 0, now-start);
+                    start = now;
+                }
                 if(result) {
                     char* effective_outputname = outputname;
                     char* suffixed_outputname = malloc(strlen(outputname) + 128);
@@ -237,6 +267,8 @@ int main(int argn, char*argv[])
                         fprintf(stderr,"Error writing page %d to %s\n", t, outputname);
                         exit(1);
                     }
+                    if(stats_enabled)
+                        stats_add(&stat_save, 1, 0, stats_time()-start);
                     free(suffixed_outputname);
                     result->destroy(result);
                 }
@@ -244,6 +276,9 @@ int main(int argn, char*argv[])
         }
         doc->destroy(doc);
     }
+    if(statsfile && stats_save_json(statsfile) < 0) {
+        return 1;
+    }
     return 0;
 }
 
@@ -99,28 +99,11 @@ static SWF swf;
 static int fontnum = 0;
 static SWFFONT**fonts = 0;
 
-void fontcallback1(void*self, U16 id,U8 * name)
-{ fontnum++;
-}
-
-void fontcallback2(void*self, U16 id,U8 * name)
-{ 
-  swf_FontExtract(&swf,id,&fonts[fontnum]);
-  fontnum++;
-}
-
 
 void textcallback(void*self, int*glyphs, int*advance, int nr, int fontid, int fontsize, int startx, int starty, RGBA*color) 
 {
-    SWFFONT*font = 0;
+    SWFFONT*font = swf_FontFindID(fonts, fontnum, fontid);
     int t;
-    for(t=0;t<fontnum;t++)
-    {
-	if(fonts[t]->id == fontid) {
-	    font = fonts[t];
-	    break;
-	}
-    }
 
     if(showfonts) {
 	if(font)
@@ -210,11 +193,7 @@ int main (int argc,char ** argv)
 
     id2tag = rfx_calloc(sizeof(TAG)*65536);
 
-    fontnum = 0;
-    swf_FontEnumerate(&swf,&fontcallback1, 0);
-    fonts = (SWFFONT**)malloc(fontnum*sizeof(SWFFONT*));
-    fontnum = 0;
-    swf_FontEnumerate(&swf,&fontcallback2, 0);
+    fontnum = swf_FontExtractAll(&swf, &fonts);
  
     TAG*tag = swf.firstTag;
     while (tag)
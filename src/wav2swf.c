@@ -25,6 +25,7 @@
 #include "../lib/log.h"
 #include "../lib/args.h"
 #include "../lib/wav.h"
+#include "../lib/mp3.h"
 
 char * filename = 0;
 char * outputname = "output.swf";
@@ -46,6 +47,7 @@ static struct options_t options[] = {
 {"S", "stop"},
 {"E", "end"},
 {"b", "bitrate"},
+{"t", "threads"},
 {"v", "verbose"},
 {0,0}
 };
@@ -56,6 +58,7 @@ static int framerate = 0;
 static int samplerate = 11025;
 static int bitrate = 32;
 static int do_cgi = 0;
+static int threads = 1;
 
 static int mp3_bitrates[] =
 { 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0};
@@ -118,6 +121,12 @@ int args_callback_option(char*name,char*val)
 	}
 	return 1;
     }
+    else if(!strcmp(name, "t")) {
+	threads = atoi(val);
+	if(threads<1)
+	    threads = 1;
+	return 1;
+    }
     else if(!strcmp(name, "b")) {
 	int t;
 	int b = atoi(val);
@@ -168,6 +177,7 @@ void args_callback_usage(char *name)
     printf("-S , --stop                    Stop the movie at frame 0\n");
     printf("-E , --end                     Stop the movie at the end frame\n");
     printf("-b , --bitrate <bps>           Set mp3 bitrate to <bps> (default: 32)\n");
+    printf("-t , --threads <n>             Encode the mp3 stream in <n> parallel segments\n");
     printf("-v , --verbose                 Be more verbose\n");
     printf("\n");
 }
@@ -203,12 +213,36 @@ int main (int argc,char ** argv)
     float samplesperframe;
     float framesperblock;
     float samplesperblock;
-    U16* samples;
-    int numsamples;
+    U16* samples = 0;
+    int numsamples = 0;
+    struct MP3 mp3;
+    int is_mp3 = 0;
 
     processargs(argc, argv);
+    
+    initLog(0,-1,0,0,-1,verbose);
+
+    if(!filename) {
+	msg("<fatal> You must supply a filename");
+	exit(1);
+    }
+
+    if(!wav_read(&wav, filename))
+    {
+	/* mp3 files are copied into the swf as they are */
+	memset(&mp3, 0, sizeof(mp3));
+	if(!mp3_read(&mp3, filename)) {
+	    msg("<fatal> Error reading %s", filename);
+	    exit(1);
+	}
+	msg("<notice> %s is a mp3 file (%d frames, %d Hz), not re-encoding", filename, mp3.NumFrames, mp3.SampRate);
+	is_mp3 = 1;
+	samplerate = mp3.SampRate;
+    }
 
     blocksize = (samplerate > 22050) ? 1152 : 576;
+    if(is_mp3)
+	blocksize = mp3.SamplesPerFrame;
 
     blockspersecond = (float)samplerate/blocksize;
 
@@ -219,24 +253,14 @@ int main (int argc,char ** argv)
     framesperblock = framespersecond / blockspersecond;
     samplesperframe = (blocksize * blockspersecond) / framespersecond;
     samplesperblock = samplesperframe * framesperblock;
-    
-    initLog(0,-1,0,0,-1,verbose);
-
-    if(!filename) {
-	msg("<fatal> You must supply a filename");
-	exit(1);
-    }
 
-    if(!wav_read(&wav, filename))
-    {
-	msg("<fatal> Error reading %s", filename);
-	exit(1);
+    if(!is_mp3) {
+	wav_convert2mono(&wav,&wav2, samplerate);
+	//wav_print(&wav);
+	//wav_print(&wav2);
+	samples = (U16*)wav2.data;
+	numsamples = wav2.size/2;
     }
-    wav_convert2mono(&wav,&wav2, samplerate);
-    //wav_print(&wav);
-    //wav_print(&wav2);
-    samples = (U16*)wav2.data;
-    numsamples = wav2.size/2;
 
 #ifdef WORDS_BIGENDIAN
     /* swap bytes */
@@ -289,7 +313,33 @@ int main (int argc,char ** argv)
     swf_mp3_out_samplerate = samplerate;
     swf_mp3_in_samplerate = samplerate;
 
-    if(!definesound)
+    if(is_mp3 && !definesound)
+    {
+	/* Give every movie frame the mp3 frames which end within it. 
+	   Use the framerate the player will actually use. */
+	double spf = (swf.frameRate/256.0) ? samplerate / (swf.frameRate/256.0) : blocksize;
+	double totalsamples = (double)mp3.NumFrames * blocksize;
+	int numframes = (int)ceil(totalsamples / spf);
+	unsigned n = 0;
+	tag = swf_InsertTag(tag, ST_SOUNDSTREAMHEAD);
+	swf_SetSoundStreamHeadMP3(tag, mp3.SampRate, mp3.Channels, (int)spf);
+	for(t=0;t<numframes;t++) {
+	    double start = t*spf;
+	    double end = (t+1)*spf;
+	    unsigned first = n;
+	    while(n < mp3.NumFrames && ((n+1)*(double)blocksize <= end || t == numframes-1))
+		n++;
+	    if(n > first) {
+		tag = swf_InsertTag(tag, ST_SOUNDSTREAMBLOCK);
+		swf_SetSoundStreamBlockMP3(tag, &mp3.data[mp3.FrameOffsets[first]],
+			mp3.FrameOffsets[n] - mp3.FrameOffsets[first], 
+			(n - first) * blocksize, (int)(start - first*(double)blocksize));
+	    }
+	    tag = swf_InsertTag(tag, ST_SHOWFRAME);
+	}
+	tag = swf_InsertTag(tag, ST_END);
+    }
+    else if(!definesound)
     {
 	int oldframepos=-1, newframepos=0;
 	float framesamplepos = 0;
@@ -297,27 +347,36 @@ int main (int argc,char ** argv)
 	float samplepos = 0;
 	ActionTAG* a = 0;
 	U16 v1=0,v2=0;
+	int numblocks = numsamples/blocksize;
+	SOUNDENCODER*enc = swf_SoundEncoderNew(samplerate, samplerate, bitrate);
+	U8**data = (U8**)malloc(sizeof(U8*)*numblocks);
+	int*len = (int*)malloc(sizeof(int)*numblocks);
+
 	tag = swf_InsertTag(tag, ST_SOUNDSTREAMHEAD);
-	swf_SetSoundStreamHead(tag, samplesperframe);
-	msg("<notice> %d blocks", numsamples/blocksize);
-	for(t=0;t<numsamples/blocksize;t++) {
+	swf_SetSoundStreamHead2(tag, enc, samplesperframe);
+	msg("<notice> %d blocks", numblocks);
+	swf_SoundEncodeBlocks(enc, (S16*)samples, numblocks, data, len, threads);
+
+	for(t=0;t<numblocks;t++) {
 	    int s;
-	    U16*block1;
 	    int seek = blocksize - ((int)samplepos - (int)framesamplepos);
 
+	    if(!len[t])
+		msg("<error> mp3 empty block %d", t);
 	    if(newframepos!=oldframepos) {
 		tag = swf_InsertTag(tag, ST_SOUNDSTREAMBLOCK);
 		msg("<notice> Starting block %d %d+%d", t, (int)samplepos, (int)blocksize);
-		block1 = &samples[t*blocksize];
-		swf_SetSoundStreamBlock(tag, block1, seek, 1);
+		swf_SetU16(tag, enc->framesize); // samples per mp3 frame
+		swf_SetU16(tag, seek);
+		swf_SetBlock(tag, data[t], len[t]);
 		v1 = v2 = GET16(tag->data);
 	    } else {
 		msg("<notice> Adding data...", t);
-		block1 = &samples[t*blocksize];
-		swf_SetSoundStreamBlock(tag, block1, seek, 0);
+		swf_SetBlock(tag, data[t], len[t]);
 		v1+=v2;
 		PUT16(tag->data, v1);
 	    }
+	    rfx_free(data[t]);
 	    samplepos += blocksize;
 
 	    oldframepos = (int)framepos;
@@ -330,17 +389,24 @@ int main (int argc,char ** argv)
 	    }
 	}
 	tag = swf_InsertTag(tag, ST_END);
+	free(data);
+	free(len);
+	swf_SoundEncoderFree(enc);
     } else {
 	SOUNDINFO info;
 	tag = swf_InsertTag(tag, ST_DEFINESOUND);
 	swf_SetU16(tag, 24); //id
+	if(is_mp3) {
+	    swf_SetSoundDefineMP3(tag, mp3.data, mp3.size, mp3.SampRate, mp3.Channels, mp3.NumFrames);
+	} else {
 #ifdef DEFINESOUND_MP3
-        swf_SetSoundDefine(tag, samples, numsamples);
+	    swf_SetSoundDefine(tag, samples, numsamples);
 #else
-        swf_SetU8(tag,(/*compression*/0<<4)|(/*rate*/3<<2)|(/*size*/1<<1)|/*mono*/0);
-        swf_SetU32(tag, numsamples); // 44100 -> 11025
-        swf_SetBlock(tag, samples, numsamples*2);
+	    swf_SetU8(tag,(/*compression*/0<<4)|(/*rate*/3<<2)|(/*size*/1<<1)|/*mono*/0);
+	    swf_SetU32(tag, numsamples); // 44100 -> 11025
+	    swf_SetBlock(tag, samples, numsamples*2);
 #endif
+	}
 
 
 	tag = swf_InsertTag(tag, ST_STARTSOUND);